@@ -8,10 +8,7 @@ CONFIG += link_pkgconfig
 PKGCONFIG += gstreamer-1.0
 PKGCONFIG += gstreamer-video-1.0
 
-INCLUDEPATH += "/usr/include/vpi3"
-INCLUDEPATH += "/opt/nvidia/vpi3/include"
 INCLUDEPATH += /usr/include/SDL2
-LIBS += -L/opt/nvidia/vpi3/lib/x86_64-linux-gnu -lnvvpi
 LIBS += -lSDL2
 
 LIBS += -lgstreamer-1.0 -lgstapp-1.0 -lgstbase-1.0 -lgobject-2.0 -lglib-2.0
@@ -25,10 +22,27 @@ INCLUDEPATH += "/usr/include/glib-2.0"
 
 LIBS += -L/usr/local/lib -lopencv_core -lopencv_imgcodecs -lopencv_highgui -lopencv_imgproc
 LIBS += -L/usr/local/lib -lopencv_core   -lopencv_dnn -lopencv_videoio
+LIBS += -L/usr/local/lib -lopencv_video -lopencv_tracking
 PKGCONFIG += gstreamer-gl-1.0
 
-INCLUDEPATH += /usr/local/cuda/include
-LIBS += -L/usr/local/cuda/lib64 -lcudart
+# NVIDIA VPI DCF tracker, built when VPI 3 is installed. Without it the
+# camera trackers fall back to OpenCV; CONFIG+=no_vpi forces that build.
+!no_vpi:if(exists(/opt/nvidia/vpi3/include/vpi/Types.h)|exists(/usr/include/vpi3/vpi/Types.h)) {
+    DEFINES += RCWS_HAVE_VPI
+    INCLUDEPATH += "/usr/include/vpi3"
+    INCLUDEPATH += "/opt/nvidia/vpi3/include"
+    LIBS += -L/opt/nvidia/vpi3/lib/x86_64-linux-gnu -lnvvpi
+
+    INCLUDEPATH += /usr/local/cuda/include
+    LIBS += -L/usr/local/cuda/lib64 -lcudart
+
+    SOURCES += src/video/vpidcftrackerbackend.cpp
+    HEADERS += \
+        src/hardware/devices/vpi_helpers.h \
+        src/video/vpidcftrackerbackend.h
+} else {
+    message("VPI not found: building with the OpenCV trackers only")
+}
 
 SOURCES += \
     src/controllers/aboutcontroller.cpp \
@@ -43,7 +57,13 @@ SOURCES += \
     src/controllers/motion_modes/autosectorscanmotionmode.cpp \
     src/controllers/motion_modes/gimbalmotionmodebase.cpp \
     src/controllers/motion_modes/manualmotionmode.cpp \
+    src/controllers/motion_modes/motionclock.cpp \
+    src/controllers/motion_modes/planttuning.cpp \
     src/controllers/motion_modes/radarslewmotionmode.cpp \
+    src/controllers/motion_modes/ratestabilizer.cpp \
+    src/controllers/motion_modes/scantrajectory.cpp \
+    src/controllers/motion_modes/systemidentificationmotionmode.cpp \
+    src/controllers/motion_modes/targetstatefilter.cpp \
     src/controllers/motion_modes/trackingmotionmode.cpp \
     src/controllers/motion_modes/trpscanmotionmode.cpp \
     src/controllers/osdcontroller.cpp \
@@ -73,6 +93,7 @@ SOURCES += \
     src/main.cpp \
     src/models/aboutviewmodel.cpp \
     src/models/areazoneparameterviewmodel.cpp \
+    src/models/detectionlistmodel.cpp \
     src/models/domain/joystickdatamodel.cpp \
     src/models/domain/systemstatemodel.cpp \
     src/models/historyviewmodel.cpp \
@@ -81,24 +102,49 @@ SOURCES += \
     src/models/sectorscanparameterviewmodel.cpp \
     src/models/systemstatusviewmodel.cpp \
     src/models/trpparameterviewmodel.cpp \
+    src/models/viewmodelupdatescheduler.cpp \
     src/models/windageviewmodel.cpp \
     src/models/zeroingviewmodel.cpp \
     src/models/zonedefinitionviewmodel.cpp \
+    src/models/zonemaplistmodels.cpp \
     src/models/zonemapviewmodel.cpp \
+    src/services/detectionservice.cpp \
     src/services/servicemanager.cpp \
     src/services/telemetryapiservice.cpp \
     src/services/telemetryauthservice.cpp \
     src/services/telemetryconfig.cpp \
     src/services/telemetrywebsocketserver.cpp \
     src/services/zonegeometryservice.cpp \
+    src/services/zonestore.cpp \
+    src/utils/ballisticsbenchmark.cpp \
     src/utils/ballisticsprocessor.cpp \
+    src/utils/ballisticstable.cpp \
     src/utils/colorutils.cpp \
+    src/utils/fixedpointtext.cpp \
+    src/utils/gimbalsimulationbenchmark.cpp \
     src/utils/inference.cpp \
+    src/utils/interceptsolver.cpp \
+    src/utils/latencyhistogram.cpp \
+    src/utils/pidtuningbenchmark.cpp \
     src/utils/reticleaimpointcalculator.cpp \
+    src/utils/startupprofiler.cpp \
+    src/utils/startuptaskgraph.cpp \
+    src/utils/yuvframeconverter.cpp \
+    src/video/detectionoverlayitem.cpp \
     src/video/gstvideosource.cpp \
+    src/video/opencvtrackerbackend.cpp \
+    src/video/osdgeometrybuilder.cpp \
+    src/video/osdsceneitem.cpp \
+    src/video/pipelinebenchmark.cpp \
+    src/video/replaystatetrack.cpp \
+    src/video/trackerbackend.cpp \
     src/video/videoimageprovider.cpp \
+    src/video/zonemapitem.cpp \
+    src/hardware/communication/modbuslinkmetrics.cpp \
+    src/hardware/communication/modbuspollscheduler.cpp \
     src/hardware/communication/modbustransport.cpp \
     src/hardware/communication/serialporttransport.cpp \
+    src/hardware/communication/simulatedmodbustransport.cpp \
     src/hardware/protocols/DayCameraProtocolParser.cpp \
     src/hardware/protocols/Imu3DMGX3ProtocolParser.cpp \
     src/hardware/protocols/JoystickProtocolParser.cpp \
@@ -108,7 +154,9 @@ SOURCES += \
     src/hardware/protocols/Plc42ProtocolParser.cpp \
     src/hardware/protocols/RadarProtocolParser.cpp \
     src/hardware/protocols/ServoActuatorProtocolParser.cpp \
-    src/hardware/protocols/ServoDriverProtocolParser.cpp
+    src/hardware/protocols/ServoDriverProtocolParser.cpp \
+    src/hardware/simulation/gimbalplant.cpp \
+    src/hardware/simulation/gimbalsimulation.cpp
 
 RESOURCES += resources/resources.qrc
 
@@ -141,8 +189,14 @@ HEADERS += \
     src/controllers/motion_modes/autosectorscanmotionmode.h \
     src/controllers/motion_modes/gimbalmotionmodebase.h \
     src/controllers/motion_modes/manualmotionmode.h \
+    src/controllers/motion_modes/motionclock.h \
     src/controllers/motion_modes/pidcontroller.h \
+    src/controllers/motion_modes/planttuning.h \
     src/controllers/motion_modes/radarslewmotionmode.h \
+    src/controllers/motion_modes/ratestabilizer.h \
+    src/controllers/motion_modes/scantrajectory.h \
+    src/controllers/motion_modes/systemidentificationmotionmode.h \
+    src/controllers/motion_modes/targetstatefilter.h \
     src/controllers/motion_modes/trackingmotionmode.h \
     src/controllers/motion_modes/trpscanmotionmode.h \
     src/controllers/osdcontroller.h \
@@ -169,10 +223,10 @@ HEADERS += \
     src/hardware/devices/radardevice.h \
     src/hardware/devices/servoactuatordevice.h \
     src/hardware/devices/servodriverdevice.h \
-    src/hardware/devices/vpi_helpers.h \
     src/logger/systemdatalogger.h \
     src/models/aboutviewmodel.h \
     src/models/areazoneparameterviewmodel.h \
+    src/models/detectionlistmodel.h \
     src/models/domain/daycameradatamodel.h \
     src/models/domain/gyrodatamodel.h \
     src/models/domain/joystickdatamodel.h \
@@ -188,36 +242,63 @@ HEADERS += \
     src/models/historyviewmodel.h \
     src/models/menuviewmodel.h \
     src/models/osdviewmodel.h \
+    src/models/propertynotifybatch.h \
     src/models/sectorscanparameterviewmodel.h \
     src/models/systemstatusviewmodel.h \
     src/models/trpparameterviewmodel.h \
+    src/models/viewmodelupdatescheduler.h \
     src/models/windageviewmodel.h \
     src/models/zeroingviewmodel.h \
     src/models/zonedefinitionviewmodel.h \
+    src/models/zonemaplistmodels.h \
     src/models/zonemapviewmodel.h \
+    src/services/detectionservice.h \
     src/services/servicemanager.h \
     src/services/telemetryapiservice.h \
     src/services/telemetryauthservice.h \
     src/services/telemetryconfig.h \
     src/services/telemetrywebsocketserver.h \
     src/services/zonegeometryservice.h \
+    src/services/zonestore.h \
     src/utils/TimestampLogger.h \
+    src/utils/ballisticsbenchmark.h \
     src/utils/ballisticsprocessor.h \
+    src/utils/ballisticstable.h \
     src/utils/colorutils.h \
+    src/utils/fixedpointtext.h \
+    src/utils/gimbalsimulationbenchmark.h \
     src/utils/inference.h \
+    src/utils/interceptsolver.h \
+    src/utils/latencyhistogram.h \
     src/utils/millenious.h \
+    src/utils/pidtuningbenchmark.h \
     src/utils/reticleaimpointcalculator.h \
+    src/utils/startupprofiler.h \
+    src/utils/startuptaskgraph.h \
     src/utils/targetstate.h \
+    src/utils/yuvframeconverter.h \
+    src/video/detectionoverlayitem.h \
     src/video/gstvideosource.h \
+    src/video/opencvtrackerbackend.h \
+    src/video/osdgeometrybuilder.h \
+    src/video/osdsceneitem.h \
+    src/video/pipelinebenchmark.h \
+    src/video/replaystatetrack.h \
+    src/video/trackerbackend.h \
+    src/video/trackingstate.h \
     src/video/videoimageprovider.h \
+    src/video/zonemapitem.h \
     src/hardware/interfaces/IDevice.h \
     src/hardware/interfaces/Transport.h \
     src/hardware/interfaces/ProtocolParser.h \
     src/hardware/interfaces/Message.h \
     src/hardware/data/DataTypes.h \
     src/hardware/devices/TemplatedDevice.h \
+    src/hardware/communication/modbuslinkmetrics.h \
+    src/hardware/communication/modbuspollscheduler.h \
     src/hardware/communication/modbustransport.h \
     src/hardware/communication/serialporttransport.h \
+    src/hardware/communication/simulatedmodbustransport.h \
     src/hardware/protocols/DayCameraProtocolParser.h \
     src/hardware/protocols/Imu3DMGX3ProtocolParser.h \
     src/hardware/protocols/JoystickProtocolParser.h \
@@ -228,6 +309,8 @@ HEADERS += \
     src/hardware/protocols/RadarProtocolParser.h \
     src/hardware/protocols/ServoActuatorProtocolParser.h \
     src/hardware/protocols/ServoDriverProtocolParser.h \
+    src/hardware/simulation/gimbalplant.h \
+    src/hardware/simulation/gimbalsimulation.h \
     src/hardware/messages/DayCameraMessage.h \
     src/hardware/messages/ImuMessage.h \
     src/hardware/messages/JoystickMessage.h \
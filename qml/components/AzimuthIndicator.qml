@@ -1,6 +1,7 @@
 import QtQuick
-import QtQuick.Shapes
 
+// Text for the azimuth compass; the rose, ticks and needles are drawn by
+// OsdScene in the same rectangle
 Item {
     id: root
 
@@ -12,7 +13,6 @@ Item {
     // === DISPLAY PROPERTIES ===
     property color color: "#46E2A5"
     property color outlineColor: "#000000"
-    property real outlineWidth: 2
     property color relativeColor: "yellow"  // Color for relative angle indicator
 
     width: 100
@@ -35,91 +35,11 @@ Item {
     // Relative angle: How far gimbal is from vehicle forward (always available)
     readonly property real relativeAngle: azimuth
 
-    // === COMPASS ROSE (Rotates to align with true north) ===
+    // === CARDINAL LABELS (rotate with the compass rose) ===
     Item {
-        id: compassRose
         anchors.fill: parent
-
-        // Rotate compass so North points to true north
-        // (Only when IMU connected)
         rotation: imuConnected ? -vehicleHeading : 0
 
-        // Outer circle with outline
-        Shape {
-            anchors.fill: parent
-
-            // Outline
-            ShapePath {
-                strokeWidth: 2 + root.outlineWidth
-                strokeColor: root.outlineColor
-                fillColor: "transparent"
-                PathAngleArc {
-                    centerX: root.width / 2
-                    centerY: root.height / 2
-                    radiusX: root.width / 2 - 2
-                    radiusY: root.height / 2 - 2
-                    startAngle: 0
-                    sweepAngle: 360
-                }
-            }
-
-            // Main circle
-            ShapePath {
-                strokeWidth: 2
-                strokeColor: root.color
-                fillColor: "transparent"
-                PathAngleArc {
-                    centerX: root.width / 2
-                    centerY: root.height / 2
-                    radiusX: root.width / 2 - 2
-                    radiusY: root.height / 2 - 2
-                    startAngle: 0
-                    sweepAngle: 360
-                }
-            }
-        }
-
-        // Tick marks (every 30°)
-        Repeater {
-            model: 12
-            delegate: Item {
-                property real angle: index * 30
-                property bool isMajor: (index % 3 === 0)
-                property real tickLength: isMajor ? 10 : 5
-                property real angleRad: (90 - angle) * Math.PI / 180
-                property real outerRadius: root.width / 2 - 4
-                property real innerRadius: outerRadius - tickLength
-
-                property real endX: root.width / 2 + innerRadius * Math.cos(angleRad)
-                property real endY: root.height / 2 - innerRadius * Math.sin(angleRad)
-                property real startX: root.width / 2 + outerRadius * Math.cos(angleRad)
-                property real startY: root.height / 2 - outerRadius * Math.sin(angleRad)
-
-                // Outline
-                Rectangle {
-                    width: 2 + root.outlineWidth
-                    height: tickLength
-                    color: root.outlineColor
-                    x: startX - width / 2
-                    y: startY
-                    rotation: angle
-                    transformOrigin: Item.Top
-                }
-
-                // Main tick
-                Rectangle {
-                    width: 2
-                    height: tickLength
-                    color: root.color
-                    x: startX - width / 2
-                    y: startY
-                    rotation: angle
-                    transformOrigin: Item.Top
-                }
-            }
-        }
-
-        // Cardinal labels (N, E, S, W)
         Repeater {
             model: [
                 {angle: 0, label: "N"},
@@ -141,87 +61,19 @@ Item {
         }
     }
 
-    // === VEHICLE FORWARD INDICATOR (Yellow Reference Line) ===
-    // Shows where vehicle is pointing - only visible when IMU connected
-    Item {
-        anchors.fill: parent
+    // "V" label for the vehicle forward reference
+    Text {
         visible: root.imuConnected
-
-        // Yellow line pointing up = vehicle forward direction
-        Rectangle {
-            width: 2
-            height: root.height / 2 - 8
-            color: root.relativeColor
-            opacity: 0.7
-            anchors.horizontalCenter: parent.horizontalCenter
-            anchors.bottom: parent.verticalCenter
-            transformOrigin: Item.Bottom
-        }
-
-        // Small triangle at the end
-        Rectangle {
-            width: 8
-            height: 8
-            color: root.relativeColor
-            opacity: 0.7
-            rotation: 45
-            anchors.horizontalCenter: parent.horizontalCenter
-            anchors.bottom: parent.top
-            anchors.bottomMargin: root.height / 2 - 16
-        }
-
-        // "V" label for vehicle
-        Text {
-            text: "V"
-            font.pixelSize: 10
-            font.bold: true
-            font.family: "Segoe UI"
-            color: root.relativeColor
-            style: Text.Outline
-            styleColor: root.outlineColor
-            anchors.horizontalCenter: parent.horizontalCenter
-            anchors.bottom: parent.top
-            anchors.bottomMargin: root.height / 2 - 28
-        }
-    }
-
-    // === TARGET NEEDLE (Green) ===
-    // Points to where gimbal is actually aiming in world coordinates
-    Item {
-        anchors.fill: parent
-        rotation: root.trueBearing
-        transformOrigin: Item.Center
-
-        // Outline
-        Rectangle {
-            width: 2 + root.outlineWidth
-            height: root.height / 2 - 10
-            color: root.outlineColor
-            anchors.horizontalCenter: parent.horizontalCenter
-            anchors.bottom: parent.verticalCenter
-            transformOrigin: Item.Bottom
-        }
-
-        // Main needle (green)
-        Rectangle {
-            width: 3
-            height: root.height / 2 - 10
-            color: root.color
-            anchors.horizontalCenter: parent.horizontalCenter
-            anchors.bottom: parent.verticalCenter
-            transformOrigin: Item.Bottom
-        }
-
-        // Arrow tip
-        Rectangle {
-            width: 10
-            height: 10
-            color: root.color
-            rotation: 45
-            anchors.horizontalCenter: parent.horizontalCenter
-            anchors.bottom: parent.top
-            anchors.bottomMargin: root.height / 2 - 20
-        }
+        text: "V"
+        font.pixelSize: 10
+        font.bold: true
+        font.family: "Segoe UI"
+        color: root.relativeColor
+        style: Text.Outline
+        styleColor: root.outlineColor
+        anchors.horizontalCenter: parent.horizontalCenter
+        anchors.bottom: parent.top
+        anchors.bottomMargin: root.height / 2 - 28
     }
 
     // === TEXT DISPLAY ===
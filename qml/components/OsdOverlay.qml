@@ -1,5 +1,6 @@
 import QtQuick
 import QtQuick.Shapes
+import RCWS.Osd
 
 Item {
     id: osdRoot
@@ -137,6 +138,18 @@ Item {
             style: Text.Outline
             styleColor: "black"
         }
+
+        // Track coasting on the Kalman prediction (no recent tracker measurement)
+        Text {
+            visible: viewModel ? viewModel.coastVisible : false
+            text: "COAST"
+            font.pixelSize: 16
+            font.family: "Segoe UI"
+            font.bold: true
+            color: "yellow"
+            style: Text.Outline
+            styleColor: "black"
+        }
     }
 
     // ========================================================================
@@ -322,6 +335,8 @@ Item {
     // AZIMUTH INDICATOR (Top-Right)
     // ========================================================================
     AzimuthIndicator {
+        id: azimuthIndicator
+        z: 1 // Text above the OsdScene symbology
         anchors.right: parent.right
         anchors.top: parent.top
         anchors.rightMargin: 30
@@ -342,6 +357,8 @@ Item {
     // ELEVATION SCALE (Right Side)
     // ========================================================================
     ElevationScale {
+        id: elevationScale
+        z: 1 // Text above the OsdScene symbology
         anchors.right: parent.right
         anchors.top: parent.top
         anchors.rightMargin: 20
@@ -352,20 +369,6 @@ Item {
         color: osdRoot.accentColor
     }
 
-    // ========================================================================
-    // TRACKING BOX
-    // ========================================================================
-    TrackingBox {
-        visible: viewModel ? viewModel.trackingBoxVisible : false
-        x: viewModel ? viewModel.trackingBox.x : 0
-        y: viewModel ? viewModel.trackingBox.y : 0
-        width: viewModel ? viewModel.trackingBox.width : 0
-        height: viewModel ? viewModel.trackingBox.height : 0
-
-        boxColor: viewModel ? viewModel.trackingBoxColor : "yellow"
-        dashed: viewModel ? viewModel.trackingBoxDashed : false
-    }
-
     // ========================================================================
     // ACQUISITION BOX
     // ========================================================================
@@ -382,87 +385,102 @@ Item {
     }
 
     // ========================================================================
-    // DETECTION BOXES (YOLO Object Detection)
+    // PREDICTED TARGET (Kalman prediction, yellow while coasting)
     // ========================================================================
-    Repeater {
-        model: viewModel ? viewModel.detectionBoxes : []
+    Rectangle {
+        visible: viewModel ? viewModel.predictedTargetVisible : false
+        width: 12
+        height: 12
+        radius: width / 2
+        x: (viewModel ? viewModel.predictedTargetPos.x : 0) - width / 2
+        y: (viewModel ? viewModel.predictedTargetPos.y : 0) - height / 2
 
-        delegate: Item {
-            x: modelData.x
-            y: modelData.y
-            width: modelData.width
-            height: modelData.height
+        color: "transparent"
+        border.color: viewModel && viewModel.coastVisible ? "yellow" : osdRoot.accentColor
+        border.width: 2
+    }
 
-            // Bounding box rectangle
-            Rectangle {
-                anchors.fill: parent
-                color: "transparent"
-                border.color: Qt.rgba(modelData.colorR / 255.0,
-                                     modelData.colorG / 255.0,
-                                     modelData.colorB / 255.0,
-                                     1.0)
-                border.width: 3
-            }
+    // ========================================================================
+    // DETECTION BOXES (YOLO Object Detection)
+    // ========================================================================
+    // Boxes and label backgrounds: one scene-graph node for all detections
+    DetectionOverlay {
+        id: detectionOverlay
+        anchors.fill: parent
+        model: viewModel ? viewModel.detectionModel : null
+        lineWidth: 3
+        labelHeight: 22
+        labelPadding: 6
+        labelFont.family: "Segoe UI"
+        labelFont.pixelSize: 14
+        labelFont.bold: true
+    }
 
-            // Class label background
-            Rectangle {
-                x: 0
-                y: -24
-                width: labelText.width + 12
-                height: 22
-                color: Qt.rgba(modelData.colorR / 255.0,
-                              modelData.colorG / 255.0,
-                              modelData.colorB / 255.0,
-                              0.8)
-                radius: 3
-
-                // Class name and confidence
-                Text {
-                    id: labelText
-                    anchors.centerIn: parent
-                    text: modelData.className + " " + (modelData.confidence * 100).toFixed(0) + "%"
-                    font.pixelSize: 14
-                    font.bold: true
-                    font.family: "Segoe UI"
-                    color: "white"
-                    style: Text.Outline
-                    styleColor: "black"
-                }
-            }
+    // Class name and confidence (rows keep their delegate while tracked)
+    Repeater {
+        model: viewModel ? viewModel.detectionModel : null
+
+        delegate: Text {
+            x: boxX + detectionOverlay.labelPadding
+            y: boxY - detectionOverlay.labelHeight - 2
+            height: detectionOverlay.labelHeight
+            verticalAlignment: Text.AlignVCenter
+            text: labelText
+            font: detectionOverlay.labelFont
+            color: "white"
+            style: Text.Outline
+            styleColor: "black"
         }
     }
 
     // ========================================================================
     // RETICLE (Center with offset)
     // ========================================================================
-    ReticleRenderer {
-        /*id: reticle
-        anchors.centerIn: parent
-        x: parent.width / 2 + (viewModel ? viewModel.reticleOffsetX : 0)
-        y: parent.height / 2 + (viewModel ? viewModel.reticleOffsetY : 0)
+    // Reticle, tracking box corners, compass and elevation scale graphics
+    // (retained scene-graph geometry; the text parts are the QML items)
+    OsdScene {
+        id: osdScene
+        anchors.fill: parent
 
-        reticleType: viewModel ? viewModel.reticleType : 1
         color: osdRoot.accentColor
+        relativeColor: azimuthIndicator.relativeColor
+
+        reticleType: viewModel ? viewModel.reticleType : 1
+        reticleOffset: Qt.point(viewModel ? viewModel.reticleOffsetX : 0,
+                                viewModel ? viewModel.reticleOffsetY : 0)
         currentFov: viewModel ? viewModel.currentFov : 45.0
 
         // CCIP-specific properties
         lacActive: viewModel ? viewModel.lacActive : false
         rangeMeters: viewModel ? viewModel.rangeMeters : 0
-        confidenceLevel: viewModel ? viewModel.confidenceLevel : 1.0*/
+        confidenceLevel: viewModel ? viewModel.confidenceLevel : 1.0
+
+        trackingBox: viewModel ? viewModel.trackingBox : Qt.rect(0, 0, 0, 0)
+        trackingBoxVisible: viewModel ? viewModel.trackingBoxVisible : false
+        trackingBoxColor: viewModel ? viewModel.trackingBoxColor : "yellow"
+        trackingBoxDashed: viewModel ? viewModel.trackingBoxDashed : false
+
+        azimuthRect: Qt.rect(azimuthIndicator.x, azimuthIndicator.y,
+                             azimuthIndicator.width, azimuthIndicator.height)
+        azimuth: azimuthIndicator.azimuth
+        vehicleHeading: azimuthIndicator.vehicleHeading
+        imuConnected: azimuthIndicator.imuConnected
 
+        elevationRect: Qt.rect(elevationScale.x, elevationScale.y,
+                               elevationScale.width, elevationScale.height)
+        elevation: elevationScale.elevation
+    }
+
+    ReticleLabels {
         id: reticle
         anchors.centerIn: parent
         anchors.horizontalCenterOffset: viewModel ? viewModel.reticleOffsetX : 0
         anchors.verticalCenterOffset: viewModel ? viewModel.reticleOffsetY : 0
 
-        reticleType: viewModel ? viewModel.reticleType : 1
+        reticleType: osdScene.reticleType
         color: osdRoot.accentColor
-        currentFov: viewModel ? viewModel.currentFov : 45.0
-
-
-        lacActive: viewModel ? viewModel.lacActive : false
-        rangeMeters: viewModel ? viewModel.rangeMeters : 0
-        confidenceLevel: viewModel ? viewModel.confidenceLevel : 1.0
+        rangeMeters: osdScene.rangeMeters
+        pixelsPerMil: osdScene.pixelsPerMil
     }
 
     // ========================================================================
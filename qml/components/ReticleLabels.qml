@@ -0,0 +1,51 @@
+import QtQuick
+
+// Text for the reticles (CCIP range ladder, mil-dot numbers). The reticle
+// itself is drawn by OsdScene; this item is zero-sized and sits on the aimpoint.
+Item {
+    id: root
+
+    property int reticleType: 1 // 0=CircleDot, 1=BoxCrosshair, 2=TacticalCrosshair, 3=CCIP, 4=MilDot
+    property color color: "#46E2A5"
+    property color outlineColor: "#000000"
+    property real rangeMeters: 0
+    property real pixelsPerMil: 0
+
+    width: 0
+    height: 0
+
+    // CCIP range ladder, next to the ticks at x = +50
+    Repeater {
+        model: root.reticleType === 3 ? [2000, 1500, 1000, 500] : []
+
+        delegate: Text {
+            property bool isCurrentRange: root.rangeMeters >= modelData - 250 && root.rangeMeters <= modelData + 250
+
+            x: 65
+            y: -30 + index * 20 - height / 2
+            text: modelData + "m"
+            font.pixelSize: 10
+            font.bold: true
+            font.family: "Archivo Narrow"
+            color: isCurrentRange ? root.color : Qt.darker(root.color, 1.5)
+            style: Text.Outline
+            styleColor: root.outlineColor
+        }
+    }
+
+    // Mil-dot: number at the 5-mil dot above the centre
+    Text {
+        readonly property real dist: 5 * root.pixelsPerMil
+
+        visible: root.reticleType === 4 && dist > 0 && dist <= 100
+        x: -width / 2
+        y: -dist - 8 - height / 2
+        text: "5"
+        font.pixelSize: 9
+        font.bold: true
+        font.family: "Archivo Narrow"
+        color: root.color
+        style: Text.Outline
+        styleColor: root.outlineColor
+    }
+}
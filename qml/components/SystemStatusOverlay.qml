@@ -199,7 +199,7 @@ Rectangle {
                         title: "Control Systems"
                         width: parent.width
                         connected: viewModel ? (viewModel.plc21Connected || viewModel.plc42Connected) : false
-                        hasError: false
+                        hasError: viewModel ? viewModel.modbusDegraded : false
                         // accent: accentColor
 
                         Column {
@@ -226,6 +226,17 @@ Rectangle {
                                 value: viewModel && viewModel.gunArmed ? "ARMED" : "SAFE"
                                 valueColor: viewModel && viewModel.gunArmed ? "#C81428" : accentColor
                             }
+                            // Busiest RS-485 bus: line utilisation and p95 round trip
+                            StatusRow {
+                                label: "Bus:"
+                                value: viewModel ? viewModel.modbusBusText : "N/A"
+                            }
+                            // Timeouts, retries and errors in the last second, all buses
+                            StatusRow {
+                                label: "Errors:"
+                                value: viewModel ? viewModel.modbusErrorText : "N/A"
+                                valueColor: viewModel && viewModel.modbusDegraded ? "#FF6B6B" : accentColor
+                            }
                         }
                     }
                     // --- IMU ---
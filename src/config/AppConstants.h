@@ -99,6 +99,11 @@ namespace Gimbal {
     constexpr float MAX_ACCELERATION = 100.0f;
     constexpr float DEFAULT_ACCELERATION = 50.0f;
 
+    // Jerk (deg/s³), planned scan moves
+    constexpr float MIN_JERK = 10.0f;
+    constexpr float MAX_JERK = 1000.0f;
+    constexpr float DEFAULT_JERK = 200.0f;
+
     // Dead zones
     constexpr float JOYSTICK_DEAD_ZONE = 0.05f; // 5% dead zone
     constexpr float POSITION_TOLERANCE = 0.01f;  // degrees
@@ -127,6 +132,13 @@ namespace Ballistics {
     constexpr float DEFAULT_BULLET_SPEED = 850.0f;  // m/s
     constexpr float MIN_BULLET_SPEED = 300.0f;      // m/s
     constexpr float MAX_BULLET_SPEED = 1500.0f;     // m/s
+
+    // Drag-model range tables
+    constexpr float MIN_BALLISTIC_COEFFICIENT = 0.05f;  // lb/in²
+    constexpr float MAX_BALLISTIC_COEFFICIENT = 1.5f;   // lb/in²
+    constexpr float MAX_TABLE_RANGE = 5000.0f;          // m
+    constexpr float MIN_TABLE_STEP = 1.0f;              // m
+    constexpr float MAX_TABLE_STEP = 50.0f;             // m
 }
 
 // ============================================================================
@@ -25,6 +25,7 @@ bool ConfigurationValidator::validateAll()
     valid &= validateUI();
     valid &= validateSafety();
     valid &= validatePerformance();
+    valid &= validateSimulation();
     valid &= validateHardware();
 
     if (!m_errors.isEmpty()) {
@@ -89,6 +90,18 @@ bool ConfigurationValidator::validateVideo()
     valid &= validateRange(cfg.sourceWidth, Video::MIN_VIDEO_WIDTH, Video::MAX_VIDEO_WIDTH, "Video width");
     valid &= validateRange(cfg.sourceHeight, Video::MIN_VIDEO_HEIGHT, Video::MAX_VIDEO_HEIGHT, "Video height");
 
+    // Replay mode does not touch the cameras; check the recordings instead
+    if (cfg.replayEnabled) {
+        const QStringList files = {cfg.dayReplaySource, cfg.nightReplaySource,
+                                   cfg.dayReplayStateFile, cfg.nightReplayStateFile};
+        for (const QString& file : files) {
+            if (!file.isEmpty() && !file.startsWith("videotestsrc") && !QFile::exists(file)) {
+                addWarning(QString("Replay file not found: %1").arg(file));
+            }
+        }
+        return valid;
+    }
+
     // Validate device paths
     if (cfg.dayDevicePath.isEmpty()) {
         addError("Day camera device path cannot be empty");
@@ -145,10 +158,23 @@ bool ConfigurationValidator::validateGimbal()
 
     // Validate acceleration
     valid &= validateRange(cfg.acceleration, 1.0f, Gimbal::MAX_ACCELERATION, "Gimbal acceleration");
+    valid &= validateRange(cfg.jerk, Gimbal::MIN_JERK, Gimbal::MAX_JERK, "Gimbal jerk");
 
     // Validate dead zone
     valid &= validateRange(cfg.joystickDeadZone, 0.0f, 0.5f, "Joystick dead zone");
 
+    // Validate identified plants and loop gains
+    for (const auto* axis : {&cfg.azimuthTuning, &cfg.elevationTuning}) {
+        valid &= validateRange(static_cast<float>(axis->plantGain), 0.1f, 10.0f, "Gimbal plant gain");
+        valid &= validateRange(static_cast<float>(axis->plantTimeConstantS), 0.0f, 2.0f, "Gimbal plant time constant");
+        valid &= validateRange(static_cast<float>(axis->plantDeadTimeS), 0.0f, 1.0f, "Gimbal plant dead time");
+        for (const auto* gains : {&axis->tracking, &axis->radarSlew, &axis->scanTrim}) {
+            valid &= validateRange(static_cast<float>(gains->kp), 0.0f, 20.0f, "Gimbal loop Kp");
+            valid &= validateRange(static_cast<float>(gains->ki), 0.0f, 20.0f, "Gimbal loop Ki");
+            valid &= validateRange(static_cast<float>(gains->kd), 0.0f, 5.0f, "Gimbal loop Kd");
+        }
+    }
+
     return valid;
 }
 
@@ -171,6 +197,21 @@ bool ConfigurationValidator::validateBallistics()
                           Ballistics::MAX_BULLET_SPEED,
                           "Default bullet speed");
 
+    // Validate drag model and range table
+    if (cfg.dragModel != "G1" && cfg.dragModel != "G7") {
+        addWarning(QString("Unknown drag model '%1', will use 'G7'").arg(cfg.dragModel));
+    }
+    valid &= validateRange(cfg.ballisticCoefficient,
+                          Ballistics::MIN_BALLISTIC_COEFFICIENT,
+                          Ballistics::MAX_BALLISTIC_COEFFICIENT,
+                          "Ballistic coefficient");
+    valid &= validateRange(cfg.tableMaxRange, 100.0f, Ballistics::MAX_TABLE_RANGE, "Ballistic table range");
+    valid &= validateRange(cfg.tableStep, Ballistics::MIN_TABLE_STEP, Ballistics::MAX_TABLE_STEP, "Ballistic table step");
+    if (cfg.interceptMotionModel != "CV" && cfg.interceptMotionModel != "CA") {
+        addWarning(QString("Unknown intercept motion model '%1', will use 'CV'").arg(cfg.interceptMotionModel));
+    }
+    valid &= validateRange(cfg.interceptMaxIterations, 1, 20, "Intercept max iterations");
+
     return valid;
 }
 
@@ -233,6 +274,31 @@ bool ConfigurationValidator::validatePerformance()
     return valid;
 }
 
+bool ConfigurationValidator::validateSimulation()
+{
+    const auto& cfg = DeviceConfiguration::simulation();
+    bool valid = true;
+
+    auto validateAxis = [&valid](const DeviceConfiguration::SimulatedAxisConfig& axis, const QString& name) {
+        valid &= validateRange(static_cast<float>(axis.naturalFrequencyHz), 0.5f, 50.0f, name + " natural frequency (Hz)");
+        valid &= validateRange(static_cast<float>(axis.dampingRatio), 0.05f, 5.0f, name + " damping ratio");
+        valid &= validateRange(static_cast<float>(axis.velocityGain), 0.1f, 2.0f, name + " velocity gain");
+        valid &= validateRange(static_cast<float>(axis.maxAccelerationDegS2), 1.0f, 5000.0f, name + " max acceleration");
+    };
+    validateAxis(cfg.azimuth, "Simulated azimuth");
+    validateAxis(cfg.elevation, "Simulated elevation");
+    valid &= validateRange(static_cast<float>(cfg.busTurnaroundMs), 0.0f, 100.0f, "Simulated bus turnaround (ms)");
+    valid &= validateRange(cfg.imuRateHz, 10, 1000, "Simulated IMU rate (Hz)");
+    valid &= validateRange(static_cast<float>(cfg.cameraFrameRateHz), 1.0f, 240.0f, "Simulated camera frame rate (Hz)");
+    valid &= validateRange(static_cast<float>(cfg.cameraLatencyMs), 0.0f, 1000.0f, "Simulated camera latency (ms)");
+
+    if (cfg.enabled) {
+        addWarning("Simulation enabled: servos, IMU and tracker are simulated, not the vehicle hardware");
+    }
+
+    return valid;
+}
+
 bool ConfigurationValidator::validateHardware()
 {
     bool valid = true;
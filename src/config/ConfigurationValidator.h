@@ -44,6 +44,7 @@ private:
     static bool validateUI();
     static bool validateSafety();
     static bool validatePerformance();
+    static bool validateSimulation();
     static bool validateHardware();
 
     // Helper methods
@@ -113,6 +113,8 @@ void ApplicationController::initialize()
             this, &ApplicationController::handleZoneDefinitions);
     connect(m_mainMenuController, &MainMenuController::systemStatusRequested,
             this, &ApplicationController::handleSystemStatus);
+    connect(m_mainMenuController, &MainMenuController::systemIdentificationRequested,
+            this, &ApplicationController::handleSystemIdentification);
     connect(m_mainMenuController, &MainMenuController::toggleDetectionRequested,
             this, &ApplicationController::handleToggleDetection);
     connect(m_mainMenuController, &MainMenuController::shutdownSystemRequested,
@@ -459,6 +461,19 @@ void ApplicationController::handleSystemStatus()
     setMenuState(MenuState::SystemStatus);
 }
 
+void ApplicationController::handleSystemIdentification()
+{
+    qDebug() << "ApplicationController: System Identification requested";
+
+    // Guarded by the model; the gimbal runs the excitation with the menu closed
+    if (m_systemStateModel) {
+        m_systemStateModel->startSystemIdentification();
+    }
+
+    hideAllMenus();
+    setMenuState(MenuState::None);
+}
+
 void ApplicationController::handleToggleDetection()
 {
     qDebug() << "ApplicationController: Toggle Detection requested";
@@ -1,5 +1,6 @@
 #include "deviceconfiguration.h"
 #include <QFile>
+#include <QSaveFile>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
@@ -20,8 +21,9 @@ DeviceConfiguration::BallisticsConfig DeviceConfiguration::m_ballistics;
 DeviceConfiguration::UiConfig DeviceConfiguration::m_ui;
 DeviceConfiguration::SafetyConfig DeviceConfiguration::m_safety;
 DeviceConfiguration::PerformanceConfig DeviceConfiguration::m_performance;
+DeviceConfiguration::SimulationConfig DeviceConfiguration::m_simulation;
 
-bool DeviceConfiguration::load(const QString& externalPath)
+bool DeviceConfiguration::load(const QString& externalPath, const QString& tuningPath)
 {
     qInfo() << "Loading device configuration...";
 
@@ -30,6 +32,7 @@ bool DeviceConfiguration::load(const QString& externalPath)
         qInfo() << "  Loading from external file:" << externalPath;
         if (loadFromFile(externalPath)) {
             qInfo() << "  ✓ Configuration loaded from external file";
+            loadGimbalTuning(tuningPath);
             return true;
         }
         qWarning() << "  ⚠ Failed to parse external config, trying embedded resource...";
@@ -39,6 +42,7 @@ bool DeviceConfiguration::load(const QString& externalPath)
     qInfo() << "  Loading from embedded resource: qrc:/config/devices.json";
     if (loadFromFile(":/config/devices.json")) {
         qInfo() << "  ✓ Configuration loaded from embedded resource";
+        loadGimbalTuning(tuningPath);
         return true;
     }
 
@@ -89,6 +93,8 @@ bool DeviceConfiguration::loadFromFile(const QString& filePath)
         QJsonObject video = root["video"].toObject();
         m_video.sourceWidth = video["sourceWidth"].toInt(m_video.sourceWidth);
         m_video.sourceHeight = video["sourceHeight"].toInt(m_video.sourceHeight);
+        m_video.trackingBackend = video["trackingBackend"].toString(m_video.trackingBackend);
+        m_video.trackingConfidence = video["trackingConfidence"].toDouble(m_video.trackingConfidence);
 
         if (video.contains("dayCamera")) {
             QJsonObject day = video["dayCamera"].toObject();
@@ -101,6 +107,16 @@ bool DeviceConfiguration::loadFromFile(const QString& filePath)
             m_video.nightDevicePath = night["devicePath"].toString();
             m_video.nightControlPort = night["controlPort"].toString();
         }
+
+        if (video.contains("replay")) {
+            QJsonObject replay = video["replay"].toObject();
+            m_video.replayEnabled = replay["enabled"].toBool(m_video.replayEnabled);
+            m_video.replayRealtime = replay["realtime"].toBool(m_video.replayRealtime);
+            m_video.dayReplaySource = replay["daySource"].toString();
+            m_video.dayReplayStateFile = replay["dayStateFile"].toString();
+            m_video.nightReplaySource = replay["nightSource"].toString();
+            m_video.nightReplayStateFile = replay["nightStateFile"].toString();
+        }
     }
 
     // Parse IMU
@@ -128,6 +144,7 @@ bool DeviceConfiguration::loadFromFile(const QString& filePath)
             m_plc21.baudRate = plc21["baudRate"].toInt(m_plc21.baudRate);
             m_plc21.slaveId = plc21["slaveId"].toInt(m_plc21.slaveId);
             m_plc21.parity = parseParity(plc21["parity"].toString());
+            parsePolling(plc21["polling"].toObject(), m_plc21.polling);
         }
 
         if (plc.contains("plc42")) {
@@ -136,6 +153,8 @@ bool DeviceConfiguration::loadFromFile(const QString& filePath)
             m_plc42.baudRate = plc42["baudRate"].toInt(m_plc42.baudRate);
             m_plc42.slaveId = plc42["slaveId"].toInt(m_plc42.slaveId);
             m_plc42.parity = parseParity(plc42["parity"].toString());
+            parsePolling(plc42["polling"].toObject(), m_plc42.polling);
+            m_plc42.readEnvironment = plc42["readEnvironment"].toBool(m_plc42.readEnvironment);
         }
     }
 
@@ -150,6 +169,7 @@ bool DeviceConfiguration::loadFromFile(const QString& filePath)
             m_servoAz.baudRate = az["baudRate"].toInt(m_servoAz.baudRate);
             m_servoAz.slaveId = az["slaveId"].toInt(m_servoAz.slaveId);
             m_servoAz.parity = parseParity(az["parity"].toString());
+            parsePolling(az["polling"].toObject(), m_servoAz.polling);
         }
 
         if (servo.contains("elevation")) {
@@ -159,6 +179,7 @@ bool DeviceConfiguration::loadFromFile(const QString& filePath)
             m_servoEl.baudRate = el["baudRate"].toInt(m_servoEl.baudRate);
             m_servoEl.slaveId = el["slaveId"].toInt(m_servoEl.slaveId);
             m_servoEl.parity = parseParity(el["parity"].toString());
+            parsePolling(el["polling"].toObject(), m_servoEl.polling);
         }
     }
 
@@ -185,7 +206,13 @@ bool DeviceConfiguration::loadFromFile(const QString& filePath)
         m_gimbal.maxSlewSpeed = gimbal["maxSlewSpeed"].toDouble(m_gimbal.maxSlewSpeed);
         m_gimbal.defaultSlewSpeed = gimbal["defaultSlewSpeed"].toDouble(m_gimbal.defaultSlewSpeed);
         m_gimbal.acceleration = gimbal["acceleration"].toDouble(m_gimbal.acceleration);
+        m_gimbal.jerk = gimbal["jerk"].toDouble(m_gimbal.jerk);
         m_gimbal.joystickDeadZone = gimbal["joystickDeadZone"].toDouble(m_gimbal.joystickDeadZone);
+        m_gimbal.servoPositionMode = gimbal["servoPositionMode"].toBool(m_gimbal.servoPositionMode);
+
+        QJsonObject tuning = gimbal["tuning"].toObject();
+        parseAxisTuning(tuning["azimuth"].toObject(), m_gimbal.azimuthTuning);
+        parseAxisTuning(tuning["elevation"].toObject(), m_gimbal.elevationTuning);
     }
 
     // Parse Ballistics
@@ -196,6 +223,13 @@ bool DeviceConfiguration::loadFromFile(const QString& filePath)
         m_ballistics.maxWindSpeed = ballistics["maxWindSpeed"].toDouble(m_ballistics.maxWindSpeed);
         m_ballistics.windStepSize = ballistics["windStepSize"].toDouble(m_ballistics.windStepSize);
         m_ballistics.defaultBulletSpeed = ballistics["defaultBulletSpeed"].toDouble(m_ballistics.defaultBulletSpeed);
+        m_ballistics.dragModel = ballistics["dragModel"].toString(m_ballistics.dragModel);
+        m_ballistics.ballisticCoefficient = ballistics["ballisticCoefficient"].toDouble(m_ballistics.ballisticCoefficient);
+        m_ballistics.tableMaxRange = ballistics["tableMaxRange"].toDouble(m_ballistics.tableMaxRange);
+        m_ballistics.tableStep = ballistics["tableStep"].toDouble(m_ballistics.tableStep);
+        m_ballistics.interceptMotionModel = ballistics["interceptMotionModel"].toString(m_ballistics.interceptMotionModel);
+        m_ballistics.interceptMaxIterations = ballistics["interceptMaxIterations"].toInt(m_ballistics.interceptMaxIterations);
+        m_ballistics.interceptBudgetUs = ballistics["interceptBudgetUs"].toDouble(m_ballistics.interceptBudgetUs);
     }
 
     // Parse UI
@@ -228,8 +262,161 @@ bool DeviceConfiguration::loadFromFile(const QString& filePath)
         m_performance.imuDataBufferSize = perf["imuDataBufferSize"].toInt(m_performance.imuDataBufferSize);
         m_performance.trackingDataBufferSize = perf["trackingDataBufferSize"].toInt(m_performance.trackingDataBufferSize);
         m_performance.videoFrameBufferSize = perf["videoFrameBufferSize"].toInt(m_performance.videoFrameBufferSize);
+        m_performance.startupProfilePath = perf["startupProfilePath"].toString(m_performance.startupProfilePath);
+    }
+
+    // Parse Simulation
+    if (root.contains("simulation")) {
+        parseSimulation(root["simulation"].toObject(), m_simulation);
+    }
+
+    return true;
+}
+
+void DeviceConfiguration::parseSimulation(const QJsonObject& obj, SimulationConfig& simulation)
+{
+    simulation.enabled = obj["enabled"].toBool(simulation.enabled);
+    simulation.busTurnaroundMs = obj["busTurnaroundMs"].toDouble(simulation.busTurnaroundMs);
+
+    auto parseAxis = [&obj](const char* name, SimulatedAxisConfig& axis) {
+        QJsonObject a = obj[name].toObject();
+        axis.naturalFrequencyHz = a["naturalFrequencyHz"].toDouble(axis.naturalFrequencyHz);
+        axis.dampingRatio = a["dampingRatio"].toDouble(axis.dampingRatio);
+        axis.velocityGain = a["velocityGain"].toDouble(axis.velocityGain);
+        axis.maxAccelerationDegS2 = a["maxAccelerationDegS2"].toDouble(axis.maxAccelerationDegS2);
+    };
+    parseAxis("azimuth", simulation.azimuth);
+    parseAxis("elevation", simulation.elevation);
+
+    QJsonObject vehicle = obj["vehicle"].toObject();
+    simulation.rollAmplitudeDeg = vehicle["rollAmplitudeDeg"].toDouble(simulation.rollAmplitudeDeg);
+    simulation.rollPeriodS = vehicle["rollPeriodS"].toDouble(simulation.rollPeriodS);
+    simulation.pitchAmplitudeDeg = vehicle["pitchAmplitudeDeg"].toDouble(simulation.pitchAmplitudeDeg);
+    simulation.pitchPeriodS = vehicle["pitchPeriodS"].toDouble(simulation.pitchPeriodS);
+    simulation.yawAmplitudeDeg = vehicle["yawAmplitudeDeg"].toDouble(simulation.yawAmplitudeDeg);
+    simulation.yawPeriodS = vehicle["yawPeriodS"].toDouble(simulation.yawPeriodS);
+    simulation.yawRateDegS = vehicle["yawRateDegS"].toDouble(simulation.yawRateDegS);
+    simulation.gyroNoiseDps = vehicle["gyroNoiseDps"].toDouble(simulation.gyroNoiseDps);
+    simulation.imuRateHz = vehicle["imuRateHz"].toInt(simulation.imuRateHz);
+    simulation.seed = vehicle["seed"].toInt(simulation.seed);
+
+    QJsonObject target = obj["target"].toObject();
+    simulation.targetEnabled = target["enabled"].toBool(simulation.targetEnabled);
+    simulation.targetAzDeg = target["azDeg"].toDouble(simulation.targetAzDeg);
+    simulation.targetElDeg = target["elDeg"].toDouble(simulation.targetElDeg);
+    simulation.targetAzRateDegS = target["azRateDegS"].toDouble(simulation.targetAzRateDegS);
+    simulation.targetElRateDegS = target["elRateDegS"].toDouble(simulation.targetElRateDegS);
+    simulation.targetWeaveAmplitudeDeg = target["weaveAmplitudeDeg"].toDouble(simulation.targetWeaveAmplitudeDeg);
+    simulation.targetWeavePeriodS = target["weavePeriodS"].toDouble(simulation.targetWeavePeriodS);
+
+    QJsonObject camera = obj["camera"].toObject();
+    simulation.cameraFrameRateHz = camera["frameRateHz"].toDouble(simulation.cameraFrameRateHz);
+    simulation.cameraLatencyMs = camera["latencyMs"].toDouble(simulation.cameraLatencyMs);
+}
+
+void DeviceConfiguration::parseAxisTuning(const QJsonObject& obj, AxisTuningConfig& tuning)
+{
+    auto parseGains = [&obj](const char* loop, PidGainConfig& gains) {
+        QJsonObject g = obj[loop].toObject();
+        gains.kp = g["kp"].toDouble(gains.kp);
+        gains.ki = g["ki"].toDouble(gains.ki);
+        gains.kd = g["kd"].toDouble(gains.kd);
+    };
+    parseGains("tracking", tuning.tracking);
+    parseGains("radarSlew", tuning.radarSlew);
+    parseGains("scanTrim", tuning.scanTrim);
+
+    QJsonObject plant = obj["plant"].toObject();
+    tuning.plantGain = plant["gain"].toDouble(tuning.plantGain);
+    tuning.plantTimeConstantS = plant["timeConstantS"].toDouble(tuning.plantTimeConstantS);
+    tuning.plantDeadTimeS = plant["deadTimeS"].toDouble(tuning.plantDeadTimeS);
+    tuning.identified = plant["identified"].toBool(tuning.identified);
+}
+
+void DeviceConfiguration::parsePolling(const QJsonObject& obj, ModbusPollingConfig& polling)
+{
+    polling.intervalMs = obj["intervalMs"].toInt(polling.intervalMs);
+    polling.activeIntervalMs = obj["activeIntervalMs"].toInt(polling.activeIntervalMs);
+    polling.idleIntervalMs = obj["idleIntervalMs"].toInt(polling.idleIntervalMs);
+    polling.idleAfterMs = obj["idleAfterMs"].toInt(polling.idleAfterMs);
+    polling.slowIntervalMs = obj["slowIntervalMs"].toInt(polling.slowIntervalMs);
+    polling.slowMaxIntervalMs = obj["slowMaxIntervalMs"].toInt(polling.slowMaxIntervalMs);
+    polling.busBudget = obj["busBudget"].toDouble(polling.busBudget);
+    polling.turnaroundMs = obj["turnaroundMs"].toDouble(polling.turnaroundMs);
+}
+
+QJsonObject DeviceConfiguration::axisTuningToJson(const AxisTuningConfig& tuning)
+{
+    auto gainsToJson = [](const PidGainConfig& gains) {
+        QJsonObject g;
+        g["kp"] = gains.kp;
+        g["ki"] = gains.ki;
+        g["kd"] = gains.kd;
+        return g;
+    };
+
+    QJsonObject plant;
+    plant["gain"] = tuning.plantGain;
+    plant["timeConstantS"] = tuning.plantTimeConstantS;
+    plant["deadTimeS"] = tuning.plantDeadTimeS;
+    plant["identified"] = tuning.identified;
+
+    QJsonObject obj;
+    obj["plant"] = plant;
+    obj["tracking"] = gainsToJson(tuning.tracking);
+    obj["radarSlew"] = gainsToJson(tuning.radarSlew);
+    obj["scanTrim"] = gainsToJson(tuning.scanTrim);
+    return obj;
+}
+
+void DeviceConfiguration::setGimbalTuning(const AxisTuningConfig& azimuth, const AxisTuningConfig& elevation)
+{
+    m_gimbal.azimuthTuning = azimuth;
+    m_gimbal.elevationTuning = elevation;
+}
+
+void DeviceConfiguration::loadGimbalTuning(const QString& tuningPath)
+{
+    // Same layout as gimbal.tuning in devices.json; fields present override it
+    if (!QFile::exists(tuningPath)) return;
+
+    QFile file(tuningPath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "  ⚠ Cannot open gimbal tuning:" << tuningPath;
+        return;
     }
 
+    QJsonParseError parseError;
+    const QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+    if (parseError.error != QJsonParseError::NoError || !doc.isObject()) {
+        qWarning() << "  ⚠ Ignoring gimbal tuning" << tuningPath << ":" << parseError.errorString();
+        return;
+    }
+
+    const QJsonObject tuning = doc.object();
+    parseAxisTuning(tuning["azimuth"].toObject(), m_gimbal.azimuthTuning);
+    parseAxisTuning(tuning["elevation"].toObject(), m_gimbal.elevationTuning);
+    qInfo() << "  ✓ Gimbal tuning loaded from" << tuningPath;
+}
+
+bool DeviceConfiguration::saveGimbalTuning(const QString& tuningPath)
+{
+    QJsonObject tuning;
+    tuning["azimuth"] = axisTuningToJson(m_gimbal.azimuthTuning);
+    tuning["elevation"] = axisTuningToJson(m_gimbal.elevationTuning);
+
+    // Written atomically: an interrupted save leaves the previous tuning in place
+    QSaveFile out(tuningPath);
+    if (!out.open(QIODevice::WriteOnly)) {
+        qWarning() << "Cannot write gimbal tuning to" << tuningPath;
+        return false;
+    }
+    out.write(QJsonDocument(tuning).toJson(QJsonDocument::Indented));
+    if (!out.commit()) {
+        qWarning() << "Cannot write gimbal tuning to" << tuningPath << ":" << out.errorString();
+        return false;
+    }
+    qInfo() << "Gimbal tuning saved to" << tuningPath;
     return true;
 }
 
@@ -1,6 +1,7 @@
 #ifndef DEVICECONFIGURATION_H
 #define DEVICECONFIGURATION_H
 
+#include <QJsonObject>
 #include <QObject>
 #include <QString>
 #include <QSerialPort>
@@ -15,6 +16,17 @@ public:
         QString dayControlPort;
         QString nightDevicePath;
         QString nightControlPort;
+
+        QString trackingBackend = "VPI_BACKEND_CUDA";  // Or VPI_BACKEND_PVA, OPENCV_KCF, OPENCV_CSRT
+        float trackingConfidence = 0.25f;              // CPU trackers: below this the target is lost
+
+        // Replay source instead of v4l2 cameras (headless benchmarking / CI)
+        bool replayEnabled = false;
+        bool replayRealtime = true;         // false = as fast as the pipeline can go
+        QString dayReplaySource;            // Video file path or "videotestsrc ..."
+        QString dayReplayStateFile;         // Sidecar gimbal/IMU CSV (optional)
+        QString nightReplaySource;
+        QString nightReplayStateFile;
     };
 
     struct ImuConfig {
@@ -29,11 +41,25 @@ public:
         int baudRate = 115200;
     };
 
+    // Adaptive read scheduling on one Modbus RTU bus (ModbusPollScheduler)
+    struct ModbusPollingConfig {
+        int intervalMs = 50;            // Fast blocks (position, inputs) at normal activity
+        int activeIntervalMs = 0;       // While moving or tracking; 0 = intervalMs
+        int idleIntervalMs = 0;         // After idleAfterMs without motion; 0 = intervalMs
+        int idleAfterMs = 5000;
+        int slowIntervalMs = 2000;      // Temperatures and environment
+        int slowMaxIntervalMs = 10000;  // Backoff ceiling while they do not change
+        double busBudget = 0.6;         // Share of the line polling may use; the rest is for commands
+        double turnaroundMs = 1.0;      // Slave response delay
+    };
+
     struct PlcConfig {
         QString port;
         int baudRate = 115200;
         int slaveId = 31;
         QSerialPort::Parity parity = QSerialPort::EvenParity;
+        ModbusPollingConfig polling{50, 0, 0, 5000, 1000, 5000};
+        bool readEnvironment = false;    // PLC42 station temperature/pressure input registers (assumed map)
     };
 
     struct ServoConfig {
@@ -42,6 +68,7 @@ public:
         int baudRate = 230400;
         int slaveId = 1;
         QSerialPort::Parity parity = QSerialPort::NoParity;
+        ModbusPollingConfig polling{50, 20, 200, 5000, 2000, 10000};
     };
 
     struct ActuatorConfig {
@@ -59,6 +86,23 @@ public:
         QString databasePath = "./data/rcws_history.db";
     };
 
+    struct PidGainConfig {
+        double kp = 0.0;
+        double ki = 0.0;
+        double kd = 0.0;
+    };
+
+    // Loop gains of one axis and the plant they were tuned for
+    struct AxisTuningConfig {
+        PidGainConfig tracking{0.15, 0.005, 0.01};
+        PidGainConfig radarSlew{1.5, 0.08, 0.15};
+        PidGainConfig scanTrim{1.0, 0.0, 0.0};
+        double plantGain = 1.0;                 // Achieved / commanded velocity
+        double plantTimeConstantS = 0.08;
+        double plantDeadTimeS = 0.1;
+        bool identified = false;                // False: nominal plant, hand-tuned gains
+    };
+
     struct GimbalConfig {
         float azimuthMin = -180.0f;
         float azimuthMax = 180.0f;
@@ -67,7 +111,14 @@ public:
         float maxSlewSpeed = 120.0f;
         float defaultSlewSpeed = 30.0f;
         float acceleration = 50.0f;
+        float jerk = 200.0f;                    // deg/s³, planned scan moves
         float joystickDeadZone = 0.05f;
+        // Slews/scans as driver-side absolute moves when unstabilized. Off until tried on
+        // the AZD drivers: step counts vs. encoder az/el, arrival and timeout handling, and
+        // stopping short of no-traverse zones must all be checked on the real turret first.
+        bool servoPositionMode = false;
+        AxisTuningConfig azimuthTuning;
+        AxisTuningConfig elevationTuning;
     };
 
     struct BallisticsConfig {
@@ -76,6 +127,13 @@ public:
         float maxWindSpeed = 50.0f;
         float windStepSize = 1.0f;
         float defaultBulletSpeed = 850.0f;
+        QString dragModel = "G7";               // G1 or G7
+        float ballisticCoefficient = 0.32f;     // lb/in², for dragModel
+        float tableMaxRange = 2500.0f;          // m
+        float tableStep = 10.0f;                // m between table samples
+        QString interceptMotionModel = "CV";    // CV (constant velocity) or CA (constant acceleration)
+        int interceptMaxIterations = 6;
+        float interceptBudgetUs = 50.0f;        // Per fire-control update
     };
 
     struct UiConfig {
@@ -102,10 +160,57 @@ public:
         int imuDataBufferSize = 120000;
         int trackingDataBufferSize = 36000;
         int videoFrameBufferSize = 10;
+        QString startupProfilePath;     // Startup timings (JSON) written here once video and traverse are up; empty = log only
     };
 
-    // Load configuration from file (tries external first, then embedded resource)
-    static bool load(const QString& externalPath = "./config/devices.json");
+    // Second-order speed response of one simulated driver + axis
+    struct SimulatedAxisConfig {
+        double naturalFrequencyHz = 4.0;
+        double dampingRatio = 0.7;
+        double velocityGain = 1.0;
+        double maxAccelerationDegS2 = 300.0;
+    };
+
+    // In-process servo/IMU/tracker plant instead of the hardware (off-vehicle benchmarking)
+    struct SimulationConfig {
+        bool enabled = false;
+        SimulatedAxisConfig azimuth;
+        SimulatedAxisConfig elevation;
+        double busTurnaroundMs = 2.0;           // Driver response delay; baud rate from servoAz/servoEl
+
+        // Vehicle motion: sinusoid per axis plus a steady turn
+        double rollAmplitudeDeg = 0.0;
+        double rollPeriodS = 4.0;
+        double pitchAmplitudeDeg = 0.0;
+        double pitchPeriodS = 5.0;
+        double yawAmplitudeDeg = 0.0;
+        double yawPeriodS = 8.0;
+        double yawRateDegS = 0.0;
+        double gyroNoiseDps = 0.0;
+        int imuRateHz = 100;
+        int seed = 1;
+
+        // Synthetic target, world frame
+        bool targetEnabled = false;
+        double targetAzDeg = 0.0;
+        double targetElDeg = 5.0;
+        double targetAzRateDegS = 0.0;
+        double targetElRateDegS = 0.0;
+        double targetWeaveAmplitudeDeg = 0.0;
+        double targetWeavePeriodS = 6.0;
+        double cameraFrameRateHz = 30.0;
+        double cameraLatencyMs = 60.0;         // Capture to tracking result
+    };
+
+    // Load configuration from file (tries external first, then embedded resource),
+    // then overlays the saved gimbal tuning when tuningPath exists
+    static bool load(const QString& externalPath = "./config/devices.json",
+                     const QString& tuningPath = "./config/gimbal_tuning.json");
+
+    // Tuning from the identification mode: applied immediately, persisted on save.
+    // Saved to its own file so devices.json is never rewritten by the application.
+    static void setGimbalTuning(const AxisTuningConfig& azimuth, const AxisTuningConfig& elevation);
+    static bool saveGimbalTuning(const QString& tuningPath = "./config/gimbal_tuning.json");
 
     // Getters - Hardware
     static const VideoConfig& video() { return m_video; }
@@ -124,9 +229,17 @@ public:
     static const UiConfig& ui() { return m_ui; }
     static const SafetyConfig& safety() { return m_safety; }
     static const PerformanceConfig& performance() { return m_performance; }
+    static const SimulationConfig& simulation() { return m_simulation; }
+
+    // Fields present in obj override simulation (scenario files reuse the devices.json layout)
+    static void parseSimulation(const QJsonObject& obj, SimulationConfig& simulation);
 
 private:
     static bool loadFromFile(const QString& filePath);
+    static void loadGimbalTuning(const QString& tuningPath);
+    static void parseAxisTuning(const QJsonObject& obj, AxisTuningConfig& tuning);
+    static void parsePolling(const QJsonObject& obj, ModbusPollingConfig& polling);
+    static QJsonObject axisTuningToJson(const AxisTuningConfig& tuning);
     static QSerialPort::Parity parseParity(const QString& parityStr);
 
     static VideoConfig m_video;
@@ -143,6 +256,7 @@ private:
     static UiConfig m_ui;
     static SafetyConfig m_safety;
     static PerformanceConfig m_performance;
+    static SimulationConfig m_simulation;
 };
 
 #endif // DEVICECONFIGURATION_H
@@ -4,9 +4,11 @@
 #include "motion_modes/autosectorscanmotionmode.h"
 #include "motion_modes/radarslewmotionmode.h"
 #include "motion_modes/trpscanmotionmode.h"
+#include "motion_modes/systemidentificationmotionmode.h"
 
 #include "hardware/devices/servodriverdevice.h"
 #include "hardware/devices/plc42device.h"
+#include "controllers/deviceconfiguration.h"
 #include <QDebug>
 
 namespace GimbalUtils { // Example namespace
@@ -46,6 +48,14 @@ namespace GimbalUtils { // Example namespace
 
 } // namespace GimbalUtils
 
+namespace {
+double imuSampleRateHz()
+{
+    const auto& simulation = DeviceConfiguration::simulation();
+    return simulation.enabled ? simulation.imuRateHz : DeviceConfiguration::imu().samplingRateHz;
+}
+}
+
 GimbalController::GimbalController(ServoDriverDevice* azServo,
                                    ServoDriverDevice* elServo,
                                    Plc42Device* plc42,
@@ -56,6 +66,7 @@ GimbalController::GimbalController(ServoDriverDevice* azServo,
     , m_elServo(elServo)
     , m_plc42(plc42)
     , m_stateModel(stateModel)
+    , m_rateStabilizer(imuSampleRateHz())
 {
     // Default motion mode
     setMotionMode(MotionMode::Idle);
@@ -63,6 +74,8 @@ GimbalController::GimbalController(ServoDriverDevice* azServo,
     if (m_stateModel) {
         connect(m_stateModel, &SystemStateModel::dataChanged,
                 this,         &GimbalController::onSystemStateChanged);
+        connect(m_stateModel, &SystemStateModel::imuSampleReceived,
+                this,         &GimbalController::onImuSample);
     }
 
     connect(m_azServo, &ServoDriverDevice::alarmDetected, this, &GimbalController::onAzAlarmDetected);
@@ -136,10 +149,12 @@ void GimbalController::onSystemStateChanged(const SystemStateData &newData)
                 );
 
 
-                // The desired target gimbal position is current gimbal position + this offset
-                // (because the offset tells us how far to move FROM current to get target to center)
-                double targetGimbalAz = newData.gimbalAz + angularOffset.x();
-                double targetGimbalEl = newData.gimbalEl + angularOffset.y();
+                // The desired target gimbal position is gimbal position + this offset
+                // (because the offset tells us how far to move FROM current to get target to center).
+                // Use the pose at frame capture when known; the gimbal has moved since then.
+                const bool hasCapturePose = newData.trackedTargetTimestampNs > 0;
+                double targetGimbalAz = (hasCapturePose ? newData.trackedTargetGimbalAz : newData.gimbalAz) + angularOffset.x();
+                double targetGimbalEl = (hasCapturePose ? newData.trackedTargetGimbalEl : newData.gimbalEl) + angularOffset.y();
 
                 QPointF angularVelocity = GimbalUtils::calculateAngularOffsetFromPixelError(
                     newData.trackedTargetVelocityX_px_s, // Use velocity in pixels/sec
@@ -160,7 +175,8 @@ void GimbalController::onSystemStateChanged(const SystemStateData &newData)
                 trackingMode->onTargetPositionUpdated(
                     targetGimbalAz, targetGimbalEl, 
                     targetAngularVelAz_dps, targetAngularVelEl_dps, // Pass the calculated angular velocities
-                    true
+                    true,
+                    newData.trackedTargetTimestampNs
                 );
                 //trackingMode->onTargetPositionUpdated(targetGimbalAz, targetGimbalEl, 0, 0, true);
             } else {
@@ -188,15 +204,23 @@ void GimbalController::onSystemStateChanged(const SystemStateData &newData)
     m_oldState = newData;
 }
 
+void GimbalController::onImuSample(const ImuData &sample)
+{
+    // Gyro bias and filtering run at the IMU rate; the modes' update() only at 20 Hz
+    m_rateStabilizer.addSample(sample.angRateX_dps, sample.angRateY_dps, sample.angRateZ_dps,
+                               m_stateModel->data().isVehicleStationary);
+
+    if (m_currentMode && m_currentMode->checkSafetyConditions(this)) {
+        m_currentMode->applyRateFeedForward(this);
+    }
+}
+
 void GimbalController::update()
 {
     if (!m_currentMode) {
         return;
     }
 
-    // Update gyro bias before any motion mode update, as it depends on the latest stationary status
-    m_currentMode->updateGyroBias(m_stateModel->data());
-
     // Centralized safety check. If conditions are not met (e.g., E-Stop),
     // the servos are stopped, and the mode's specific update logic is skipped.
     if (m_currentMode->checkSafetyConditions(this)) {
@@ -269,6 +293,9 @@ void GimbalController::setMotionMode(MotionMode newMode)
             }
         }
         break;
+    case MotionMode::SystemIdentification:
+        m_currentMode = std::make_unique<SystemIdentificationMotionMode>();
+        break;
  
  
     default:
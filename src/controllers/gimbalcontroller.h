@@ -85,6 +85,11 @@ public:
      * @return Pointer to the SystemStateModel.
      */
     SystemStateModel* systemStateModel() const { return m_stateModel; }
+
+    /**
+     * @brief Gyro bias and filtered rates, updated for every IMU sample.
+     */
+    const RateStabilizer& rateStabilizer() const { return m_rateStabilizer; }
     
     void readAlarms();
     void clearAlarms();
@@ -103,6 +108,7 @@ private slots:
      * @param newData Updated system state.
      */
     void onSystemStateChanged(const SystemStateData &newData);
+    void onImuSample(const ImuData &sample);
     void onAzAlarmDetected(uint16_t alarmCode, const QString &description);
     void onAzAlarmCleared();
     void onElAlarmDetected(uint16_t alarmCode, const QString &description);
@@ -127,6 +133,8 @@ private:
 
     QTimer* m_updateTimer = nullptr; ///< Timer for periodic updates.
 
+    RateStabilizer m_rateStabilizer; ///< IMU-rate gyro filtering and bias, shared by all modes.
+
     
 };
 
@@ -319,13 +319,13 @@ void JoystickController::onButtonChanged(int button, bool pressed)
                 if (!currentLACState) { // Was off, now turning on
                     //m_stateModel->setLeadAngleCompensationActive(true);
                     // statusBar()->showMessage("Lead Angle Compensation ENABLED.", 2000);
-                    // Trigger an initial calculation in WeaponController if it's not periodic
-                    if (m_weaponController) m_weaponController->updateFireControlSolution();
+                    // Solved on WeaponController's next fire-control tick
+                    if (m_weaponController) m_weaponController->requestFireControlUpdate();
                 } else { // Was on, now turning off
                     //m_stateModel->setLeadAngleCompensationActive(false);
                     // statusBar()->showMessage("Lead Angle Compensation DISABLED.", 2000);
-                    // WeaponController's updateFireControlSolution will see it's off and clear offsets.
-                    // if (m_weaponCtrl) m_weaponCtrl->updateFireControlSolution(); // Ensure offsets are cleared
+                    // The next fire-control tick sees it's off and clears the offsets.
+                    if (m_weaponController) m_weaponController->requestFireControlUpdate();
                 }
             } 
         }  
@@ -57,6 +57,7 @@ QStringList MainMenuController::buildMainMenuOptions() const
             << "--- SYSTEM ---"
             << "Zone Definitions"
             << "System Status"
+            << "System Identification"
             << detectionOption
             << "Shutdown System"
             << "--- INFO ---"
@@ -134,6 +135,10 @@ void MainMenuController::handleMenuOptionSelected(const QString& option)
         emit systemStatusRequested();
        // emit menuFinished();
     }
+    else if (option == "System Identification") {
+        emit systemIdentificationRequested();
+        emit menuFinished();
+    }
     else if (option.startsWith("Detection")) {
         if (option.contains("Unavailable")) {
             qDebug() << "Detection unavailable - Night camera is active";
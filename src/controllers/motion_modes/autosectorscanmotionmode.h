@@ -3,6 +3,7 @@
 
 #include "gimbalmotionmodebase.h"
 #include "models/domain/systemstatemodel.h" // For AutoSectorScanZone struct
+#include "motionclock.h"
 
 class AutoSectorScanMotionMode : public GimbalMotionModeBase
 {
@@ -19,23 +20,27 @@ public:
     void setActiveScanZone(const AutoSectorScanZone& scanZone);
 
 private:
+    // Velocity-mode sweep from the current position, executed by followTrajectory()
+    void planTrajectory(GimbalController* controller);
+
     AutoSectorScanZone m_activeScanZone;
     bool m_scanZoneSet;
-    bool m_movingToPoint2; // True if current direction is towards point 2, false if towards point 1
-    double m_targetAz, m_targetEl; // Current intermediate target for PID
-    
-    // PID controllers for smooth movement to target points
-    // You might reuse or adapt the PID logic from TrackingMotionMode
-    // Or implement simpler "move at speed towards target" if PID is overkill for scans
-   // struct PIDController { /* ... as in TrackingMotionMode ... */ 
-   // void reset(){ integral = 0; previousError = 0;} double Kp = 0.8, Ki=0.05, Kd=0.1, integral=0, previousError=0, maxIntegral=50;};
+
+    // Planned sweep: lead-in to point 2, then point 2 <-> point 1, executed by time
+    ScanTrajectory m_trajectory;
+    MotionTimer m_trajectoryTimer;
+    int m_lastWaypointIndex;
+
+    // Same sweep as driver-side position moves, while no stabilization is needed
+    OffloadedScan m_offloadedScan;
+    bool m_offloaded;
+
+    // Small position correction on top of the planned velocity
     PIDController m_azPid;
     PIDController m_elPid;
-   // double pidCompute(PIDController& pid, double error, double dt);
-
 
-    static constexpr double ARRIVAL_THRESHOLD_DEG = 0.2; // How close to consider a point "reached"
-    static constexpr double DECELERATION_DISTANCE_DEG = 2.0;
+    // Zone scanSpeed is set in UI steps of 0.1 deg/s
+    static constexpr double SCAN_SPEED_SCALE = 0.1;
 };
 
 #endif // AUTOSECTORSCANMOTIONMODE_H
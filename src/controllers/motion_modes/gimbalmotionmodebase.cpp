@@ -1,20 +1,36 @@
 #include "gimbalmotionmodebase.h"
 #include "../gimbalcontroller.h"
+#include "controllers/deviceconfiguration.h"
 #include "hardware/devices/servodriverdevice.h"
+#include "hardware/protocols/ServoDriverProtocolParser.h"
 #include "models/domain/systemstatemodel.h"
 #include <QDebug>
 #include <algorithm>
+#include <cmath>
 
-// =========================================================================
-// REGISTER DEFINITIONS for AZD-KX Direct Data Operation (from your manual)
-// =========================================================================
-namespace AzdReg {
-    // These are all 16-bit register addresses
-    constexpr quint16 OpType      = 0x005A; // Operation Type (2 registers)
-    constexpr quint16 OpSpeed     = 0x005E; // Operating Speed (2 registers, signed +/- 4,000,000 Hz)
-    constexpr quint16 OpAccel     = 0x0060; // Starting/Changing Speed Rate (2 registers)
-    constexpr quint16 OpDecel     = 0x0062; // Stopping Deceleration (2 registers)
-    constexpr quint16 OpTrigger   = 0x0066; // Trigger (2 registers)
+namespace {
+void appendRegisterPair(QVector<quint16>& registers, quint32 value)
+{
+    registers.append(static_cast<quint16>((value >> 16) & 0xFFFF));
+    registers.append(static_cast<quint16>(value & 0xFFFF));
+}
+
+double wrapDegrees180(double deg)
+{
+    deg = std::fmod(deg + 180.0, 360.0);
+    if (deg < 0.0)
+        deg += 360.0;
+    return deg - 180.0;
+}
+
+// Rest-to-rest trapezoidal move time, as executed by the driver
+double trapezoidDuration(double distance, double speed, double acceleration)
+{
+    if (distance <= 0.0 || speed <= 0.0 || acceleration <= 0.0) return 0.0;
+    if (distance >= speed * speed / acceleration)
+        return distance / speed + speed / acceleration;
+    return 2.0 * std::sqrt(distance / acceleration);
+}
 }
  
 
@@ -26,18 +42,41 @@ void GimbalMotionModeBase::configureVelocityMode(ServoDriverDevice* driverInterf
     // It should be called from the enterMode() of each motion class.
 
     // 1. Set Operation Type to 16: Continuous operation (speed control)
-    QVector<quint16> opTypeData = {0x0000, 0x0010}; // 16 is 0x10
+    QVector<quint16> opTypeData;
+    appendRegisterPair(opTypeData, AzdReg::TypeContinuousSpeed);
     driverInterface->writeData(AzdReg::OpType, opTypeData);
 
     // 2. Set a reasonable default acceleration/deceleration rate.
     // From manual, 1,000,000 = 1000 kHz/s. Let's set 1500 kHz/s = 1,500,000
-    quint32 accel = 150000;//0;
-    QVector<quint16> accelData = {
-        static_cast<quint16>((accel >> 16) & 0xFFFF),
-        static_cast<quint16>(accel & 0xFFFF)
-    };
+    QVector<quint16> accelData;
+    appendRegisterPair(accelData, VELOCITY_MODE_RATE_HZ_PER_S);
     driverInterface->writeData(AzdReg::OpAccel, accelData);
     driverInterface->writeData(AzdReg::OpDecel, accelData); // Use same for decel
+
+    // 3. Operating current, so the value writeVelocityCommand repeats each tick
+    // is already in place before the first speed command
+    QVector<quint16> currentData;
+    appendRegisterPair(currentData, AzdReg::FullCurrent);
+    driverInterface->writeData(AzdReg::OpCurrent, currentData);
+}
+
+void GimbalMotionModeBase::writeDirectDataOperation(ServoDriverDevice* driverInterface, quint32 operationType,
+                                                    qint32 positionSteps, qint32 speedHz, quint32 rateHzPerS)
+{
+    if (!driverInterface) return;
+
+    // OpType .. OpTrigger are contiguous, so the whole operation is a single write request
+    static_assert(AzdReg::OpTrigger - AzdReg::OpType == 12, "direct data registers must be contiguous");
+    QVector<quint16> registers;
+    registers.reserve(14);
+    appendRegisterPair(registers, operationType);
+    appendRegisterPair(registers, static_cast<quint32>(positionSteps));
+    appendRegisterPair(registers, static_cast<quint32>(speedHz));
+    appendRegisterPair(registers, rateHzPerS);
+    appendRegisterPair(registers, rateHzPerS);
+    appendRegisterPair(registers, AzdReg::FullCurrent);
+    appendRegisterPair(registers, static_cast<quint32>(AzdReg::TriggerAllData));
+    driverInterface->writeData(AzdReg::OpType, registers);
 }
 
 void GimbalMotionModeBase::writeVelocityCommand(ServoDriverDevice* driverInterface, 
@@ -50,48 +89,17 @@ void GimbalMotionModeBase::writeVelocityCommand(ServoDriverDevice* driverInterfa
     // The OpSpeed register is a SIGNED 32-bit integer.
     qint32 speedHz = static_cast<qint32>(finalVelocity * scalingFactor);
 
-    // 2. Split the signed 32-bit speed into two 16-bit registers
-    QVector<quint16> speedData = {
-        static_cast<quint16>((speedHz >> 16) & 0xFFFF), // Upper 16 bits
-        static_cast<quint16>(speedHz & 0xFFFF)        // Lower 16 bits
-    };
-    driverInterface->writeData(AzdReg::OpSpeed, speedData);
-
-    // 3. Trigger the speed update.
-    // From manual, trigger value -4 (FFFF FFFCh) updates the operating speed.
-    QVector<quint16> triggerData = {0xFFFF, 0xFFFC};
-    driverInterface->writeData(AzdReg::OpTrigger, triggerData);
-}
-
-void GimbalMotionModeBase::updateGyroBias(const SystemStateData& systemState)
-{
-    // Static variables to maintain state across calls
-    static double sumX = 0, sumY = 0, sumZ = 0;  // ← CHANGED: Added X and Y
-    static int count = 0;
-    static QDateTime lastResetTime = QDateTime::currentDateTime();
-
-    // Only estimate bias if the vehicle is stationary
-    if (systemState.isVehicleStationary) {
-        sumX += systemState.GyroX;   
-        sumY += systemState.GyroY;   
-        sumZ += systemState.GyroZ;
-        count++;
-
-        if (count >= 50) {
-            m_gyroBiasX = sumX / count;   
-            m_gyroBiasY = sumY / count;   
-            m_gyroBiasZ = sumZ / count;
-            sumX = sumY = sumZ = 0;       
-            count = 0;
-            lastResetTime = QDateTime::currentDateTime();
-            qDebug() << "[Gimbal] New Gyro Bias - X:" << m_gyroBiasX 
-                     << "Y:" << m_gyroBiasY << "Z:" << m_gyroBiasZ;   
-        }
-    } else {
-        sumX = sumY = sumZ = 0;   
-        count = 0;
-        lastResetTime = QDateTime::currentDateTime();
-    }
+    // 2. OpSpeed .. OpTrigger in one write request. Accel/decel/current repeat what
+    // configureVelocityMode set; trigger -4 (FFFF FFFCh) only updates the operating speed.
+    static_assert(AzdReg::OpTrigger - AzdReg::OpSpeed == 8, "speed .. trigger registers must be contiguous");
+    QVector<quint16> registers;
+    registers.reserve(10);
+    appendRegisterPair(registers, static_cast<quint32>(speedHz));
+    appendRegisterPair(registers, VELOCITY_MODE_RATE_HZ_PER_S);
+    appendRegisterPair(registers, VELOCITY_MODE_RATE_HZ_PER_S);
+    appendRegisterPair(registers, AzdReg::FullCurrent);
+    appendRegisterPair(registers, static_cast<quint32>(AzdReg::TriggerSpeedOnly));
+    driverInterface->writeData(AzdReg::OpSpeed, registers);
 }
 
 void GimbalMotionModeBase::sendStabilizedServoCommands(GimbalController* controller,
@@ -102,36 +110,123 @@ void GimbalMotionModeBase::sendStabilizedServoCommands(GimbalController* control
     // --- Step 1: Get current system state ---
     SystemStateData systemState = controller->systemStateModel()->data();
 
-    double finalAzVelocity = desiredAzVelocity;
-    double finalElVelocity = desiredElVelocity;
+    m_velocityCommand.active = true;
+    m_velocityCommand.azDps = desiredAzVelocity;
+    m_velocityCommand.elDps = desiredElVelocity;
+    m_velocityCommand.stabilized = enableStabilization && systemState.enableStabilization;
+    m_velocityCommand.azPositionCorrection = 0.0;
+    m_velocityCommand.elPositionCorrection = 0.0;
+
+    // --- Step 2: AHRS position layer at the mode's update rate ---
+    // The gyro rate layer is added in writeVelocityCommands, here and at every IMU sample
+    if (m_velocityCommand.stabilized) {
+        calculateHybridStabilizationCorrection(systemState,
+                                               m_velocityCommand.azPositionCorrection,
+                                               m_velocityCommand.elPositionCorrection);
+    }
 
-    // --- Step 2: Apply stabilization if enabled ---
-    if (enableStabilization && systemState.enableStabilization) {
-        double azCorrection = 0.0;
-        double elCorrection = 0.0;
+    writeVelocityCommands(controller, systemState, true);
+}
 
-        // Use new hybrid stabilization: AHRS position control + gyro velocity feedforward
-        calculateHybridStabilizationCorrection(systemState, azCorrection, elCorrection);
+void GimbalMotionModeBase::applyRateFeedForward(GimbalController* controller)
+{
+    if (!controller || !m_velocityCommand.active || !m_velocityCommand.stabilized || m_positionMove.active) {
+        return;
+    }
 
-        // Add the calculated correction to the desired velocity
-        finalAzVelocity += azCorrection;
-        finalElVelocity += elCorrection;
+    const SystemStateData systemState = controller->systemStateModel()->data();
+    if (!systemState.enableStabilization) {
+        return;     // Switched off since the last update(); the mode picks it up there
+    }
+    writeVelocityCommands(controller, systemState, false);
+}
+
+void GimbalMotionModeBase::writeVelocityCommands(GimbalController* controller, const SystemStateData& state,
+                                                 bool force)
+{
+    double finalAzVelocity = m_velocityCommand.azDps;
+    double finalElVelocity = m_velocityCommand.elDps;
+
+    if (m_velocityCommand.stabilized) {
+        double rateAz = 0.0;
+        double rateEl = 0.0;
+        if (state.imuConnected) {
+            controller->rateStabilizer().feedForward(state.gimbalAz, state.gimbalEl, rateAz, rateEl);
+        }
+
+        // Both stabilization layers together stay within the correction limit
+        const double MAX_TOTAL_VEL = 12.0;  // deg/s
+        finalAzVelocity += qBound(-MAX_TOTAL_VEL, m_velocityCommand.azPositionCorrection + rateAz, MAX_TOTAL_VEL);
+        finalElVelocity += qBound(-MAX_TOTAL_VEL, m_velocityCommand.elPositionCorrection + rateEl, MAX_TOTAL_VEL);
     }
 
     // --- Step 3: Apply system-wide velocity limits ---
     finalAzVelocity = qBound(-MAX_VELOCITY, finalAzVelocity, MAX_VELOCITY);
     finalElVelocity = qBound(-MAX_VELOCITY, finalElVelocity, MAX_VELOCITY);
 
-    // --- Step 4: Convert to servo steps and send commands (AZD-KD velocity mode) ---
-    const double azStepsPerDegree = 222500.0 / 360.0;
-    const double elStepsPerDegree = 200000.0 / 360.0;
+    // --- Step 3b: Decelerate in time to stop at a no-traverse zone boundary ---
+    applyNoTraverseBraking(controller, state, finalAzVelocity, finalElVelocity);
 
+    // --- Step 4: Convert to servo steps and send commands (AZD-KD velocity mode) ---
     // Send velocity commands to AZD-KD drivers (Operation Type 16)
+    // Between updates an axis is re-sent at most once per servo command period
+    auto feedForwardDue = [force](const MotionTimer& sentTimer, double finalVelocity, double sentVelocity) {
+        if (force || !sentTimer.isValid()) return true;
+        return sentTimer.elapsed() >= RATE_FF_MIN_INTERVAL_MS
+               && std::abs(finalVelocity - sentVelocity) >= RATE_FF_DEADBAND_DPS;
+    };
     if (auto azServo = controller->azimuthServo()) {
-        writeVelocityCommand(azServo, finalAzVelocity, azStepsPerDegree);
+        if (feedForwardDue(m_velocityCommand.sentAzTimer, finalAzVelocity, m_velocityCommand.sentAz)) {
+            writeVelocityCommand(azServo, finalAzVelocity, AZ_STEPS_PER_DEGREE);
+            m_velocityCommand.sentAz = finalAzVelocity;
+            m_velocityCommand.sentAzTimer.start();
+        }
     }
     if (auto elServo = controller->elevationServo()) {
-        writeVelocityCommand(elServo, -finalElVelocity, elStepsPerDegree);
+        if (feedForwardDue(m_velocityCommand.sentElTimer, finalElVelocity, m_velocityCommand.sentEl)) {
+            writeVelocityCommand(elServo, -finalElVelocity, EL_STEPS_PER_DEGREE);
+            m_velocityCommand.sentEl = finalElVelocity;
+            m_velocityCommand.sentElTimer.start();
+        }
+    }
+}
+
+double GimbalMotionModeBase::brakingSpeedLimit(double distanceDeg, double decelerationDegS2)
+{
+    if (std::isinf(distanceDeg)) return distanceDeg;
+    if (distanceDeg <= 0.0 || decelerationDegS2 <= 0.0) return 0.0;
+
+    // v * t + v² / (2a) = d, with t the command period before braking takes effect
+    const double t = UPDATE_INTERVAL_S;
+    const double a = decelerationDegS2;
+    return a * (std::sqrt(t * t + 2.0 * distanceDeg / a) - t);
+}
+
+void GimbalMotionModeBase::applyNoTraverseBraking(GimbalController* controller, const SystemStateData& state,
+                                                  double& azVelocity, double& elVelocity) const
+{
+    const SystemStateModel* stateModel = controller->systemStateModel();
+    if (!stateModel || stateModel->zoneGeometry().zoneCount(ZoneType::NoTraverse) == 0) return;
+
+    const ZoneGeometryService::BoundaryDistance distance =
+        stateModel->zoneGeometry().distanceToBoundary(ZoneType::NoTraverse,
+                                                      static_cast<float>(state.gimbalAz),
+                                                      static_cast<float>(state.gimbalEl));
+    // Already inside: leave the operator free to drive out
+    if (distance.inside) return;
+
+    // Stop just short of the boundary: zone limits are inclusive, and a gimbal resting
+    // exactly on one would count as inside and no longer be held back
+    const double decel = DeviceConfiguration::gimbal().acceleration;
+    if (azVelocity > 0.0) {
+        azVelocity = std::min(azVelocity, brakingSpeedLimit(distance.azIncreasing - NTZ_STOP_MARGIN_DEG, decel));
+    } else if (azVelocity < 0.0) {
+        azVelocity = std::max(azVelocity, -brakingSpeedLimit(distance.azDecreasing - NTZ_STOP_MARGIN_DEG, decel));
+    }
+    if (elVelocity > 0.0) {
+        elVelocity = std::min(elVelocity, brakingSpeedLimit(distance.elUp - NTZ_STOP_MARGIN_DEG, decel));
+    } else if (elVelocity < 0.0) {
+        elVelocity = std::max(elVelocity, -brakingSpeedLimit(distance.elDown - NTZ_STOP_MARGIN_DEG, decel));
     }
 }
 
@@ -165,6 +260,214 @@ double GimbalMotionModeBase::pidCompute(PIDController& pid, double error, double
     return proportional + integral + derivative;
 }
 
+void GimbalMotionModeBase::loadGains(PIDController& pid, const DeviceConfiguration::PidGainConfig& gains)
+{
+    pid.Kp = gains.kp;
+    pid.Ki = gains.ki;
+    pid.Kd = gains.kd;
+}
+
+ScanTrajectory::Limits GimbalMotionModeBase::trajectoryLimits(double pathSpeedDegS)
+{
+    ScanTrajectory::Limits limits;
+    limits.maxVelocity = qMin(pathSpeedDegS, MAX_VELOCITY);
+    limits.maxAcceleration = DeviceConfiguration::gimbal().acceleration;
+    limits.maxJerk = DeviceConfiguration::gimbal().jerk;
+    return limits;
+}
+
+void GimbalMotionModeBase::followTrajectory(GimbalController* controller, const ScanTrajectory::Sample& reference,
+                                            PIDController& azPid, PIDController& elPid)
+{
+    auto stateModel = controller->systemStateModel();
+    SystemStateData data = stateModel->data();
+
+    double desiredAzVelocity = reference.azVelocity;
+    double desiredElVelocity = reference.elVelocity;
+
+    if (data.imuConnected) {
+        // The planned point is the world-frame target: stabilization holds the gimbal on it
+        double worldAz, worldEl;
+        convertGimbalToWorldFrame(reference.az, reference.el,
+                                  data.imuRollDeg, data.imuPitchDeg, data.imuYawDeg,
+                                  worldAz, worldEl);
+        SystemStateData updatedState = data;
+        updatedState.targetAzimuth_world = worldAz;
+        updatedState.targetElevation_world = worldEl;
+        updatedState.useWorldFrameTarget = true;
+        stateModel->updateData(updatedState);
+    }
+
+    if (!(data.imuConnected && data.enableStabilization)) {
+        // No position loop in the stabilizer: close the error to the planned point here
+        double errAz = reference.az - data.gimbalAz;
+        while (errAz > 180.0)  errAz -= 360.0;
+        while (errAz < -180.0) errAz += 360.0;
+        const double errEl = reference.el - data.gimbalEl;
+
+        desiredAzVelocity += qBound(-TRAJECTORY_MAX_CORRECTION_DPS, pidCompute(azPid, errAz, UPDATE_INTERVAL_S),
+                                    TRAJECTORY_MAX_CORRECTION_DPS);
+        desiredElVelocity += qBound(-TRAJECTORY_MAX_CORRECTION_DPS, pidCompute(elPid, errEl, UPDATE_INTERVAL_S),
+                                    TRAJECTORY_MAX_CORRECTION_DPS);
+    }
+
+    sendStabilizedServoCommands(controller, desiredAzVelocity, desiredElVelocity, true);
+}
+
+// =========================================================================
+// SERVO POSITION-MODE OFFLOAD
+// =========================================================================
+
+bool GimbalMotionModeBase::canOffloadPositionMove(GimbalController* controller) const
+{
+    if (!controller || !DeviceConfiguration::gimbal().servoPositionMode) return false;
+    if (!controller->azimuthServo() || !controller->elevationServo()) return false;
+
+    const SystemStateData data = controller->systemStateModel()->data();
+    if (!data.azServoConnected || !data.elServoConnected) return false;
+
+    // The drivers hold platform-frame positions: only valid while nothing needs stabilizing
+    const bool stabilizing = data.enableStabilization && data.imuConnected;
+    return !stabilizing || data.isVehicleStationary;
+}
+
+bool GimbalMotionModeBase::startPositionMove(GimbalController* controller, double targetAz, double targetEl,
+                                             double speedDegS, double accelerationDegS2)
+{
+    if (!canOffloadPositionMove(controller) || speedDegS <= 0.0 || accelerationDegS2 <= 0.0) {
+        endPositionMove(controller);
+        return false;
+    }
+
+    const SystemStateModel* stateModel = controller->systemStateModel();
+    const SystemStateData data = stateModel->data();
+    targetEl = qBound(MIN_ELEVATION_ANGLE, targetEl, MAX_ELEVATION_ANGLE);
+    const double deltaAz = wrapDegrees180(targetAz - data.gimbalAz);
+    const double deltaEl = targetEl - data.gimbalEl;
+
+    // The axes run independently, so the path stays within the az/el box of the move.
+    // Moves near no-traverse zones stay on the host loop, which brakes at the boundary.
+    const ZoneGeometryService::SweepHit hit =
+        stateModel->zoneGeometry().sweepBand(ZoneType::NoTraverse,
+                                             static_cast<float>(data.gimbalAz), static_cast<float>(deltaAz),
+                                             static_cast<float>(std::min(data.gimbalEl, targetEl)),
+                                             static_cast<float>(std::max(data.gimbalEl, targetEl)));
+    if (hit.hit) {
+        qDebug() << "[Gimbal] Position move crosses no-traverse zone" << hit.zoneId << "- using velocity loop";
+        endPositionMove(controller);
+        return false;
+    }
+
+    // Share speed and acceleration by axis so both trapezoids finish together (straight az/el line)
+    const double length = std::hypot(deltaAz, deltaEl);
+    const double speed = std::min(speedDegS, MAX_VELOCITY);
+    const double azShare = length > 1e-9 ? std::abs(deltaAz) / length : 1.0;
+    const double elShare = length > 1e-9 ? std::abs(deltaEl) / length : 1.0;
+
+    // Absolute targets relative to the current count, taking the shortest way round in azimuth
+    const qint32 azSteps = static_cast<qint32>(std::lround((data.gimbalAz + deltaAz) * AZ_STEPS_PER_DEGREE));
+    const qint32 elSteps = static_cast<qint32>(std::lround(-targetEl * EL_STEPS_PER_DEGREE));
+    auto speedHz = [](double degS, double stepsPerDegree) {
+        return std::max<qint32>(1, static_cast<qint32>(degS * stepsPerDegree));
+    };
+    auto rateHz = [](double degS2, double stepsPerDegree) {
+        return std::max<quint32>(1, static_cast<quint32>(degS2 * stepsPerDegree));
+    };
+
+    writeDirectDataOperation(controller->azimuthServo(), AzdReg::TypeAbsolutePositioning, azSteps,
+                             speedHz(speed * azShare, AZ_STEPS_PER_DEGREE),
+                             rateHz(accelerationDegS2 * azShare, AZ_STEPS_PER_DEGREE));
+    writeDirectDataOperation(controller->elevationServo(), AzdReg::TypeAbsolutePositioning, elSteps,
+                             speedHz(speed * elShare, EL_STEPS_PER_DEGREE),
+                             rateHz(accelerationDegS2 * elShare, EL_STEPS_PER_DEGREE));
+
+    m_positionMove.active = true;
+    m_velocityCommand.active = false;   // No rate feed-forward while the drivers position
+    m_positionMove.targetAz = data.gimbalAz + deltaAz;
+    m_positionMove.targetEl = targetEl;
+    m_positionMove.timeoutS = 2.0 * trapezoidDuration(length, speed, accelerationDegS2)
+                              + POSITION_MOVE_TIMEOUT_MARGIN_S;
+    m_positionMove.timer.start();
+    return true;
+}
+
+GimbalMotionModeBase::PositionMoveStatus GimbalMotionModeBase::supervisePositionMove(GimbalController* controller)
+{
+    if (!m_positionMove.active) return PositionMoveStatus::Idle;
+
+    const char* reason = nullptr;
+    if (!checkSafetyConditions(controller)) {
+        reason = "safety conditions";
+    } else if (!canOffloadPositionMove(controller)) {
+        reason = "stabilization required or servo lost";
+    }
+
+    const SystemStateData data = controller->systemStateModel()->data();
+    const bool arrived = std::abs(wrapDegrees180(m_positionMove.targetAz - data.gimbalAz)) < POSITION_MOVE_ARRIVAL_DEG &&
+                         std::abs(m_positionMove.targetEl - data.gimbalEl) < POSITION_MOVE_ARRIVAL_DEG;
+    if (!reason && !arrived && m_positionMove.timer.elapsed() > m_positionMove.timeoutS * 1000.0) {
+        reason = "timeout";
+    }
+
+    if (reason) {
+        qWarning() << "[Gimbal] Position move aborted:" << reason;
+        endPositionMove(controller);
+        return PositionMoveStatus::Aborted;
+    }
+    return arrived ? PositionMoveStatus::Arrived : PositionMoveStatus::Moving;
+}
+
+void GimbalMotionModeBase::endPositionMove(GimbalController* controller)
+{
+    if (!m_positionMove.active || !controller) return;
+    m_positionMove.active = false;
+
+    // A continuous operation at 0 Hz stops at the configured rate and re-arms speed updates
+    const double decel = DeviceConfiguration::gimbal().acceleration;
+    writeDirectDataOperation(controller->azimuthServo(), AzdReg::TypeContinuousSpeed, 0, 0,
+                             static_cast<quint32>(decel * AZ_STEPS_PER_DEGREE));
+    writeDirectDataOperation(controller->elevationServo(), AzdReg::TypeContinuousSpeed, 0, 0,
+                             static_cast<quint32>(decel * EL_STEPS_PER_DEGREE));
+}
+
+bool GimbalMotionModeBase::startOffloadedScan(GimbalController* controller, OffloadedScan& scan)
+{
+    scan.index = 0;
+    scan.holding = false;
+    if (scan.waypoints.empty()) return false;
+    const ScanWaypoint& first = scan.waypoints.front();
+    return startPositionMove(controller, first.az, first.el, scan.speedDegS,
+                             DeviceConfiguration::gimbal().acceleration);
+}
+
+bool GimbalMotionModeBase::runOffloadedScan(GimbalController* controller, OffloadedScan& scan)
+{
+    if (scan.waypoints.empty() || scan.index < 0) return false;
+
+    switch (supervisePositionMove(controller)) {
+    case PositionMoveStatus::Moving:
+        return true;
+    case PositionMoveStatus::Arrived:
+        break;
+    default:
+        return false;
+    }
+
+    // Dwell at the waypoint, then hand the drivers the next move
+    if (!scan.holding) {
+        scan.holding = true;
+        scan.holdTimer.start();
+    }
+    if (scan.holdTimer.elapsed() < scan.waypoints[scan.index].holdS * 1000.0) return true;
+    if (scan.waypoints.size() == 1) return true;    // Nowhere else to go: the driver holds it
+
+    scan.holding = false;
+    scan.index = (scan.index + 1) % static_cast<int>(scan.waypoints.size());
+    const ScanWaypoint& next = scan.waypoints[scan.index];
+    return startPositionMove(controller, next.az, next.el, scan.speedDegS,
+                             DeviceConfiguration::gimbal().acceleration);
+}
+
 // Implementation of the original, simpler PID function (overload)
 // This function now calls the more advanced one with the correct parameters.
 double GimbalMotionModeBase::pidCompute(PIDController& pid, double error, double dt)
@@ -286,79 +589,6 @@ bool GimbalMotionModeBase::checkElevationLimits(double currentEl, double targetV
     return true;
 }
 
-void GimbalMotionModeBase::calculateStabilizationCorrection(double currentAz_deg, double currentEl_deg,
-                                                            double gyroX_dps_raw, double gyroY_dps_raw, double gyroZ_dps_raw,
-                                                            double& azCorrection_dps, double& elCorrection_dps)
-{
-    // === START OF DIAGNOSTIC LOGGING ===
-    // Use a static variable to log only every Nth frame to avoid flooding the console.
-    static int logCounter = 0;
-    const int LOG_INTERVAL = 50; // Log every 5th call (20 times per second)
-
-    bool shouldLog = (logCounter++ % LOG_INTERVAL == 0); 
-
-    // Validate inputs
-    if (std::isnan(gyroX_dps_raw) || std::isnan(gyroY_dps_raw) || std::isnan(gyroZ_dps_raw) ||
-        std::isnan(currentAz_deg) || std::isnan(currentEl_deg)) {
-        azCorrection_dps = 0.0;
-        elCorrection_dps = 0.0;
-        return;
-    }
-    // Apply bias correction
-    double gyroX_dps_corrected = gyroX_dps_raw - m_gyroBiasX;
-    double gyroY_dps_corrected = gyroY_dps_raw - m_gyroBiasY;
-    double gyroZ_dps_corrected = gyroZ_dps_raw - m_gyroBiasZ;
-    //  Filter the raw DPS data ---
-    double gyroX_dps_filtered = m_gyroXFilter.update(gyroX_dps_corrected);
-    double gyroY_dps_filtered = m_gyroYFilter.update(gyroY_dps_corrected);
-    double gyroZ_dps_filtered = m_gyroZFilter.update(gyroZ_dps_corrected);
-
-    // Map to platform motion axes (p, q, r)
-    const double p_imu = gyroY_dps_filtered; // Roll
-    const double q_imu = gyroX_dps_filtered; // Pitch
-    const double r_imu = gyroZ_dps_filtered; // Yaw
-
-    // Get current gimbal angles in radians
-    const double currentAzRad = degToRad(currentAz_deg);
-    const double currentElRad = degToRad(currentEl_deg);
-
-    // Apply full kinematic transformation
-    double platformEffectOnEl = (q_imu * cos(currentAzRad)) - (p_imu * sin(currentAzRad));
-
-    double tanEl = tan(currentElRad); // Calculate tan() once
-    double platformEffectOnAz;
-    if (qAbs(cos(currentElRad)) < 1e-6) {
-        platformEffectOnAz = r_imu;
-    } else {
-        platformEffectOnAz = r_imu + tanEl * (q_imu * sin(currentAzRad) + p_imu * cos(currentAzRad));
-    }
-
-    // The correction is the negative of the platform's effect
-    azCorrection_dps = -platformEffectOnAz;
-    elCorrection_dps = -platformEffectOnEl;
-
-    // --- DETAILED LOGGING OUTPUT ---
-    if (shouldLog) {
-        // Use fixed-point notation for easy comparison
-        qDebug().noquote().nospace()
-            << "StabIn(GYRO):"
-            << " X=" << QString::number(gyroX_dps_raw, 'f', 2)
-            << " Y=" << QString::number(gyroY_dps_raw, 'f', 2)
-            << " Z=" << QString::number(gyroZ_dps_raw, 'f', 2)
-            << " | ElAngle=" << QString::number(currentEl_deg, 'f', 1)
-            << " tan(El)=" << QString::number(tanEl, 'f', 2)
-            << " | StabOut(CORR):"
-            << " Az=" << QString::number(azCorrection_dps, 'f', 2)
-            << " El=" << QString::number(elCorrection_dps, 'f', 2);
-    }
-    // ================================
-
-    // Limit the correction velocity
-    const double MAX_CORRECTION_DPS = 5.0;
-    azCorrection_dps = qBound(-MAX_CORRECTION_DPS, azCorrection_dps, MAX_CORRECTION_DPS);
-    elCorrection_dps = qBound(-MAX_CORRECTION_DPS, elCorrection_dps, MAX_CORRECTION_DPS);
-}
-
 // =========================================================================
 // AHRS-BASED WORLD-FRAME STABILIZATION FUNCTIONS
 // =========================================================================
@@ -504,71 +734,8 @@ void GimbalMotionModeBase::calculateHybridStabilizationCorrection(
         positionCorrectionEl_dps = qBound(-MAX_POSITION_VEL, positionCorrectionEl_dps, MAX_POSITION_VEL);
     }
 
-    // ========================================
-    // LAYER 2: VELOCITY FEEDFORWARD (Gyro-based)
-    // Compensates for platform rotation
-    // ========================================
-    double velocityCorrectionAz_dps = 0.0;
-    double velocityCorrectionEl_dps = 0.0;
-
-    if (state.imuConnected) {
-        // Validate gyro inputs
-        if (std::isnan(state.GyroX) || std::isnan(state.GyroY) || std::isnan(state.GyroZ)) {
-            velocityCorrectionAz_dps = 0.0;
-            velocityCorrectionEl_dps = 0.0;
-        } else {
-            // Apply bias correction
-            double gyroX_corrected = state.GyroX - m_gyroBiasX;
-            double gyroY_corrected = state.GyroY - m_gyroBiasY;
-            double gyroZ_corrected = state.GyroZ - m_gyroBiasZ;
-
-            // Filter gyro rates
-            double gyroX_filtered = m_gyroXFilter.update(gyroX_corrected);
-            double gyroY_filtered = m_gyroYFilter.update(gyroY_corrected);
-            double gyroZ_filtered = m_gyroZFilter.update(gyroZ_corrected);
-
-            // Map to platform axes
-            // TODO: VERIFY THIS MAPPING WITH PHYSICAL IMU ORIENTATION!
-            // Current assumption: IMU X=platform forward, Y=right, Z=up
-            const double p_imu = gyroX_filtered; // Roll rate (rotation around X)
-            const double q_imu = gyroY_filtered; // Pitch rate (rotation around Y)
-            const double r_imu = gyroZ_filtered; // Yaw rate (rotation around Z)
-
-            // Kinematic transformation
-            const double currentAzRad = degToRad(state.gimbalAz);
-            const double currentElRad = degToRad(state.gimbalEl);
-
-            double platformEffectOnEl = (q_imu * cos(currentAzRad)) - (p_imu * sin(currentAzRad));
-
-            double tanEl = tan(currentElRad);
-            double platformEffectOnAz;
-            if (qAbs(cos(currentElRad)) < 1e-6) {
-                platformEffectOnAz = r_imu;
-            } else {
-                platformEffectOnAz = r_imu + tanEl * (q_imu * sin(currentAzRad) + p_imu * cos(currentAzRad));
-            }
-
-            // Negate to get correction
-            velocityCorrectionAz_dps = -platformEffectOnAz;
-            velocityCorrectionEl_dps = -platformEffectOnEl;
-
-            // Limit velocity correction
-            const double MAX_VELOCITY_CORR = 5.0;  // deg/s
-            velocityCorrectionAz_dps = qBound(-MAX_VELOCITY_CORR, velocityCorrectionAz_dps, MAX_VELOCITY_CORR);
-            velocityCorrectionEl_dps = qBound(-MAX_VELOCITY_CORR, velocityCorrectionEl_dps, MAX_VELOCITY_CORR);
-        }
-    }
-
-    // ========================================
-    // COMBINE BOTH LAYERS
-    // ========================================
-    azCorrection_dps = positionCorrectionAz_dps + velocityCorrectionAz_dps;
-    elCorrection_dps = positionCorrectionEl_dps + velocityCorrectionEl_dps;
-
-    // Final safety limit
-    const double MAX_TOTAL_VEL = 12.0;  // deg/s
-    azCorrection_dps = qBound(-MAX_TOTAL_VEL, azCorrection_dps, MAX_TOTAL_VEL);
-    elCorrection_dps = qBound(-MAX_TOTAL_VEL, elCorrection_dps, MAX_TOTAL_VEL);
+    azCorrection_dps = positionCorrectionAz_dps;
+    elCorrection_dps = positionCorrectionEl_dps;
 
     // Diagnostic logging (every 50th call)
     static int logCounter = 0;
@@ -577,9 +744,7 @@ void GimbalMotionModeBase::calculateHybridStabilizationCorrection(
             << "[HybridStab] TargetWorld: Az=" << QString::number(state.targetAzimuth_world, 'f', 1)
             << "° El=" << QString::number(state.targetElevation_world, 'f', 1)
             << "° | PosCorr: Az=" << QString::number(positionCorrectionAz_dps, 'f', 2)
-            << " El=" << QString::number(positionCorrectionEl_dps, 'f', 2)
-            << " | VelCorr: Az=" << QString::number(velocityCorrectionAz_dps, 'f', 2)
-            << " El=" << QString::number(velocityCorrectionEl_dps, 'f', 2);
+            << " El=" << QString::number(positionCorrectionEl_dps, 'f', 2);
     }
 }
 
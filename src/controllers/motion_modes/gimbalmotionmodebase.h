@@ -1,61 +1,23 @@
 #ifndef GIMBALMOTIONMODEBASE_H
 #define GIMBALMOTIONMODEBASE_H
 
+#include "motionclock.h"
 #include <QObject>
 #include <QtMath>
+#include "controllers/deviceconfiguration.h"
 #include "models/domain/systemstatedata.h" // Include for SystemStateData
+#include "ratestabilizer.h"
+#include "scantrajectory.h"
 
 // Forward declare GimbalController
 class GimbalController;
 
-// Low-pass filter class for gyroscope data
-class GyroLowPassFilter {
-private:
-    double alpha;           // Filter coefficient (0 < alpha < 1)
-    double filteredValue;   // Current filtered value
-    bool initialized;       // Whether filter has been initialized
-
-public:
-    GyroLowPassFilter(double cutoffFreq = 10.0, double sampleRate = 100.0) : initialized(false) {
-        // Calculate alpha from cutoff frequency and sample rate
-        // alpha = dt / (RC + dt), where RC = 1 / (2 * pi * cutoff_freq)
-        double dt = 1.0 / sampleRate;
-        double RC = 1.0 / (2.0 * M_PI * cutoffFreq);
-        alpha = dt / (RC + dt);
-
-        // Clamp alpha to reasonable bounds
-        alpha = qBound(0.01, alpha, 0.99);
-    }
-
-    double update(double newValue) {
-        if (!initialized) {
-            filteredValue = newValue;
-            initialized = true;
-            return filteredValue;
-        }
-
-        // Low-pass filter: y[n] = alpha * x[n] + (1 - alpha) * y[n-1]
-        filteredValue = alpha * newValue + (1.0 - alpha) * filteredValue;
-        return filteredValue;
-    }
-
-    void reset() {
-        initialized = false;
-        filteredValue = 0.0;
-    }
-
-    bool isInitialized() const { return initialized; }
-};
-
 class GimbalMotionModeBase : public QObject
 {
     Q_OBJECT
 public:
     explicit GimbalMotionModeBase(QObject* parent = nullptr)
         : QObject(parent)
-        , m_gyroXFilter(5.0, 100.0)  // 5Hz cutoff, 100Hz sample rate (matches IMU 3DM-GX3-25)
-        , m_gyroYFilter(5.0, 100.0)
-        , m_gyroZFilter(5.0, 100.0)
     {}
 
     virtual ~GimbalMotionModeBase() = default;
@@ -71,11 +33,12 @@ public:
     void stopServos(GimbalController* controller);
     bool checkSafetyConditions(GimbalController* controller);
     /**
-     * @brief Updates the Z-axis gyro bias if the vehicle is stationary.
-     * This function should be called periodically from the main controller loop.
-     * @param systemState The current system state data.
+     * @brief Re-sends the last stabilized velocity command with the current rate feed-forward.
+     *        Called by GimbalController for every IMU sample between update() calls; an axis
+     *        is only written when its command moved by more than RATE_FF_DEADBAND_DPS and
+     *        RATE_FF_MIN_INTERVAL_MS has passed since its last write.
      */
-    void updateGyroBias(const SystemStateData& systemState);
+    void applyRateFeedForward(GimbalController* controller);
 
     /**
      * @brief Converts gimbal angles from platform frame to world frame.
@@ -105,6 +68,24 @@ protected:
                                  double desiredAzVelocity,
                                  double desiredElVelocity,
                                  bool enableStabilization = true);
+
+    /**
+     * @brief Limits velocities so the gimbal can still stop before a no-traverse zone.
+     *        Uses the zone distance field and the configured gimbal deceleration;
+     *        motion away from a zone, or out of one, is never limited.
+     * @param controller Pointer to the GimbalController to access the zone index.
+     * @param state Current system state (gimbal position).
+     * @param azVelocity Azimuth velocity in deg/s, clamped in place.
+     * @param elVelocity Elevation velocity in deg/s, clamped in place.
+     */
+    void applyNoTraverseBraking(GimbalController* controller, const SystemStateData& state,
+                                double& azVelocity, double& elVelocity) const;
+
+    /**
+     * @brief Highest speed from which the gimbal stops within distanceDeg, allowing
+     *        for one command period of reaction time before it starts braking.
+     */
+    static double brakingSpeedLimit(double distanceDeg, double decelerationDegS2);
     // --- UNIFIED PID CONTROLLER ---
     struct PIDController {
         double Kp = 0.0;
@@ -128,9 +109,77 @@ protected:
     };
     double pidCompute(PIDController& pid, double error, double setpoint, double measurement, bool derivativeOnMeasurement, double dt);
 
+    // Loads one loop's gains from gimbal.tuning; the integral limit stays with the mode
+    static void loadGains(PIDController& pid, const DeviceConfiguration::PidGainConfig& gains);
+
     // We can provide a convenient overload for the old "derivative on error" method
     // This way, you don't have to change your existing code in the scanning modes.
     double pidCompute(PIDController& pid, double error, double dt);
+
+    /**
+     * @brief Executes one step of a planned scan trajectory.
+     *        The planned velocity is sent as feed-forward. The remaining position error is
+     *        closed by the world-frame stabilization loop when it is active, otherwise by a
+     *        bounded correction from the given PIDs.
+     * @param controller Pointer to the GimbalController.
+     * @param reference Trajectory sample for the current time.
+     */
+    void followTrajectory(GimbalController* controller, const ScanTrajectory::Sample& reference,
+                          PIDController& azPid, PIDController& elPid);
+
+    /**
+     * @brief Trajectory limits from the gimbal configuration for a given path speed.
+     */
+    static ScanTrajectory::Limits trajectoryLimits(double pathSpeedDegS);
+
+    // --- SERVO POSITION-MODE OFFLOAD ---
+    enum class PositionMoveStatus { Idle, Moving, Arrived, Aborted };
+
+    /**
+     * @brief Whether a move may run in the drivers' internal position loop instead of
+     *        the host velocity loop: enabled by gimbal.servoPositionMode, both servos
+     *        connected, and no host stabilization needed (off, no IMU, or vehicle stationary).
+     */
+    bool canOffloadPositionMove(GimbalController* controller) const;
+
+    /**
+     * @brief Sends one absolute positioning operation (position, speed, acceleration) to
+     *        each driver. Axis speeds are scaled so both axes arrive together.
+     *        Refused when the az/el extent of the move touches a no-traverse zone.
+     * @return True if the drivers took over the move.
+     */
+    bool startPositionMove(GimbalController* controller, double targetAz, double targetEl,
+                           double speedDegS, double accelerationDegS2);
+
+    /**
+     * @brief Supervises the running move: completion, safety conditions, zones and timeout.
+     *        On Arrived the drivers hold the target in position mode until endPositionMove();
+     *        on Aborted they have already been stopped and returned to velocity mode.
+     */
+    PositionMoveStatus supervisePositionMove(GimbalController* controller);
+
+    /**
+     * @brief Stops any position move and returns both drivers to continuous velocity mode.
+     */
+    void endPositionMove(GimbalController* controller);
+    bool isPositionMoveActive() const { return m_positionMove.active; }
+
+    // Waypoint cycle executed as consecutive driver-side moves, dwelling at each waypoint
+    struct OffloadedScan {
+        std::vector<ScanWaypoint> waypoints;
+        double speedDegS = 0.0;
+        int index = -1;             // Waypoint being approached, or held at
+        bool holding = false;
+        MotionTimer holdTimer;
+    };
+    bool startOffloadedScan(GimbalController* controller, OffloadedScan& scan);
+
+    /**
+     * @brief Advances an offloaded scan by one supervision step.
+     * @return False once the scan can no longer run in position mode; the drivers are
+     *         then in velocity mode and the caller continues with the host loop.
+     */
+    bool runOffloadedScan(GimbalController* controller, OffloadedScan& scan);
     // Helper methods for common operations
     //       double joystickInput, quint16 angularVelocity);
 
@@ -144,6 +193,14 @@ protected:
      */
     void configureVelocityMode(class ServoDriverDevice* driverInterface);
 
+    /**
+     * @brief Writes a complete AZD direct data operation in one Modbus request and starts it.
+     * @param operationType 1 = absolute positioning, 16 = continuous operation (speed control).
+     * @param rateHzPerS Acceleration and deceleration rate in Hz/s.
+     */
+    void writeDirectDataOperation(class ServoDriverDevice* driverInterface, quint32 operationType,
+                                  qint32 positionSteps, qint32 speedHz, quint32 rateHzPerS);
+
     /**
      * @brief Writes a new speed command to the driver in real-time.
      * @param finalVelocity The calculated velocity in degrees/second.
@@ -173,6 +230,10 @@ protected:
     static constexpr double MAX_ELEVATION_ANGLE = 50.0;
     static constexpr double MAX_VELOCITY = 30.0; // General velocity limit deg/s
 
+    // Encoder resolution: steps per degree of gimbal motion (elevation counts are inverted)
+    static constexpr double AZ_STEPS_PER_DEGREE = 222500.0 / 360.0;
+    static constexpr double EL_STEPS_PER_DEGREE = 200000.0 / 360.0;
+
     // Scaling factors
     static constexpr float SPEED_SCALING_FACTOR_SCAN = 250.0f;
     static constexpr float SPEED_SCALING_FACTOR_TRP_SCAN = 250.0f;
@@ -180,21 +241,43 @@ protected:
     // Common PID/Scan constants
     static constexpr double ARRIVAL_THRESHOLD_DEG = 0.5;   // How close to consider a point "reached"
     static constexpr double UPDATE_INTERVAL_S = 0.05;      // 50ms update interval
+    static constexpr double NTZ_STOP_MARGIN_DEG = 0.1;     // Braking target short of a no-traverse boundary
+    static constexpr double TRAJECTORY_MAX_CORRECTION_DPS = 3.0; // Feedback on top of a planned velocity
+    static constexpr double POSITION_MOVE_ARRIVAL_DEG = 0.05;   // Driver-side moves settle on the encoder
+    static constexpr double POSITION_MOVE_TIMEOUT_MARGIN_S = 2.0;
+    static constexpr double RATE_FF_DEADBAND_DPS = 0.05;    // Smallest change re-sent between updates
+    static constexpr qint64 RATE_FF_MIN_INTERVAL_MS = 20;   // Servo command period (active poll interval)
+    static constexpr quint32 VELOCITY_MODE_RATE_HZ_PER_S = 150000;  // Velocity mode accel/decel
 
 private:
     // Helper for angle conversions
     static inline double degToRad(double deg) { return deg * (M_PI / 180.0); }
     static inline double radToDeg(double rad) { return rad * (180.0 / M_PI); }
 
-    // Gyro filters for stabilization
-    GyroLowPassFilter m_gyroXFilter;
-    GyroLowPassFilter m_gyroYFilter;
-    GyroLowPassFilter m_gyroZFilter;
-
-    // Gyro bias
-    double m_gyroBiasX = 0.0;
-    double m_gyroBiasY = 0.0;
-    double m_gyroBiasZ = 0.0;
+    // Last velocity command of the mode; the rate feed-forward is merged in at send time
+    struct VelocityCommand {
+        bool active = false;        // Drivers are in velocity mode following this command
+        bool stabilized = false;
+        double azDps = 0.0;         // Mode command (world-frame rate)
+        double elDps = 0.0;
+        double azPositionCorrection = 0.0;  // AHRS position layer, refreshed each update()
+        double elPositionCorrection = 0.0;
+        double sentAz = 0.0;        // Last velocities written to the drivers
+        double sentEl = 0.0;
+        MotionTimer sentAzTimer;    // Since the last write per axis
+        MotionTimer sentElTimer;
+    };
+    VelocityCommand m_velocityCommand;
+
+    // Driver-side move currently supervised
+    struct PositionMove {
+        bool active = false;
+        double targetAz = 0.0;
+        double targetEl = 0.0;
+        double timeoutS = 0.0;
+        MotionTimer timer;
+    };
+    PositionMove m_positionMove;
 
     /**
      * @brief Calculates required gimbal angles to point at a world-frame target.
@@ -211,7 +294,8 @@ private:
                                        double& required_gimbal_az, double& required_gimbal_el);
 
     /**
-     * @brief Hybrid stabilization: combines position control (AHRS) + velocity feedforward (gyros).
+     * @brief Position layer of the hybrid stabilization: holds the world-frame target (AHRS).
+     *        The gyro velocity layer comes from the controller's RateStabilizer at send time.
      * @param state Current system state with IMU data and gimbal angles
      * @param azCorrection_dps Output azimuth correction velocity (deg/s)
      * @param elCorrection_dps Output elevation correction velocity (deg/s)
@@ -219,9 +303,12 @@ private:
     void calculateHybridStabilizationCorrection(const SystemStateData& state,
                                                 double& azCorrection_dps, double& elCorrection_dps);
 
-    void calculateStabilizationCorrection(double currentAz_deg, double currentEl_deg,
-                                                            double gyroX_dps_raw, double gyroY_dps_raw, double gyroZ_dps_raw,
-                                                            double& azCorrection_dps, double& elCorrection_dps);
+    /**
+     * @brief Merges the stored command with the rate feed-forward, applies the velocity
+     *        limits and no-traverse braking, and writes the axes that need it.
+     * @param force Write both axes regardless of the deadband (the mode's own update).
+     */
+    void writeVelocityCommands(GimbalController* controller, const SystemStateData& state, bool force);
 };
 
 #endif // GIMBALMOTIONMO
@@ -0,0 +1,39 @@
+#include "motionclock.h"
+#include "utils/latencyhistogram.h"
+
+#include <atomic>
+
+namespace {
+std::atomic<bool> s_simulated{false};
+std::atomic<qint64> s_simulatedNs{0};
+}
+
+qint64 MotionClock::nowNs()
+{
+    return s_simulated.load(std::memory_order_relaxed) ? s_simulatedNs.load(std::memory_order_relaxed)
+                                                       : FrameLatencyMonitor::nowNs();
+}
+
+void MotionClock::setSimulatedTimeNs(qint64 ns)
+{
+    s_simulatedNs.store(ns, std::memory_order_relaxed);
+    s_simulated.store(true, std::memory_order_relaxed);
+}
+
+void MotionClock::useRealTime()
+{
+    s_simulated.store(false, std::memory_order_relaxed);
+}
+
+bool MotionClock::isSimulated()
+{
+    return s_simulated.load(std::memory_order_relaxed);
+}
+
+qint64 MotionTimer::restart()
+{
+    const qint64 now = MotionClock::nowNs();
+    const qint64 elapsedMs = isValid() ? (now - m_startNs) / 1000000 : 0;
+    m_startNs = now;
+    return elapsedMs;
+}
@@ -0,0 +1,41 @@
+#ifndef MOTIONCLOCK_H
+#define MOTIONCLOCK_H
+
+#include <QtGlobal>
+
+/**
+ * @brief Time base of the motion modes and the target filter.
+ *
+ * CLOCK_MONOTONIC (same as FrameLatencyMonitor::nowNs(), so frame capture
+ * timestamps compare directly) unless a simulation drives it: the gimbal
+ * simulation runner sets simulated time so scenarios run faster than real
+ * time through the unmodified mode code.
+ */
+class MotionClock
+{
+public:
+    static qint64 nowNs();
+
+    static void setSimulatedTimeNs(qint64 ns);     // Switches to simulated time
+    static void useRealTime();
+    static bool isSimulated();
+};
+
+/**
+ * @brief QElapsedTimer subset on MotionClock.
+ */
+class MotionTimer
+{
+public:
+    void start() { m_startNs = MotionClock::nowNs(); }
+    qint64 restart();                               // Elapsed ms, then starts again
+    qint64 elapsed() const { return nsecsElapsed() / 1000000; }
+    qint64 nsecsElapsed() const { return isValid() ? MotionClock::nowNs() - m_startNs : 0; }
+    bool isValid() const { return m_startNs >= 0; }
+    void invalidate() { m_startNs = -1; }
+
+private:
+    qint64 m_startNs = -1;
+};
+
+#endif // MOTIONCLOCK_H
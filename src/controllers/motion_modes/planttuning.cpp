@@ -0,0 +1,230 @@
+#include "planttuning.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+constexpr size_t kMinFitSamples = 40;
+constexpr double kSimulationStepS = 0.001;
+}
+
+// =========================== AxisIdentifier ===========================
+
+void AxisIdentifier::clear()
+{
+    m_commands.clear();
+    m_positions.clear();
+}
+
+void AxisIdentifier::addCommand(double timeS, double velocityDegS)
+{
+    m_commands.push_back({timeS, velocityDegS});
+}
+
+void AxisIdentifier::addPosition(double timeS, double positionDeg)
+{
+    if (!m_positions.empty() && timeS <= m_positions.back().t)
+        return;     // Reads are only useful in arrival order
+    m_positions.push_back({timeS, positionDeg});
+}
+
+AxisPlantModel AxisIdentifier::fit(double sampleS, double maxDeadTimeS) const
+{
+    AxisPlantModel model;
+    if (sampleS <= 0.0 || m_commands.empty() || m_positions.size() < 2)
+        return model;
+
+    const double t0 = std::max(m_commands.front().t, m_positions.front().t);
+    const double t1 = m_positions.back().t;
+    if (t1 <= t0)
+        return model;
+    const size_t n = static_cast<size_t>((t1 - t0) / sampleS) + 1;
+    const int maxDelay = std::max(0, static_cast<int>(std::lround(maxDeadTimeS / sampleS)));
+    if (n < static_cast<size_t>(maxDelay) + kMinFitSamples)
+        return model;
+
+    // Uniform grid: positions interpolated, commands held
+    std::vector<double> theta(n), u(n);
+    size_t p = 0, c = 0;
+    for (size_t k = 0; k < n; ++k) {
+        const double t = t0 + static_cast<double>(k) * sampleS;
+        while (p + 2 < m_positions.size() && m_positions[p + 1].t <= t)
+            ++p;
+        const Point &a = m_positions[p];
+        const Point &b = m_positions[p + 1];
+        const double alpha = std::clamp((t - a.t) / (b.t - a.t), 0.0, 1.0);
+        theta[k] = a.value + alpha * (b.value - a.value);
+
+        while (c + 1 < m_commands.size() && m_commands[c + 1].t <= t)
+            ++c;
+        u[k] = m_commands[c].value;
+    }
+
+    std::vector<double> increment(n - 1);
+    for (size_t k = 0; k + 1 < n; ++k)
+        increment[k] = theta[k + 1] - theta[k];
+
+    double bestRms = std::numeric_limits<double>::infinity();
+    for (int d = 0; d <= maxDelay; ++d) {
+        // Normal equations of y = a x1 + b x2
+        double s11 = 0.0, s12 = 0.0, s22 = 0.0, s1y = 0.0, s2y = 0.0;
+        for (size_t k = static_cast<size_t>(d); k + 1 < increment.size(); ++k) {
+            const double x1 = increment[k];
+            const double x2 = u[k - d];
+            const double y = increment[k + 1];
+            s11 += x1 * x1;
+            s12 += x1 * x2;
+            s22 += x2 * x2;
+            s1y += x1 * y;
+            s2y += x2 * y;
+        }
+        const double det = s11 * s22 - s12 * s12;
+        if (std::abs(det) < 1e-12)
+            continue;
+        const double a = (s22 * s1y - s12 * s2y) / det;
+        const double b = (s11 * s2y - s12 * s1y) / det;
+        if (a < 0.0 || a >= 1.0 || b <= 0.0)
+            continue;   // Not a stable lag with positive gain
+
+        double sse = 0.0;
+        size_t rows = 0;
+        for (size_t k = static_cast<size_t>(d); k + 1 < increment.size(); ++k, ++rows) {
+            const double r = increment[k + 1] - a * increment[k] - b * u[k - d];
+            sse += r * r;
+        }
+        const double rms = std::sqrt(sse / static_cast<double>(rows));
+        if (rms < bestRms) {
+            bestRms = rms;
+            model.timeConstantS = a > 1e-6 ? -sampleS / std::log(a) : 0.0;
+            model.gain = b / ((1.0 - a) * sampleS);
+            // The increment over [k+1, k+2] first sees a command issued at k - d
+            model.deadTimeS = (d + 1) * sampleS;
+            model.fitRmsDeg = rms;
+            model.valid = true;
+        }
+    }
+    return model;
+}
+
+// =========================== PidTuner ===========================
+
+PidTuner::LoopProfile PidTuner::profile(Loop loop)
+{
+    switch (loop) {
+    case Loop::Tracking:  return {"tracking", 2.0, 10.0};
+    case Loop::RadarSlew: return {"radarSlew", 4.0, 30.0};     // Inside the slew deceleration distance
+    case Loop::ScanTrim:  return {"scanTrim", 1.0, 0.0};
+    }
+    return {"", 1.0, 0.0};
+}
+
+double PidTuner::closedLoopTimeConstant(Loop loop)
+{
+    switch (loop) {
+    case Loop::Tracking:  return 6.5;   // Video measurements are noisy: smooth, low bandwidth
+    case Loop::RadarSlew: return 0.57;  // Fast approach, integral removes the final offset
+    case Loop::ScanTrim:  return 0.9;   // Trims the planned trajectory only
+    }
+    return 1.0;
+}
+
+double PidTuner::integralTimeFactor(Loop loop)
+{
+    switch (loop) {
+    case Loop::Tracking:  return 4.0;
+    case Loop::RadarSlew: return 28.0;
+    case Loop::ScanTrim:  return 0.0;
+    }
+    return 4.0;
+}
+
+PidGains PidTuner::tune(const AxisPlantModel &plant, Loop loop)
+{
+    PidGains gains;
+    if (!plant.valid || plant.gain <= 0.0)
+        return gains;
+
+    const double tauC = closedLoopTimeConstant(loop);
+    const double kc = 1.0 / (plant.gain * (tauC + plant.deadTimeS));
+    const double ti = integralTimeFactor(loop) * (tauC + plant.deadTimeS);
+    const double td = plant.timeConstantS;
+
+    if (ti <= 0.0) {
+        gains.kp = kc;
+        return gains;
+    }
+    // Series PID Kc (1 + 1/(Ti s)) (1 + Td s) in parallel form
+    gains.kp = kc * (1.0 + td / ti);
+    gains.ki = kc / ti;
+    gains.kd = kc * td;
+    return gains;
+}
+
+// =========================== AxisPlantSimulator ===========================
+
+AxisPlantSimulator::AxisPlantSimulator(const AxisPlantModel &plant, double controlPeriodS, double maxVelocityDegS)
+    : m_plant(plant)
+    , m_controlPeriodS(controlPeriodS)
+    , m_maxVelocityDegS(maxVelocityDegS)
+{
+}
+
+AxisPlantSimulator::StepMetrics AxisPlantSimulator::stepResponse(const PidGains &gains, double stepDeg,
+                                                                 double durationS, double maxIntegral) const
+{
+    StepMetrics metrics;
+    const double target = std::abs(stepDeg);
+    if (target <= 0.0 || durationS <= 0.0)
+        return metrics;
+
+    const double h = kSimulationStepS;
+    const long steps = static_cast<long>(durationS / h);
+    const long controlEvery = std::max(1L, std::lround(m_controlPeriodS / h));
+    const double dt = controlEvery * h;
+
+    // Dead time as a FIFO of per-step commands
+    std::vector<double> pipeline(static_cast<size_t>(std::lround(m_plant.deadTimeS / h)) + 1, 0.0);
+    size_t head = 0;
+
+    const double band = std::max(SettlingBandFraction * target, MinSettlingBandDeg);
+    double theta = 0.0, omega = 0.0, command = 0.0;
+    double integral = 0.0, previousError = 0.0;
+    double peak = 0.0, t10 = -1.0, t90 = -1.0, lastOutside = 0.0;
+
+    for (long i = 0; i < steps; ++i) {
+        const double t = i * h;
+        const double error = target - theta;
+
+        if (i % controlEvery == 0) {
+            integral = std::clamp(integral + error * dt, -maxIntegral, maxIntegral);
+            command = gains.kp * error + gains.ki * integral + gains.kd * (error - previousError) / dt;
+            command = std::clamp(command, -m_maxVelocityDegS, m_maxVelocityDegS);
+            previousError = error;
+        }
+
+        pipeline[head] = command;
+        head = (head + 1) % pipeline.size();
+        const double applied = pipeline[head];     // Oldest entry: issued deadTime ago
+
+        if (m_plant.timeConstantS > h)
+            omega += h * (m_plant.gain * applied - omega) / m_plant.timeConstantS;
+        else
+            omega = m_plant.gain * applied;
+        theta += h * omega;
+
+        metrics.iaeDegS += std::abs(error) * h;
+        metrics.peakVelocityDegS = std::max(metrics.peakVelocityDegS, std::abs(omega));
+        peak = std::max(peak, theta);
+        if (t10 < 0.0 && theta >= 0.1 * target) t10 = t;
+        if (t90 < 0.0 && theta >= 0.9 * target) t90 = t;
+        if (std::abs(target - theta) > band) lastOutside = t + h;
+    }
+
+    metrics.overshootPct = std::max(0.0, (peak - target) / target * 100.0);
+    metrics.riseTimeS = (t10 >= 0.0 && t90 >= 0.0) ? t90 - t10 : durationS;
+    metrics.finalErrorDeg = target - theta;
+    metrics.settled = std::abs(metrics.finalErrorDeg) <= band;
+    metrics.settlingTimeS = metrics.settled ? lastOutside : durationS;
+    return metrics;
+}
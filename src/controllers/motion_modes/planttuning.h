@@ -0,0 +1,125 @@
+#ifndef PLANTTUNING_H
+#define PLANTTUNING_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Identified model of one velocity-commanded gimbal axis.
+ *
+ * The AZD drivers close their own speed loop, so seen from the host a
+ * commanded velocity u reaches the axis after a dead time (bus write, poll and
+ * driver latency) and a first-order lag:
+ *     w' = (K u(t - Td) - w) / tau,    theta' = w
+ */
+struct AxisPlantModel {
+    double gain = 1.0;              // K, achieved / commanded velocity
+    double timeConstantS = 0.05;    // tau
+    double deadTimeS = 0.1;         // Td
+    double fitRmsDeg = 0.0;         // One-step prediction residual of the fit
+    bool valid = false;
+};
+
+struct PidGains {
+    double kp = 0.0;
+    double ki = 0.0;
+    double kd = 0.0;
+};
+
+/**
+ * @brief Fits an AxisPlantModel to a recorded excitation experiment.
+ *
+ * Commands are held until the next one (zero-order hold) and positions are
+ * encoder reads time-stamped on arrival. Both are resampled onto a uniform
+ * grid and the per-sample position increment is fitted as an ARX model
+ *     dTheta[k+1] = a dTheta[k] + b u[k - d]
+ * by least squares for every candidate delay d; the delay with the smallest
+ * residual wins. tau and K follow from a and b.
+ */
+class AxisIdentifier
+{
+public:
+    void clear();
+    void addCommand(double timeS, double velocityDegS);
+    void addPosition(double timeS, double positionDeg);
+
+    size_t positionCount() const { return m_positions.size(); }
+
+    AxisPlantModel fit(double sampleS, double maxDeadTimeS) const;
+
+private:
+    struct Point {
+        double t = 0.0;
+        double value = 0.0;
+    };
+
+    std::vector<Point> m_commands;
+    std::vector<Point> m_positions;
+};
+
+/**
+ * @brief Gains for each motion-mode loop from an identified plant.
+ *
+ * SIMC rules for an integrating plant with lag and dead time, with the
+ * desired closed-loop time constant tauC per loop:
+ *     Kc = 1 / (K (tauC + Td)),  Ti = f (tauC + Td),  Td' = tau
+ * converted to the parallel form used by GimbalMotionModeBase::pidCompute.
+ * f = 4 is the SIMC value; the slew loop uses a longer integral time to keep
+ * overshoot low. tauC and f reproduce the hand-tuned gains on the nominal
+ * plant (K = 1, Td = 0.1 s); scan trim is proportional only.
+ */
+class PidTuner
+{
+public:
+    enum class Loop { Tracking, RadarSlew, ScanTrim };
+    static constexpr Loop Loops[] = {Loop::Tracking, Loop::RadarSlew, Loop::ScanTrim};
+
+    struct LoopProfile {
+        const char *name;       // Key in gimbal.tuning
+        double stepDeg;         // Typical correction, used to compare gains
+        double maxIntegral;     // Integral clamp of the motion mode
+    };
+
+    static LoopProfile profile(Loop loop);
+    static double closedLoopTimeConstant(Loop loop);
+    static double integralTimeFactor(Loop loop);    // 0 = no integral action
+    static PidGains tune(const AxisPlantModel &plant, Loop loop);
+};
+
+/**
+ * @brief Replays an identified plant in closed loop with a motion-mode PID.
+ *
+ * The PID runs at the motion-mode period with the same integral clamp and
+ * derivative-on-error form as pidCompute(); the plant is integrated at 1 kHz
+ * with its dead time. Runs much faster than real time, so gains can be
+ * compared without hardware.
+ */
+class AxisPlantSimulator
+{
+public:
+    struct StepMetrics {
+        double overshootPct = 0.0;
+        double riseTimeS = 0.0;         // 10% to 90%
+        double settlingTimeS = 0.0;     // Last exit from the settling band
+        double iaeDegS = 0.0;           // Integrated absolute error
+        double finalErrorDeg = 0.0;
+        double peakVelocityDegS = 0.0;
+        bool settled = false;
+    };
+
+    explicit AxisPlantSimulator(const AxisPlantModel &plant, double controlPeriodS = 0.05,
+                                double maxVelocityDegS = 30.0);
+
+    StepMetrics stepResponse(const PidGains &gains, double stepDeg, double durationS,
+                             double maxIntegral = 30.0) const;
+
+    static constexpr double SettlingBandFraction = 0.02;
+    static constexpr double MinSettlingBandDeg = 0.05;
+
+private:
+    AxisPlantModel m_plant;
+    double m_controlPeriodS;
+    double m_maxVelocityDegS;
+};
+
+#endif // PLANTTUNING_H
@@ -1,5 +1,6 @@
 #include "radarslewmotionmode.h"
 #include "controllers/gimbalcontroller.h" // For GimbalController and SystemStateData
+#include "controllers/deviceconfiguration.h"
 #include "models/domain/systemstatemodel.h" // For SimpleRadarPlot
 #include <QDebug>
 #include <cmath>
@@ -10,10 +11,10 @@ RadarSlewMotionMode::RadarSlewMotionMode(QObject* parent)
     m_currentTargetId(0),
     m_isSlewInProgress(false)
 {
-    // Configure PID gains for fast but stable slewing.
+    // PID gains for fast but stable slewing, per axis from gimbal.tuning.
     // These will likely be more aggressive than the TRP scan PIDs.
-    m_azPid.Kp = 1.5; m_azPid.Ki = 0.08; m_azPid.Kd = 0.15; m_azPid.maxIntegral = 30.0;
-    m_elPid.Kp = 1.5; m_elPid.Ki = 0.08; m_elPid.Kd = 0.15; m_elPid.maxIntegral = 30.0;
+    loadGains(m_azPid, DeviceConfiguration::gimbal().azimuthTuning.radarSlew); m_azPid.maxIntegral = 30.0;
+    loadGains(m_elPid, DeviceConfiguration::gimbal().elevationTuning.radarSlew); m_elPid.maxIntegral = 30.0;
 }
 
 void RadarSlewMotionMode::enterMode(GimbalController* controller)
@@ -41,6 +42,7 @@ void RadarSlewMotionMode::enterMode(GimbalController* controller)
 void RadarSlewMotionMode::exitMode(GimbalController* controller)
 {
     qDebug() << "[RadarSlewMotionMode] Exit.";
+    endPositionMove(controller);
     stopServos(controller);
 }
 
@@ -51,6 +53,7 @@ void RadarSlewMotionMode::update(GimbalController* controller)
     if (!checkSafetyConditions(controller)) {
         if (m_isSlewInProgress) {
             qWarning() << "[RadarSlewMotionMode] Safety condition failed during slew. Stopping.";
+            endPositionMove(controller);
             stopServos(controller);
             m_isSlewInProgress = false;
         }
@@ -81,8 +84,15 @@ void RadarSlewMotionMode::update(GimbalController* controller)
             m_previousDesiredElVel = 0.0;
 
             qDebug() << "[RadarSlewMotionMode] Target set to Az:" << m_targetAz << "| Calculated El:" << m_targetEl;
+
+            // Whole slew as one driver-side move when possible; the host only supervises it
+            if (startPositionMove(controller, m_targetAz, m_targetEl, CRUISE_SPEED_DEGS,
+                                  DeviceConfiguration::gimbal().acceleration)) {
+                qDebug() << "[RadarSlewMotionMode] Slew offloaded to servo position mode";
+            }
         } else {
             qWarning() << "[RadarSlewMotionMode] Could not find commanded target ID" << m_currentTargetId << "in model data. Slew aborted.";
+            endPositionMove(controller);
             m_isSlewInProgress = false;
             m_currentTargetId = 0;
         }
@@ -109,6 +119,25 @@ void RadarSlewMotionMode::update(GimbalController* controller)
         stateModel->updateData(updatedState);
     }
 
+    if (isPositionMoveActive()) {
+        switch (supervisePositionMove(controller)) {
+        case PositionMoveStatus::Moving:
+            return;
+        case PositionMoveStatus::Arrived:
+            qInfo() << "[RadarSlewMotionMode] Arrived at target ID:" << m_currentTargetId;
+            endPositionMove(controller);
+            m_isSlewInProgress = false;
+            return;
+        default:
+            // Finish the slew on the host velocity loop from wherever the gimbal is now
+            m_azPid.reset();
+            m_elPid.reset();
+            m_previousDesiredAzVel = 0.0;
+            m_previousDesiredElVel = 0.0;
+            break;
+        }
+    }
+
     // Calculate error to the target
     double errAz = m_targetAz - data.gimbalAz; // Azimuth still uses encoder
     double errEl = m_targetEl - data.imuPitchDeg; // Elevation now uses IMU Pitch
@@ -133,7 +162,6 @@ void RadarSlewMotionMode::update(GimbalController* controller)
 
     // Define constants for motion profiling
     static const double DECELERATION_DISTANCE_DEG = 5.0;  // Start decelerating when within 5 degrees
-    static const double CRUISE_SPEED_DEGS = 12.0;         // Cruise speed for slewing
     static const double MAX_VELOCITY_CHANGE = 3.0;        // Maximum velocity change per update cycle
 
     if (distanceToTarget < DECELERATION_DISTANCE_DEG) {
@@ -30,6 +30,7 @@ private:
     double m_previousDesiredElVel = 0.0;
     // Motion parameters
     static constexpr double MAX_SLEW_SPEED_DEGS = 25.0; // Max speed for slewing to cue
+    static constexpr double CRUISE_SPEED_DEGS = 12.0;   // Cruise speed for slewing
     static constexpr float SYSTEM_HEIGHT_METERS = 15.0f; // Example height of the system for El calculation
 };
 
@@ -0,0 +1,83 @@
+#include "ratestabilizer.h"
+
+#include <QDebug>
+#include <cmath>
+
+RateStabilizer::RateStabilizer(double sampleRateHz, double cutoffHz)
+    : m_gyroXFilter(cutoffHz, sampleRateHz)
+    , m_gyroYFilter(cutoffHz, sampleRateHz)
+    , m_gyroZFilter(cutoffHz, sampleRateHz)
+{
+}
+
+void RateStabilizer::addSample(double gyroX_dps, double gyroY_dps, double gyroZ_dps, bool vehicleStationary)
+{
+    if (std::isnan(gyroX_dps) || std::isnan(gyroY_dps) || std::isnan(gyroZ_dps)) {
+        return;
+    }
+
+    // Only estimate bias if the vehicle is stationary
+    if (vehicleStationary) {
+        m_sumX += gyroX_dps;
+        m_sumY += gyroY_dps;
+        m_sumZ += gyroZ_dps;
+        if (++m_biasCount >= BiasSampleCount) {
+            m_biasX = m_sumX / m_biasCount;
+            m_biasY = m_sumY / m_biasCount;
+            m_biasZ = m_sumZ / m_biasCount;
+            m_sumX = m_sumY = m_sumZ = 0.0;
+            m_biasCount = 0;
+            qDebug() << "[Gimbal] New Gyro Bias - X:" << m_biasX << "Y:" << m_biasY << "Z:" << m_biasZ;
+        }
+    } else {
+        m_sumX = m_sumY = m_sumZ = 0.0;
+        m_biasCount = 0;
+    }
+
+    m_gyroXFilter.update(gyroX_dps - m_biasX);
+    m_gyroYFilter.update(gyroY_dps - m_biasY);
+    m_gyroZFilter.update(gyroZ_dps - m_biasZ);
+}
+
+void RateStabilizer::reset()
+{
+    m_gyroXFilter.reset();
+    m_gyroYFilter.reset();
+    m_gyroZFilter.reset();
+    m_sumX = m_sumY = m_sumZ = 0.0;
+    m_biasCount = 0;
+}
+
+void RateStabilizer::feedForward(double gimbalAz_deg, double gimbalEl_deg,
+                                 double& azCorrection_dps, double& elCorrection_dps) const
+{
+    azCorrection_dps = 0.0;
+    elCorrection_dps = 0.0;
+    if (!hasSample() || std::isnan(gimbalAz_deg) || std::isnan(gimbalEl_deg)) {
+        return;
+    }
+
+    // Map to platform axes
+    // TODO: VERIFY THIS MAPPING WITH PHYSICAL IMU ORIENTATION!
+    // Current assumption: IMU X=platform forward, Y=right, Z=up
+    const double p_imu = m_gyroXFilter.value(); // Roll rate (rotation around X)
+    const double q_imu = m_gyroYFilter.value(); // Pitch rate (rotation around Y)
+    const double r_imu = m_gyroZFilter.value(); // Yaw rate (rotation around Z)
+
+    // Kinematic transformation
+    const double currentAzRad = qDegreesToRadians(gimbalAz_deg);
+    const double currentElRad = qDegreesToRadians(gimbalEl_deg);
+
+    const double platformEffectOnEl = (q_imu * std::cos(currentAzRad)) - (p_imu * std::sin(currentAzRad));
+
+    double platformEffectOnAz;
+    if (qAbs(std::cos(currentElRad)) < 1e-6) {
+        platformEffectOnAz = r_imu;
+    } else {
+        platformEffectOnAz = r_imu + std::tan(currentElRad) * (q_imu * std::sin(currentAzRad) + p_imu * std::cos(currentAzRad));
+    }
+
+    // Negate to get correction
+    azCorrection_dps = qBound(-MaxCorrectionDps, -platformEffectOnAz, MaxCorrectionDps);
+    elCorrection_dps = qBound(-MaxCorrectionDps, -platformEffectOnEl, MaxCorrectionDps);
+}
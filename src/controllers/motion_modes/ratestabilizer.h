@@ -0,0 +1,95 @@
+#ifndef RATESTABILIZER_H
+#define RATESTABILIZER_H
+
+#include <QtMath>
+
+// Low-pass filter class for gyroscope data
+class GyroLowPassFilter {
+private:
+    double alpha;           // Filter coefficient (0 < alpha < 1)
+    double filteredValue;   // Current filtered value
+    bool initialized;       // Whether filter has been initialized
+
+public:
+    GyroLowPassFilter(double cutoffFreq = 10.0, double sampleRate = 100.0) : initialized(false) {
+        // Calculate alpha from cutoff frequency and sample rate
+        // alpha = dt / (RC + dt), where RC = 1 / (2 * pi * cutoff_freq)
+        double dt = 1.0 / sampleRate;
+        double RC = 1.0 / (2.0 * M_PI * cutoffFreq);
+        alpha = dt / (RC + dt);
+
+        // Clamp alpha to reasonable bounds
+        alpha = qBound(0.01, alpha, 0.99);
+    }
+
+    double update(double newValue) {
+        if (!initialized) {
+            filteredValue = newValue;
+            initialized = true;
+            return filteredValue;
+        }
+
+        // Low-pass filter: y[n] = alpha * x[n] + (1 - alpha) * y[n-1]
+        filteredValue = alpha * newValue + (1.0 - alpha) * filteredValue;
+        return filteredValue;
+    }
+
+    double value() const { return initialized ? filteredValue : 0.0; }
+
+    void reset() {
+        initialized = false;
+        filteredValue = 0.0;
+    }
+
+    bool isInitialized() const { return initialized; }
+};
+
+/**
+ * @brief Gyro rate feed-forward for line-of-sight stabilization, run at the IMU rate.
+ *
+ * Every IMU sample goes through addSample(): while the vehicle is stationary the
+ * rates are averaged into the gyro bias, otherwise the bias-corrected rates are
+ * low-pass filtered at the IMU sample rate the filters are designed for.
+ * feedForward() maps the filtered body rates (p, q, r) into the gimbal axes for
+ * the current pointing angles; the motion modes add it to their command each
+ * time one is written.
+ *
+ * Owned by GimbalController so the bias estimate and filter state survive mode
+ * changes.
+ */
+class RateStabilizer
+{
+public:
+    static constexpr double DefaultCutoffHz = 5.0;
+    static constexpr int BiasSampleCount = 50;          // Stationary samples per bias estimate
+    static constexpr double MaxCorrectionDps = 5.0;
+
+    explicit RateStabilizer(double sampleRateHz = 100.0, double cutoffHz = DefaultCutoffHz);
+
+    void addSample(double gyroX_dps, double gyroY_dps, double gyroZ_dps, bool vehicleStationary);
+    void reset();
+
+    // Gimbal-axis velocities (deg/s) that cancel the platform rotation, limited to MaxCorrectionDps
+    void feedForward(double gimbalAz_deg, double gimbalEl_deg,
+                     double& azCorrection_dps, double& elCorrection_dps) const;
+
+    bool hasSample() const { return m_gyroXFilter.isInitialized(); }
+    double biasX() const { return m_biasX; }
+    double biasY() const { return m_biasY; }
+    double biasZ() const { return m_biasZ; }
+
+private:
+    GyroLowPassFilter m_gyroXFilter;
+    GyroLowPassFilter m_gyroYFilter;
+    GyroLowPassFilter m_gyroZFilter;
+
+    double m_biasX = 0.0;
+    double m_biasY = 0.0;
+    double m_biasZ = 0.0;
+    double m_sumX = 0.0;
+    double m_sumY = 0.0;
+    double m_sumZ = 0.0;
+    int m_biasCount = 0;
+};
+
+#endif // RATESTABILIZER_H
@@ -0,0 +1,180 @@
+#include "scantrajectory.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+double wrapDegrees180(double deg)
+{
+    deg = std::fmod(deg + 180.0, 360.0);
+    if (deg < 0.0)
+        deg += 360.0;
+    return deg - 180.0;
+}
+}
+
+// =========================== SCurveProfile ===========================
+
+void SCurveProfile::plan(double distance, double maxVelocity, double maxAcceleration, double maxJerk)
+{
+    *this = SCurveProfile();
+    m_distance = std::abs(distance);
+    if (m_distance <= 0.0 || maxVelocity <= 0.0 || maxAcceleration <= 0.0 || maxJerk <= 0.0)
+        return;
+
+    m_jerk = maxJerk;
+
+    // Acceleration phase reaching maxVelocity: with or without a constant-acceleration part
+    if (maxVelocity * maxJerk >= maxAcceleration * maxAcceleration) {
+        m_jerkTime = maxAcceleration / maxJerk;
+        m_accelTime = m_jerkTime + maxVelocity / maxAcceleration;
+    } else {
+        m_jerkTime = std::sqrt(maxVelocity / maxJerk);
+        m_accelTime = 2.0 * m_jerkTime;
+    }
+    m_peakAccel = m_jerk * m_jerkTime;
+    m_peakVelocity = m_peakAccel * (m_accelTime - m_jerkTime);
+
+    // Accelerating and braking symmetrically covers peakVelocity * Ta
+    if (m_peakVelocity * m_accelTime <= m_distance) {
+        m_cruiseTime = (m_distance - m_peakVelocity * m_accelTime) / m_peakVelocity;
+    } else {
+        // Too short to reach maxVelocity: D = a (Ta - Tj) Ta
+        m_jerkTime = maxAcceleration / maxJerk;
+        m_accelTime = 0.5 * (m_jerkTime + std::sqrt(m_jerkTime * m_jerkTime + 4.0 * m_distance / maxAcceleration));
+        if (m_accelTime < 2.0 * m_jerkTime) {
+            // Not even maxAcceleration is reached: D = 2 j Tj³
+            m_jerkTime = std::cbrt(m_distance / (2.0 * maxJerk));
+            m_accelTime = 2.0 * m_jerkTime;
+        }
+        m_peakAccel = m_jerk * m_jerkTime;
+        m_peakVelocity = m_peakAccel * (m_accelTime - m_jerkTime);
+        m_cruiseTime = 0.0;
+    }
+    m_duration = 2.0 * m_accelTime + m_cruiseTime;
+}
+
+void SCurveProfile::sampleAcceleration(double t, double &position, double &velocity) const
+{
+    const double tj = m_jerkTime;
+    if (t < tj) {
+        velocity = 0.5 * m_jerk * t * t;
+        position = m_jerk * t * t * t / 6.0;
+    } else if (t < m_accelTime - tj) {
+        velocity = m_peakAccel * (t - 0.5 * tj);
+        position = m_peakAccel / 6.0 * (3.0 * t * t - 3.0 * tj * t + tj * tj);
+    } else {
+        const double tau = m_accelTime - t;
+        velocity = m_peakVelocity - 0.5 * m_jerk * tau * tau;
+        position = m_peakVelocity * (t - 0.5 * m_accelTime) + m_jerk * tau * tau * tau / 6.0;
+    }
+}
+
+void SCurveProfile::sample(double t, double &position, double &velocity) const
+{
+    if (m_duration <= 0.0 || t >= m_duration) {
+        position = m_distance;
+        velocity = 0.0;
+        return;
+    }
+    t = std::max(t, 0.0);
+
+    if (t < m_accelTime) {
+        sampleAcceleration(t, position, velocity);
+    } else if (t < m_accelTime + m_cruiseTime) {
+        velocity = m_peakVelocity;
+        position = m_peakVelocity * (0.5 * m_accelTime + (t - m_accelTime));
+    } else {
+        // Braking mirrors the acceleration phase in time
+        sampleAcceleration(m_duration - t, position, velocity);
+        position = m_distance - position;
+    }
+}
+
+// =========================== ScanTrajectory ===========================
+
+ScanTrajectory::Segment ScanTrajectory::makeSegment(double fromAz, double fromEl, const ScanWaypoint &to,
+                                                    int index, const Limits &limits)
+{
+    Segment segment;
+    segment.fromAz = fromAz;
+    segment.fromEl = fromEl;
+    segment.holdS = std::max(to.holdS, 0.0);
+    segment.waypointIndex = index;
+
+    const double dAz = wrapDegrees180(to.az - fromAz);     // Shortest way round
+    const double dEl = to.el - fromEl;
+    const double length = std::hypot(dAz, dEl);
+    if (length > 1e-6) {
+        segment.unitAz = dAz / length;
+        segment.unitEl = dEl / length;
+        // Path limits such that neither axis exceeds its own acceleration and jerk limit
+        const double dominant = std::max(std::abs(segment.unitAz), std::abs(segment.unitEl));
+        segment.profile.plan(length, limits.maxVelocity,
+                             limits.maxAcceleration / dominant, limits.maxJerk / dominant);
+    }
+    segment.moveS = segment.profile.duration();
+    return segment;
+}
+
+void ScanTrajectory::clear()
+{
+    m_leadIn = Segment();
+    m_cycle.clear();
+    m_cycleDuration = 0.0;
+}
+
+void ScanTrajectory::plan(double startAz, double startEl, const std::vector<ScanWaypoint> &waypoints,
+                          const Limits &limits)
+{
+    clear();
+    if (waypoints.empty())
+        return;
+
+    m_leadIn = makeSegment(startAz, startEl, waypoints.front(), 0, limits);
+
+    const int count = static_cast<int>(waypoints.size());
+    double startS = 0.0;
+    for (int i = 0; i < count; ++i) {
+        const int next = (i + 1) % count;
+        Segment segment = makeSegment(waypoints[i].az, waypoints[i].el, waypoints[next], next, limits);
+        segment.startS = startS;
+        startS += segment.moveS + segment.holdS;
+        m_cycle.push_back(segment);
+    }
+    m_cycleDuration = startS;
+}
+
+ScanTrajectory::Sample ScanTrajectory::sampleSegment(const Segment &segment, double t)
+{
+    Sample sample;
+    sample.waypointIndex = segment.waypointIndex;
+    double position = 0.0, velocity = 0.0;
+    segment.profile.sample(t, position, velocity);
+    sample.az = segment.fromAz + segment.unitAz * position;
+    sample.el = segment.fromEl + segment.unitEl * position;
+    sample.azVelocity = segment.unitAz * velocity;
+    sample.elVelocity = segment.unitEl * velocity;
+    sample.holding = t >= segment.moveS;
+    return sample;
+}
+
+ScanTrajectory::Sample ScanTrajectory::sample(double t) const
+{
+    if (!isValid())
+        return Sample();
+
+    if (t < leadInDuration())
+        return sampleSegment(m_leadIn, t);
+
+    if (m_cycleDuration <= 0.0) {
+        // Single waypoint without dwell: stay there
+        return sampleSegment(m_cycle.front(), 0.0);
+    }
+
+    const double tc = std::fmod(t - leadInDuration(), m_cycleDuration);
+    auto it = std::upper_bound(m_cycle.begin(), m_cycle.end(), tc,
+                               [](double value, const Segment &segment) { return value < segment.startS; });
+    const Segment &segment = *std::prev(it);
+    return sampleSegment(segment, tc - segment.startS);
+}
@@ -0,0 +1,101 @@
+#ifndef SCANTRAJECTORY_H
+#define SCANTRAJECTORY_H
+
+#include <vector>
+
+/**
+ * @brief Rest-to-rest jerk-limited (S-curve) motion profile along one path.
+ *
+ * Seven phases: jerk up, constant acceleration, jerk down, cruise, and the
+ * mirror image for braking. Short moves that never reach the speed or
+ * acceleration limit drop the corresponding constant phases.
+ */
+class SCurveProfile
+{
+public:
+    void plan(double distance, double maxVelocity, double maxAcceleration, double maxJerk);
+
+    double duration() const { return m_duration; }
+    double distance() const { return m_distance; }
+
+    // Path position and velocity at time t (clamped to [0, duration])
+    void sample(double t, double &position, double &velocity) const;
+
+private:
+    void sampleAcceleration(double t, double &position, double &velocity) const;
+
+    double m_distance = 0.0;
+    double m_jerk = 0.0;
+    double m_jerkTime = 0.0;        // Tj, each jerk phase
+    double m_accelTime = 0.0;       // Ta, whole acceleration phase (= braking phase)
+    double m_cruiseTime = 0.0;      // Tv
+    double m_peakAccel = 0.0;
+    double m_peakVelocity = 0.0;
+    double m_duration = 0.0;
+};
+
+struct ScanWaypoint {
+    double az = 0.0;
+    double el = 0.0;
+    double holdS = 0.0;             // Dwell after arriving
+};
+
+/**
+ * @brief Precomputed scan path through az/el waypoints.
+ *
+ * plan() builds a lead-in move from the current gimbal position to the first
+ * waypoint, then a cycle visiting every waypoint and returning to the first,
+ * repeated indefinitely. Each move is a straight line in az/el (azimuth by the
+ * shortest way) with an S-curve profile, so the gimbal stops at every
+ * waypoint without the overshoot of a position loop. Motion modes execute it
+ * by time lookup and only close the remaining error with a small feedback term.
+ */
+class ScanTrajectory
+{
+public:
+    struct Limits {
+        double maxVelocity = 20.0;      // deg/s along the path
+        double maxAcceleration = 50.0;  // deg/s², per axis
+        double maxJerk = 200.0;         // deg/s³, per axis
+    };
+
+    struct Sample {
+        double az = 0.0;
+        double el = 0.0;
+        double azVelocity = 0.0;
+        double elVelocity = 0.0;
+        int waypointIndex = -1;         // Waypoint being approached, or held at
+        bool holding = false;
+    };
+
+    void plan(double startAz, double startEl, const std::vector<ScanWaypoint> &waypoints, const Limits &limits);
+    void clear();
+
+    bool isValid() const { return !m_cycle.empty(); }
+    double leadInDuration() const { return m_leadIn.moveS + m_leadIn.holdS; }
+    double cycleDuration() const { return m_cycleDuration; }
+
+    Sample sample(double t) const;
+
+private:
+    struct Segment {
+        double fromAz = 0.0;
+        double fromEl = 0.0;
+        double unitAz = 0.0;            // Direction of travel
+        double unitEl = 0.0;
+        SCurveProfile profile;
+        double startS = 0.0;            // Within the cycle
+        double moveS = 0.0;
+        double holdS = 0.0;
+        int waypointIndex = -1;
+    };
+
+    static Segment makeSegment(double fromAz, double fromEl, const ScanWaypoint &to, int index, const Limits &limits);
+    static Sample sampleSegment(const Segment &segment, double t);
+
+    Segment m_leadIn;
+    std::vector<Segment> m_cycle;
+    double m_cycleDuration = 0.0;
+};
+
+#endif // SCANTRAJECTORY_H
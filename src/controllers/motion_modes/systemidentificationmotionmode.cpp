@@ -0,0 +1,232 @@
+#include "systemidentificationmotionmode.h"
+#include "controllers/gimbalcontroller.h"
+#include "hardware/devices/servodriverdevice.h"
+#include "models/domain/systemstatemodel.h"
+#include "utils/pidtuningbenchmark.h"
+#include <QDebug>
+#include <cmath>
+
+namespace {
+constexpr double kComparisonDurationS = 60.0;
+
+void logComparison(const char* axis, const QJsonObject& comparison)
+{
+    const QJsonObject loops = comparison["loops"].toObject();
+    for (auto it = loops.begin(); it != loops.end(); ++it) {
+        const QJsonObject loop = it.value().toObject();
+        const QJsonObject gains = loop["retunedGains"].toObject();
+        const QJsonObject before = loop["configured"].toObject();
+        const QJsonObject after = loop["retuned"].toObject();
+        qInfo().noquote() << QString("[SystemIdentificationMotionMode] %1 %2: Kp %3 Ki %4 Kd %5 | "
+                                     "overshoot %6% -> %7%, settling %8 s -> %9 s")
+                                 .arg(axis, it.key())
+                                 .arg(gains["kp"].toDouble(), 0, 'f', 3)
+                                 .arg(gains["ki"].toDouble(), 0, 'f', 4)
+                                 .arg(gains["kd"].toDouble(), 0, 'f', 4)
+                                 .arg(before["overshootPct"].toDouble(), 0, 'f', 1)
+                                 .arg(after["overshootPct"].toDouble(), 0, 'f', 1)
+                                 .arg(before["settlingTimeS"].toDouble(), 0, 'f', 2)
+                                 .arg(after["settlingTimeS"].toDouble(), 0, 'f', 2);
+    }
+}
+}
+
+SystemIdentificationMotionMode::SystemIdentificationMotionMode(QObject* parent)
+    : GimbalMotionModeBase(parent)
+    , m_phase(Phase::Aborted)
+    , m_phaseStartS(0.0)
+    , m_lastUpdateS(0.0)
+    , m_azPositionDeg(0.0)
+    , m_elPositionDeg(0.0)
+    , m_phaseStartPositionDeg(0.0)
+    , m_relayUp(true)
+{
+}
+
+void SystemIdentificationMotionMode::enterMode(GimbalController* controller)
+{
+    qDebug() << "[SystemIdentificationMotionMode] Enter";
+    m_azIdentifier.clear();
+    m_elIdentifier.clear();
+
+    auto azServo = controller ? controller->azimuthServo() : nullptr;
+    auto elServo = controller ? controller->elevationServo() : nullptr;
+    if (!azServo || !elServo) {
+        m_phase = Phase::Aborted;
+        qWarning() << "[SystemIdentificationMotionMode] Both servos are required. Nothing to identify.";
+        return;
+    }
+
+    // Record every encoder read as it arrives
+    m_azPositionDeg = azServo->data()->position / AZ_STEPS_PER_DEGREE;
+    m_elPositionDeg = elServo->data()->position / EL_STEPS_PER_DEGREE;
+    m_azConnection = connect(azServo, &ServoDriverDevice::servoDataChanged, this,
+                             [this](const ServoDriverData& data) { recordPosition(true, data); });
+    m_elConnection = connect(elServo, &ServoDriverDevice::servoDataChanged, this,
+                             [this](const ServoDriverData& data) { recordPosition(false, data); });
+
+    m_clock.start();
+    startPhase(controller, Phase::AzimuthRelay);
+}
+
+void SystemIdentificationMotionMode::exitMode(GimbalController* controller)
+{
+    qDebug() << "[SystemIdentificationMotionMode] Exit";
+    disconnect(m_azConnection);
+    disconnect(m_elConnection);
+    if (m_phase != Phase::Done && m_phase != Phase::Aborted) {
+        qWarning() << "[SystemIdentificationMotionMode] Left before completion. Gains unchanged.";
+        m_phase = Phase::Aborted;
+    }
+    stopServos(controller);
+}
+
+void SystemIdentificationMotionMode::recordPosition(bool azimuth, const ServoDriverData& data)
+{
+    const double timeS = m_clock.nsecsElapsed() * 1e-9;
+    if (azimuth) {
+        m_azPositionDeg = data.position / AZ_STEPS_PER_DEGREE;
+        if (isAzimuthPhase()) m_azIdentifier.addPosition(timeS, m_azPositionDeg);
+    } else {
+        m_elPositionDeg = data.position / EL_STEPS_PER_DEGREE;
+        if (m_phase == Phase::ElevationRelay || m_phase == Phase::ElevationChirp)
+            m_elIdentifier.addPosition(timeS, m_elPositionDeg);
+    }
+}
+
+bool SystemIdentificationMotionMode::noTraverseZoneInReach(GimbalController* controller, bool azimuth) const
+{
+    const SystemStateModel* stateModel = controller->systemStateModel();
+    if (!stateModel || stateModel->zoneGeometry().zoneCount(ZoneType::NoTraverse) == 0) return false;
+
+    const SystemStateData data = stateModel->data();
+    const ZoneGeometryService::BoundaryDistance distance =
+        stateModel->zoneGeometry().distanceToBoundary(ZoneType::NoTraverse,
+                                                      static_cast<float>(data.gimbalAz),
+                                                      static_cast<float>(data.gimbalEl));
+    // Only the axis under test moves, at most MAX_EXCURSION_DEG either way
+    const double reach = MAX_EXCURSION_DEG + NTZ_STOP_MARGIN_DEG;
+    if (distance.inside) return true;
+    return azimuth ? (distance.azIncreasing < reach || distance.azDecreasing < reach)
+                   : (distance.elUp < reach || distance.elDown < reach);
+}
+
+void SystemIdentificationMotionMode::startPhase(GimbalController* controller, Phase phase)
+{
+    const bool azimuthPhase = phase == Phase::AzimuthRelay || phase == Phase::AzimuthChirp;
+    if (noTraverseZoneInReach(controller, azimuthPhase)) {
+        abort(controller, "no-traverse zone within the excursion limit");
+        return;
+    }
+
+    m_phase = phase;
+    m_phaseStartS = m_clock.nsecsElapsed() * 1e-9;
+    m_lastUpdateS = m_phaseStartS;
+    m_phaseStartPositionDeg = isAzimuthPhase() ? m_azPositionDeg : m_elPositionDeg;
+    m_relayUp = true;
+
+    // The axis not under test is held still
+    if (isAzimuthPhase()) {
+        writeVelocityCommand(controller->elevationServo(), 0.0, EL_STEPS_PER_DEGREE);
+    } else {
+        writeVelocityCommand(controller->azimuthServo(), 0.0, AZ_STEPS_PER_DEGREE);
+    }
+    qInfo() << "[SystemIdentificationMotionMode] Phase" << static_cast<int>(phase);
+}
+
+double SystemIdentificationMotionMode::excitation(double phaseTimeS, double positionDeg)
+{
+    if (isRelayPhase()) {
+        // Relay with hysteresis around the start position: a limit cycle near the crossover
+        const double offset = positionDeg - m_phaseStartPositionDeg;
+        if (offset > RELAY_HYSTERESIS_DEG) m_relayUp = false;
+        else if (offset < -RELAY_HYSTERESIS_DEG) m_relayUp = true;
+        return m_relayUp ? RELAY_AMPLITUDE_DEGS : -RELAY_AMPLITUDE_DEGS;
+    }
+
+    // Exponential chirp from CHIRP_START_HZ to CHIRP_END_HZ
+    const double ratio = CHIRP_END_HZ / CHIRP_START_HZ;
+    const double phase = 2.0 * M_PI * CHIRP_START_HZ * CHIRP_DURATION_S / std::log(ratio)
+                         * (std::pow(ratio, phaseTimeS / CHIRP_DURATION_S) - 1.0);
+    return CHIRP_AMPLITUDE_DEGS * std::sin(phase);
+}
+
+void SystemIdentificationMotionMode::update(GimbalController* controller)
+{
+    if (!controller) return;
+    if (m_phase == Phase::Done || m_phase == Phase::Aborted) {
+        stopServos(controller);
+        return;
+    }
+
+    const double nowS = m_clock.nsecsElapsed() * 1e-9;
+    if (nowS - m_lastUpdateS > MAX_UPDATE_GAP_S) {
+        abort(controller, "excitation interrupted");
+        return;
+    }
+    m_lastUpdateS = nowS;
+
+    const SystemStateData data = controller->systemStateModel()->data();
+    const bool azimuth = isAzimuthPhase();
+    const double position = azimuth ? m_azPositionDeg : m_elPositionDeg;
+    if (std::abs(position - m_phaseStartPositionDeg) > MAX_EXCURSION_DEG ||
+        data.gimbalEl > MAX_ELEVATION_ANGLE || data.gimbalEl < MIN_ELEVATION_ANGLE) {
+        abort(controller, "excursion limit");
+        return;
+    }
+
+    const double phaseTimeS = nowS - m_phaseStartS;
+    const double duration = isRelayPhase() ? RELAY_DURATION_S : CHIRP_DURATION_S;
+    if (phaseTimeS >= duration) {
+        switch (m_phase) {
+        case Phase::AzimuthRelay:   startPhase(controller, Phase::AzimuthChirp); break;
+        case Phase::AzimuthChirp:   startPhase(controller, Phase::ElevationRelay); break;
+        case Phase::ElevationRelay: startPhase(controller, Phase::ElevationChirp); break;
+        default:                    finish(controller); return;
+        }
+        return;
+    }
+
+    const double command = excitation(phaseTimeS, position);
+    if (azimuth) {
+        m_azIdentifier.addCommand(nowS, command);
+        writeVelocityCommand(controller->azimuthServo(), command, AZ_STEPS_PER_DEGREE);
+    } else {
+        m_elIdentifier.addCommand(nowS, command);
+        writeVelocityCommand(controller->elevationServo(), command, EL_STEPS_PER_DEGREE);
+    }
+}
+
+void SystemIdentificationMotionMode::abort(GimbalController* controller, const QString& reason)
+{
+    qWarning() << "[SystemIdentificationMotionMode] Aborted:" << reason << "- gains unchanged";
+    m_phase = Phase::Aborted;
+    stopServos(controller);
+}
+
+void SystemIdentificationMotionMode::finish(GimbalController* controller)
+{
+    stopServos(controller);
+
+    const AxisPlantModel azPlant = m_azIdentifier.fit(UPDATE_INTERVAL_S, MAX_DEAD_TIME_S);
+    const AxisPlantModel elPlant = m_elIdentifier.fit(UPDATE_INTERVAL_S, MAX_DEAD_TIME_S);
+    for (const auto& [axis, plant] : {std::pair{"Az", azPlant}, std::pair{"El", elPlant}}) {
+        qInfo().noquote() << QString("[SystemIdentificationMotionMode] %1 plant: valid %2 K %3 tau %4 s Td %5 s (fit rms %6 deg)")
+                                 .arg(axis).arg(plant.valid)
+                                 .arg(plant.gain, 0, 'f', 3).arg(plant.timeConstantS, 0, 'f', 3)
+                                 .arg(plant.deadTimeS, 0, 'f', 3).arg(plant.fitRmsDeg, 0, 'f', 4);
+    }
+    if (!azPlant.valid || !elPlant.valid) {
+        abort(controller, "plant fit failed");
+        return;
+    }
+
+    const auto& gimbalConf = DeviceConfiguration::gimbal();
+    logComparison("Az", PidTuningBenchmark::compareAxis(gimbalConf.azimuthTuning, azPlant, kComparisonDurationS));
+    logComparison("El", PidTuningBenchmark::compareAxis(gimbalConf.elevationTuning, elPlant, kComparisonDurationS));
+    DeviceConfiguration::setGimbalTuning(PidTuningBenchmark::retune(gimbalConf.azimuthTuning, azPlant),
+                                         PidTuningBenchmark::retune(gimbalConf.elevationTuning, elPlant));
+    DeviceConfiguration::saveGimbalTuning();
+    m_phase = Phase::Done;
+    qInfo() << "[SystemIdentificationMotionMode] Identification complete, gains applied to new motion modes";
+}
@@ -0,0 +1,81 @@
+#ifndef SYSTEMIDENTIFICATIONMOTIONMODE_H
+#define SYSTEMIDENTIFICATIONMOTIONMODE_H
+
+#include "gimbalmotionmodebase.h"
+#include "planttuning.h"
+#include "motionclock.h"
+
+struct ServoDriverData;
+
+/**
+ * @brief Identifies each gimbal axis and retunes the motion-mode PID loops.
+ *
+ * Excites one axis at a time with raw velocity commands (no stabilization):
+ * a relay around the start position, then an exponential chirp. Every encoder
+ * read from the ServoDriverDevice is recorded as it arrives, not just at the
+ * mode update rate. At the end each axis is fitted (AxisIdentifier), gains are
+ * computed for every loop (PidTuner), compared against the current gains on
+ * the fitted plant (AxisPlantSimulator) and saved to config/gimbal_tuning.json,
+ * which overlays gimbal.tuning from devices.json at load. Motion modes pick the
+ * new gains up the next time they start.
+ *
+ * Started from the main menu (SystemStateModel::startSystemIdentification()).
+ * The excitation bypasses the no-traverse braking of the other modes, so a
+ * phase is refused when a no-traverse zone lies within MAX_EXCURSION_DEG of
+ * the pose it starts from.
+ */
+class SystemIdentificationMotionMode : public GimbalMotionModeBase
+{
+    Q_OBJECT
+public:
+    explicit SystemIdentificationMotionMode(QObject* parent = nullptr);
+    ~SystemIdentificationMotionMode() override = default;
+
+    void enterMode(GimbalController* controller) override;
+    void exitMode(GimbalController* controller) override;
+    void update(GimbalController* controller) override;
+
+private:
+    enum class Phase { AzimuthRelay, AzimuthChirp, ElevationRelay, ElevationChirp, Done, Aborted };
+
+    void startPhase(GimbalController* controller, Phase phase);
+    bool noTraverseZoneInReach(GimbalController* controller, bool azimuth) const;
+    void recordPosition(bool azimuth, const ServoDriverData& data);
+    double excitation(double phaseTimeS, double positionDeg);
+    void abort(GimbalController* controller, const QString& reason);
+    void finish(GimbalController* controller);
+    bool isAzimuthPhase() const { return m_phase == Phase::AzimuthRelay || m_phase == Phase::AzimuthChirp; }
+    bool isRelayPhase() const { return m_phase == Phase::AzimuthRelay || m_phase == Phase::ElevationRelay; }
+
+    Phase m_phase;
+    MotionTimer m_clock;                // Time base for commands and encoder reads
+    double m_phaseStartS;
+    double m_lastUpdateS;
+
+    // Latest reads in driver frame (degrees, sign as commanded)
+    double m_azPositionDeg;
+    double m_elPositionDeg;
+    double m_phaseStartPositionDeg;
+    bool m_relayUp;
+
+    AxisIdentifier m_azIdentifier;
+    AxisIdentifier m_elIdentifier;
+    QMetaObject::Connection m_azConnection;
+    QMetaObject::Connection m_elConnection;
+
+    // Excitation
+    static constexpr double RELAY_AMPLITUDE_DEGS = 5.0;
+    static constexpr double RELAY_HYSTERESIS_DEG = 0.2;
+    static constexpr double RELAY_DURATION_S = 10.0;
+    static constexpr double CHIRP_AMPLITUDE_DEGS = 5.0;
+    static constexpr double CHIRP_START_HZ = 0.2;
+    static constexpr double CHIRP_END_HZ = 3.0;       // Command rate is 20 Hz
+    static constexpr double CHIRP_DURATION_S = 30.0;
+
+    // Supervision and fit
+    static constexpr double MAX_EXCURSION_DEG = 10.0;  // From the position the phase started at
+    static constexpr double MAX_UPDATE_GAP_S = 0.5;    // Safety stop or stalled loop: data unusable
+    static constexpr double MAX_DEAD_TIME_S = 0.5;
+};
+
+#endif // SYSTEMIDENTIFICATIONMOTIONMODE_H
@@ -0,0 +1,131 @@
+#include "targetstatefilter.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+constexpr double kNsToS = 1e-9;
+
+double wrapDegrees180(double deg)
+{
+    deg = std::fmod(deg + 180.0, 360.0);
+    if (deg < 0.0)
+        deg += 360.0;
+    return deg - 180.0;
+}
+}
+
+TargetStateFilter::TargetStateFilter()
+    : TargetStateFilter(Config())
+{
+}
+
+TargetStateFilter::TargetStateFilter(const Config &config)
+    : m_config(config)
+{
+    m_H(0, 0) = 1.0;
+    m_H(1, 2) = 1.0;
+    m_R = Eigen::Matrix2d::Identity() * (config.measurementNoise * config.measurementNoise);
+}
+
+void TargetStateFilter::reset()
+{
+    m_initialized = false;
+    m_x.setZero();
+    m_P.setIdentity();
+    m_stateNs = 0;
+    m_lastMeasurementNs = 0;
+    m_gateRejects = 0;
+}
+
+void TargetStateFilter::initialize(double az, double el, double azRate, double elRate, qint64 timestampNs)
+{
+    m_x << az, azRate, el, elRate;
+    const double posVar = m_config.measurementNoise * m_config.measurementNoise;
+    const double rateVar = m_config.initialRateStd * m_config.initialRateStd;
+    m_P = Vector4(posVar, rateVar, posVar, rateVar).asDiagonal();
+    m_stateNs = timestampNs;
+    m_lastMeasurementNs = timestampNs;
+    m_gateRejects = 0;
+    m_initialized = true;
+}
+
+void TargetStateFilter::transition(double dt, Matrix4 &F, Matrix4 &Q) const
+{
+    F.setIdentity();
+    F(0, 1) = dt;
+    F(2, 3) = dt;
+
+    // Continuous white-noise acceleration, per axis: q * [dt³/3 dt²/2; dt²/2 dt]
+    const double q = m_config.accelNoise;
+    const double dt2 = dt * dt;
+    Eigen::Matrix2d block;
+    block << q * dt2 * dt / 3.0, q * dt2 / 2.0,
+             q * dt2 / 2.0,      q * dt;
+    Q.setZero();
+    Q.block<2, 2>(0, 0) = block;
+    Q.block<2, 2>(2, 2) = block;
+}
+
+bool TargetStateFilter::update(double az, double el, qint64 timestampNs)
+{
+    if (!m_initialized) {
+        initialize(az, el, 0.0, 0.0, timestampNs);
+        return true;
+    }
+    if (timestampNs <= m_stateNs)
+        return false;   // Duplicate or out-of-order frame
+
+    // Predict to the measurement time
+    Matrix4 F, Q;
+    transition((timestampNs - m_stateNs) * kNsToS, F, Q);
+    m_x = F * m_x;
+    m_P = F * m_P * F.transpose() + Q;
+    m_stateNs = timestampNs;
+
+    // Innovation, with azimuth wrap-around
+    Eigen::Vector2d y(wrapDegrees180(az - m_x(0)), el - m_x(2));
+    const Eigen::Matrix2d S = m_H * m_P * m_H.transpose() + m_R;
+    const Eigen::Matrix2d Sinv = S.inverse();
+
+    if (y.dot(Sinv * y) > m_config.gateChi2) {
+        // Outlier (tracker jumped to clutter): keep coasting, re-acquire if it persists
+        if (++m_gateRejects < m_config.maxGateRejects)
+            return false;
+        initialize(az, el, 0.0, 0.0, timestampNs);
+        return true;
+    }
+    m_gateRejects = 0;
+
+    const Eigen::Matrix<double, 4, 2> K = m_P * m_H.transpose() * Sinv;
+    m_x += K * y;
+    // Joseph form keeps P symmetric positive definite
+    const Matrix4 IKH = Matrix4::Identity() - K * m_H;
+    m_P = IKH * m_P * IKH.transpose() + K * m_R * K.transpose();
+    m_x(0) = wrapDegrees180(m_x(0));
+    m_lastMeasurementNs = timestampNs;
+    return true;
+}
+
+bool TargetStateFilter::predict(qint64 timestampNs, double &az, double &el, double &azRate, double &elRate) const
+{
+    if (!m_initialized)
+        return false;
+    const double dt = std::max<qint64>(0, timestampNs - m_stateNs) * kNsToS;
+    az = wrapDegrees180(m_x(0) + m_x(1) * dt);
+    azRate = m_x(1);
+    el = m_x(2) + m_x(3) * dt;
+    elRate = m_x(3);
+    return true;
+}
+
+bool TargetStateFilter::isCoasting(qint64 nowNs) const
+{
+    // More than two tracker frames (at 30 fps) without a fused measurement
+    return m_initialized && (nowNs - m_lastMeasurementNs) > 70000000LL;
+}
+
+bool TargetStateFilter::hasExpired(qint64 nowNs) const
+{
+    return !m_initialized || (nowNs - m_lastMeasurementNs) * kNsToS > m_config.maxCoastS;
+}
@@ -0,0 +1,70 @@
+#ifndef TARGETSTATEFILTER_H
+#define TARGETSTATEFILTER_H
+
+#include <Eigen/Dense>
+#include <QtGlobal>
+
+/**
+ * @brief Constant-velocity Kalman filter for the tracked target's gimbal-frame angles.
+ *
+ * State x = [az, azRate, el, elRate] (deg, deg/s), measurement z = [az, el].
+ * Both axes share one 4x4 filter with a block-diagonal model; process noise is
+ * continuous white acceleration, so the filter follows manoeuvres without the
+ * fixed lag of an exponential smoother.
+ *
+ * Time comes from the tracker's frame capture timestamps (monotonic ns), so a
+ * late or bunched delivery does not distort the velocity estimate. Between
+ * measurements the state is only predicted, which lets the filter coast through
+ * short occlusions; after maxCoastS without a measurement the track is dropped.
+ */
+class TargetStateFilter
+{
+public:
+    struct Config {
+        double accelNoise = 20.0;         // Process noise, (deg/s²)² per Hz
+        double measurementNoise = 0.02;   // Measurement std dev, deg
+        double initialRateStd = 5.0;      // Initial velocity std dev, deg/s
+        double maxCoastS = 1.0;           // Drop the track after this long without a measurement
+        double gateChi2 = 13.8;           // 2-DOF chi-square gate (99.9 %)
+        int maxGateRejects = 5;           // Consecutive gated measurements before re-initialising
+    };
+
+    TargetStateFilter();
+    explicit TargetStateFilter(const Config &config);
+
+    void reset();
+
+    // Starts a new track at the measurement; rates are an optional prior (deg/s)
+    void initialize(double az, double el, double azRate, double elRate, qint64 timestampNs);
+
+    // Predicts to timestampNs and fuses the measurement. Returns false if the
+    // measurement is older than the current state or fails the gate.
+    bool update(double az, double el, qint64 timestampNs);
+
+    // State predicted to timestampNs without modifying the filter
+    bool predict(qint64 timestampNs, double &az, double &el, double &azRate, double &elRate) const;
+
+    bool isValid() const { return m_initialized; }
+    bool isCoasting(qint64 nowNs) const;
+    bool hasExpired(qint64 nowNs) const;
+    qint64 lastMeasurementNs() const { return m_lastMeasurementNs; }
+
+private:
+    using Vector4 = Eigen::Matrix<double, 4, 1>;
+    using Matrix4 = Eigen::Matrix<double, 4, 4>;
+
+    void transition(double dt, Matrix4 &F, Matrix4 &Q) const;
+
+    Config m_config;
+    Vector4 m_x = Vector4::Zero();
+    Matrix4 m_P = Matrix4::Identity();
+    Eigen::Matrix<double, 2, 4> m_H = Eigen::Matrix<double, 2, 4>::Zero();
+    Eigen::Matrix2d m_R = Eigen::Matrix2d::Identity();
+
+    bool m_initialized = false;
+    qint64 m_stateNs = 0;             // Time the state refers to
+    qint64 m_lastMeasurementNs = 0;
+    int m_gateRejects = 0;
+};
+
+#endif // TARGETSTATEFILTER_H
@@ -1,32 +1,26 @@
 #include "trackingmotionmode.h"
 #include "controllers/gimbalcontroller.h"
 #include "models/domain/systemstatemodel.h"
+#include "motionclock.h"
 #include <QDebug>
 #include <QtGlobal>
 #include <cmath>
 
-// Define smoothing and rate limiting constants
-static const double SMOOTHING_ALPHA = 0.3;           // Position smoothing (0.0 = no smoothing, 1.0 = no filtering)
-static const double VELOCITY_SMOOTHING_ALPHA = 0.2;   // Velocity smoothing (more aggressive)
+// Define rate limiting constants
 static const double MAX_VELOCITY = 15.0;              // Maximum velocity in deg/s
 static const double MAX_ACCELERATION = 30.0;          // Maximum acceleration in deg/s²
 static const double VELOCITY_CHANGE_LIMIT = 5.0;      // Maximum velocity change per update cycle
 
 TrackingMotionMode::TrackingMotionMode(QObject* parent)
-    : GimbalMotionModeBase(parent), m_targetValid(false), m_targetAz(0.0), m_targetEl(0.0)
-    , m_smoothedAzVel_dps(0.0), m_smoothedElVel_dps(0.0)
+    : GimbalMotionModeBase(parent), m_targetValid(false)
     , m_previousDesiredAzVel(0.0), m_previousDesiredElVel(0.0)  // Initialize previous velocities
 {
-    // Configure PID gains for STABLE and SMOOTH target tracking
-    // Reduced gains to prevent motor overload
-    m_azPid.Kp = 0.15;  // Reduced from 0.25
-    m_azPid.Ki = 0.005; // Reduced from 0.01
-    m_azPid.Kd = 0.01;  // Reduced from 0.02
+    // PID gains for STABLE and SMOOTH target tracking, per axis from gimbal.tuning
+    // (defaults are the hand-tuned 0.15 / 0.005 / 0.01, reduced to prevent motor overload)
+    loadGains(m_azPid, DeviceConfiguration::gimbal().azimuthTuning.tracking);
     m_azPid.maxIntegral = 10.0; // Reduced from 20.0
 
-    m_elPid.Kp = 0.15;  // Reduced from 0.25
-    m_elPid.Ki = 0.005; // Reduced from 0.01
-    m_elPid.Kd = 0.01;  // Reduced from 0.02
+    loadGains(m_elPid, DeviceConfiguration::gimbal().elevationTuning.tracking);
     m_elPid.maxIntegral = 10.0; // Reduced from 20.0
 }
 
@@ -36,6 +30,7 @@ void TrackingMotionMode::enterMode(GimbalController* controller)
     
     // Invalidate target on entering the mode to ensure we wait for a fresh command.
     m_targetValid = false;
+    m_filter.reset();
     m_azPid.reset();
     m_elPid.reset();
     
@@ -54,40 +49,36 @@ void TrackingMotionMode::enterMode(GimbalController* controller)
 void TrackingMotionMode::exitMode(GimbalController* controller)
 {
     qDebug() << "[TrackingMotionMode] Exit";
+    m_targetValid = false;
+    m_filter.reset();
+    if (controller) {
+        publishPredictedTarget(controller, false, false, 0.0, 0.0, 0.0, 0.0);
+    }
     stopServos(controller);
 }
 
 void TrackingMotionMode::onTargetPositionUpdated(double az, double el, 
                                                double velocityAz_dps, double velocityEl_dps, 
-                                               bool isValid)
+                                               bool isValid, qint64 timestampNs)
 {
     if (isValid) {
-        if (!m_targetValid) {
+        // Measurements are placed at their frame capture time; fall back to now if unknown
+        const qint64 measurementNs = timestampNs > 0 ? timestampNs : MotionClock::nowNs();
+        if (!m_targetValid || !m_filter.isValid()) {
              qDebug() << "[TrackingMotionMode] New valid target acquired.";
              m_azPid.reset();
              m_elPid.reset();
-             m_smoothedTargetAz = az;
-             m_smoothedTargetEl = el;
-             // Initialize velocity smoother with first measured velocity
-             m_smoothedAzVel_dps = velocityAz_dps;
-             m_smoothedElVel_dps = velocityEl_dps;
+             // Start the track with the tracker's velocity as the rate prior
+             m_filter.initialize(az, el, velocityAz_dps, velocityEl_dps, measurementNs);
+        } else {
+             // Repeated state updates for the same frame are rejected by the filter
+             m_filter.update(az, el, measurementNs);
         }
         m_targetValid = true;
-        m_targetAz = az;
-        m_targetEl = el;
-        m_targetAzVel_dps = velocityAz_dps;
-        m_targetElVel_dps = velocityEl_dps;
-
-    } else {
-        if (m_targetValid) {
-             qDebug() << "[TrackingMotionMode] Target has been definitively lost.";
-        }
-        m_targetValid = false;
-        // Reset velocities when target is lost
-        m_targetAzVel_dps = 0.0;
-        m_targetElVel_dps = 0.0;
-        m_smoothedAzVel_dps = 0.0;
-        m_smoothedElVel_dps = 0.0;
+
+    } else if (m_targetValid) {
+        // Keep the track and coast on the prediction; update() drops it once it expires
+        qDebug() << "[TrackingMotionMode] Target measurement lost, coasting.";
     }
 }
 
@@ -123,27 +114,66 @@ double TrackingMotionMode::applyVelocityScaling(double velocity, double error)
     return velocity * scale;
 }
 
+void TrackingMotionMode::publishPredictedTarget(GimbalController* controller, bool valid, bool coasting,
+                                                double az, double el, double azRate, double elRate)
+{
+    auto stateModel = controller->systemStateModel();
+    if (!stateModel) return;
+
+    SystemStateData updatedState = stateModel->data();
+    updatedState.predictedTargetValid = valid;
+    updatedState.predictedTargetCoasting = coasting;
+    updatedState.predictedTargetAz = az;
+    updatedState.predictedTargetEl = el;
+    updatedState.predictedTargetAzRate = static_cast<float>(azRate);
+    updatedState.predictedTargetElRate = static_cast<float>(elRate);
+
+    // Convert the predicted target to world-frame for AHRS-based stabilization
+    if (valid && updatedState.imuConnected) {
+        double worldAz, worldEl;
+        convertGimbalToWorldFrame(az, el,
+                                  updatedState.imuRollDeg, updatedState.imuPitchDeg, updatedState.imuYawDeg,
+                                  worldAz, worldEl);
+        updatedState.targetAzimuth_world = worldAz;
+        updatedState.targetElevation_world = worldEl;
+        updatedState.useWorldFrameTarget = true; // Enable world-frame tracking
+    }
+    stateModel->updateData(updatedState);
+}
+
 void TrackingMotionMode::update(GimbalController* controller)
 {
     if (!m_targetValid) {
         stopServos(controller);
         return;
     }
+
+    const qint64 nowNs = MotionClock::nowNs();
+    if (m_filter.hasExpired(nowNs)) {
+        qDebug() << "[TrackingMotionMode] Target has been definitively lost.";
+        m_targetValid = false;
+        m_filter.reset();
+        publishPredictedTarget(controller, false, false, 0.0, 0.0, 0.0, 0.0);
+        stopServos(controller);
+        return;
+    }
+
     qint64 ms_elapsed = m_velocityTimer.restart(); // restart() returns elapsed and resets
     double dt_s = ms_elapsed / 1000.0;    
     SystemStateData data = controller->systemStateModel()->data();
 
-    // 1. Smooth the Target Position (for PID feedback)
-    m_smoothedTargetAz = (SMOOTHING_ALPHA * m_targetAz) + (1.0 - SMOOTHING_ALPHA) * m_smoothedTargetAz;
-    m_smoothedTargetEl = (SMOOTHING_ALPHA * m_targetEl) + (1.0 - SMOOTHING_ALPHA) * m_smoothedTargetEl;
+    // 1. Target state predicted to this control cycle (also while coasting through occlusions)
+    double targetAz, targetEl, targetAzVel_dps, targetElVel_dps;
+    m_filter.predict(nowNs, targetAz, targetEl, targetAzVel_dps, targetElVel_dps);
+    const bool coasting = m_filter.isCoasting(nowNs);
 
-    // 2. Smooth the Target Velocity (for feed-forward)
-    m_smoothedAzVel_dps = (VELOCITY_SMOOTHING_ALPHA * m_targetAzVel_dps) + (1.0 - VELOCITY_SMOOTHING_ALPHA) * m_smoothedAzVel_dps;
-    m_smoothedElVel_dps = (VELOCITY_SMOOTHING_ALPHA * m_targetElVel_dps) + (1.0 - VELOCITY_SMOOTHING_ALPHA) * m_smoothedElVel_dps;
+    // 2. Publish the prediction for the OSD and world-frame stabilization
+    publishPredictedTarget(controller, true, coasting,
+                           targetAz, targetEl, targetAzVel_dps, targetElVel_dps);
 
     // 3. Calculate Position Error
-    double errAz = m_smoothedTargetAz - data.gimbalAz;  
-    double errEl = m_smoothedTargetEl - data.gimbalEl;  
+    double errAz = targetAz - data.gimbalAz;  
+    double errEl = targetEl - data.gimbalEl;  
     
     // Normalize azimuth error to [-180, 180] range
     while (errAz > 180.0) errAz -= 360.0;
@@ -152,17 +182,19 @@ void TrackingMotionMode::update(GimbalController* controller)
     // 4. Calculate PID output (Feedback)
     bool useDerivativeOnMeasurement = true;
     // CRITICAL FIX: Use the measured dt_s, not the constant UPDATE_INTERVAL_S
-    double pidAzVelocity = pidCompute(m_azPid, errAz, m_smoothedTargetAz, data.gimbalAz, useDerivativeOnMeasurement, dt_s);
-    double pidElVelocity = pidCompute(m_elPid, errEl, m_smoothedTargetEl, data.gimbalEl, useDerivativeOnMeasurement, dt_s); // Use imuPitchDeg for derivative measurement
+    double pidAzVelocity = pidCompute(m_azPid, errAz, targetAz, data.gimbalAz, useDerivativeOnMeasurement, dt_s);
+    double pidElVelocity = pidCompute(m_elPid, errEl, targetEl, data.gimbalEl, useDerivativeOnMeasurement, dt_s); // Use imuPitchDeg for derivative measurement
 
-    // 5. Add Feed-forward term (scaled down to prevent aggressive response)
-    const double FEEDFORWARD_GAIN = 0.5; // Scale down the feed-forward contribution
-    double desiredAzVelocity = pidAzVelocity + (FEEDFORWARD_GAIN * m_smoothedAzVel_dps);
-    double desiredElVelocity = pidElVelocity + (FEEDFORWARD_GAIN * m_smoothedElVel_dps);
+    // 5. Apply velocity scaling based on error magnitude (feedback only: scaling the
+    // feed-forward would leave a steady lag behind fast targets)
+    pidAzVelocity = applyVelocityScaling(pidAzVelocity, errAz);
+    pidElVelocity = applyVelocityScaling(pidElVelocity, errEl);
 
-    // 6. Apply velocity scaling based on error magnitude
-    desiredAzVelocity = applyVelocityScaling(desiredAzVelocity, errAz);
-    desiredElVelocity = applyVelocityScaling(desiredElVelocity, errEl);
+    // 6. Add Feed-forward term. The filtered rate is the target's own angular rate,
+    // so it is applied in full and the PID only removes the residual error.
+    const double FEEDFORWARD_GAIN = 1.0;
+    double desiredAzVelocity = pidAzVelocity + (FEEDFORWARD_GAIN * targetAzVel_dps);
+    double desiredElVelocity = pidElVelocity + (FEEDFORWARD_GAIN * targetElVel_dps);
 
     // 7. Apply system velocity constraints
     desiredAzVelocity = qBound(-MAX_VELOCITY, desiredAzVelocity, MAX_VELOCITY);
@@ -176,34 +208,16 @@ void TrackingMotionMode::update(GimbalController* controller)
     m_previousDesiredAzVel = desiredAzVelocity;
     m_previousDesiredElVel = desiredElVelocity;
 
-    // 10. Convert target to world-frame for AHRS-based stabilization
-    if (data.imuConnected) {
-        // Convert current target position from platform frame to world frame
-        double worldAz, worldEl;
-        convertGimbalToWorldFrame(m_smoothedTargetAz, m_smoothedTargetEl,
-                                  data.imuRollDeg, data.imuPitchDeg, data.imuYawDeg,
-                                  worldAz, worldEl);
-
-        // Update system state with world-frame target
-        auto stateModel = controller->systemStateModel();
-        SystemStateData updatedState = stateModel->data();
-        updatedState.targetAzimuth_world = worldAz;
-        updatedState.targetElevation_world = worldEl;
-        updatedState.useWorldFrameTarget = true; // Enable world-frame tracking
-        stateModel->updateData(updatedState);
-    }
-
     // Debug output (reduced frequency to avoid spam)
     /*static int debugCounter = 0;
     if (++debugCounter % 10 == 0) { // Print every 10 updates
         qDebug() << "Tracking - Error(Az,El):" << errAz << "," << errEl
                  << "| Vel(Az,El):" << desiredAzVelocity << "," << desiredElVelocity
-                 << "| FF(Az,El):" << m_smoothedAzVel_dps << "," << m_smoothedElVel_dps
-                 << "| elapsed(s):" << dt_s;
+                 << "| FF(Az,El):" << targetAzVel_dps << "," << targetElVel_dps
+                 << "| coasting:" << coasting << "| elapsed(s):" << dt_s;
     }*/
 
-    // 11. Send final commands with stabilization enabled
+    // 10. Send final commands with stabilization enabled
     // Hybrid stabilization adds platform motion compensation to tracking velocity
     sendStabilizedServoCommands(controller, desiredAzVelocity, desiredElVelocity, true);
 }
-
@@ -2,6 +2,7 @@
 #define TRACKINGMOTIONMODE_H
 
 #include "gimbalmotionmodebase.h"
+#include "targetstatefilter.h"
 #include "utils/TimestampLogger.h"
 
 class TrackingMotionMode : public GimbalMotionModeBase
@@ -18,21 +19,19 @@ public:
 public slots:
     void onTargetPositionUpdated(double az, double el, 
                                double velocityAz_dps, double velocityEl_dps, 
-                               bool isValid);
+                               bool isValid, qint64 timestampNs = 0);
 
 private:
     // Helper functions for improved control
     double applyRateLimit(double newVelocity, double previousVelocity, double maxChange);
     double applyVelocityScaling(double velocity, double error);
     
-    // Target state
+    void publishPredictedTarget(GimbalController* controller, bool valid, bool coasting,
+                                double az, double el, double azRate, double elRate);
+
+    // Target state: measurements are fused by the filter, the loop runs on its prediction
     bool m_targetValid;
-    double m_targetAz, m_targetEl;
-    double m_targetAzVel_dps, m_targetElVel_dps;
-    
-    // Smoothed values
-    double m_smoothedTargetAz, m_smoothedTargetEl;
-    double m_smoothedAzVel_dps, m_smoothedElVel_dps;
+    TargetStateFilter m_filter;
     
     // Rate limiting
     double m_previousDesiredAzVel, m_previousDesiredElVel;
@@ -40,7 +39,7 @@ private:
     // PID controllers
     PIDController m_azPid, m_elPid;
 
-    QElapsedTimer m_velocityTimer; // To measure time between frames
+    MotionTimer m_velocityTimer; // To measure time between frames
 
 };
 
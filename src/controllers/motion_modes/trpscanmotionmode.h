@@ -4,7 +4,7 @@
 #include "gimbalmotionmodebase.h"
 #include "models/domain/systemstatemodel.h" // For TargetReferencePoint struct
 #include <vector>
-#include <QElapsedTimer> // Include for the halt timer
+#include "motionclock.h"
 
 class TRPScanMotionMode : public GimbalMotionModeBase
 {
@@ -20,29 +20,28 @@ public:
     void setActiveTRPPage(const std::vector<TargetReferencePoint>& trpPage);
 
 private:
-    // --- State Machine for managing the path execution ---
-    enum class State {
-        Idle,       // Not running, path finished, or no path set.
-        Moving,     // Moving towards the current waypoint.
-        Halted      // Paused at a waypoint for the specified halt time.
-    };
-    State m_currentState;
-    double m_targetAz, m_targetEl; // Current intermediate target for PID
+    // Velocity-mode path from the current position, executed by followTrajectory()
+    void planTrajectory(GimbalController* controller);
 
     // --- Path Data & Progress ---
     std::vector<TargetReferencePoint> m_trpPage;
-    int m_currentTrpIndex;
-    QElapsedTimer m_haltTimer; // Timer to manage the halt duration
+    bool m_running;
 
-    // --- PID Controllers for smooth stopping ---
+    // Planned path: lead-in to point 0, then every TRP in turn with its halt time, looping
+    ScanTrajectory m_trajectory;
+    MotionTimer m_trajectoryTimer;
+    int m_lastWaypointIndex;
+
+    // Same path as driver-side position moves, while no stabilization is needed
+    OffloadedScan m_offloadedScan;
+    bool m_offloaded;
+
+    // Small position correction on top of the planned velocity
     PIDController m_azPid;
     PIDController m_elPid;
 
-    // --- Motion Tuning Parameters ---
-    // Distance from target to switch from cruising to PID-controlled deceleration.
-    static constexpr double DECELERATION_DISTANCE_DEG = 3.0;
-    // Position tolerance to consider the gimbal "arrived" at a waypoint.
-    static constexpr double ARRIVAL_THRESHOLD_DEG = 0.1;
+    // Travel speed between TRPs (deg/s)
+    static constexpr double TRAVEL_SPEED_DEG_S = 15.0;
 };
 
 #endif // TRPSCANMOTIONMODE_H
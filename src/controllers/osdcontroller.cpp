@@ -1,13 +1,17 @@
 #include "osdcontroller.h"
 #include "models/osdviewmodel.h"
 #include "models/domain/systemstatemodel.h"
+#include "models/viewmodelupdatescheduler.h"
 #include "hardware/devices/cameravideostreamdevice.h"
+#include "utils/latencyhistogram.h"
 #include <QDebug>
 
 OsdController::OsdController(QObject *parent)
     : QObject(parent)
     , m_viewModel(nullptr)
     , m_stateModel(nullptr)
+    , m_updateScheduler(nullptr)
+    , m_schedulerClientId(-1)
     , m_startupTimer(new QTimer(this))
     , m_staticDetectionTimer(new QTimer(this))
     , m_startupState(StartupState::Idle)
@@ -24,6 +28,8 @@ OsdController::OsdController(QObject *parent)
     m_staticDetectionTimer->setSingleShot(true);
 }
 
+OsdController::~OsdController() = default;
+
 void OsdController::setViewModel(OsdViewModel* viewModel)
 {
     m_viewModel = viewModel;
@@ -36,6 +42,11 @@ void OsdController::setStateModel(SystemStateModel* stateModel)
     qDebug() << "OsdController: StateModel set:" << m_stateModel;
 }
 
+void OsdController::setUpdateScheduler(ViewModelUpdateScheduler* scheduler)
+{
+    m_updateScheduler = scheduler;
+}
+
 void OsdController::initialize()
 {
     qDebug() << "OsdController::initialize()";
@@ -65,6 +76,13 @@ void OsdController::initialize()
     // Set initial state
     m_viewModel->setAccentColor(initialData.colorStyle);
 
+    // Camera frames arrive faster than the display refreshes; only the newest
+    // one is applied, once per rendered frame
+    if (m_updateScheduler) {
+        m_schedulerClientId = m_updateScheduler->registerClient(
+            QStringLiteral("osd"), [this]() { flushPendingFrame(); });
+    }
+
     qDebug() << "OsdController initialized successfully";
 
     // =========================================================================
@@ -141,6 +159,12 @@ void OsdController::checkForCriticalErrors(const SystemStateData& data)
         return;
     }
 
+    // Priority 4: System alerts (e.g. zone store recovery)
+    if (!data.alertsWarnings.isEmpty()) {
+        showErrorMessage(data.alertsWarnings);
+        return;
+    }
+
     // If no critical errors, hide error message
     hideErrorMessage();
 }
@@ -156,6 +180,42 @@ void OsdController::onFrameDataReady(const FrameData& frmdata)
         return;
     }
 
+    if (!m_updateScheduler || m_schedulerClientId < 0) {
+        applyFrameData(frmdata);
+        return;
+    }
+
+    // Keep only the newest frame; the pixels are not needed for the OSD
+    if (!m_pendingFrame) {
+        m_pendingFrame = std::make_unique<FrameData>();
+    }
+    *m_pendingFrame = frmdata;
+    m_pendingFrame->baseImage = QImage();
+    m_updateScheduler->markDirty(m_schedulerClientId);
+}
+
+void OsdController::flushPendingFrame()
+{
+    if (!m_pendingFrame || !m_viewModel) return;
+
+    // Frames superseded before this display frame are simply dropped
+    if (m_pendingFrame->cameraIndex == m_activeCameraIndex) {
+        applyFrameData(*m_pendingFrame);
+    }
+}
+
+void OsdController::applyFrameData(const FrameData& frmdata)
+{
+    // Glass-to-reticle: how old the image is by the time its OSD data lands
+    if (frmdata.captureTimestampNs > 0) {
+        const qint64 nowNs = FrameLatencyMonitor::nowNs();
+        FrameLatencyMonitor &latency = FrameLatencyMonitor::instance();
+        latency.record(frmdata.cameraIndex, FrameStage::EmitToOsd, nowNs - frmdata.emitTimestampNs);
+        latency.record(frmdata.cameraIndex, FrameStage::CaptureToOsd, nowNs - frmdata.captureTimestampNs);
+    }
+
+    m_viewModel->beginUpdate();
+
     // === BASIC OSD DATA ===
     m_viewModel->updateMode(frmdata.currentOpMode);
     m_viewModel->updateMotionMode(frmdata.motionMode);
@@ -260,6 +320,13 @@ void OsdController::onFrameDataReady(const FrameData& frmdata)
                frmdata.acquisitionBoxW_px, frmdata.acquisitionBoxH_px)
         );
 
+    m_viewModel->updatePredictedTarget(
+        frmdata.predictedTargetValid,
+        frmdata.predictedTargetCoasting,
+        frmdata.predictedTargetX_px,
+        frmdata.predictedTargetY_px
+        );
+
     // === ZEROING ===
     m_viewModel->updateZeroingDisplay(
         frmdata.zeroingModeActive,
@@ -290,6 +357,8 @@ void OsdController::onFrameDataReady(const FrameData& frmdata)
 
     // === SCAN NAME ===
     m_viewModel->updateCurrentScanName(frmdata.currentScanName);
+
+    m_viewModel->endUpdate();
 }
 // ============================================================================
 // SHARED UPDATE LOGIC
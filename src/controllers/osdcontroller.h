@@ -3,10 +3,12 @@
 
 #include <QObject>
 #include <QTimer>
+#include <memory>
 
 // Forward declarations
 class OsdViewModel;
 class SystemStateModel;
+class ViewModelUpdateScheduler;
 struct FrameData;
 struct SystemStateData;
 
@@ -24,10 +26,12 @@ class OsdController : public QObject
 
 public:
     explicit OsdController(QObject *parent = nullptr);
+    ~OsdController() override;
 
     // Dependency injection (called by SystemController)
     void setViewModel(OsdViewModel* viewModel);
     void setStateModel(SystemStateModel* stateModel);
+    void setUpdateScheduler(ViewModelUpdateScheduler* scheduler);
 
     // Initialize connections
     void initialize();
@@ -68,15 +72,24 @@ private:
     bool areCriticalDevicesConnected(const SystemStateData& data) const;
     void checkForCriticalErrors(const SystemStateData& data);
 
+    // Pushes one frame's OSD data into the view model as a single batch
+    void applyFrameData(const FrameData& frmdata);
+    void flushPendingFrame();
+
     // Shared update logic
     //void updateViewModelFromSystemState(const SystemStateData& data);
 
     // Dependencies (injected)
     OsdViewModel* m_viewModel;
     SystemStateModel* m_stateModel;
+    ViewModelUpdateScheduler* m_updateScheduler;
 
     int m_activeCameraIndex;
 
+    // Latest frame from the active camera, applied on the next display frame
+    std::unique_ptr<FrameData> m_pendingFrame;
+    int m_schedulerClientId;
+
     // Startup sequence state machine
     QTimer* m_startupTimer;
     QTimer* m_staticDetectionTimer;
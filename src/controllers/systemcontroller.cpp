@@ -17,6 +17,14 @@
 #include "models/domain/systemstatemodel.h"
 #include "logger/systemdatalogger.h"
 #include "video/videoimageprovider.h"
+#include "models/viewmodelupdatescheduler.h"
+#include "models/detectionlistmodel.h"
+#include "video/detectionoverlayitem.h"
+#include "video/osdsceneitem.h"
+#include "video/zonemapitem.h"
+#include "models/zonemaplistmodels.h"
+#include "utils/latencyhistogram.h"
+#include "utils/startupprofiler.h"
 
 // Telemetry Services
 #include "services/telemetryauthservice.h"
@@ -26,9 +34,12 @@
 
 // Hardware Devices (for video connection)
 #include "hardware/devices/cameravideostreamdevice.h"
+#include "hardware/devices/servodriverdevice.h"
 
 #include <QQmlContext>
 #include <QQmlApplicationEngine>
+#include <QQuickWindow>
+#include <QQmlEngine>
 #include <QDebug>
 #include <QJsonObject>
 #include <QJsonArray>
@@ -60,6 +71,7 @@ void SystemController::initializeHardware()
 
     // 1. Create SystemStateModel (central data hub)
     m_systemStateModel = new SystemStateModel(this);
+    m_systemStateModel->loadZonesAsync();   // Finishes while the hardware comes up
     qInfo() << "  ✓ SystemStateModel created";
 
     // 2. Create Data Logger
@@ -108,6 +120,19 @@ void SystemController::initializeQmlSystem(QQmlApplicationEngine* engine)
         return;
     }
 
+    // 0. Register scene-graph OSD / zone map items
+    qmlRegisterType<DetectionOverlayItem>("RCWS.Osd", 1, 0, "DetectionOverlay");
+    qmlRegisterType<OsdSceneItem>("RCWS.Osd", 1, 0, "OsdScene");
+    qmlRegisterUncreatableType<DetectionListModel>("RCWS.Osd", 1, 0, "DetectionListModel",
+                                                   "Provided by OsdViewModel");
+    qmlRegisterType<ZoneMapItem>("RCWS.Osd", 1, 0, "ZoneMap");
+    qmlRegisterUncreatableType<AreaZoneListModel>("RCWS.Osd", 1, 0, "AreaZoneListModel",
+                                                  "Provided by ZoneMapViewModel");
+    qmlRegisterUncreatableType<SectorScanListModel>("RCWS.Osd", 1, 0, "SectorScanListModel",
+                                                    "Provided by ZoneMapViewModel");
+    qmlRegisterUncreatableType<TrpListModel>("RCWS.Osd", 1, 0, "TrpListModel",
+                                             "Provided by ZoneMapViewModel");
+
     // 1. Create Video Provider
     m_videoProvider = new VideoImageProvider();
     engine->addImageProvider("video", m_videoProvider);
@@ -153,6 +178,15 @@ void SystemController::initializeQmlSystem(QQmlApplicationEngine* engine)
         return;
     }
 
+    // 9. Synchronise view-model updates to the window's frames once it exists
+    ViewModelUpdateScheduler* scheduler = m_viewModelRegistry->updateScheduler();
+    connect(engine, &QQmlApplicationEngine::objectCreated, scheduler,
+            [scheduler](QObject* object, const QUrl&) {
+        if (auto* window = qobject_cast<QQuickWindow*>(object)) {
+            scheduler->attachWindow(window);
+        }
+    });
+
     qInfo() << "=== PHASE 2 COMPLETE ===\n";
 }
 
@@ -170,18 +204,22 @@ void SystemController::startSystem()
         qInfo() << "  ✓ OSD startup sequence started";
     }
 
-    // 2. Start hardware (open transports, initialize devices)
+    // 2. Start hardware (open transports, initialize devices). The devices
+    //    come up asynchronously; the gimbal alarms are cleared once PLC42 is up.
+    watchStartupMilestones();
+    connect(m_hardwareManager, &HardwareManager::hardwareStarted, this, [this]() {
+        // 3. Clear gimbal alarms (via gimbal controller)
+        if (m_controllerRegistry->gimbalController()) {
+            m_controllerRegistry->gimbalController()->clearAlarms();
+            qInfo() << "  ✓ Gimbal alarms cleared";
+        }
+    }, Qt::SingleShotConnection);
+
     if (!m_hardwareManager->startHardware()) {
         qCritical() << "Failed to start hardware!";
         return;
     }
 
-    // 3. Clear gimbal alarms (via gimbal controller)
-    if (m_controllerRegistry->gimbalController()) {
-        m_controllerRegistry->gimbalController()->clearAlarms();
-        qInfo() << "  ✓ Gimbal alarms cleared";
-    }
-
     // 4. Create API server (legacy)
     createApiServer();
 
@@ -369,6 +407,48 @@ void SystemController::createTelemetryServices()
     }
 }
 
+void SystemController::watchStartupMilestones()
+{
+    // First frame from either camera: the operator has live video
+    for (CameraVideoStreamDevice* camera : {m_hardwareManager->dayVideoProcessor(),
+                                            m_hardwareManager->nightVideoProcessor()}) {
+        if (camera) {
+            connect(camera, &CameraVideoStreamDevice::frameDataReady, this, [this]() {
+                onStartupMilestone("firstVideoFrame");
+            }, Qt::SingleShotConnection);
+        }
+    }
+
+    // Both servo drivers answering: the operator can traverse
+    connect(m_hardwareManager->servoAzDevice(), &ServoDriverDevice::servoDataChanged, this, [this]() {
+        onStartupMilestone("servoAzOnline");
+    }, Qt::SingleShotConnection);
+    connect(m_hardwareManager->servoElDevice(), &ServoDriverDevice::servoDataChanged, this, [this]() {
+        onStartupMilestone("servoElOnline");
+    }, Qt::SingleShotConnection);
+}
+
+void SystemController::onStartupMilestone(const QString& name)
+{
+    StartupProfiler& profiler = StartupProfiler::instance();
+    profiler.milestone(name);
+
+    if (profiler.hasMilestone("servoAzOnline") && profiler.hasMilestone("servoElOnline")) {
+        profiler.milestone("traverseReady");
+    }
+
+    if (m_startupReported || !profiler.hasMilestone("firstVideoFrame") || !profiler.hasMilestone("traverseReady")) {
+        return;
+    }
+    m_startupReported = true;
+
+    profiler.logSummary();
+    const QString reportPath = DeviceConfiguration::performance().startupProfilePath;
+    if (!reportPath.isEmpty() && profiler.writeReport(reportPath)) {
+        qInfo() << "  ✓ Startup profile written to" << reportPath;
+    }
+}
+
 void SystemController::connectVideoToProvider()
 {
     if (!m_videoProvider || !m_hardwareManager) {
@@ -384,6 +464,10 @@ void SystemController::connectVideoToProvider()
                 this, [this](const FrameData& data) {
                     if (data.cameraIndex == 0 && m_systemStateModel->data().activeCameraIsDay) {
                         m_videoProvider->updateImage(data.baseImage);
+                        if (data.captureTimestampNs > 0) {
+                            FrameLatencyMonitor::instance().record(data.cameraIndex, FrameStage::CaptureToDisplay,
+                                                                   FrameLatencyMonitor::nowNs() - data.captureTimestampNs);
+                        }
                     }
                 });
         qInfo() << "    ✓ Day camera connected to video provider";
@@ -395,6 +479,10 @@ void SystemController::connectVideoToProvider()
                 this, [this](const FrameData& data) {
                     if (data.cameraIndex == 1 && !m_systemStateModel->data().activeCameraIsDay) {
                         m_videoProvider->updateImage(data.baseImage);
+                        if (data.captureTimestampNs > 0) {
+                            FrameLatencyMonitor::instance().record(data.cameraIndex, FrameStage::CaptureToDisplay,
+                                                                   FrameLatencyMonitor::nowNs() - data.captureTimestampNs);
+                        }
                     }
                 });
         qInfo() << "    ✓ Night camera connected to video provider";
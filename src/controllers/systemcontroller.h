@@ -59,7 +59,8 @@ public:
 
     /**
      * @brief Phase 3: Start system
-     * Opens all transport connections and starts devices
+     * Opens all transport connections and starts devices (asynchronously,
+     * see HardwareManager::startHardware)
      */
     void startSystem();
 
@@ -70,6 +71,8 @@ private:
     void createApiServer();
     void createTelemetryServices();  // NEW: Create modern telemetry API services
     void connectVideoToProvider();
+    void watchStartupMilestones();
+    void onStartupMilestone(const QString& name);
 
     // ========================================================================
     // CORE COMPONENTS
@@ -92,6 +95,9 @@ private:
     TelemetryAuthService* m_telemetryAuthService = nullptr;
     TelemetryApiService* m_telemetryApiService = nullptr;
     TelemetryWebSocketServer* m_telemetryWebSocketServer = nullptr;
+
+    // Startup profile logged once live video and traverse are both available
+    bool m_startupReported = false;
 };
 
 #endif // SYSTEMCONTROLLER_H
@@ -1,13 +1,22 @@
 #include "systemstatuscontroller.h"
 #include "models/systemstatusviewmodel.h"
 #include "models/domain/systemstatemodel.h"
+#include "models/viewmodelupdatescheduler.h"
+#include "hardware/communication/modbuslinkmetrics.h"
 #include <QDebug>
+#include <QTimer>
 
 SystemStatusController::SystemStatusController(QObject *parent)
     : QObject(parent)
     , m_viewModel(nullptr)
     , m_stateModel(nullptr)
+    , m_updateScheduler(nullptr)
+    , m_schedulerClientId(-1)
+    , m_busMetricsTimer(new QTimer(this))
 {
+    // Bus statistics are not part of the system state: sample them while open
+    m_busMetricsTimer->setInterval(1000);
+    connect(m_busMetricsTimer, &QTimer::timeout, this, &SystemStatusController::applyBusMetrics);
 }
 
 void SystemStatusController::setViewModel(SystemStatusViewModel* viewModel)
@@ -22,6 +31,11 @@ void SystemStatusController::setStateModel(SystemStateModel* stateModel)
     qDebug() << "SystemStatusController: StateModel set";
 }
 
+void SystemStatusController::setUpdateScheduler(ViewModelUpdateScheduler* scheduler)
+{
+    m_updateScheduler = scheduler;
+}
+
 void SystemStatusController::initialize()
 {
     qDebug() << "SystemStatusController::initialize()";
@@ -54,18 +68,39 @@ void SystemStatusController::initialize()
     const auto& data = m_stateModel->data();
     m_viewModel->setAccentColor(data.colorStyle);
 
+    // The panel shows the latest state once per display frame, and only while
+    // it is open; changes made while hidden are applied when it is shown
+    if (m_updateScheduler) {
+        m_schedulerClientId = m_updateScheduler->registerClient(
+            QStringLiteral("systemStatus"),
+            [this]() { applyState(m_stateModel->data()); },
+            m_viewModel->visible());
+        connect(m_viewModel, &SystemStatusViewModel::visibleChanged, this, [this]() {
+            m_updateScheduler->setClientVisible(m_schedulerClientId, m_viewModel->visible());
+        });
+    }
+
     qDebug() << "SystemStatusController initialized successfully";
 }
 
 void SystemStatusController::show()
 {
-    if (m_viewModel) {
-        m_viewModel->setVisible(true);
+    if (!m_viewModel) return;
+
+    // Refresh before the panel appears so it never shows stale values
+    if (m_updateScheduler && m_schedulerClientId >= 0) {
+        m_updateScheduler->markDirty(m_schedulerClientId);
+    } else if (m_stateModel) {
+        applyState(m_stateModel->data());
     }
+    applyBusMetrics();
+    m_busMetricsTimer->start();
+    m_viewModel->setVisible(true);
 }
 
 void SystemStatusController::hide()
 {
+    m_busMetricsTimer->stop();
     if (m_viewModel) {
         m_viewModel->setVisible(false);
     }
@@ -75,6 +110,21 @@ void SystemStatusController::onSystemStateChanged(const SystemStateData& data)
 {
     if (!m_viewModel) return;
 
+    if (m_updateScheduler && m_schedulerClientId >= 0) {
+        m_updateScheduler->markDirty(m_schedulerClientId);
+        return;
+    }
+
+    // Nothing to refresh while the panel is closed; show() catches up
+    if (m_viewModel->visible()) {
+        applyState(data);
+    }
+}
+
+void SystemStatusController::applyState(const SystemStateData& data)
+{
+    m_viewModel->beginUpdate();
+
     // Update Azimuth Servo
     m_viewModel->updateAzimuthServo(
         data.azServoConnected,
@@ -164,6 +214,36 @@ void SystemStatusController::onSystemStateChanged(const SystemStateData& data)
     // Update Alarms
     QStringList alarms = buildAlarmsList(data);
     m_viewModel->updateAlarms(alarms);
+
+    m_viewModel->endUpdate();
+}
+
+void SystemStatusController::applyBusMetrics()
+{
+    if (!m_viewModel) return;
+
+    const ModbusLinkMetrics* busiest = nullptr;
+    ModbusLinkMetrics::Window busiestWindow;
+    quint64 timeouts = 0;
+    quint64 retries = 0;
+    quint64 errors = 0;
+    for (const ModbusLinkMetrics* link : ModbusLinkMetrics::all()) {
+        const ModbusLinkMetrics::Window window = link->lastWindow();
+        if (!busiest || window.utilisation > busiestWindow.utilisation) {
+            busiest = link;
+            busiestWindow = window;
+        }
+        timeouts += window.timeouts;
+        retries += window.retries;
+        errors += window.errors;
+    }
+
+    m_viewModel->beginUpdate();
+    m_viewModel->updateModbusBuses(busiest ? busiest->busName() : QString(),
+                                   busiestWindow.utilisation,
+                                   busiest ? busiest->roundTrip().summary().p95Ms : 0.0,
+                                   timeouts, retries, errors);
+    m_viewModel->endUpdate();
 }
 
 QStringList SystemStatusController::buildAlarmsList(const SystemStateData& data)
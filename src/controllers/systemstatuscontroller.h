@@ -3,9 +3,11 @@
 
 #include <QObject>
 
+class QTimer;
 class SystemStatusViewModel;
 class SystemStateModel;
 class SystemStateData;
+class ViewModelUpdateScheduler;
 
 class SystemStatusController : public QObject
 {
@@ -16,6 +18,7 @@ public:
 
     void setViewModel(SystemStatusViewModel* viewModel);
     void setStateModel(SystemStateModel* stateModel);
+    void setUpdateScheduler(ViewModelUpdateScheduler* scheduler);
     void initialize();
 
     void show();
@@ -41,9 +44,14 @@ private slots:
 private:
     QStringList buildAlarmsList(const SystemStateData& data);
     void updateUI();
+    void applyState(const SystemStateData& data);
+    void applyBusMetrics();
 
     SystemStatusViewModel* m_viewModel;
     SystemStateModel* m_stateModel;
+    ViewModelUpdateScheduler* m_updateScheduler;
+    int m_schedulerClientId;
+    QTimer* m_busMetricsTimer;
 };
 
 #endif // SYSTEMSTATUSCONTROLLER_H
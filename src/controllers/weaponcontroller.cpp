@@ -3,7 +3,14 @@
 #include "hardware/devices/servoactuatordevice.h"
 #include "hardware/devices/plc42device.h"
 #include "weaponcontroller.h"
+#include "controllers/deviceconfiguration.h"
 #include <QDebug>
+#include <QtMath>
+#include <cmath>
+
+namespace {
+constexpr double KNOTS_TO_MPS = 0.514444;
+}
 
 WeaponController::WeaponController(SystemStateModel* m_stateModel,
                                    ServoActuatorDevice* servoActuator,
@@ -20,6 +27,75 @@ WeaponController::WeaponController(SystemStateModel* m_stateModel,
     }
 
     m_ballisticsProcessor = new BallisticsProcessor();
+
+    const auto& ballisticsConf = DeviceConfiguration::ballistics();
+    m_interceptSolver.setMotionModel(ballisticsConf.interceptMotionModel == "CA"
+                                         ? InterceptSolver::MotionModel::ConstantAcceleration
+                                         : InterceptSolver::MotionModel::ConstantVelocity);
+    m_interceptSolver.setMaxIterations(ballisticsConf.interceptMaxIterations);
+    m_interceptSolver.setBudgetUs(ballisticsConf.interceptBudgetUs);
+
+    m_fireControlClock.start();
+    m_fireControlTimer = new QTimer(this);
+    m_fireControlTimer->setInterval(FIRE_CONTROL_INTERVAL_MS);
+    connect(m_fireControlTimer, &QTimer::timeout, this, &WeaponController::onFireControlTimer);
+    m_fireControlTimer->start();
+}
+
+void WeaponController::onFireControlTimer()
+{
+    if (!m_stateModel) return;
+
+    // Requested updates also run with LAC off, to clear the reticle offsets
+    const bool dirty = m_fireControlDirty;
+    m_fireControlDirty = false;
+
+    if (m_stateModel->data().leadAngleCompensationActive || dirty) {
+        updateFireControlSolution();
+    }
+    if (!m_stateModel->data().leadAngleCompensationActive && m_interceptSolver.hasTarget()) {
+        // Stale motion history must not leak into the next engagement
+        m_interceptSolver.reset();
+        m_lastIntercept = InterceptSolution();
+    }
+}
+
+InterceptMeasurement WeaponController::buildInterceptMeasurement(const SystemStateData& sData)
+{
+    InterceptMeasurement m;
+    m.timeS = m_fireControlClock.nsecsElapsed() * 1e-9;
+    m.gimbalAzDeg = static_cast<float>(sData.gimbalAz);
+    m.gimbalElDeg = static_cast<float>(sData.gimbalEl);
+
+    // Tracker offset from bore sight and its rate, pixels to degrees
+    const float hfov = static_cast<float>(sData.activeCameraIsDay ? sData.dayCurrentHFOV : sData.nightCurrentHFOV);
+    if (sData.trackerHasValidTarget && hfov > 0.01f &&
+        sData.currentImageWidthPx > 0 && sData.currentImageHeightPx > 0) {
+        const double aspect = static_cast<double>(sData.currentImageWidthPx) / sData.currentImageHeightPx;
+        const double vfov = qRadiansToDegrees(2.0 * std::atan(std::tan(qDegreesToRadians(hfov) / 2.0) / aspect));
+        const float degPerPxAz = hfov / sData.currentImageWidthPx;
+        const float degPerPxEl = static_cast<float>(vfov / sData.currentImageHeightPx);
+        m.trackOffsetAzDeg = (sData.trackedTargetCenterX_px - sData.currentImageWidthPx / 2.0f) * degPerPxAz;
+        m.trackOffsetElDeg = -(sData.trackedTargetCenterY_px - sData.currentImageHeightPx / 2.0f) * degPerPxEl;
+        m.trackOffsetRateAzDps = sData.trackedTargetVelocityX_px_s * degPerPxAz;
+        m.trackOffsetRateElDps = -sData.trackedTargetVelocityY_px_s * degPerPxEl;
+    }
+
+    // A new LRF reading shows up as a new laser count (or a changed distance)
+    const bool newLrfReading = sData.lrfConnected && sData.lrfDistance > 0.0 && !sData.lrfNoEcho &&
+                               (sData.lrfLaserCount != m_lastLrfLaserCount ||
+                                !qFuzzyCompare(sData.lrfDistance, m_lastLrfDistance));
+    if (newLrfReading) {
+        m.hasNewRange = true;
+        m.rangeM = static_cast<float>(sData.lrfDistance);
+        m_lastLrfLaserCount = sData.lrfLaserCount;
+        m_lastLrfDistance = sData.lrfDistance;
+    } else if (!m_interceptSolver.hasTarget() && sData.currentTargetRange > 0.0f) {
+        // No LRF history yet: seed with the operator/system range
+        m.hasNewRange = true;
+        m.rangeM = sData.currentTargetRange;
+    }
+    return m;
 }
 
 void WeaponController::onSystemStateChanged(const SystemStateData &newData)
@@ -200,11 +276,47 @@ void WeaponController::updateFireControlSolution() {
         return; // Or handle error
     }
     
-    LeadCalculationResult lead = m_ballisticsProcessor->calculateLeadAngle(
-        targetRange, targetAngRateAz, targetAngRateEl,
-        sData.muzzleVelocityMPS, // Pass actual muzzle velocity
-        tofGuess, currentFOV
-        );
+    // Ammunition and station air for the drag-model table. The table is only
+    // rebuilt when these drift past the processor's thresholds.
+    const auto& ballisticsConf = DeviceConfiguration::ballistics();
+    AmmunitionProfile ammo;
+    ammo.dragModel = (ballisticsConf.dragModel == "G1") ? DragModel::G1 : DragModel::G7;
+    ammo.ballisticCoefficient = ballisticsConf.ballisticCoefficient;
+    ammo.muzzleVelocityMps = sData.muzzleVelocityMPS;
+
+    AtmosphericConditions air; // Standard atmosphere until the PLC42 reports pressure
+    if (sData.plc42Connected && sData.stationPressure > 0) {
+        air.temperatureC = static_cast<float>(sData.stationTemperature);
+        air.pressureHpa = static_cast<float>(sData.stationPressure);
+    }
+    m_ballisticsProcessor->updateConditions(ammo, air);
+
+    // Crosswind component: windage direction is the azimuth the station faced into the wind
+    float crosswindMps = 0.0f;
+    if (sData.windageAppliedToBallistics) {
+        const double relativeWindRad = qDegreesToRadians(sData.windageDirectionDegrees - sData.gimbalAz);
+        crosswindMps = static_cast<float>(sData.windageSpeedKnots * KNOTS_TO_MPS * std::sin(relativeWindRad));
+    }
+
+    // Intercept: predicted target motion, TOF iterated against the range table
+    m_interceptSolver.addMeasurement(buildInterceptMeasurement(sData));
+    m_lastIntercept = m_interceptSolver.solve(m_ballisticsProcessor->table());
+    if (m_lastIntercept.overBudget && (m_interceptOverBudgetCount++ % 100) == 0) {
+        qWarning() << "WeaponController: Intercept solve took" << m_lastIntercept.solveTimeUs
+                   << "us, budget" << DeviceConfiguration::ballistics().interceptBudgetUs << "us";
+    }
+
+    LeadCalculationResult lead = m_ballisticsProcessor->calculateInterceptLead(m_lastIntercept, currentFOV, crosswindMps);
+    if (lead.status == LeadAngleStatus::Off) {
+        // No intercept (no range yet, or beyond the table): instantaneous-rate lead
+        lead = m_ballisticsProcessor->calculateLeadAngle(
+            targetRange, targetAngRateAz, targetAngRateEl,
+            sData.muzzleVelocityMPS, // Pass actual muzzle velocity
+            tofGuess, currentFOV,
+            crosswindMps
+            );
+        lead.interceptStatus = m_lastIntercept.status;
+    }
 
     // Update the model with the calculated offsets (these are now for the reticle)
     m_stateModel->updateCalculatedLeadOffsets(lead.leadAzimuthDegrees, lead.leadElevationDegrees, lead.status);
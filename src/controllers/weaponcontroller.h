@@ -2,6 +2,8 @@
 #define WEAPONCONTROLLER_H
 
 #include <QObject>
+#include <QElapsedTimer>
+#include <QTimer>
 
 
 class Plc42Device;
@@ -41,7 +43,9 @@ public:
     virtual void stopFiring();
     virtual void unloadAmmo();
 
-    virtual void updateFireControlSolution();
+    // Solve on the next fire-control tick (e.g. LAC toggled); the timer is the only solver
+    void requestFireControlUpdate() { m_fireControlDirty = true; }
+    const InterceptSolution& lastInterceptSolution() const { return m_lastIntercept; }
 signals:
     void weaponArmed(bool armed);
     void weaponFired();
@@ -51,6 +55,10 @@ private slots:
 
     void onSystemStateChanged(const SystemStateData &newData);
     void onActuatorPositionReached();
+    void onFireControlTimer();
+
+protected:
+    virtual void updateFireControlSolution();
 
 private:
     SystemStateModel*  m_stateModel = nullptr;
@@ -58,6 +66,18 @@ private:
     ServoActuatorDevice* m_servoActuator = nullptr;
     SystemStateData m_oldState;
     BallisticsProcessor* m_ballisticsProcessor = nullptr;
+
+    // Fire control loop: target-motion prediction and TOF iteration for lead
+    InterceptMeasurement buildInterceptMeasurement(const SystemStateData& sData);
+    static constexpr int FIRE_CONTROL_INTERVAL_MS = 50;    // Same 20 Hz as the gimbal loop
+    QTimer* m_fireControlTimer = nullptr;
+    QElapsedTimer m_fireControlClock;
+    InterceptSolver m_interceptSolver;
+    InterceptSolution m_lastIntercept;
+    quint32 m_lastLrfLaserCount = 0;
+    double m_lastLrfDistance = 0.0;
+    int m_interceptOverBudgetCount = 0;
+    bool m_fireControlDirty = false;
     
 
     bool m_weaponArmed = false;
@@ -939,10 +939,10 @@ void ZoneDefinitionController::processConfirmSaveSelect()
 
         if (success) {
             // Save to file
-            if (m_stateModel->saveZonesToFile("zones.json")) {
-                qDebug() << "Zones successfully saved to zones.json";
+            if (m_stateModel->saveZones()) {
+                qDebug() << "Zones successfully saved";
             } else {
-                qWarning() << "Failed to save zones to zones.json!";
+                qWarning() << "Failed to save zones!";
             }
 
             resetWipData();
@@ -988,14 +988,14 @@ void ZoneDefinitionController::processConfirmDeleteSelect()
 
             if (success) {
                 // Save to file
-                bool saveSuccess = m_stateModel->saveZonesToFile("zones.json");
+                bool saveSuccess = m_stateModel->saveZones();
 
                 if (saveSuccess) {
                     setupShowMessageUI(QString("%1 deleted and saved successfully!").arg(zoneTypeName));
                     qDebug() << "Successfully deleted and saved" << zoneTypeName << "ID:" << m_editingZoneId;
                 } else {
                     setupShowMessageUI(QString("%1 deleted but failed to save to file!").arg(zoneTypeName));
-                    qWarning() << "Deleted" << zoneTypeName << "but failed to save to JSON";
+                    qWarning() << "Deleted" << zoneTypeName << "but failed to save the zone store";
                 }
 
                 transitionToState(State::Show_Message);
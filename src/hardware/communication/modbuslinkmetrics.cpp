@@ -0,0 +1,236 @@
+#include "modbuslinkmetrics.h"
+#include <algorithm>
+
+namespace {
+QList<ModbusLinkMetrics*>& registry()
+{
+    static QList<ModbusLinkMetrics*> links;
+    return links;
+}
+
+bool isBitRegister(QModbusDataUnit::RegisterType type)
+{
+    return type == QModbusDataUnit::Coils || type == QModbusDataUnit::DiscreteInputs;
+}
+}
+
+ModbusLinkMetrics::ModbusLinkMetrics()
+{
+    m_clock.start();
+    registry().append(this);
+}
+
+ModbusLinkMetrics::~ModbusLinkMetrics()
+{
+    registry().removeAll(this);
+}
+
+void ModbusLinkMetrics::configure(int baudRate, int timeoutMs, int retries)
+{
+    m_baudRate = std::max(1200, baudRate);
+    m_timeoutMs = std::max(1, timeoutMs);
+    m_retries = std::max(0, retries);
+}
+
+qint64 ModbusLinkMetrics::requestStarted()
+{
+    ++m_requests;
+    m_queueDepth++;
+    m_maxQueueDepth = std::max(m_maxQueueDepth, m_queueDepth);
+    return m_clock.nsecsElapsed();
+}
+
+void ModbusLinkMetrics::requestFinished(qint64 startedNs, Outcome outcome, int requestBytes, int responseBytes)
+{
+    const qint64 nowNs = m_clock.nsecsElapsed();
+    rollWindow(nowNs);
+
+    m_queueDepth = std::max(0, m_queueDepth - 1);
+
+    // Aborted or never sent: nothing reliable to say about the line
+    if (outcome == Outcome::Failed) {
+        ++m_failures;
+        ++m_total.errors;
+        ++m_window.errors;
+        return;
+    }
+
+    const qint64 onWireNs = std::min(nowNs, std::max(startedNs, m_lastFinishNs));
+    const qint64 roundTripNs = nowNs - onWireNs;
+    m_lastFinishNs = nowNs;
+
+    int retries = m_retries;
+    if (outcome != Outcome::Timeout) {
+        const qint64 timeoutNs = static_cast<qint64>(m_timeoutMs) * 1000000;
+        retries = static_cast<int>(std::min<qint64>(m_retries, roundTripNs / timeoutNs));
+    }
+
+    const int responseOnWire = outcome == Outcome::Timeout ? 0 : responseBytes;
+    const double wireS = frameS(requestBytes) * (1 + retries) + (responseOnWire > 0 ? frameS(responseOnWire) : 0.0);
+    const double busyS = roundTripNs / 1e9;
+    m_bytes += static_cast<quint64>(requestBytes) * (1 + retries) + responseOnWire;
+
+    for (Accumulator* acc : {&m_total, &m_window}) {
+        acc->wireS += wireS;
+        acc->busyS += busyS;
+        acc->transactions++;
+        acc->retries += retries;
+        if (outcome == Outcome::Timeout) acc->timeouts++;
+        if (outcome == Outcome::Exception) acc->errors++;
+    }
+
+    m_queueWait.record(onWireNs - startedNs);
+    if (outcome == Outcome::Timeout) return;
+
+    // A slave exception is still a complete round trip
+    if (outcome == Outcome::Exception) {
+        ++m_exceptions;
+    } else {
+        ++m_responses;
+    }
+    m_latency.record(nowNs - startedNs);
+    m_roundTrip.record(roundTripNs);
+}
+
+void ModbusLinkMetrics::clearQueue()
+{
+    m_queueDepth = 0;
+}
+
+void ModbusLinkMetrics::reset()
+{
+    const qint64 nowNs = m_clock.nsecsElapsed();
+    m_resetNs = nowNs;
+    m_windowStartNs = nowNs;
+    m_maxQueueDepth = m_queueDepth;
+
+    m_latency.reset();
+    m_roundTrip.reset();
+    m_queueWait.reset();
+
+    m_total = Accumulator();
+    m_window = Accumulator();
+    m_lastWindow = Window();
+    m_requests = m_responses = m_exceptions = m_failures = m_bytes = 0;
+}
+
+double ModbusLinkMetrics::frameS(int bytes) const
+{
+    return (bytes + 3.5) * 11.0 / m_baudRate;      // Start, 8 data, parity/stop, stop + t3.5 gap
+}
+
+void ModbusLinkMetrics::rollWindow(qint64 nowNs)
+{
+    const qint64 lengthNs = nowNs - m_windowStartNs;
+    if (lengthNs < WINDOW_NS) return;
+
+    m_lastWindow = windowFrom(m_window, lengthNs / 1e9);
+    m_window = Accumulator();
+    m_windowStartNs = nowNs;
+}
+
+ModbusLinkMetrics::Window ModbusLinkMetrics::windowFrom(const Accumulator& acc, double lengthS)
+{
+    Window window;
+    window.utilisation = lengthS > 0.0 ? std::min(1.0, acc.wireS / lengthS) : 0.0;
+    window.occupancy = lengthS > 0.0 ? std::min(1.0, acc.busyS / lengthS) : 0.0;
+    window.transactions = acc.transactions;
+    window.timeouts = acc.timeouts;
+    window.retries = acc.retries;
+    window.errors = acc.errors;
+    return window;
+}
+
+ModbusLinkMetrics::Window ModbusLinkMetrics::lastWindow() const
+{
+    // A window nothing has closed yet (quiet bus) is reported as it stands
+    const qint64 lengthNs = m_clock.nsecsElapsed() - m_windowStartNs;
+    return lengthNs >= WINDOW_NS ? windowFrom(m_window, lengthNs / 1e9) : m_lastWindow;
+}
+
+QJsonObject ModbusLinkMetrics::windowToJson(const Window& window)
+{
+    QJsonObject obj;
+    obj["utilisation"] = window.utilisation;
+    obj["occupancy"] = window.occupancy;
+    obj["transactions"] = static_cast<double>(window.transactions);
+    obj["timeouts"] = static_cast<double>(window.timeouts);
+    obj["retries"] = static_cast<double>(window.retries);
+    obj["errors"] = static_cast<double>(window.errors);
+    return obj;
+}
+
+QJsonObject ModbusLinkMetrics::toJson() const
+{
+    const double elapsedS = (m_clock.nsecsElapsed() - m_resetNs) / 1e9;
+
+    QJsonObject totals;
+    totals["requests"] = static_cast<double>(m_requests);
+    totals["responses"] = static_cast<double>(m_responses);
+    totals["exceptions"] = static_cast<double>(m_exceptions);
+    totals["timeouts"] = static_cast<double>(m_total.timeouts);
+    totals["retries"] = static_cast<double>(m_total.retries);
+    totals["failures"] = static_cast<double>(m_failures);
+    totals["bytes"] = static_cast<double>(m_bytes);
+    totals["utilisation"] = windowFrom(m_total, elapsedS).utilisation;
+    totals["occupancy"] = windowFrom(m_total, elapsedS).occupancy;
+    totals["elapsedS"] = elapsedS;
+
+    QJsonObject root;
+    root["baudRate"] = m_baudRate;
+    root["timeoutMs"] = m_timeoutMs;
+    root["retries"] = m_retries;
+    root["queueDepth"] = m_queueDepth;
+    root["maxQueueDepth"] = m_maxQueueDepth;
+    root["totals"] = totals;
+    root["window"] = windowToJson(lastWindow());
+    root["latency"] = m_latency.toJson();
+    root["roundTrip"] = m_roundTrip.toJson();
+    root["queueWait"] = m_queueWait.toJson();
+    return root;
+}
+
+QList<const ModbusLinkMetrics*> ModbusLinkMetrics::all()
+{
+    QList<const ModbusLinkMetrics*> links;
+    for (const ModbusLinkMetrics* link : registry()) {
+        if (!link->busName().isEmpty()) {
+            links.append(link);
+        }
+    }
+    return links;
+}
+
+QJsonObject ModbusLinkMetrics::allToJson()
+{
+    QJsonObject buses;
+    for (const ModbusLinkMetrics* link : all()) {
+        buses[link->busName()] = link->toJson();
+    }
+    return buses;
+}
+
+ModbusLinkMetrics::Outcome ModbusLinkMetrics::outcomeFor(QModbusDevice::Error error)
+{
+    switch (error) {
+    case QModbusDevice::NoError: return Outcome::Ok;
+    case QModbusDevice::ProtocolError: return Outcome::Exception;
+    case QModbusDevice::TimeoutError: return Outcome::Timeout;
+    default: return Outcome::Failed;
+    }
+}
+
+int ModbusLinkMetrics::readResponseBytes(QModbusDataUnit::RegisterType type, int count)
+{
+    // Slave, function, byte count, data, CRC
+    const int dataBytes = isBitRegister(type) ? (count + 7) / 8 : 2 * count;
+    return 5 + dataBytes;
+}
+
+int ModbusLinkMetrics::writeRequestBytes(QModbusDataUnit::RegisterType type, int count)
+{
+    // The client uses function 05/06 for a single value, 15/16 otherwise
+    if (count <= 1) return 8;
+    const int dataBytes = isBitRegister(type) ? (count + 7) / 8 : 2 * count;
+    return 9 + dataBytes;
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include "utils/latencyhistogram.h"
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QList>
+#include <QModbusDataUnit>
+#include <QModbusDevice>
+#include <QString>
+
+/**
+ * @brief Round-trip, error and line-usage statistics for one Modbus RTU bus.
+ *
+ * Owned by the transport, which reports each request as it is handed to the
+ * client and again when its reply finishes. The client serves its queue in
+ * order on a half-duplex line, so a request is on the wire from the later of
+ * its submission and the previous completion; the difference is queue wait.
+ *
+ * Utilisation is the frame time actually transmitted (11 bits per character
+ * plus the t3.5 gap, request and response) over the baud capacity; occupancy
+ * is the share of time a transaction was outstanding, which adds turnaround,
+ * slave processing and time lost waiting for timeouts. Both are reported for
+ * the last full one-second window.
+ *
+ * The client retries silently, so retries are inferred: a reply whose round
+ * trip spans n response timeouts was sent n + 1 times, and a timeout was sent
+ * 1 + retries times.
+ *
+ * Main thread only, like the transports.
+ */
+class ModbusLinkMetrics
+{
+public:
+    enum class Outcome { Ok, Exception, Timeout, Failed };
+
+    struct Window {
+        double utilisation = 0.0;
+        double occupancy = 0.0;
+        quint64 transactions = 0;
+        quint64 timeouts = 0;
+        quint64 retries = 0;
+        quint64 errors = 0;              // Exceptions and failures
+    };
+
+    ModbusLinkMetrics();
+    ~ModbusLinkMetrics();
+
+    void setBusName(const QString& busName) { m_busName = busName; }
+    QString busName() const { return m_busName; }
+
+    void configure(int baudRate, int timeoutMs, int retries);
+
+    // Returns the submission timestamp to hand back to requestFinished()
+    qint64 requestStarted();
+    void requestFinished(qint64 startedNs, Outcome outcome, int requestBytes, int responseBytes);
+
+    // Link closed: outstanding requests will not be reported
+    void clearQueue();
+    void reset();
+
+    int queueDepth() const { return m_queueDepth; }
+    const LatencyHistogram& roundTrip() const { return m_roundTrip; }
+    Window lastWindow() const;
+
+    /**
+     * @brief { baudRate, timeoutMs, retries, queueDepth, maxQueueDepth, totals: {...},
+     *          window: {...}, latency: {...}, roundTrip: {...}, queueWait: {...} }
+     */
+    QJsonObject toJson() const;
+
+    // Every named bus (REST stats, status panel)
+    static QList<const ModbusLinkMetrics*> all();
+    static QJsonObject allToJson();
+
+    static Outcome outcomeFor(QModbusDevice::Error error);
+
+    // RTU frame sizes including address and CRC
+    static int readRequestBytes() { return 8; }
+    static int readResponseBytes(QModbusDataUnit::RegisterType type, int count);
+    static int writeRequestBytes(QModbusDataUnit::RegisterType type, int count);
+    static int writeResponseBytes() { return 8; }
+    static int exceptionResponseBytes() { return 5; }
+
+private:
+    struct Accumulator {
+        double wireS = 0.0;
+        double busyS = 0.0;
+        quint64 transactions = 0;
+        quint64 timeouts = 0;
+        quint64 retries = 0;
+        quint64 errors = 0;
+    };
+
+    double frameS(int bytes) const;
+    void rollWindow(qint64 nowNs);
+    static Window windowFrom(const Accumulator& acc, double lengthS);
+    static QJsonObject windowToJson(const Window& window);
+
+    QString m_busName;
+    int m_baudRate = 9600;
+    int m_timeoutMs = 500;
+    int m_retries = 3;
+
+    QElapsedTimer m_clock;
+    qint64 m_resetNs = 0;
+    qint64 m_lastFinishNs = 0;
+    int m_queueDepth = 0;
+    int m_maxQueueDepth = 0;
+
+    LatencyHistogram m_latency;       // Submission -> reply, as the device sees it
+    LatencyHistogram m_roundTrip;     // On the wire -> reply
+    LatencyHistogram m_queueWait;     // Submission -> on the wire
+
+    Accumulator m_total;
+    quint64 m_requests = 0;
+    quint64 m_responses = 0;
+    quint64 m_exceptions = 0;
+    quint64 m_failures = 0;
+    quint64 m_bytes = 0;
+
+    qint64 m_windowStartNs = 0;
+    Accumulator m_window;
+    Window m_lastWindow;
+
+    static constexpr qint64 WINDOW_NS = 1000000000;
+};
@@ -0,0 +1,315 @@
+#include "modbuspollscheduler.h"
+#include "modbuslinkmetrics.h"
+#include <QJsonArray>
+#include <QList>
+#include <QTimer>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+QList<ModbusPollScheduler*>& registry()
+{
+    static QList<ModbusPollScheduler*> schedulers;
+    return schedulers;
+}
+}
+
+ModbusPollScheduler::ModbusPollScheduler(const QString& busName, QObject* parent)
+    : QObject(parent),
+    m_busName(busName),
+    m_timer(new QTimer(this)),
+    m_inFlightGuard(new QTimer(this))
+{
+    m_timer->setSingleShot(true);
+    m_timer->setTimerType(Qt::PreciseTimer);
+    connect(m_timer, &QTimer::timeout, this, &ModbusPollScheduler::dispatch);
+
+    // A reply that never comes back must not stall the bus
+    m_inFlightGuard->setSingleShot(true);
+    m_inFlightGuard->setInterval(IN_FLIGHT_TIMEOUT_MS);
+    connect(m_inFlightGuard, &QTimer::timeout, this, [this]() {
+        if (m_inFlight >= 0) {
+            qWarning() << "ModbusPollScheduler:" << m_busName << "no reply for"
+                       << m_blocks.at(m_inFlight).block.name;
+            complete(m_inFlight, Result::Failed);
+        }
+    });
+
+    registry().append(this);
+}
+
+ModbusPollScheduler::~ModbusPollScheduler()
+{
+    registry().removeAll(this);
+}
+
+void ModbusPollScheduler::configureBus(int baudRate, double budget, double turnaroundMs)
+{
+    m_baudRate = std::max(1200, baudRate);
+    m_budget = std::clamp(budget, 0.05, 1.0);
+    m_turnaroundMs = std::max(0.0, turnaroundMs);
+
+    for (BlockState& state : m_blocks) {
+        state.transactionMs = frameMs(ModbusLinkMetrics::readRequestBytes()) + m_turnaroundMs
+                            + frameMs(ModbusLinkMetrics::readResponseBytes(state.block.registerType, state.block.count));
+    }
+    replan();
+}
+
+int ModbusPollScheduler::addBlock(const Block& block)
+{
+    BlockState state;
+    state.block = block;
+    state.block.intervalMs = std::max(1, block.intervalMs);
+    state.transactionMs = frameMs(ModbusLinkMetrics::readRequestBytes()) + m_turnaroundMs
+                        + frameMs(ModbusLinkMetrics::readResponseBytes(block.registerType, block.count));
+    m_blocks.append(state);
+
+    replan();
+    armTimer();
+    return m_blocks.size() - 1;
+}
+
+void ModbusPollScheduler::clearBlocks()
+{
+    m_blocks.clear();
+    m_inFlight = -1;
+    m_inFlightGuard->stop();
+    replan();
+}
+
+void ModbusPollScheduler::setBlockInterval(int block, int intervalMs)
+{
+    if (block < 0 || block >= m_blocks.size()) return;
+    m_blocks[block].block.intervalMs = std::max(1, intervalMs);
+    replan();
+    armTimer();
+}
+
+void ModbusPollScheduler::setBlockEnabled(int block, bool enabled)
+{
+    if (block < 0 || block >= m_blocks.size() || m_blocks.at(block).enabled == enabled) return;
+    m_blocks[block].enabled = enabled;
+    m_blocks[block].backoffLevel = 0;
+    m_blocks[block].failureLevel = 0;
+    replan();
+    armTimer();
+}
+
+void ModbusPollScheduler::setActivity(Activity activity)
+{
+    if (m_activity == activity) return;
+    m_activity = activity;
+    replan();
+    armTimer();
+}
+
+void ModbusPollScheduler::start()
+{
+    m_clock.start();
+    for (BlockState& state : m_blocks) {
+        state.lastStartMs = -1;
+        state.nextDueMs = 0;
+        state.backoffLevel = 0;
+        state.failureLevel = 0;
+    }
+    m_inFlight = -1;
+    m_running = true;
+
+    replan();
+    armTimer();
+}
+
+void ModbusPollScheduler::stop()
+{
+    m_running = false;
+    m_inFlight = -1;
+    m_timer->stop();
+    m_inFlightGuard->stop();
+}
+
+void ModbusPollScheduler::complete(int block, Result result)
+{
+    // Late reply for a read the guard already gave up on
+    if (block != m_inFlight) return;
+
+    m_inFlight = -1;
+    m_inFlightGuard->stop();
+
+    BlockState& state = m_blocks[block];
+    if (result == Result::Failed) {
+        ++state.failures;
+        if (requestedIntervalMs(state) < std::max(state.block.backoffMaxIntervalMs, FAILURE_BACKOFF_MAX_MS)) {
+            ++state.failureLevel;
+        }
+    } else {
+        state.failureLevel = 0;
+        if (result == Result::Changed) {
+            state.backoffLevel = 0;
+        } else if (requestedIntervalMs(state) < state.block.backoffMaxIntervalMs) {
+            ++state.backoffLevel;
+        }
+    }
+
+    replan();
+    armTimer();
+}
+
+int ModbusPollScheduler::requestedIntervalMs(const BlockState& state) const
+{
+    const Block& block = state.block;
+    int intervalMs = block.intervalMs;
+    if (m_activity == Activity::Active && block.activeIntervalMs > 0) {
+        intervalMs = block.activeIntervalMs;
+    } else if (m_activity == Activity::Idle && block.idleIntervalMs > 0) {
+        intervalMs = block.idleIntervalMs;
+    }
+
+    if (block.backoffMaxIntervalMs > intervalMs && state.backoffLevel > 0) {
+        const qint64 backedOff = static_cast<qint64>(intervalMs) << std::min(state.backoffLevel, 20);
+        intervalMs = static_cast<int>(std::min<qint64>(backedOff, block.backoffMaxIntervalMs));
+    }
+
+    const int failureCeilingMs = std::max(block.backoffMaxIntervalMs, FAILURE_BACKOFF_MAX_MS);
+    if (state.failureLevel > 0 && failureCeilingMs > intervalMs) {
+        const qint64 backedOff = static_cast<qint64>(intervalMs) << std::min(state.failureLevel, 20);
+        intervalMs = static_cast<int>(std::min<qint64>(backedOff, failureCeilingMs));
+    }
+    return intervalMs;
+}
+
+int ModbusPollScheduler::effectiveIntervalMs(int block) const
+{
+    if (block < 0 || block >= m_blocks.size()) return 0;
+    return static_cast<int>(std::ceil(requestedIntervalMs(m_blocks.at(block)) * m_stretch));
+}
+
+double ModbusPollScheduler::transactionMs(int block) const
+{
+    if (block < 0 || block >= m_blocks.size()) return 0.0;
+    return m_blocks.at(block).transactionMs;
+}
+
+double ModbusPollScheduler::busLoad() const
+{
+    return m_requestedLoad / m_stretch;
+}
+
+void ModbusPollScheduler::replan()
+{
+    double load = 0.0;
+    for (const BlockState& state : m_blocks) {
+        if (state.enabled) {
+            load += state.transactionMs / requestedIntervalMs(state);
+        }
+    }
+
+    const double previousStretch = m_stretch;
+    m_requestedLoad = load;
+    m_stretch = load > m_budget ? load / m_budget : 1.0;
+
+    if (m_stretch > 1.0 && previousStretch <= 1.0) {
+        qWarning().noquote() << QString("ModbusPollScheduler: %1 schedule needs %2% of the line, budget %3% - stretching intervals x%4")
+                                    .arg(m_busName)
+                                    .arg(load * 100.0, 0, 'f', 1)
+                                    .arg(m_budget * 100.0, 0, 'f', 0)
+                                    .arg(m_stretch, 0, 'f', 2);
+    }
+
+    // A rate change takes effect from each block's last read, not its next one
+    for (int i = 0; i < m_blocks.size(); ++i) {
+        BlockState& state = m_blocks[i];
+        if (i != m_inFlight && state.lastStartMs >= 0) {
+            state.nextDueMs = state.lastStartMs + effectiveIntervalMs(i);
+        }
+    }
+}
+
+void ModbusPollScheduler::armTimer()
+{
+    if (m_running && m_inFlight < 0) {
+        m_timer->start(0);
+    }
+}
+
+void ModbusPollScheduler::dispatch()
+{
+    if (!m_running || m_inFlight >= 0) return;
+
+    int next = -1;
+    for (int i = 0; i < m_blocks.size(); ++i) {
+        const BlockState& state = m_blocks.at(i);
+        if (state.enabled && (next < 0 || state.nextDueMs < m_blocks.at(next).nextDueMs)) {
+            next = i;
+        }
+    }
+    if (next < 0) return;
+
+    const qint64 nowMs = m_clock.elapsed();
+    BlockState& state = m_blocks[next];
+    if (state.nextDueMs > nowMs) {
+        m_timer->start(static_cast<int>(state.nextDueMs - nowMs));
+        return;
+    }
+
+    m_inFlight = next;
+    state.lastStartMs = nowMs;
+    ++state.polls;
+    m_inFlightGuard->start();
+    emit pollDue(next);
+}
+
+double ModbusPollScheduler::frameMs(int bytes) const
+{
+    return (bytes + 3.5) * 11.0 * 1000.0 / m_baudRate;     // Start, 8 data, parity/stop, stop + t3.5 gap
+}
+
+const char* ModbusPollScheduler::activityName(Activity activity)
+{
+    switch (activity) {
+    case Activity::Idle: return "idle";
+    case Activity::Normal: return "normal";
+    case Activity::Active: return "active";
+    }
+    return "unknown";
+}
+
+QJsonObject ModbusPollScheduler::toJson() const
+{
+    QJsonArray blocks;
+    for (int i = 0; i < m_blocks.size(); ++i) {
+        const BlockState& state = m_blocks.at(i);
+        const int intervalMs = effectiveIntervalMs(i);
+
+        QJsonObject obj;
+        obj["name"] = state.block.name;
+        obj["enabled"] = state.enabled;
+        obj["intervalMs"] = intervalMs;
+        obj["rateHz"] = state.enabled ? 1000.0 / intervalMs : 0.0;
+        obj["transactionMs"] = state.transactionMs;
+        obj["backoff"] = state.backoffLevel;
+        obj["failureBackoff"] = state.failureLevel;
+        obj["polls"] = static_cast<double>(state.polls);
+        obj["failures"] = static_cast<double>(state.failures);
+        blocks.append(obj);
+    }
+
+    QJsonObject root;
+    root["baudRate"] = m_baudRate;
+    root["budget"] = m_budget;
+    root["load"] = busLoad();
+    root["requestedLoad"] = m_requestedLoad;
+    root["activity"] = activityName(m_activity);
+    root["blocks"] = blocks;
+    return root;
+}
+
+QJsonObject ModbusPollScheduler::allToJson()
+{
+    QJsonObject buses;
+    for (const ModbusPollScheduler* scheduler : registry()) {
+        buses[scheduler->busName()] = scheduler->toJson();
+    }
+    return buses;
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QModbusDataUnit>
+#include <QObject>
+#include <QString>
+#include <QVector>
+
+class QTimer;
+
+/**
+ * @brief Decides which register block a Modbus RTU device reads next, and when.
+ *
+ * One scheduler per bus. The device registers its read blocks, connects
+ * pollDue() to issue the request and reports each reply with complete();
+ * only one scheduled read is on the wire at a time, and the most overdue
+ * block goes first.
+ *
+ * Each block has three nominal intervals selected by the device's activity
+ * (an axis slewing or tracking wants fresher position than one parked), and
+ * blocks with a backoff ceiling double their interval on every unchanged
+ * reply up to that ceiling, dropping back on the first change. Temperatures
+ * and environment registers use this. Failed reads back off the same way, up
+ * to the larger of the block's ceiling and FAILURE_BACKOFF_MAX_MS, so a dead
+ * link or a register the slave does not serve stops occupying the line.
+ *
+ * The planned bus time (RTU frame time of each transaction times its rate)
+ * is kept within the bus budget by stretching every interval by the same
+ * factor; the remaining share of the line is left for commands.
+ *
+ * Main thread only, like the transports.
+ */
+class ModbusPollScheduler : public QObject {
+    Q_OBJECT
+public:
+    enum class Activity { Idle, Normal, Active };
+    enum class Result { Changed, Unchanged, Failed };
+
+    struct Block {
+        QString name;
+        QModbusDataUnit::RegisterType registerType = QModbusDataUnit::HoldingRegisters;
+        int count = 1;                   // Registers or bits read
+        int intervalMs = 50;
+        int activeIntervalMs = 0;        // 0 = intervalMs
+        int idleIntervalMs = 0;          // 0 = intervalMs
+        int backoffMaxIntervalMs = 0;    // Above the nominal interval enables backoff on unchanged replies
+    };
+
+    explicit ModbusPollScheduler(const QString& busName, QObject* parent = nullptr);
+    ~ModbusPollScheduler() override;
+
+    QString busName() const { return m_busName; }
+
+    // Line timing: 11 bits per character, t3.5 gaps, driver turnaround between request and reply
+    void configureBus(int baudRate, double budget, double turnaroundMs);
+
+    int addBlock(const Block& block);
+    void clearBlocks();
+    void setBlockInterval(int block, int intervalMs);
+    void setBlockEnabled(int block, bool enabled);
+
+    void setActivity(Activity activity);
+    Activity activity() const { return m_activity; }
+
+    void start();
+    void stop();
+    bool isRunning() const { return m_running; }
+
+    // Reply (or failure) for the block last handed out by pollDue()
+    void complete(int block, Result result);
+
+    int effectiveIntervalMs(int block) const;
+    double transactionMs(int block) const;
+
+    // Share of the line the current schedule occupies, 0..1
+    double busLoad() const;
+    double requestedBusLoad() const { return m_requestedLoad; }
+    double budget() const { return m_budget; }
+
+    /**
+     * @brief { baudRate, budget, load, requestedLoad, activity, blocks: [ { name, intervalMs, rateHz, transactionMs, backoff, failureBackoff, polls, failures } ] }
+     */
+    QJsonObject toJson() const;
+
+    // Every live scheduler keyed by bus name (REST stats)
+    static QJsonObject allToJson();
+
+    static const char* activityName(Activity activity);
+
+signals:
+    void pollDue(int block);
+
+private:
+    struct BlockState {
+        Block block;
+        double transactionMs = 0.0;
+        int backoffLevel = 0;
+        int failureLevel = 0;
+        bool enabled = true;
+        qint64 lastStartMs = -1;
+        qint64 nextDueMs = 0;
+        quint64 polls = 0;
+        quint64 failures = 0;
+    };
+
+    int requestedIntervalMs(const BlockState& state) const;
+    void replan();
+    void dispatch();
+    void armTimer();
+    double frameMs(int bytes) const;
+
+    QString m_busName;
+    int m_baudRate = 115200;
+    double m_budget = 0.6;
+    double m_turnaroundMs = 1.0;
+
+    QVector<BlockState> m_blocks;
+    Activity m_activity = Activity::Normal;
+    double m_requestedLoad = 0.0;
+    double m_stretch = 1.0;
+
+    QTimer* m_timer;
+    QTimer* m_inFlightGuard;
+    QElapsedTimer m_clock;
+    int m_inFlight = -1;
+    bool m_running = false;
+
+    static constexpr int IN_FLIGHT_TIMEOUT_MS = 3000;   // Longer than client timeout x retries
+    static constexpr int FAILURE_BACKOFF_MAX_MS = 2000; // Below the device watchdogs, so reconnects are seen
+};
@@ -34,6 +34,9 @@ bool ModbusTransport::open(const QJsonObject& config) {
     m_client->setTimeout(config["timeoutMs"].toInt(500));
     m_client->setNumberOfRetries(config["retries"].toInt(3));
 
+    m_metrics.setBusName(objectName().isEmpty() ? port : objectName());
+    m_metrics.configure(baudRate, m_client->timeout(), m_client->numberOfRetries());
+
     if (!m_client->connectDevice()) {
         QString error = QString("ModbusTransport: Failed to connect to %1 (slave %2) - %3")
                         .arg(port).arg(m_slaveId).arg(m_client->errorString());
@@ -49,6 +52,7 @@ bool ModbusTransport::open(const QJsonObject& config) {
 void ModbusTransport::close() {
     if (m_client->state() != QModbusDevice::UnconnectedState)
         m_client->disconnectDevice();
+    m_metrics.clearQueue();
     emit connectionStateChanged(false);
 }
 
@@ -64,6 +68,8 @@ QModbusReply* ModbusTransport::sendReadRequest(const QModbusDataUnit &unit) {
 
     QModbusReply *reply = m_client->sendReadRequest(unit, m_slaveId);
     if (reply) {
+        trackReply(reply, ModbusLinkMetrics::readRequestBytes(),
+                   ModbusLinkMetrics::readResponseBytes(unit.registerType(), static_cast<int>(unit.valueCount())));
         connect(reply, &QModbusReply::finished, this, [this, reply]() {
             if (reply->error() == QModbusDevice::NoError) {
                 //qDebug() << "ModbusTransport: Read reply received successfully from slave" << m_slaveId;
@@ -90,6 +96,8 @@ QModbusReply* ModbusTransport::sendWriteRequest(const QModbusDataUnit &unit) {
 
     QModbusReply *reply = m_client->sendWriteRequest(unit, m_slaveId);
     if (reply) {
+        trackReply(reply, ModbusLinkMetrics::writeRequestBytes(unit.registerType(), static_cast<int>(unit.valueCount())),
+                   ModbusLinkMetrics::writeResponseBytes());
         connect(reply, &QModbusReply::finished, this, [this, reply]() {
             if (reply->error() == QModbusDevice::NoError) {
                 //qDebug() << "ModbusTransport: Write reply received successfully from slave" << m_slaveId;
@@ -104,6 +112,18 @@ QModbusReply* ModbusTransport::sendWriteRequest(const QModbusDataUnit &unit) {
     return reply;
 }
 
+void ModbusTransport::trackReply(QModbusReply* reply, int requestBytes, int responseBytes) {
+    if (reply->isFinished()) return;     // Broadcast: nothing comes back
+
+    const qint64 startedNs = m_metrics.requestStarted();
+    connect(reply, &QModbusReply::finished, this, [this, reply, startedNs, requestBytes, responseBytes]() {
+        const auto outcome = ModbusLinkMetrics::outcomeFor(reply->error());
+        const int bytes = outcome == ModbusLinkMetrics::Outcome::Exception
+            ? ModbusLinkMetrics::exceptionResponseBytes() : responseBytes;
+        m_metrics.requestFinished(startedNs, outcome, requestBytes, bytes);
+    });
+}
+
 void ModbusTransport::onStateChanged(QModbusDevice::State state) {
     bool connected = (state == QModbusDevice::ConnectedState);
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "../interfaces/Transport.h"
+#include "modbuslinkmetrics.h"
 #include <QModbusRtuSerialClient>
 #include <QJsonObject>
 
@@ -25,6 +26,9 @@ public:
     QModbusRtuSerialClient* client() const { return m_client; }
     QObject* clientObject() const { return m_client; }
 
+    // Named after objectName(), or the port when unset
+    const ModbusLinkMetrics& metrics() const { return m_metrics; }
+
 signals:
     void modbusReplyReady(QModbusReply* reply);
 
@@ -33,7 +37,10 @@ private slots:
     void onModbusError(QModbusDevice::Error err);
 
 private:
+    void trackReply(QModbusReply* reply, int requestBytes, int responseBytes);
+
     QModbusRtuSerialClient* m_client;
     QJsonObject m_config;
     int m_slaveId; // FIXED: Store slave ID from config
+    ModbusLinkMetrics m_metrics;
 };
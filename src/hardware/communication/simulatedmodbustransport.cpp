@@ -0,0 +1,100 @@
+#include "simulatedmodbustransport.h"
+#include <QDebug>
+
+SimulatedModbusTransport::SimulatedModbusTransport(SimulatedServoAxis* axis, double turnaroundS, QObject* parent)
+    : Transport(parent),
+    m_axis(axis),
+    m_turnaroundS(turnaroundS)
+{
+    m_link.configure(230400, m_turnaroundS);
+}
+
+bool SimulatedModbusTransport::open(const QJsonObject& config) {
+    m_slaveId = config["slaveId"].toInt(1);
+    m_link.configure(config["baudRate"].toInt(230400), m_turnaroundS);
+    m_link.reset(m_nowS);
+    m_metrics.setBusName(objectName().isEmpty() ? config["port"].toString() : objectName());
+    m_metrics.configure(config["baudRate"].toInt(230400), config["timeoutMs"].toInt(500), 0);
+    m_open = true;
+
+    qDebug() << "SimulatedModbusTransport: Simulated slave" << m_slaveId
+             << "at" << config["baudRate"].toInt(230400) << "baud";
+    emit connectionStateChanged(true);
+    return true;
+}
+
+void SimulatedModbusTransport::close() {
+    m_open = false;
+    for (Pending& pending : m_pending) {
+        if (pending.reply) {
+            pending.reply->setError(QModbusDevice::ConnectionError, "Simulated link closed");
+        }
+    }
+    m_pending.clear();
+    m_metrics.clearQueue();
+    emit connectionStateChanged(false);
+}
+
+QModbusReply* SimulatedModbusTransport::sendReadRequest(const QModbusDataUnit &unit) {
+    if (!m_open) {
+        emit linkError("SimulatedModbusTransport: not open");
+        return nullptr;
+    }
+
+    auto* reply = new QModbusReply(QModbusReply::Common, m_slaveId, this);
+    const int requestBytes = ModbusLinkModel::readRequestBytes();
+    const int responseBytes = ModbusLinkModel::readResponseBytes(static_cast<int>(unit.valueCount()));
+    const double completion = m_link.schedule(m_nowS, requestBytes, responseBytes);
+    m_pending.push_back({completion, reply, unit, false, m_metrics.requestStarted(), requestBytes, responseBytes});
+    return reply;
+}
+
+QModbusReply* SimulatedModbusTransport::sendWriteRequest(const QModbusDataUnit &unit) {
+    if (!m_open) {
+        emit linkError("SimulatedModbusTransport: not open");
+        return nullptr;
+    }
+
+    auto* reply = new QModbusReply(QModbusReply::Common, m_slaveId, this);
+    const int requestBytes = ModbusLinkModel::writeRequestBytes(static_cast<int>(unit.valueCount()));
+    const int responseBytes = ModbusLinkModel::writeResponseBytes();
+    const double completion = m_link.schedule(m_nowS, requestBytes, responseBytes);
+    m_pending.push_back({completion, reply, unit, true, m_metrics.requestStarted(), requestBytes, responseBytes});
+    return reply;
+}
+
+void SimulatedModbusTransport::advanceTo(double nowS) {
+    m_nowS = nowS;
+    m_link.advanceTo(nowS);
+
+    // The line is serial: transactions complete in submission order
+    while (!m_pending.empty() && m_pending.front().completionS <= nowS) {
+        Pending pending = m_pending.front();
+        m_pending.pop_front();
+        m_metrics.requestFinished(pending.startedNs, ModbusLinkMetrics::Outcome::Ok,
+                                  pending.requestBytes, pending.responseBytes);
+
+        const int start = pending.unit.startAddress();
+        if (pending.write) {
+            const QList<quint16> values = pending.unit.values();
+            m_axis->writeRegisters(start, std::vector<uint16_t>(values.cbegin(), values.cend()));
+        }
+        if (!pending.reply) continue;
+
+        if (!pending.write) {
+            const std::vector<uint16_t> registers = m_axis->readRegisters(start, static_cast<int>(pending.unit.valueCount()));
+            QModbusDataUnit result(pending.unit.registerType(), start,
+                                   QList<quint16>(registers.cbegin(), registers.cend()));
+            pending.reply->setResult(result);
+        } else {
+            pending.reply->setResult(pending.unit);
+        }
+        pending.reply->setFinished(true);
+        emit modbusReplyReady(pending.reply);
+    }
+}
+
+void SimulatedModbusTransport::resetStats() {
+    m_link.reset(m_nowS);
+    m_metrics.reset();
+}
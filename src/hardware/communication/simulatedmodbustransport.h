@@ -0,0 +1,60 @@
+#pragma once
+#include "../interfaces/Transport.h"
+#include "../simulation/gimbalplant.h"
+#include "modbuslinkmetrics.h"
+#include <QJsonObject>
+#include <QModbusDataUnit>
+#include <QModbusReply>
+#include <QPointer>
+#include <deque>
+
+/**
+ * @brief ModbusTransport stand-in that talks to a simulated AZD-KX axis.
+ *
+ * Same invokable interface as ModbusTransport, so ServoDriverDevice runs
+ * unchanged. Each request is timed on a ModbusLinkModel and completes when
+ * the simulation advances past its response: writes reach the axis then and
+ * read replies carry the registers at that moment. The same bus metrics as
+ * the real transport are kept, so the REST stats cover simulated runs.
+ */
+class SimulatedModbusTransport : public Transport {
+    Q_OBJECT
+public:
+    SimulatedModbusTransport(SimulatedServoAxis* axis, double turnaroundS, QObject* parent = nullptr);
+
+    bool open(const QJsonObject& config) override;
+    void close() override;
+    void sendFrame(const QByteArray& /*frame*/) override { /* no-op */ }
+
+    Q_INVOKABLE QModbusReply* sendReadRequest(const QModbusDataUnit &unit);
+    Q_INVOKABLE QModbusReply* sendWriteRequest(const QModbusDataUnit &unit);
+
+    // Completes every transaction whose response has arrived by nowS (simulated seconds)
+    void advanceTo(double nowS);
+    void resetStats();
+    const ModbusLinkModel::Stats& stats() const { return m_link.stats(); }
+    const ModbusLinkMetrics& metrics() const { return m_metrics; }
+
+signals:
+    void modbusReplyReady(QModbusReply* reply);
+
+private:
+    struct Pending {
+        double completionS;
+        QPointer<QModbusReply> reply;
+        QModbusDataUnit unit;
+        bool write;
+        qint64 startedNs;
+        int requestBytes;
+        int responseBytes;
+    };
+
+    SimulatedServoAxis* m_axis;
+    ModbusLinkModel m_link;
+    ModbusLinkMetrics m_metrics;
+    double m_turnaroundS;
+    double m_nowS = 0.0;
+    int m_slaveId = 1;
+    bool m_open = false;
+    std::deque<Pending> m_pending;
+};
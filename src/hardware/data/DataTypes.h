@@ -279,6 +279,88 @@ struct Plc21PanelData {
     }
 };
 
+/**
+ * @brief PLC21 report-by-exception: the fields of a poll that changed.
+ *
+ * Only the fields flagged in `changed` are meaningful in `data`; the rest
+ * carry the sender's current values and must not be applied.
+ */
+struct Plc21PanelDelta {
+    enum Field : quint32 {
+        Connected        = 1u << 0,
+        ArmGun           = 1u << 1,
+        LoadAmmunition   = 1u << 2,
+        EnableStation    = 1u << 3,
+        HomePosition     = 1u << 4,
+        Stabilization    = 1u << 5,
+        Authorize        = 1u << 6,
+        SwitchCamera     = 1u << 7,
+        MenuUp           = 1u << 8,
+        MenuDown         = 1u << 9,
+        MenuVal          = 1u << 10,
+        Speed            = 1u << 11,
+        FireMode         = 1u << 12,
+        PanelTemperature = 1u << 13,
+        All              = (1u << 14) - 1,
+
+        // Fields carried by each Modbus block
+        InputFields      = ArmGun | LoadAmmunition | EnableStation | HomePosition | Stabilization |
+                           Authorize | SwitchCamera | MenuUp | MenuDown | MenuVal,
+        AnalogFields     = Speed | FireMode | PanelTemperature
+    };
+
+    quint32 changed = 0;
+    Plc21PanelData data;
+
+    bool isEmpty() const { return changed == 0; }
+    bool has(Field field) const { return (changed & field) != 0; }
+
+    static Plc21PanelDelta between(const Plc21PanelData &before, const Plc21PanelData &after) {
+        Plc21PanelDelta delta;
+        delta.data = after;
+        auto flag = [&delta](bool differs, Field field) { if (differs) delta.changed |= field; };
+        flag(before.isConnected != after.isConnected, Connected);
+        flag(before.armGunSW != after.armGunSW, ArmGun);
+        flag(before.loadAmmunitionSW != after.loadAmmunitionSW, LoadAmmunition);
+        flag(before.enableStationSW != after.enableStationSW, EnableStation);
+        flag(before.homePositionSW != after.homePositionSW, HomePosition);
+        flag(before.enableStabilizationSW != after.enableStabilizationSW, Stabilization);
+        flag(before.authorizeSw != after.authorizeSw, Authorize);
+        flag(before.switchCameraSW != after.switchCameraSW, SwitchCamera);
+        flag(before.menuUpSW != after.menuUpSW, MenuUp);
+        flag(before.menuDownSW != after.menuDownSW, MenuDown);
+        flag(before.menuValSw != after.menuValSw, MenuVal);
+        flag(before.speedSW != after.speedSW, Speed);
+        flag(before.fireMode != after.fireMode, FireMode);
+        flag(before.panelTemperature != after.panelTemperature, PanelTemperature);
+        return delta;
+    }
+
+    static Plc21PanelDelta full(const Plc21PanelData &data) {
+        Plc21PanelDelta delta;
+        delta.changed = All;
+        delta.data = data;
+        return delta;
+    }
+
+    void applyTo(Plc21PanelData &target) const {
+        if (has(Connected)) target.isConnected = data.isConnected;
+        if (has(ArmGun)) target.armGunSW = data.armGunSW;
+        if (has(LoadAmmunition)) target.loadAmmunitionSW = data.loadAmmunitionSW;
+        if (has(EnableStation)) target.enableStationSW = data.enableStationSW;
+        if (has(HomePosition)) target.homePositionSW = data.homePositionSW;
+        if (has(Stabilization)) target.enableStabilizationSW = data.enableStabilizationSW;
+        if (has(Authorize)) target.authorizeSw = data.authorizeSw;
+        if (has(SwitchCamera)) target.switchCameraSW = data.switchCameraSW;
+        if (has(MenuUp)) target.menuUpSW = data.menuUpSW;
+        if (has(MenuDown)) target.menuDownSW = data.menuDownSW;
+        if (has(MenuVal)) target.menuValSw = data.menuValSw;
+        if (has(Speed)) target.speedSW = data.speedSW;
+        if (has(FireMode)) target.fireMode = data.fireMode;
+        if (has(PanelTemperature)) target.panelTemperature = data.panelTemperature;
+    }
+};
+
 /**
  * @brief PLC42 data structure
  */
@@ -305,6 +387,10 @@ struct Plc42Data {
     uint16_t solenoidState = 0;
     uint16_t resetAlarm = 0;
 
+    // Input registers (station environment sensors)
+    int16_t stationTemperature = 0;     // Celsius
+    uint16_t stationPressure = 0;       // hPa, 0 = sensor not reporting
+
     bool operator!=(const Plc42Data &other) const {
         return (isConnected != other.isConnected ||
                 stationUpperSensor != other.stationUpperSensor ||
@@ -322,7 +408,9 @@ struct Plc42Data {
                 azimuthDirection != other.azimuthDirection ||
                 elevationDirection != other.elevationDirection ||
                 solenoidState != other.solenoidState ||
-                resetAlarm != other.resetAlarm);
+                resetAlarm != other.resetAlarm ||
+                stationTemperature != other.stationTemperature ||
+                stationPressure != other.stationPressure);
     }
 };
 
@@ -1,12 +1,16 @@
 #include "cameravideostreamdevice.h"
-#include "vpi_helpers.h" // For CHECK_VPI_STATUS
+#include "services/detectionservice.h"
+#include "utils/latencyhistogram.h"
+#include "utils/reticleaimpointcalculator.h"
 
 #include <QDebug>
 #include <QElapsedTimer>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <stdexcept>
 
 #include <opencv2/imgcodecs.hpp>
-#include <cuda_runtime.h>
 
 
 CameraVideoStreamDevice::CameraVideoStreamDevice(int cameraIndex,
@@ -14,6 +18,7 @@ CameraVideoStreamDevice::CameraVideoStreamDevice(int cameraIndex,
                                int sourceWidth,
                                int sourceHeight,
                                SystemStateModel* stateModel,
+                               DetectionService* detectionService,
                                QObject *parent)
     : QThread(parent), // Base class first
     // Configuration & Identification (in declaration order)
@@ -24,8 +29,7 @@ CameraVideoStreamDevice::CameraVideoStreamDevice(int cameraIndex,
     m_outputWidth(1024),
     m_outputHeight(768),
     m_stateModel(stateModel),
-    m_maxTrackedTargets(1),     // const int - declared early
-    m_abortRequest(false),      // atomic<bool> - declared after maxTrackedTargets
+    m_abortRequest(false),
     
     // State variables in declaration order
     m_stabEnabled(false),
@@ -47,24 +51,23 @@ CameraVideoStreamDevice::CameraVideoStreamDevice(int cameraIndex,
     m_appSink(nullptr),
     m_gstLoop(nullptr),
     
-    // VPI Components & State (in declaration order)
-    m_vpiBackend(VPI_BACKEND_CUDA),
-    m_vpiStream(nullptr),
-    m_dcfPayload(nullptr),
-    m_cropScalePayload(nullptr),
-    m_vpiFrameNV12(nullptr),
-    m_vpiTgtPatches(nullptr),
-    m_vpiInTargets(nullptr),
-    m_vpiOutTargets(nullptr),
-    m_vpiConfidenceScores(nullptr),
-    m_vpiTgtPatchSize(0),
-    m_currentTarget(),          // VPIDCFTrackedBoundingBox
-    m_velocityTimer(),          // QElapsedTimer
+    // Tracker Backend & State (in declaration order)
+    m_trackingBackendName("VPI_BACKEND_CUDA"),
+    m_tracker(),
+    m_currentTarget(),          // TrackedTarget, starts LOST
     m_lastTargetCenterX_px(0.0f),
     m_lastTargetCenterY_px(0.0f),
     
-    // OpenCV Buffers
-    m_yuy2_host_buffer(),       // cv::Mat
+    // Replay
+    m_replay(),
+    m_replayState(),
+    m_lastPts(GST_CLOCK_TIME_NONE),
+    
+    // Negotiated format & conversion
+    m_videoInfo(),
+    m_videoCaps(nullptr),
+    m_frameConverter(detectionService ? detectionService->inputShape() : cv::Size(640, 640)),
+    m_detectionTensor(),
     
     // State Variables (in declaration order from header)
     m_currentMode(OperationalMode::Surveillance),
@@ -95,20 +98,14 @@ CameraVideoStreamDevice::CameraVideoStreamDevice(int cameraIndex,
     m_colorStyle(70, 226, 165),
     m_isLacActiveForReticle(false),
     
-    // YoloInference Engine (last member)
-    m_inference("/home/rapit/yolov8s.onnx",
-                cv::Size(640, 640),
-                "", // classes.txt path
-                false), // use CUDA
+    // Shared detection service
+    m_detectionService(detectionService),
     
     // Frame counter
     m_frameCount(0)
     // m_stateMutex is default constructed (no initialization needed)
 {
 
-    memset(&m_currentTarget, 0, sizeof(m_currentTarget));
-    m_currentTarget.state = VPI_TRACKING_STATE_LOST;
-
         // Sanity check calculated width (should be even for YUY2)
         if (m_outputWidth % 2 != 0) {
             qWarning() << "Calculated output width" << m_outputWidth << "is odd, adjusting to" << m_outputWidth - 1;
@@ -162,7 +159,7 @@ CameraVideoStreamDevice::~CameraVideoStreamDevice()
              wait();
         }
     }
-    cleanupVPI();
+    cleanupTracker();
     cleanupGStreamer();
     qInfo() << "CameraVideoStreamDevice cleanup complete for Cam" << m_cameraIndex;
 }
@@ -181,6 +178,33 @@ void CameraVideoStreamDevice::stop()
     }
 }
 
+void CameraVideoStreamDevice::setTrackingBackend(const QString &backendName)
+{
+    if (isRunning()) {
+        qWarning() << "Cam" << m_cameraIndex << ": Tracking backend must be set before the thread starts.";
+        return;
+    }
+    m_trackingBackendName = backendName;
+}
+
+void CameraVideoStreamDevice::setReplayOptions(const ReplayOptions &options)
+{
+    if (isRunning()) {
+        qWarning() << "Cam" << m_cameraIndex << ": Replay options must be set before the thread starts.";
+        return;
+    }
+    m_replay = options;
+    qInfo() << "Cam" << m_cameraIndex << ": Replay mode, source:" << m_replay.source
+            << "state file:" << (m_replay.stateFile.isEmpty() ? QString("<none>") : m_replay.stateFile)
+            << (m_replay.realtime ? "(real-time)" : "(as fast as possible)");
+
+    // Loaded here, before the thread starts, since onSystemStateChanged() checks it
+    m_replayState.clear();
+    if (!m_replay.stateFile.isEmpty() && !m_replayState.load(m_replay.stateFile)) {
+        qWarning() << "Cam" << m_cameraIndex << ": Replaying without recorded state, using live state instead.";
+    }
+}
+
 
 
 // setTrackingEnabled() method (No changes needed based on errors)
@@ -192,7 +216,7 @@ void CameraVideoStreamDevice::setTrackingEnabled(bool enabled)
     if (!enabled) {
         m_trackerInitialized = false;
          qInfo() << "Cam" << m_cameraIndex << ": Tracking disabled, tracker marked for re-initialization.";
-         m_currentTarget.state = VPI_TRACKING_STATE_LOST;
+         m_currentTarget.state = TRACKING_STATE_LOST;
     }
 }
 
@@ -208,7 +232,7 @@ void CameraVideoStreamDevice::run()
     qInfo() << "CameraVideoStreamDevice thread started for Camera" << m_cameraIndex;
     emit statusUpdate(m_cameraIndex, "Initializing...");
 
-    bool vpiInitialized = false;
+    bool trackerInitialized = false;
     bool gstInitialized = false;
 
     try {
@@ -217,12 +241,10 @@ void CameraVideoStreamDevice::run()
         if (!gstInitialized) throw std::runtime_error("GStreamer initialization failed.");
         qInfo() << "GStreamer initialized successfully for Camera" << m_cameraIndex;
 
-        emit statusUpdate(m_cameraIndex, "Initializing VPI...");
-        vpiInitialized = initializeVPI();
-        if (!vpiInitialized) throw std::runtime_error("VPI initialization failed.");
-        qInfo() << "VPI initialized successfully for Camera" << m_cameraIndex;
-
-        m_yuy2_host_buffer.create(m_sourceHeight, m_sourceWidth, CV_8UC2);
+        emit statusUpdate(m_cameraIndex, "Initializing tracker...");
+        trackerInitialized = initializeTracker();
+        if (!trackerInitialized) throw std::runtime_error("Tracker initialization failed.");
+        qInfo() << "Tracker" << m_tracker->name() << "initialized successfully for Camera" << m_cameraIndex;
 
         emit statusUpdate(m_cameraIndex, "Starting GStreamer pipeline...");
         if (gst_element_set_state(m_pipeline, GST_STATE_PLAYING) == GST_STATE_CHANGE_FAILURE) {
@@ -254,10 +276,10 @@ void CameraVideoStreamDevice::run()
         qInfo() << "Cam" << m_cameraIndex << ": Pipeline state set to NULL.";
     }
 
-    if (vpiInitialized) {
-        qInfo() << "Cam" << m_cameraIndex << ": Cleaning up VPI resources...";
-        cleanupVPI();
-         qInfo() << "Cam" << m_cameraIndex << ": VPI cleanup finished.";
+    if (trackerInitialized) {
+        qInfo() << "Cam" << m_cameraIndex << ": Cleaning up tracker resources...";
+        cleanupTracker();
+         qInfo() << "Cam" << m_cameraIndex << ": Tracker cleanup finished.";
     }
 
     if (gstInitialized) {
@@ -336,6 +358,32 @@ void CameraVideoStreamDevice::onSystemStateChanged(const SystemStateData &newSta
     m_currentLeadAngleOffsetAz = newState.leadAngleOffsetAz;     // ⭐ ADD
     m_currentLeadAngleOffsetEl = newState.leadAngleOffsetEl;
 
+    m_currentPredictedTargetValid = newState.predictedTargetValid;
+    m_currentPredictedTargetCoasting = newState.predictedTargetCoasting;
+    m_currentPredictedTargetAz = newState.predictedTargetAz;
+    m_currentPredictedTargetEl = newState.predictedTargetEl;
+
+    // Keep a short timestamped history so each frame can be paired with the
+    // gimbal/IMU state closest to its capture time rather than the latest one.
+    // During replay the history is fed from the recorded state track instead.
+    if (!m_replayState.isLoaded()) {
+        StateSample sample;
+        sample.timestampNs = FrameLatencyMonitor::nowNs();
+        sample.azimuth = newState.gimbalAz;
+        sample.elevation = newState.gimbalEl;
+        sample.imuRollDeg = newState.imuRollDeg;
+        sample.imuPitchDeg = newState.imuPitchDeg;
+        sample.imuYawDeg = newState.imuYawDeg;
+        sample.gyroX = newState.GyroX;
+        sample.gyroY = newState.GyroY;
+        sample.gyroZ = newState.GyroZ;
+        sample.accelX = newState.AccelX;
+        sample.accelY = newState.AccelY;
+        sample.accelZ = newState.AccelZ;
+        sample.lrfDistance = newState.lrfDistance;
+        pushStateSample(sample);
+    }
+
     // ⭐ UPDATE DETECTION STATE
     m_detectionEnabled.store(newState.detectionEnabled);
 }
@@ -375,16 +423,9 @@ bool CameraVideoStreamDevice::initializeGStreamer()
         .arg(m_cropLeft)
         .arg(m_cropRight);
 */
-    QString pipelineStr = QString(
-                              "v4l2src device=%1 do-timestamp=true ! "
-                              "image/jpeg,width=%2,height=%3,framerate=30/1 ! jpegdec ! video/x-raw ! "
-                              "aspectratiocrop aspect-ratio=4/3 ! "
-                              "videoscale  ! "
-                              "video/x-raw,width=1024,height=768 ! "
-                              "videoconvert ! video/x-raw,format=YUY2 ! " // Explicit conversion
-                              "queue max-size-buffers=2 leaky=downstream ! "
-                              "appsink name=mysink emit-signals=true max-buffers=2 drop=true sync=false"
-                              ).arg(m_deviceName).arg(m_sourceWidth).arg(m_sourceHeight);
+    m_lastPts = GST_CLOCK_TIME_NONE;
+
+    const QString pipelineStr = buildPipelineDescription();
 
     qInfo() << "Cam" << m_cameraIndex << " GStreamer Pipeline:" << pipelineStr;
     GError *error = nullptr;
@@ -412,6 +453,7 @@ bool CameraVideoStreamDevice::initializeGStreamer()
         {nullptr, nullptr, nullptr}            // _gst_reserved array
     };*/
     GstAppSinkCallbacks callbacks = {};
+    callbacks.eos = &CameraVideoStreamDevice::on_eos_from_sink;
     callbacks.new_sample = &CameraVideoStreamDevice::on_new_sample_from_sink;
     //GstAppSinkCallbacks callbacks = {nullptr, nullptr, &CameraVideoStreamDevice::on_new_sample_from_sink, nullptr};
     gst_app_sink_set_callbacks(GST_APP_SINK(m_appSink), &callbacks, this, nullptr);
@@ -423,6 +465,60 @@ bool CameraVideoStreamDevice::initializeGStreamer()
     return true;
 }
 
+QString CameraVideoStreamDevice::buildPipelineDescription() const
+{
+    // Everything after the source is shared between live and replay so the
+    // benchmark exercises the same conversion/scaling path as the cameras.
+    const QString processing = QString(
+                                   "aspectratiocrop aspect-ratio=4/3 ! "
+                                   "videoscale  ! "
+                                   "video/x-raw,width=%1,height=%2 ! "
+                                   // Passthrough when the decoder already outputs I420/YUY2; the fused
+                                   // converter in processFrame() handles either layout.
+                                   "videoconvert ! video/x-raw,format={ I420, YUY2 } ! "
+                                   ).arg(m_outputWidth).arg(m_outputHeight);
+
+    if (!isReplay()) {
+        return QString(
+                   "v4l2src device=%1 do-timestamp=true ! "
+                   "image/jpeg,width=%2,height=%3,framerate=30/1 ! jpegdec ! video/x-raw ! "
+                   ).arg(m_deviceName).arg(m_sourceWidth).arg(m_sourceHeight)
+               + processing
+               + "queue max-size-buffers=2 leaky=downstream ! "
+                 "appsink name=mysink emit-signals=true max-buffers=2 drop=true sync=false";
+    }
+
+    QString source;
+    if (m_replay.source.startsWith("videotestsrc")) {
+        source = QString("%1 is-live=%2 ! video/x-raw,width=%3,height=%4,framerate=30/1 ! ")
+                     .arg(m_replay.source, m_replay.realtime ? QStringLiteral("true") : QStringLiteral("false"))
+                     .arg(m_sourceWidth).arg(m_sourceHeight);
+    } else {
+        QString location = m_replay.source;
+        location.replace('"', "\\\"");
+        source = QString("filesrc location=\"%1\" ! decodebin ! videoconvert ! ").arg(location);
+    }
+
+    // Real-time: the sink paces buffers on their PTS and drops late ones, like a
+    // live camera. Flat out: no clock sync and no dropping, the pipeline back-pressures.
+    const QString sink = m_replay.realtime
+        ? "queue max-size-buffers=2 leaky=downstream ! "
+          "appsink name=mysink emit-signals=true max-buffers=2 drop=true sync=true"
+        : "queue max-size-buffers=2 ! "
+          "appsink name=mysink emit-signals=true max-buffers=2 drop=false sync=false";
+
+    return source + processing + sink;
+}
+
+void CameraVideoStreamDevice::on_eos_from_sink(GstAppSink *sink, gpointer user_data)
+{
+    Q_UNUSED(sink);
+    CameraVideoStreamDevice *processor = static_cast<CameraVideoStreamDevice *>(user_data);
+    qInfo() << "Cam" << processor->m_cameraIndex << ": End of stream.";
+    if (processor->m_gstLoop && g_main_loop_is_running(processor->m_gstLoop))
+        g_main_loop_quit(processor->m_gstLoop);
+}
+
 void CameraVideoStreamDevice::cleanupGStreamer()
 {
     qInfo() << "Cam" << m_cameraIndex << ": Cleaning up GStreamer...";
@@ -433,6 +529,7 @@ void CameraVideoStreamDevice::cleanupGStreamer()
         g_main_loop_unref(m_gstLoop); m_gstLoop = nullptr;
          qInfo() << "Cam" << m_cameraIndex << ": Unreferenced GStreamer main loop.";
     }
+    gst_caps_replace(&m_videoCaps, nullptr);
     if (m_pipeline) {
         gst_object_unref(m_pipeline); m_pipeline = nullptr; m_appSink = nullptr;
          qInfo() << "Cam" << m_cameraIndex << ": Unreferenced GStreamer pipeline.";
@@ -473,9 +570,70 @@ GstFlowReturn CameraVideoStreamDevice::handleNewSample(GstAppSink *sink)
         gst_sample_unref(sample); return GST_FLOW_ERROR;
     }
 
+    // Re-parse the negotiated format only when the caps actually change
+    GstCaps *caps = gst_sample_get_caps(sample);
+    if (caps && caps != m_videoCaps) {
+        if (!gst_video_info_from_caps(&m_videoInfo, caps)) {
+            qWarning() << "Cam" << m_cameraIndex << ": Failed to parse sample caps.";
+            gst_sample_unref(sample); return GST_FLOW_ERROR;
+        }
+        gst_caps_replace(&m_videoCaps, caps);
+        qInfo() << "Cam" << m_cameraIndex << ": Negotiated format"
+                << gst_video_format_to_string(GST_VIDEO_INFO_FORMAT(&m_videoInfo))
+                << GST_VIDEO_INFO_WIDTH(&m_videoInfo) << "x" << GST_VIDEO_INFO_HEIGHT(&m_videoInfo);
+    }
+
+    // Capture time on the monotonic clock: with do-timestamp=true the PTS is the
+    // running time at capture, and the pipeline clock is the system monotonic clock.
+    // When replaying flat out there is no clock sync, so the PTS has no relation
+    // to wall time and the frame counts as captured when it reaches the sink.
+    FrameLatencyMonitor &latency = FrameLatencyMonitor::instance();
+    const qint64 sampleNs = FrameLatencyMonitor::nowNs();
+    qint64 captureNs = sampleNs;
+    const GstClockTime pts = GST_BUFFER_PTS(buffer);
+    if (GST_CLOCK_TIME_IS_VALID(pts) && m_pipeline && (!isReplay() || m_replay.realtime)) {
+        captureNs = static_cast<qint64>(gst_element_get_base_time(m_pipeline) + pts);
+    }
+    latency.record(m_cameraIndex, FrameStage::CaptureToSample, sampleNs - captureNs);
+
+    // Frames lost upstream (leaky queue, appsink drop) show up as PTS gaps
+    if (GST_CLOCK_TIME_IS_VALID(pts)) {
+        const GstClockTime frameDuration = GST_VIDEO_INFO_FPS_N(&m_videoInfo) > 0
+            ? gst_util_uint64_scale_int(GST_SECOND, GST_VIDEO_INFO_FPS_D(&m_videoInfo), GST_VIDEO_INFO_FPS_N(&m_videoInfo))
+            : GST_BUFFER_DURATION(buffer);
+        if (GST_CLOCK_TIME_IS_VALID(m_lastPts) && GST_CLOCK_TIME_IS_VALID(frameDuration)
+            && frameDuration > 0 && pts > m_lastPts) {
+            const guint64 missed = (pts - m_lastPts + frameDuration / 2) / frameDuration;
+            if (missed > 1)
+                latency.recordDroppedFrames(m_cameraIndex, missed - 1);
+        }
+        m_lastPts = pts;
+
+        // Recorded gimbal/IMU state for this frame, stamped with its capture time
+        ReplayStateSample recorded;
+        if (m_replayState.sampleAt(static_cast<qint64>(pts), recorded)) {
+            StateSample sample;
+            sample.timestampNs = captureNs;
+            sample.azimuth = recorded.azimuth;
+            sample.elevation = recorded.elevation;
+            sample.imuRollDeg = recorded.imuRollDeg;
+            sample.imuPitchDeg = recorded.imuPitchDeg;
+            sample.imuYawDeg = recorded.imuYawDeg;
+            sample.gyroX = recorded.gyroX;
+            sample.gyroY = recorded.gyroY;
+            sample.gyroZ = recorded.gyroZ;
+            sample.accelX = recorded.accelX;
+            sample.accelY = recorded.accelY;
+            sample.accelZ = recorded.accelZ;
+            sample.lrfDistance = recorded.lrfDistance;
+            QMutexLocker locker(&m_stateMutex);
+            pushStateSample(sample);
+        }
+    }
+
     bool success = false;
     try {
-        success = processFrame(buffer);
+        success = processFrame(buffer, captureNs, sampleNs);
     } catch (const std::exception &e) {
         qCritical() << "Cam" << m_cameraIndex << ": Exception during processFrame:" << e.what();
         emit processingError(m_cameraIndex, QString("Frame Error: %1").arg(e.what()));
@@ -486,6 +644,8 @@ GstFlowReturn CameraVideoStreamDevice::handleNewSample(GstAppSink *sink)
         success = false;
     }
     gst_sample_unref(sample);
+    if (!success)
+        latency.recordDroppedFrames(m_cameraIndex);
     if (m_abortRequest.load(std::memory_order_relaxed)) {
         qDebug() << "Cam" << m_cameraIndex << ": Abort requested during frame processing.";
         return GST_FLOW_EOS;
@@ -494,146 +654,103 @@ GstFlowReturn CameraVideoStreamDevice::handleNewSample(GstAppSink *sink)
 }
 
 
-// --- VPI Handling --- (No changes needed based on errors)
-bool CameraVideoStreamDevice::initializeVPI()
+// --- Tracker Handling ---
+bool CameraVideoStreamDevice::initializeTracker()
 {
-    // CUDA device check and reset before VPI initialization
-    cudaError_t cudaStatus = cudaSetDevice(0);
-    if (cudaStatus != cudaSuccess) {
-        qWarning() << "Cam" << m_cameraIndex << ": CUDA device unavailable:"
-                   << cudaGetErrorString(cudaStatus);
-
-        // Try to reset the device
-        cudaStatus = cudaDeviceReset();
-        if (cudaStatus != cudaSuccess) {
-            qCritical() << "Cam" << m_cameraIndex << ": Failed to reset CUDA device:"
-                        << cudaGetErrorString(cudaStatus);
-            return false;
-        }
-
-        // Retry setting device
-        cudaStatus = cudaSetDevice(0);
-        if (cudaStatus != cudaSuccess) {
-            qCritical() << "Cam" << m_cameraIndex << ": CUDA device still unavailable after reset";
-            return false;
-        }
+    m_tracker = TrackerBackend::create(m_trackingBackendName, m_cameraIndex);
+    if (!m_tracker) {
+        qWarning() << "Cam" << m_cameraIndex << ": Tracking backend" << m_trackingBackendName
+                   << "unknown or not built in, falling back to" << TrackerBackend::CpuFallbackName;
+    } else if (m_tracker->initialize(m_outputWidth, m_outputHeight)) {
+        return true;
+    } else {
+        // No GPU on this host (CI, replay benchmarking): keep the pipeline running on CPU
+        qWarning() << "Cam" << m_cameraIndex << ":" << m_tracker->name()
+                   << "unavailable, falling back to" << TrackerBackend::CpuFallbackName;
+        m_tracker->cleanup();
     }
+    m_tracker = TrackerBackend::create(TrackerBackend::CpuFallbackName, m_cameraIndex);
+    if (m_tracker && m_tracker->initialize(m_outputWidth, m_outputHeight))
+        return true;
 
-    qInfo() << "Cam" << m_cameraIndex << ": CUDA device initialized successfully";
-
-    try {
-        CHECK_VPI_STATUS(vpiStreamCreate(0, &m_vpiStream));
-        CHECK_VPI_STATUS(vpiImageCreate(m_outputWidth, m_outputHeight, VPI_IMAGE_FORMAT_NV12_ER, 0, &m_vpiFrameNV12));
-        CHECK_VPI_STATUS(vpiCreateCropScaler(m_vpiBackend, 1, m_maxTrackedTargets, &m_cropScalePayload));
-        VPIDCFTrackerCreationParams dcfParams;
-        CHECK_VPI_STATUS(vpiInitDCFTrackerCreationParams(&dcfParams));
-        m_vpiTgtPatchSize = dcfParams.featurePatchSize * dcfParams.hogCellSize;
-        CHECK_VPI_STATUS(vpiCreateDCFTracker(m_vpiBackend, 1, m_maxTrackedTargets, &dcfParams, &m_dcfPayload));
-        VPIImageFormat patchFormat = (m_vpiBackend == VPI_BACKEND_PVA) ? VPI_IMAGE_FORMAT_RGB8p : VPI_IMAGE_FORMAT_RGBA8;
-        CHECK_VPI_STATUS(vpiImageCreate(m_vpiTgtPatchSize, m_vpiTgtPatchSize * m_maxTrackedTargets, patchFormat, 0, &m_vpiTgtPatches));
-        CHECK_VPI_STATUS(vpiArrayCreate(m_maxTrackedTargets, VPI_ARRAY_TYPE_DCF_TRACKED_BOUNDING_BOX, 0, &m_vpiInTargets));
-        CHECK_VPI_STATUS(vpiArrayCreate(m_maxTrackedTargets, VPI_ARRAY_TYPE_DCF_TRACKED_BOUNDING_BOX, 0, &m_vpiOutTargets));
-        // Create an array to hold the confidence scores.
-        CHECK_VPI_STATUS(vpiArrayCreate(m_maxTrackedTargets, VPI_ARRAY_TYPE_F32, 0, &m_vpiConfidenceScores));
-    } catch (const std::exception &e) {
-        qCritical() << "Cam" << m_cameraIndex << ": VPI Initialization failed:" << e.what();
-        cleanupVPI(); return false;
-    }
-    return true;
+    m_tracker.reset();
+    return false;
 }
 
-void CameraVideoStreamDevice::cleanupVPI()
+void CameraVideoStreamDevice::cleanupTracker()
 {
-    qInfo() << "Cam" << m_cameraIndex << ": Cleaning up VPI resources...";
-     if (m_vpiStream) {
-         qInfo() << "Cam" << m_cameraIndex << ": Syncing VPI stream before cleanup...";
-         VPIStatus syncStatus = vpiStreamSync(m_vpiStream);
-         if (syncStatus != VPI_SUCCESS) {
-              qWarning() << "Cam" << m_cameraIndex << ": VPI Stream sync failed during cleanup: " << vpiStatusGetName(syncStatus);
-         }
-     } else {
-          qDebug() << "Cam" << m_cameraIndex << ": VPI stream is null during cleanup.";
-     }
-    VPI_SAFE_DESTROY(vpiArrayDestroy, m_vpiInTargets);
-    VPI_SAFE_DESTROY(vpiArrayDestroy, m_vpiOutTargets);
-    VPI_SAFE_DESTROY(vpiImageDestroy, m_vpiTgtPatches);
-    VPI_SAFE_DESTROY(vpiPayloadDestroy, m_dcfPayload);
-    VPI_SAFE_DESTROY(vpiPayloadDestroy, m_cropScalePayload);
-    VPI_SAFE_DESTROY(vpiImageDestroy, m_vpiFrameNV12);
-    VPI_SAFE_DESTROY(vpiStreamDestroy, m_vpiStream);
-    VPI_SAFE_DESTROY(vpiArrayDestroy, m_vpiConfidenceScores);
-
-    // CUDA context cleanup
-    cudaError_t cudaStatus = cudaDeviceSynchronize();
-    if (cudaStatus != cudaSuccess) {
-        qWarning() << "Cam" << m_cameraIndex << ": CUDA sync failed:"
-                   << cudaGetErrorString(cudaStatus);
+    if (m_tracker) {
+        qInfo() << "Cam" << m_cameraIndex << ": Cleaning up" << m_tracker->name() << "tracker...";
+        m_tracker->cleanup();
+        m_tracker.reset();
     }
-
-    qInfo() << "Cam" << m_cameraIndex << ": Finished cleaning VPI objects.";
 }
 
 
 // --- Frame Processing Logic ---
 // processFrame: Populate FrameData, including data.trackingBbox (should compile now)
-bool CameraVideoStreamDevice::processFrame(GstBuffer *buffer)
+bool CameraVideoStreamDevice::processFrame(GstBuffer *buffer, qint64 captureNs, qint64 sampleNs)
 {
-    GstMapInfo mapInfo = GST_MAP_INFO_INIT;
-    VPIImage vpiImgInput_wrapped = nullptr;
+    FrameLatencyMonitor &latency = FrameLatencyMonitor::instance();
     cv::Mat cvFrameBGRA;
-    cv::Mat cvFrameBGR;
+    QImage displayImage;
 
     try {
-        // 1. Map GStreamer Buffer & Copy YUY2
-        if (!gst_buffer_map(buffer, &mapInfo, GST_MAP_READ)) {
-            qWarning() << "Cam" << m_cameraIndex << ": Failed to map GStreamer buffer"; return false;
+        // 1. Map GStreamer buffer in its negotiated layout
+        const GstVideoFormat format = GST_VIDEO_INFO_FORMAT(&m_videoInfo);
+        if (format != GST_VIDEO_FORMAT_YUY2 && format != GST_VIDEO_FORMAT_I420) {
+            qWarning() << "Cam" << m_cameraIndex << ": Unsupported negotiated format"
+                       << gst_video_format_to_string(format); return false;
         }
-        size_t expected_size = static_cast<size_t>(m_outputWidth * m_outputHeight * 2);
-        if (mapInfo.size < expected_size) { // Check if buffer is at least expected size
-             qWarning() << "Cam" << m_cameraIndex << ": GStreamer buffer size (" << mapInfo.size
-                        << ") smaller than expected YUY2 size (" << expected_size << ")!";
-             gst_buffer_unmap(buffer, &mapInfo); return false;
+        if (GST_VIDEO_INFO_WIDTH(&m_videoInfo) != m_outputWidth || GST_VIDEO_INFO_HEIGHT(&m_videoInfo) != m_outputHeight) {
+            qWarning() << "Cam" << m_cameraIndex << ": Frame size" << GST_VIDEO_INFO_WIDTH(&m_videoInfo)
+                       << "x" << GST_VIDEO_INFO_HEIGHT(&m_videoInfo) << "does not match expected"
+                       << m_outputWidth << "x" << m_outputHeight; return false;
         }
-        // Ensure host buffer is allocated
-        if (m_yuy2_host_buffer.empty() || m_yuy2_host_buffer.total() * m_yuy2_host_buffer.elemSize() != expected_size) {
-            m_yuy2_host_buffer.create(m_outputHeight, m_outputWidth, CV_8UC2);
+        GstVideoFrame videoFrame;
+        if (!gst_video_frame_map(&videoFrame, &m_videoInfo, buffer, GST_MAP_READ)) {
+            qWarning() << "Cam" << m_cameraIndex << ": Failed to map GStreamer buffer"; return false;
         }
-        memcpy(m_yuy2_host_buffer.data, mapInfo.data, expected_size);
-        gst_buffer_unmap(buffer, &mapInfo);
 
-        // 2. Convert YUY2 host buffer to BGRA
-        cv::cvtColor(m_yuy2_host_buffer, cvFrameBGRA, cv::COLOR_YUV2BGRA_YUY2);
-        if (cvFrameBGRA.empty()) throw std::runtime_error("cv::cvtColor failed YUY2->BGRA.");
+        YuvFrameView view;
+        view.format = (format == GST_VIDEO_FORMAT_YUY2) ? YuvFrameView::Format::YUY2 : YuvFrameView::Format::I420;
+        view.width = m_outputWidth;
+        view.height = m_outputHeight;
+        for (guint plane = 0; plane < GST_VIDEO_FRAME_N_PLANES(&videoFrame) && plane < 3; ++plane) {
+            view.planes[plane] = static_cast<const uint8_t *>(GST_VIDEO_FRAME_PLANE_DATA(&videoFrame, plane));
+            view.strides[plane] = GST_VIDEO_FRAME_PLANE_STRIDE(&videoFrame, plane);
+        }
 
-        // --- Object Detection Start ---
+        // 2. Single pass: BGRA straight into the QImage that goes to the display,
+        //    plus the letterboxed detection tensor when detection is on
         std::vector<YoloDetection> detections;
         bool detection_this_frame = m_detectionEnabled.load(std::memory_order_relaxed);
+        const bool runDetection = detection_this_frame && m_detectionService;
+        YoloLetterbox letterbox;
+
+        displayImage = QImage(m_outputWidth, m_outputHeight, QImage::Format_ARGB32);
+        cvFrameBGRA = cv::Mat(m_outputHeight, m_outputWidth, CV_8UC4,
+                              displayImage.bits(), static_cast<size_t>(displayImage.bytesPerLine()));
+        try {
+            m_frameConverter.convert(view, cvFrameBGRA, runDetection ? &m_detectionTensor : nullptr, &letterbox);
+        } catch (...) {
+            gst_video_frame_unmap(&videoFrame);
+            throw;
+        }
+        gst_video_frame_unmap(&videoFrame);
+        const qint64 convertedNs = FrameLatencyMonitor::nowNs();
+        latency.record(m_cameraIndex, FrameStage::Conversion, convertedNs - sampleNs);
 
-        if (detection_this_frame) {
-            // The YoloInference class expects a BGR cv::Mat by default (due to blobFromImage swapRB=true)
-            // Or it might handle BGRA if you modify it. Let's assume BGR for now.
-            if (cvFrameBGRA.channels() == 4) {
-                cv::cvtColor(cvFrameBGRA, cvFrameBGR, cv::COLOR_BGRA2BGR);
-            } else if (cvFrameBGRA.channels() == 3) { // If it was already BGR for some reason
-                cvFrameBGR = cvFrameBGRA;
-            } else {
-                qWarning() << "Cam" << m_cameraIndex << "Unsupported channel count for detection input:" << cvFrameBGRA.channels();
-                // Potentially skip detection or handle error
-            }
-
-            if (!cvFrameBGR.empty()) {
-                QElapsedTimer detectionTimer;
-                detectionTimer.start();
-                detections = m_inference.runInference(cvFrameBGR); // Pass the BGR frame
-                qDebug() << "Cam" << m_cameraIndex << "Inference time:" << detectionTimer.elapsed() << "ms, Detections:" << detections.size();
-            }
+        // --- Object Detection Start ---
+        if (runDetection) {
+            detections = m_detectionService->detect(m_cameraIndex, m_detectionTensor, letterbox); // Batched with the other camera when possible
+            const qint64 detectionNs = FrameLatencyMonitor::nowNs() - convertedNs;
+            latency.record(m_cameraIndex, FrameStage::Detection, detectionNs);
+            qDebug() << "Cam" << m_cameraIndex << "Inference time:" << detectionNs / 1000000 << "ms, Detections:" << detections.size();
         }
         // --- Object Detection End ---
 
-        // 3. Wrap BGRA Mat for VPI input
-        CHECK_VPI_STATUS(vpiImageCreateWrapperOpenCVMat(cvFrameBGRA, 0, &vpiImgInput_wrapped));
-
-        // 4. Tracking Logic (State-Driven)
+        // 3-4. Tracking Logic (State-Driven), backend timing is recorded per call
         TrackingPhase currentPhase = m_currentTrackingPhase; // Use local cached copy
         bool amITheActiveCamera = (m_cameraIndex == 0) ? m_currentActiveCameraIsDay : !m_currentActiveCameraIsDay;
 
@@ -643,7 +760,7 @@ bool CameraVideoStreamDevice::processFrame(GstBuffer *buffer)
                 qDebug() << "[CAM" << m_cameraIndex << "] TrackingPhase is Off, resetting local tracker state.";
                 m_trackerInitialized = false;
                 m_currentTarget = {}; // Zero-initialize the struct
-                m_currentTarget.state = VPI_TRACKING_STATE_LOST;
+                m_currentTarget.state = TRACKING_STATE_LOST;
             }
         }
         // Action 2: Handle tracking operations if tracking is commanded ON in any phase
@@ -658,7 +775,7 @@ bool CameraVideoStreamDevice::processFrame(GstBuffer *buffer)
                             qDebug() << "[CAM" << m_cameraIndex << "] In Acquisition, resetting local tracker state.";
                             m_trackerInitialized = false;
                             m_currentTarget = {};
-                            m_currentTarget.state = VPI_TRACKING_STATE_LOST;
+                            m_currentTarget.state = TRACKING_STATE_LOST;
                         }
                         break;
 
@@ -666,7 +783,7 @@ bool CameraVideoStreamDevice::processFrame(GstBuffer *buffer)
                         // Is this the very first frame after receiving a Lock-On command?
                         if (!m_trackerInitialized) {
                             qDebug() << "[CAM" << m_cameraIndex << "] Initializing tracker with acquisition box...";
-                            if (initializeFirstTarget(vpiImgInput_wrapped,
+                            if (initializeFirstTarget(cvFrameBGRA,
                                                     m_currentAcquisitionBoxX_px, m_currentAcquisitionBoxY_px,
                                                     m_currentAcquisitionBoxW_px, m_currentAcquisitionBoxH_px))
                             {
@@ -674,16 +791,16 @@ bool CameraVideoStreamDevice::processFrame(GstBuffer *buffer)
                             } else {
                                 qWarning() << "[CAM" << m_cameraIndex << "] Tracker init failed. Reporting failure to model.";
                                 // Report failure to model so it can transition back to Off
-                                m_stateModel->updateTrackingResult(m_cameraIndex, false, 0,0,0,0,0,0, VPI_TRACKING_STATE_LOST);
+                                m_stateModel->updateTrackingResult(m_cameraIndex, false, 0,0,0,0,0,0, TRACKING_STATE_LOST);
                             }
                         }
                         // Fall through to runTrackingCycle if initialized (or just initialized)
                         // This allows the tracker to immediately try to localize after initialization
                         // and report its state (NEW, then hopefully TRACKED/LOST)
                         if (m_trackerInitialized) {
-                            if (!runTrackingCycle(vpiImgInput_wrapped)) {
+                            if (!runTrackingCycle(cvFrameBGRA)) {
                                 qWarning() << "Cam" << m_cameraIndex << ": Tracking cycle failed or target lost during LockPending.";
-                                // m_currentTarget.state is updated to VPI_TRACKING_STATE_LOST inside runTrackingCycle.
+                                // m_currentTarget.state is updated to TRACKING_STATE_LOST inside runTrackingCycle.
                                 // This "lost" state will be reported to the model below.
                             }
                         }
@@ -693,18 +810,18 @@ bool CameraVideoStreamDevice::processFrame(GstBuffer *buffer)
                     case TrackingPhase::Tracking_Coast:
                         // If we are initialized, we must run the tracking cycle to localize the target on the new frame.
                         if (m_trackerInitialized) {
-                            if (!runTrackingCycle(vpiImgInput_wrapped)) {
+                            if (!runTrackingCycle(cvFrameBGRA)) {
                                 qWarning() << "Cam" << m_cameraIndex << ": Tracking cycle failed or target lost during ActiveLock/Coast.";
-                                // m_currentTarget.state is updated to VPI_TRACKING_STATE_LOST inside runTrackingCycle.
+                                // m_currentTarget.state is updated to TRACKING_STATE_LOST inside runTrackingCycle.
                                 // This "lost" state will be reported to the model below.
                             }
                         } else {
                             // Anomaly: In ActiveLock/Coast but tracker not initialized. Force reset.
                             qWarning() << "[CAM" << m_cameraIndex << "] Anomaly: In ActiveLock/Coast but tracker not initialized. Resetting.";
                             m_currentTarget = {};
-                            m_currentTarget.state = VPI_TRACKING_STATE_LOST;
+                            m_currentTarget.state = TRACKING_STATE_LOST;
                             // Inform model of lost state so it can transition to Off
-                            m_stateModel->updateTrackingResult(m_cameraIndex, false, 0,0,0,0,0,0, VPI_TRACKING_STATE_LOST);
+                            m_stateModel->updateTrackingResult(m_cameraIndex, false, 0,0,0,0,0,0, TRACKING_STATE_LOST);
                         }
                         break;
 
@@ -713,14 +830,14 @@ bool CameraVideoStreamDevice::processFrame(GstBuffer *buffer)
                         // but the tracker should continue to run to maintain its internal state.
                         // However, the model's phase transition logic for Firing is external.
                         if (m_trackerInitialized) {
-                            if (!runTrackingCycle(vpiImgInput_wrapped)) {
+                            if (!runTrackingCycle(cvFrameBGRA)) {
                                 qWarning() << "Cam" << m_cameraIndex << ": Tracking cycle failed or target lost during Firing.";
                             }
                         } else {
                             qWarning() << "[CAM" << m_cameraIndex << "] Anomaly: In Firing but tracker not initialized. Resetting.";
                             m_currentTarget = {};
-                            m_currentTarget.state = VPI_TRACKING_STATE_LOST;
-                            m_stateModel->updateTrackingResult(m_cameraIndex, false, 0,0,0,0,0,0, VPI_TRACKING_STATE_LOST);
+                            m_currentTarget.state = TRACKING_STATE_LOST;
+                            m_stateModel->updateTrackingResult(m_cameraIndex, false, 0,0,0,0,0,0, TRACKING_STATE_LOST);
                         }
                         break;
 
@@ -730,7 +847,7 @@ bool CameraVideoStreamDevice::processFrame(GstBuffer *buffer)
                             qWarning() << "[CAM" << m_cameraIndex << "] Unexpected TrackingPhase: " << static_cast<int>(currentPhase) << ". Resetting tracker.";
                             m_trackerInitialized = false;
                             m_currentTarget = {};
-                            m_currentTarget.state = VPI_TRACKING_STATE_LOST;
+                            m_currentTarget.state = TRACKING_STATE_LOST;
                         }
                         break;
                 }
@@ -739,26 +856,34 @@ bool CameraVideoStreamDevice::processFrame(GstBuffer *buffer)
                      qDebug() << "[CAM" << m_cameraIndex << "] I am INACTIVE, resetting local tracker state.";
                      m_trackerInitialized = false;
                      m_currentTarget = {};
-                     m_currentTarget.state = VPI_TRACKING_STATE_LOST;
+                     m_currentTarget.state = TRACKING_STATE_LOST;
                 }
             }
         }
 
-        // This part is perfect and should be kept exactly as it is.
-        // It correctly handles all cases and passes all data to the model.
+        // State snapshot closest to the capture instant (not simply the latest one)
+        StateSample state;
+        {
+            QMutexLocker locker(&m_stateMutex);
+            state = nearestStateSample(captureNs);
+        }
+
+        // The tracking result is reported with its capture time and the gimbal pose
+        // at that instant, so the target filter can place it correctly in time.
         if (m_stateModel) {
-            bool trackerIsValidThisFrame = (m_trackerInitialized && m_currentTarget.state == VPI_TRACKING_STATE_TRACKED);
+            bool trackerIsValidThisFrame = (m_trackerInitialized && m_currentTarget.state == TRACKING_STATE_TRACKED);
             float cX_px = 0.0f, cY_px = 0.0f, tW_px = 0.0f, tH_px = 0.0f;
             float velX_px_s = 0.0f, velY_px_s = 0.0f;
 
             if (trackerIsValidThisFrame) {
-                cX_px = m_currentTarget.bbox.left + m_currentTarget.bbox.width / 2.0f;
-                cY_px = m_currentTarget.bbox.top + m_currentTarget.bbox.height / 2.0f;
-                tW_px = static_cast<float>(m_currentTarget.bbox.width);
-                tH_px = static_cast<float>(m_currentTarget.bbox.height);
-
-                qint64 ms_elapsed = m_velocityTimer.restart();
-                double dt_s = ms_elapsed / 1000.0;
+                cX_px = m_currentTarget.bbox.x() + m_currentTarget.bbox.width() / 2.0f;
+                cY_px = m_currentTarget.bbox.y() + m_currentTarget.bbox.height() / 2.0f;
+                tW_px = static_cast<float>(m_currentTarget.bbox.width());
+                tH_px = static_cast<float>(m_currentTarget.bbox.height());
+
+                // Frame-to-frame velocity on capture timestamps, not processing time
+                double dt_s = (captureNs - m_lastTargetCaptureNs) / 1e9;
+                m_lastTargetCaptureNs = captureNs;
                 if (dt_s > 1e-6 && m_lastTargetCenterX_px > 0) {
                     velX_px_s = (cX_px - m_lastTargetCenterX_px) / dt_s;
                     velY_px_s = (cY_px - m_lastTargetCenterY_px) / dt_s;
@@ -773,48 +898,45 @@ bool CameraVideoStreamDevice::processFrame(GstBuffer *buffer)
             // Call the model's update method (using the new name if you changed it)
             m_stateModel->updateTrackingResult(m_cameraIndex, trackerIsValidThisFrame,
                                                cX_px, cY_px, tW_px, tH_px,
-                                               velX_px_s, velY_px_s, m_currentTarget.state);
+                                               velX_px_s, velY_px_s, m_currentTarget.state,
+                                               captureNs, state.azimuth, state.elevation);
         }
          // --- END OF SystemStateModel UPDATE ---
 
-        // 5. Sync VPI
-        CHECK_VPI_STATUS(vpiStreamSync(m_vpiStream));
-
         // 6. Prepare FrameData
         FrameData data;
         data.cameraIndex = m_cameraIndex;
-        data.baseImage = cvMatToQImage(cvFrameBGRA);
-        if (data.baseImage.isNull()) qWarning() << "Cam" << m_cameraIndex << ": Failed convert cv::Mat to QImage";
+        data.captureTimestampNs = captureNs;
+        data.stateTimestampNs = state.timestampNs;
+        data.baseImage = displayImage; // Already BGRA in QImage memory, no extra copy
+        if (data.baseImage.isNull()) qWarning() << "Cam" << m_cameraIndex << ": Display image is null";
 
         //data.trackingEnabled = tracking_this_frame;
         data.trackerInitialized = m_trackerInitialized;
-        data.trackingState = m_currentTarget.state; // VPITrackingState
+        data.trackingState = m_currentTarget.state; // TrackingState
 
-        // >>> *** Convert VPIRectI (m_currentTarget.bbox) to QRect (data.trackingBbox) ***
-        data.trackingBbox = QRect(m_currentTarget.bbox.left,
-                                                            m_currentTarget.bbox.top,
-                                                            m_currentTarget.bbox.width,
-                                                            m_currentTarget.bbox.height);
+        data.trackingBbox = m_currentTarget.bbox;
+        data.trackingConfidence = m_currentTarget.confidence;
         data.cameraFOV = m_cameraFOV;
         data.currentOpMode = m_currentMode;
         data.motionMode = m_motionMode;
         data.stabEnabled = m_stabEnabled;
-        data.azimuth = m_currentAzimuth;
-        data.elevation = m_currentElevation;
+        data.azimuth = state.azimuth;
+        data.elevation = state.elevation;
         data.imuConnected = m_imuConnected;
-        data.imuRollDeg = m_imuRollDeg;
-        data.imuPitchDeg = m_imuPitchDeg;
-        data.imuYawDeg = m_imuYawDeg;           // Vehicle heading for azimuth calculation
+        data.imuRollDeg = state.imuRollDeg;
+        data.imuPitchDeg = state.imuPitchDeg;
+        data.imuYawDeg = state.imuYawDeg;       // Vehicle heading for azimuth calculation
         data.imuTemp = m_imuTemp;
-        data.gyroX = m_gyroX;
-        data.gyroY = m_gyroY;
-        data.gyroZ = m_gyroZ;
-        data.accelX = m_accelX;
-        data.accelY = m_accelY;
-        data.accelZ = m_accelZ;
+        data.gyroX = state.gyroX;
+        data.gyroY = state.gyroY;
+        data.gyroZ = state.gyroZ;
+        data.accelX = state.accelX;
+        data.accelY = state.accelY;
+        data.accelZ = state.accelZ;
 
         data.speed = m_speed;
-        data.lrfDistance = m_lrfDistance;
+        data.lrfDistance = state.lrfDistance;
         data.sysCharged = m_sysCharged;
         data.gunArmed = m_sysArmed;
         data.sysReady = m_sysReady;
@@ -847,205 +969,117 @@ bool CameraVideoStreamDevice::processFrame(GstBuffer *buffer)
         data.leadAngleStatus = m_currentLeadAngleStatus;           // ⭐ ADD
         data.leadAngleOffsetAz_deg = m_currentLeadAngleOffsetAz;  // ⭐ ADD
         data.leadAngleOffsetEl_deg = m_currentLeadAngleOffsetEl;  // ⭐ ADD
+
+        // Place the predicted target relative to the pose this frame was captured at
+        if (m_currentPredictedTargetValid && m_cameraFOV > 0.01f) {
+            const double offsetAz = std::remainder(m_currentPredictedTargetAz - state.azimuth, 360.0);
+            const double offsetEl = m_currentPredictedTargetEl - state.elevation;
+            const QPointF predictedPx = ReticleAimpointCalculator::angularOffsetToImagePositionPx(
+                static_cast<float>(offsetAz), static_cast<float>(offsetEl),
+                m_cameraFOV, m_outputWidth, m_outputHeight);
+            data.predictedTargetValid = true;
+            data.predictedTargetCoasting = m_currentPredictedTargetCoasting;
+            data.predictedTargetX_px = static_cast<float>(predictedPx.x());
+            data.predictedTargetY_px = static_cast<float>(predictedPx.y());
+        }
         // 7. Emit FrameData
-        if (!data.baseImage.isNull()) emit frameDataReady(data);
+        data.emitTimestampNs = FrameLatencyMonitor::nowNs();
+        latency.record(m_cameraIndex, FrameStage::SampleToEmit, data.emitTimestampNs - sampleNs);
+        latency.record(m_cameraIndex, FrameStage::CaptureToEmit, data.emitTimestampNs - captureNs);
+        if (state.timestampNs > 0)
+            latency.record(m_cameraIndex, FrameStage::StateSkew, std::abs(captureNs - state.timestampNs));
+        if (!data.baseImage.isNull()) {
+            latency.recordProcessedFrame(m_cameraIndex);
+            emit frameDataReady(data);
+        }
 
     } catch (const std::exception &e) {
         qCritical() << "Cam" << m_cameraIndex << ": Exception in processFrame loop:" << e.what();
         emit processingError(m_cameraIndex, QString("Frame Loop Error: %1").arg(e.what()));
-        VPI_SAFE_DESTROY(vpiImageDestroy, vpiImgInput_wrapped); return false;
+        return false;
     }
 
-    // 8. Destroy Wrapper
-    VPI_SAFE_DESTROY(vpiImageDestroy, vpiImgInput_wrapped);
     return true;
 }
 
 
-// initializeFirstTarget() method (No changes needed based on errors)
-/*bool CameraVideoStreamDevice::initializeFirstTarget(VPIImage vpiFrameInput)
-{
-    qInfo() << "Cam" << m_cameraIndex << ": Initializing first tracker target...";
-    try {
-        float boxW = std::min(100.0f, static_cast<float>(m_outputWidth * 0.2f));
-        float boxH = std::min(100.0f, static_cast<float>(m_outputHeight * 0.2f));
-        float boxX =   m_currentReticleAimpointImageX_px  - boxW / 2.0f;  // Use outputWidth
-        float boxY =    m_currentReticleAimpointImageY_px - boxH  / 2.0f; // Use outputHeight
-
-        VPIArrayData targetsData;
-        CHECK_VPI_STATUS(vpiArrayLockData(m_vpiInTargets, VPI_LOCK_WRITE, VPI_ARRAY_BUFFER_HOST_AOS, &targetsData));
-        if (targetsData.buffer.aos.capacity < 1) {
-             qCritical() << "Cam" << m_cameraIndex << ": VPI target array capacity is zero!";
-             vpiArrayUnlock(m_vpiInTargets); return false;
-        }
-        auto *pTarget = static_cast<VPIDCFTrackedBoundingBox *>(targetsData.buffer.aos.data);
-        pTarget->bbox.left   = static_cast<int32_t>(boxX);
-        pTarget->bbox.top    = static_cast<int32_t>(boxY);
-        pTarget->bbox.width  = static_cast<int32_t>(boxW);
-        pTarget->bbox.height = static_cast<int32_t>(boxH);
-        pTarget->state       = VPI_TRACKING_STATE_NEW;
-        pTarget->seqIndex    = 0;
-        pTarget->filterLR    = 0.075f;
-        pTarget->filterChannelWeightsLR = 0.1f;
-        pTarget->userData    = nullptr;
-        m_currentTarget = *pTarget;
-        *targetsData.buffer.aos.sizePointer = 1;
-        CHECK_VPI_STATUS(vpiArrayUnlock(m_vpiInTargets));
-
-        CHECK_VPI_STATUS(vpiSubmitConvertImageFormat(m_vpiStream, VPI_BACKEND_CUDA, vpiFrameInput, m_vpiFrameNV12, nullptr));
-        CHECK_VPI_STATUS(vpiSubmitCropScalerBatch(m_vpiStream, 0, m_cropScalePayload, &m_vpiFrameNV12,
-                                                  1, m_vpiInTargets, m_vpiTgtPatchSize, m_vpiTgtPatchSize, m_vpiTgtPatches));
-        CHECK_VPI_STATUS(vpiSubmitDCFTrackerUpdateBatch(m_vpiStream, 0, m_dcfPayload, nullptr, 0,
-                                                        nullptr, nullptr, m_vpiTgtPatches, m_vpiInTargets, nullptr));
-        CHECK_VPI_STATUS(vpiStreamSync(m_vpiStream));
-    } catch (const std::exception &e) {
-        qCritical() << "Cam" << m_cameraIndex << ": Failed init first target:" << e.what();
-        m_currentTarget.state = VPI_TRACKING_STATE_LOST; m_trackerInitialized = false; return false;
-    }
-    return true;
-}*/
-
-bool CameraVideoStreamDevice::initializeFirstTarget(VPIImage vpiFrameInput, float boxX, float boxY, float boxW, float boxH)
+bool CameraVideoStreamDevice::initializeFirstTarget(const cv::Mat &frameBGRA, float boxX, float boxY, float boxW, float boxH)
 {
     qInfo() << "Cam" << m_cameraIndex << ": Initializing first tracker target with BBox at"
             << boxX << "," << boxY << "Size" << boxW << "x" << boxH;
-    try {
-        // We now use the passed-in box parameters directly
-        VPIArrayData targetsData;
-        CHECK_VPI_STATUS(vpiArrayLockData(m_vpiInTargets, VPI_LOCK_WRITE, VPI_ARRAY_BUFFER_HOST_AOS, &targetsData));
-        if (targetsData.buffer.aos.capacity < 1) {
-             qCritical() << "Cam" << m_cameraIndex << ": VPI target array capacity is zero!";
-             vpiArrayUnlock(m_vpiInTargets); return false;
-        }
-        auto *pTarget = static_cast<VPIDCFTrackedBoundingBox *>(targetsData.buffer.aos.data);
-        pTarget->bbox.left   = static_cast<int32_t>(boxX);
-        pTarget->bbox.top    = static_cast<int32_t>(boxY);
-        pTarget->bbox.width  = static_cast<int32_t>(boxW);
-        pTarget->bbox.height = static_cast<int32_t>(boxH);
-        pTarget->state       = VPI_TRACKING_STATE_NEW;
-        pTarget->seqIndex    = 0;
-        pTarget->filterLR    = 0.075f;
-        pTarget->filterChannelWeightsLR = 0.1f;
-        pTarget->userData    = nullptr;
-        m_currentTarget = *pTarget;
-        *targetsData.buffer.aos.sizePointer = 1;
-        CHECK_VPI_STATUS(vpiArrayUnlock(m_vpiInTargets));
-
-        CHECK_VPI_STATUS(vpiSubmitConvertImageFormat(m_vpiStream, VPI_BACKEND_CUDA, vpiFrameInput, m_vpiFrameNV12, nullptr));
-        CHECK_VPI_STATUS(vpiSubmitCropScalerBatch(m_vpiStream, 0, m_cropScalePayload, &m_vpiFrameNV12,
-                                                  1, m_vpiInTargets, m_vpiTgtPatchSize, m_vpiTgtPatchSize, m_vpiTgtPatches));
-        CHECK_VPI_STATUS(vpiSubmitDCFTrackerUpdateBatch(m_vpiStream, 0, m_dcfPayload, nullptr, 0,
-                                                        nullptr, nullptr, m_vpiTgtPatches, m_vpiInTargets, nullptr));
-        CHECK_VPI_STATUS(vpiStreamSync(m_vpiStream));
-    } catch (const std::exception &e) {
-        qCritical() << "Cam" << m_cameraIndex << ": Failed init first target:" << e.what();
-        m_currentTarget.state = VPI_TRACKING_STATE_LOST;
+    const qint64 startNs = FrameLatencyMonitor::nowNs();
+    const bool ok = m_tracker->initTarget(frameBGRA, QRect(static_cast<int>(boxX), static_cast<int>(boxY),
+                                                           static_cast<int>(boxW), static_cast<int>(boxH)));
+    FrameLatencyMonitor::instance().record(m_cameraIndex, FrameStage::Tracking, FrameLatencyMonitor::nowNs() - startNs);
+
+    if (!ok) {
+        m_currentTarget = {};
+        m_currentTarget.state = TRACKING_STATE_LOST;
         m_trackerInitialized = false;
         return false;
     }
+    m_currentTarget = m_tracker->target();
     return true;
 }
 
-// runTrackingCycle() method (No changes needed based on errors)
-bool CameraVideoStreamDevice::runTrackingCycle(VPIImage vpiFrameInput)
+bool CameraVideoStreamDevice::runTrackingCycle(const cv::Mat &frameBGRA)
 {
-    //const float CONFIDENCE_THRESHOLD_LOW = 0.25f; // Example: If score drops below this, enter shadow mode.
-    //const float CONFIDENCE_THRESHOLD_HIGH = 0.40f; // Example: If score rises above this, re-acquire lock.
-
-    try {
-        CHECK_VPI_STATUS(vpiSubmitConvertImageFormat(m_vpiStream, VPI_BACKEND_CUDA, vpiFrameInput, m_vpiFrameNV12, nullptr));
-        CHECK_VPI_STATUS(vpiSubmitCropScalerBatch(m_vpiStream, 0, m_cropScalePayload, &m_vpiFrameNV12,
-                                                  1, m_vpiInTargets, m_vpiTgtPatchSize, m_vpiTgtPatchSize, m_vpiTgtPatches));
-        CHECK_VPI_STATUS(vpiSubmitDCFTrackerLocalizeBatch(m_vpiStream, 0, m_dcfPayload, NULL, 0,
-                                                          NULL, m_vpiTgtPatches, m_vpiInTargets, m_vpiOutTargets,
-                                                          NULL, m_vpiConfidenceScores, NULL));
-        CHECK_VPI_STATUS(vpiStreamSync(m_vpiStream));
-
-        VPIArrayData outTargetsData;
-        VPIArrayData confidenceData;
-        CHECK_VPI_STATUS(vpiArrayLockData(m_vpiOutTargets, VPI_LOCK_READ, VPI_ARRAY_BUFFER_HOST_AOS, &outTargetsData));
-        CHECK_VPI_STATUS(vpiArrayLockData(m_vpiConfidenceScores, VPI_LOCK_READ, VPI_ARRAY_BUFFER_HOST_AOS, &confidenceData));
-        
-        //qDebug() << "[CAM" << m_cameraIndex << "] runTrackingCycle: After localize, outTargetsData size:" << *outTargetsData.buffer.aos.sizePointer;
-
-        bool target_found = false;
-        if (*outTargetsData.buffer.aos.sizePointer > 0) {
-            VPIDCFTrackedBoundingBox *tempTarget = static_cast<VPIDCFTrackedBoundingBox *>(outTargetsData.buffer.aos.data);
-            float currentConfidence = static_cast<float*>(confidenceData.buffer.aos.data)[0];
-            qDebug() << "[CAM" << m_cameraIndex << "] VPI Localize Result: State=" << tempTarget->state << "Confidence=" << currentConfidence;
-            // IMPORTANT: Copy the data to m_currentTarget
-            m_currentTarget = *tempTarget;
-
-            //qDebug() << "[CAM" << m_cameraIndex << "] runTrackingCycle: Localized BBox: L=" << m_currentTarget.bbox.left
-             //        << ", T=" << m_currentTarget.bbox.top
-             //        << ", W=" << m_currentTarget.bbox.width
-             //        << ", H=" << m_currentTarget.bbox.height
-             //        << ", State=" << static_cast<int>(m_currentTarget.state);
-
-            if (m_currentTarget.state == VPI_TRACKING_STATE_LOST ||
-                m_currentTarget.bbox.left < 0 || m_currentTarget.bbox.top < 0 ||
-                m_currentTarget.bbox.width <= 0 || m_currentTarget.bbox.height <= 0 ||
-                m_currentTarget.bbox.left + m_currentTarget.bbox.width > m_outputWidth ||
-                m_currentTarget.bbox.top + m_currentTarget.bbox.height > m_outputHeight) {
-                 qInfo() << "Cam" << m_cameraIndex << ": Target lost or invalid box after localize. State=" << m_currentTarget.state;
-                 m_currentTarget.state = VPI_TRACKING_STATE_LOST; // Ensure state is LOST if box is invalid
-                 target_found = false;
-            } else {
-                target_found = true;
-            }
-        } else {
-             qWarning() << "Cam" << m_cameraIndex << ": Output target array empty after localize.";
-             m_currentTarget.state = VPI_TRACKING_STATE_LOST; target_found = false;
-        }
-        CHECK_VPI_STATUS(vpiArrayUnlock(m_vpiOutTargets));
-                CHECK_VPI_STATUS(vpiArrayUnlock(m_vpiConfidenceScores));
-
-        if (target_found) {
-            // If target is found, update the tracker's internal model for the next frame
-            // We need to copy the *current* tracked target from m_currentTarget back to m_vpiInTargets
-            // for the update batch, and then swap for the next localize cycle.
-            VPIArrayData inTargetsData;
-            CHECK_VPI_STATUS(vpiArrayLockData(m_vpiInTargets, VPI_LOCK_WRITE, VPI_ARRAY_BUFFER_HOST_AOS, &inTargetsData));
-            if (inTargetsData.buffer.aos.capacity < 1) {
-                qCritical() << "Cam" << m_cameraIndex << ": VPI inTargets array capacity is zero for update!";
-                vpiArrayUnlock(m_vpiInTargets); return false;
-            }
-            *static_cast<VPIDCFTrackedBoundingBox *>(inTargetsData.buffer.aos.data) = m_currentTarget; // Copy current tracked box back
-            *inTargetsData.buffer.aos.sizePointer = 1;
-            CHECK_VPI_STATUS(vpiArrayUnlock(m_vpiInTargets));
+    const qint64 startNs = FrameLatencyMonitor::nowNs();
+    const bool ok = m_tracker->track(frameBGRA);
+    FrameLatencyMonitor::instance().record(m_cameraIndex, FrameStage::Tracking, FrameLatencyMonitor::nowNs() - startNs);
 
-            CHECK_VPI_STATUS(vpiSubmitDCFTrackerUpdateBatch(m_vpiStream, 0, m_dcfPayload, nullptr, 0,
-                                                            nullptr, nullptr, m_vpiTgtPatches, m_vpiInTargets, nullptr));
-            CHECK_VPI_STATUS(vpiStreamSync(m_vpiStream)); // Sync after update
+    m_currentTarget = m_tracker->target();
+    if (!ok) {
+        m_currentTarget.state = TRACKING_STATE_LOST;
+        return false;
+    }
+    if (m_currentTarget.state == TRACKING_STATE_LOST) {
+        qInfo() << "Cam" << m_cameraIndex << ": Target lost or invalid box after localize. Confidence=" << m_currentTarget.confidence;
+        return false;
+    }
+    return true;
+}
 
-            //qDebug() << "[CAM" << m_cameraIndex << "] runTrackingCycle: After update batch, m_currentTarget state:" << static_cast<int>(m_currentTarget.state);
 
-        } else {
-            // If target not found, ensure m_vpiInTargets is reset for the next cycle
-            VPIArrayData inTargetsData;
-            CHECK_VPI_STATUS(vpiArrayLockData(m_vpiInTargets, VPI_LOCK_WRITE, VPI_ARRAY_BUFFER_HOST_AOS, &inTargetsData));
-            *inTargetsData.buffer.aos.sizePointer = 0; // Clear the array
-            CHECK_VPI_STATUS(vpiArrayUnlock(m_vpiInTargets));
-            //qDebug() << "[CAM" << m_cameraIndex << "] runTrackingCycle: Target not found, resetting inTargets.";
-        }
+// --- Helper Functions --- (No changes needed based on errors)
+void CameraVideoStreamDevice::pushStateSample(const StateSample &sample)
+{
+    m_stateHistory[m_stateHistoryHead] = sample;
+    m_stateHistoryHead = (m_stateHistoryHead + 1) % StateHistorySize;
+    m_stateHistoryCount = std::min(m_stateHistoryCount + 1, static_cast<int>(StateHistorySize));
+}
 
-        // The swap should still be fine, as m_vpiInTargets now holds the data for the *next* localize cycle.
-        // std::swap(m_vpiInTargets, m_vpiOutTargets); // This swap is implicitly handled by the logic above if m_vpiInTargets is updated directly.
-        // If m_vpiInTargets and m_vpiOutTargets are distinct buffers used in a ping-pong fashion,
-        // the current setup where m_vpiInTargets is explicitly updated with m_currentTarget
-        // and then used for the update batch, and then becomes the input for the next localize
-        // is correct. The swap is not strictly necessary if you're always writing to m_vpiInTargets
-        // for the next cycle's input.
+CameraVideoStreamDevice::StateSample CameraVideoStreamDevice::nearestStateSample(qint64 timestampNs) const
+{
+    if (m_stateHistoryCount == 0) {
+        // No state received yet: fall back to the live members
+        StateSample fallback;
+        fallback.azimuth = m_currentAzimuth;
+        fallback.elevation = m_currentElevation;
+        fallback.imuRollDeg = m_imuRollDeg;
+        fallback.imuPitchDeg = m_imuPitchDeg;
+        fallback.imuYawDeg = m_imuYawDeg;
+        fallback.gyroX = m_gyroX; fallback.gyroY = m_gyroY; fallback.gyroZ = m_gyroZ;
+        fallback.accelX = m_accelX; fallback.accelY = m_accelY; fallback.accelZ = m_accelZ;
+        fallback.lrfDistance = m_lrfDistance;
+        return fallback;
+    }
 
-    } catch (const std::exception &e) {
-        qCritical() << "Cam" << m_cameraIndex << ": Exception during tracking cycle:" << e.what();
-         m_currentTarget.state = VPI_TRACKING_STATE_LOST; return false;
+    int best = (m_stateHistoryHead - 1 + StateHistorySize) % StateHistorySize;
+    qint64 bestDelta = std::abs(m_stateHistory[best].timestampNs - timestampNs);
+    for (int i = 1; i < m_stateHistoryCount; ++i) {
+        const int index = (m_stateHistoryHead - 1 - i + 2 * StateHistorySize) % StateHistorySize;
+        const qint64 delta = std::abs(m_stateHistory[index].timestampNs - timestampNs);
+        if (delta < bestDelta) {
+            best = index;
+            bestDelta = delta;
+        } else if (m_stateHistory[index].timestampNs < timestampNs) {
+            break; // Walking backwards in time and already past the capture instant
+        }
     }
-    return true;
+    return m_stateHistory[best];
 }
 
-
-// --- Helper Functions --- (No changes needed based on errors)
 QImage CameraVideoStreamDevice::cvMatToQImage(const cv::Mat &mat)
 {
     if (mat.empty()) return QImage();
@@ -2,7 +2,9 @@
 #define CAMERAVIDEOSTREAMDEVICE_H
 
 // --- Standard Library Includes ---
+#include <array>
 #include <atomic>
+#include <memory>
 #include <string>
 #include <vector> // For FrameData::detections
 
@@ -18,16 +20,7 @@
 // --- GStreamer Includes ---
 #include <gst/gst.h>
 #include <gst/app/gstappsink.h>
-
-// --- VPI Includes ---
-#include <vpi/Types.h>          // VPIImage, VPIStream, VPIPayload, etc.
-#include <vpi/Array.h>
-#include <vpi/Image.h>
-#include <vpi/Stream.h>
-#include <vpi/algo/ConvertImageFormat.h>
-#include <vpi/algo/CropScaler.h>
-#include <vpi/algo/DCFTracker.h> // VPITrackingState, VPIDCFTrackedBoundingBox
-#include <vpi/OpenCVInterop.hpp>
+#include <gst/video/video.h>
 
 // --- OpenCV Includes ---
 #include <opencv2/core.hpp>
@@ -36,8 +29,13 @@
 // --- Project Includes ---
 //#include "osdrenderer.h" // For OperationalMode, MotionMode, FireMode, ReticleType
 #include "utils/inference.h" // For Detection struct used in FrameData
+#include "utils/yuvframeconverter.h"
+#include "video/replaystatetrack.h"
+#include "video/trackerbackend.h" // TrackedTarget, TrackingState
 #include "models/domain/systemstatemodel.h" // For SystemStateData used in onSystemStateChanged slot
 
+class DetectionService;
+
 // --- Data Structure Definition ---
 
 /**
@@ -46,10 +44,17 @@
 struct FrameData {
     int cameraIndex = -1;
     QImage baseImage;
+
+    // Timing (CLOCK_MONOTONIC ns, see FrameLatencyMonitor::nowNs())
+    qint64 captureTimestampNs = 0;  // Sensor capture time (GStreamer PTS + pipeline base time)
+    qint64 stateTimestampNs = 0;    // Time of the gimbal/IMU snapshot attached below
+    qint64 emitTimestampNs = 0;     // Time frameDataReady was emitted
+
     bool trackingEnabled = false;
     bool trackerInitialized = false;
-    VPITrackingState trackingState = VPI_TRACKING_STATE_LOST;
+    TrackingState trackingState = TRACKING_STATE_LOST;
     QRect trackingBbox = QRect(0, 0, 0, 0); // Use QRect for Qt integration
+    float trackingConfidence = 0.0f;        // Tracker backend confidence, 0..1
     OperationalMode currentOpMode = OperationalMode::Idle;
     MotionMode motionMode = MotionMode::Manual;
     bool stabEnabled = false;
@@ -118,15 +123,21 @@ struct FrameData {
     float acquisitionBoxY_px = 0.0f;
     float acquisitionBoxW_px = 0.0f;
     float acquisitionBoxH_px = 0.0f;
+
+    // Kalman-predicted target position, projected into image pixels
+    bool predictedTargetValid = false;
+    bool predictedTargetCoasting = false;
+    float predictedTargetX_px = 0.0f;
+    float predictedTargetY_px = 0.0f;
 };
 
 // --- Class Definition ---
 
 /**
- * @brief Processes video frames from a GStreamer pipeline using VPI for tracking/detection.
+ * @brief Processes video frames from a GStreamer pipeline, with pluggable tracking and detection.
  *
  * This class runs in a separate thread to avoid blocking the main GUI thread.
- * It receives video frames, performs VPI operations (like tracking), gathers system state,
+ * It receives video frames, runs tracking and detection on them, gathers system state,
  * and emits the combined data in a FrameData struct.
  */
 class CameraVideoStreamDevice : public QThread
@@ -134,12 +145,22 @@ class CameraVideoStreamDevice : public QThread
     Q_OBJECT
 
 public:
+    /**
+     * @brief Settings for replaying a recording instead of reading the v4l2 camera.
+     */
+    struct ReplayOptions {
+        QString source;         // Video file path, or "videotestsrc [properties]"
+        QString stateFile;      // Optional sidecar gimbal/IMU CSV (see ReplayStateTrack)
+        bool realtime = true;   // Pace at the recorded frame rate (dropping if behind) or run flat out
+    };
+
     // --- Constructor & Destructor ---
     explicit CameraVideoStreamDevice(int cameraIndex,
                             const QString &deviceName,
                             int sourceWidth, // Output width expected after processing (e.g., crop/scale)
                             int sourceHeight, // Output height expected
                             SystemStateModel* stateModel,
+                            DetectionService* detectionService,
                             QObject *parent = nullptr);
     ~CameraVideoStreamDevice() override;
 
@@ -149,10 +170,23 @@ public:
      */
     void stop();
 
+    /**
+     * @brief Switches the device to replay mode. Must be called before start().
+     */
+    void setReplayOptions(const ReplayOptions &options);
+    bool isReplay() const { return !m_replay.source.isEmpty(); }
+
+    /**
+     * @brief Selects the tracker backend by devices.json name (see TrackerBackend).
+     * Must be called before start(). Defaults to VPI_BACKEND_CUDA.
+     */
+    void setTrackingBackend(const QString &backendName);
+    QString trackingBackendName() const { return m_trackingBackendName; }
+
 public slots:
     // --- Public Slots ---
     /**
-     * @brief Enables or disables the VPI tracker.
+     * @brief Enables or disables the tracker.
      * @param enabled True to enable tracking, false to disable.
      */
     void setTrackingEnabled(bool enabled);
@@ -209,19 +243,42 @@ private:
     // GStreamer Management
     bool initializeGStreamer();
     void cleanupGStreamer();
+    QString buildPipelineDescription() const;
     static GstFlowReturn on_new_sample_from_sink(GstAppSink *sink, gpointer user_data);
+    static void on_eos_from_sink(GstAppSink *sink, gpointer user_data);
     GstFlowReturn handleNewSample(GstAppSink *sink);
 
-    // VPI Management & Processing
-    bool initializeVPI();
-    void cleanupVPI();
-    bool processFrame(GstBuffer *buffer);
-    bool initializeFirstTarget(VPIImage vpiFrameInput, float boxX, float boxY, float boxW, float boxH);
-    bool runTrackingCycle(VPIImage vpiFrameInput);
+    // Tracker Management & Processing
+    bool initializeTracker();
+    void cleanupTracker();
+    bool processFrame(GstBuffer *buffer, qint64 captureNs, qint64 sampleNs);
+    bool initializeFirstTarget(const cv::Mat &frameBGRA, float boxX, float boxY, float boxW, float boxH);
+    bool runTrackingCycle(const cv::Mat &frameBGRA);
 
     // Utility Methods
     QImage cvMatToQImage(const cv::Mat &inMat);
 
+    /**
+     * @brief Time-critical state (gimbal angles, IMU, LRF) captured on each state change.
+     */
+    struct StateSample {
+        qint64 timestampNs = 0;
+        float azimuth = 0.0f;
+        float elevation = 0.0f;
+        double imuRollDeg = 0.0, imuPitchDeg = 0.0, imuYawDeg = 0.0;
+        double gyroX = 0.0, gyroY = 0.0, gyroZ = 0.0;
+        double accelX = 0.0, accelY = 0.0, accelZ = 0.0;
+        float lrfDistance = 0.0f;
+    };
+    static constexpr int StateHistorySize = 64; // ~0.6 s of state updates at 100 Hz
+
+    /**
+     * @brief Returns the state sample closest in time to timestampNs.
+     * Caller must hold m_stateMutex.
+     */
+    StateSample nearestStateSample(qint64 timestampNs) const;
+    void pushStateSample(const StateSample &sample);  // Caller must hold m_stateMutex
+
     // --- Member Variables ---
 
     // Thread Control
@@ -234,7 +291,6 @@ private:
     int m_outputWidth;          // Target width after VPI processing (e.g., crop/scale)
     int m_outputHeight;         // Target height after VPI processing
     SystemStateModel* m_stateModel;
-    const int m_maxTrackedTargets; // Max targets for VPI arrays
     std::atomic<bool> m_abortRequest; // Flag to signal thread termination
 
 
@@ -266,25 +322,32 @@ private:
     GstElement *m_appSink;      // Sink element to grab frames from
     GMainLoop *m_gstLoop;       // GStreamer main loop for event handling
 
-    // VPI Components & State
-    VPIBackend m_vpiBackend;    // VPI backend (e.g., VPI_BACKEND_CUDA)
-    VPIStream m_vpiStream;      // VPI processing stream
-    VPIPayload m_dcfPayload;    // Payload for DCF tracker algorithm
-    VPIPayload m_cropScalePayload; // Payload for Crop/Scaler algorithm
-    VPIImage m_vpiFrameNV12;    // VPI Image buffer for NV12 format
-    VPIImage m_vpiTgtPatches;   // VPI Image for tracker target patches
-    VPIArray m_vpiInTargets;    // VPI Array for input bounding boxes
-    VPIArray m_vpiOutTargets;   // VPI Array for output tracked bounding boxes
-    VPIArray m_vpiConfidenceScores; // VPI Array for confidence scores
-    int m_vpiTgtPatchSize;      // Size of the target patches
-    VPIDCFTrackedBoundingBox m_currentTarget; // Internal tracker state (uses VPIRectI)
-    QElapsedTimer m_velocityTimer; // To measure time between frames
+    // Tracker Backend & State
+    QString m_trackingBackendName;            // devices.json video.trackingBackend
+    std::unique_ptr<TrackerBackend> m_tracker; // Created on the video thread in run()
+    TrackedTarget m_currentTarget;            // Last tracker result
+    qint64 m_lastTargetCaptureNs = 0; // Capture time of the previous tracked frame, for velocity
     float m_lastTargetCenterX_px;
     float m_lastTargetCenterY_px;
 
 
-    // OpenCV Buffers (if needed for intermediate steps)
-    cv::Mat m_yuy2_host_buffer; // Example buffer for format conversion
+    // Recent state snapshots for timestamp matching (guarded by m_stateMutex)
+    std::array<StateSample, StateHistorySize> m_stateHistory;
+    int m_stateHistoryHead = 0;   // Next write position
+    int m_stateHistoryCount = 0;
+
+    // Replay mode (empty source = live camera)
+    ReplayOptions m_replay;
+    ReplayStateTrack m_replayState;   // Replaces live state history when loaded
+    GstClockTime m_lastPts;           // For dropped-frame detection from PTS gaps
+
+    // Negotiated appsink format (I420 or YUY2, whatever the decoder produces)
+    GstVideoInfo m_videoInfo;
+    GstCaps *m_videoCaps;       // Caps m_videoInfo was parsed from
+
+    // Fused YUV -> BGRA display + detection tensor conversion
+    YuvFrameConverter m_frameConverter;
+    cv::Mat m_detectionTensor;  // 1x3xHxW letterboxed detection input
 
     // State Variables (synchronized via mutex or atomic where needed)
     QMutex m_stateMutex;        // Mutex to protect access to shared state variables below
@@ -294,7 +357,7 @@ private:
     bool m_currentZeroingApplied;
     float m_currentZeroingAzOffset;
     float m_currentZeroingElOffset;
-    //TrackingPhase m_currentTrackingState; // Current tracking state (e.g., VPI_TRACKING_STATE_LOST)
+    //TrackingPhase m_currentTrackingState; // Current tracking state (e.g., TRACKING_STATE_LOST)
 
     bool m_currentWindageModeActive;
     bool m_currentWindageApplied;
@@ -317,13 +380,18 @@ private:
     float m_currentLeadAngleOffsetAz;          // ⭐ ADD
     float m_currentLeadAngleOffsetEl;
 
+    bool m_currentPredictedTargetValid = false;
+    bool m_currentPredictedTargetCoasting = false;
+    double m_currentPredictedTargetAz = 0.0;
+    double m_currentPredictedTargetEl = 0.0;
+
     FireMode m_fireMode;
     ReticleType m_reticleType;
     QColor m_colorStyle;
     bool m_isLacActiveForReticle; // Flag for LAC reticle mode
 
-    // YoloInference Engine
-    YoloInference m_inference;      // Object detection inference handler
+    // Shared detection service (not owned, batches day + night frames)
+    DetectionService* m_detectionService;
 
 
     int m_frameCount = 0;
@@ -2,6 +2,7 @@
 #include "../interfaces/Transport.h"
 #include "../protocols/Plc21ProtocolParser.h"
 #include "../messages/Plc21Message.h"
+#include "../communication/modbuspollscheduler.h"
 #include <QModbusRtuSerialClient>
 #include <QModbusDataUnit>
 #include <QModbusReply>
@@ -11,10 +12,10 @@
 Plc21Device::Plc21Device(const QString& identifier, QObject* parent)
     : TemplatedDevice<Plc21PanelData>(parent),
       m_identifier(identifier),
-      m_pollTimer(new QTimer(this)),
+      m_poller(new ModbusPollScheduler(identifier, this)),
       m_communicationWatchdog(new QTimer(this))
 {
-    connect(m_pollTimer, &QTimer::timeout, this, &Plc21Device::pollTimerTimeout);
+    connect(m_poller, &ModbusPollScheduler::pollDue, this, &Plc21Device::onPollDue);
 
     m_communicationWatchdog->setSingleShot(false);
     m_communicationWatchdog->setInterval(COMMUNICATION_TIMEOUT_MS);
@@ -23,7 +24,7 @@ Plc21Device::Plc21Device(const QString& identifier, QObject* parent)
 }
 
 Plc21Device::~Plc21Device() {
-    m_pollTimer->stop();
+    m_poller->stop();
     m_communicationWatchdog->stop();
 }
 
@@ -51,25 +52,47 @@ bool Plc21Device::initialize() {
     // Transport should already be opened by SystemController
     qDebug() << m_identifier << "initializing...";
 
-    // Get poll interval from config (default 50ms)
+    // Get poll interval from config (default 50ms). The panel switches are
+    // operator inputs, so neither block backs off.
     QJsonObject config = property("config").toJsonObject();
     int pollInterval = config["pollIntervalMs"].toInt(50);
-    m_pollTimer->setInterval(pollInterval);
+
+    m_poller->stop();
+    m_poller->clearBlocks();
+    m_poller->configureBus(config["baudRate"].toInt(115200),
+                           config["busBudget"].toDouble(0.6),
+                           config["turnaroundMs"].toDouble(1.0));
+
+    ModbusPollScheduler::Block inputs;
+    inputs.name = "inputs";
+    inputs.registerType = QModbusDataUnit::DiscreteInputs;
+    inputs.count = Plc21Registers::DIGITAL_INPUTS_COUNT;
+    inputs.intervalMs = pollInterval;
+    m_inputsBlock = m_poller->addBlock(inputs);
+
+    ModbusPollScheduler::Block analog;
+    analog.name = "analog";
+    analog.count = Plc21Registers::ANALOG_INPUTS_COUNT;
+    analog.intervalMs = pollInterval;
+    m_analogBlock = m_poller->addBlock(analog);
+    m_lastInputsBlock.clear();
+    m_lastAnalogBlock.clear();
+    m_fullUpdatePending = true;
 
     setState(DeviceState::Online);
 
     // Start watchdog
     m_communicationWatchdog->start();
 
-    // Start first poll cycle immediately
-    startPollCycle();
+    // First reads go out immediately
+    m_poller->start();
 
     qDebug() << m_identifier << "initialized successfully with poll interval:" << pollInterval << "ms";
     return true;
 }
 
 void Plc21Device::shutdown() {
-    m_pollTimer->stop();
+    m_poller->stop();
     m_communicationWatchdog->stop();
 
     if (m_transport) {
@@ -79,36 +102,32 @@ void Plc21Device::shutdown() {
     setState(DeviceState::Offline);
 }
 
-void Plc21Device::pollTimerTimeout() {
-    // Timer fired - start a new poll cycle
-    startPollCycle();
+void Plc21Device::onPollDue(int block) {
+    if (block == m_inputsBlock) {
+        sendReadRequest(Plc21Registers::DIGITAL_INPUTS_START_ADDR,
+                        Plc21Registers::DIGITAL_INPUTS_COUNT,
+                        true, block);
+    } else if (block == m_analogBlock) {
+        sendReadRequest(Plc21Registers::ANALOG_INPUTS_START_ADDR,
+                        Plc21Registers::ANALOG_INPUTS_COUNT,
+                        false, block);
+    }
 }
 
-void Plc21Device::startPollCycle() {
-    // Don't start a new cycle if one is already in progress
-    // This implements adaptive polling - we wait for the previous cycle to complete
-    if (m_pollCycleActive) {
+void Plc21Device::sendReadRequest(int startAddress, int count, bool isDiscreteInputs, int pollBlock) {
+    if (state() != DeviceState::Online || !m_transport) {
+        m_poller->complete(pollBlock, ModbusPollScheduler::Result::Failed);
         return;
     }
 
-    m_pollCycleActive = true;
-    m_needsHoldingRegistersRead = true;
-    m_waitingForResponse = true;
-
-    // Start the request sequence: first read digital inputs
-    sendReadRequest(Plc21Registers::DIGITAL_INPUTS_START_ADDR,
-                    Plc21Registers::DIGITAL_INPUTS_COUNT,
-                    true);
-}
-
-void Plc21Device::sendReadRequest(int startAddress, int count, bool isDiscreteInputs) {
-    if (state() != DeviceState::Online || !m_transport) return;
-
     // Cast to ModbusTransport to access Modbus-specific methods
     auto modbusTransport = qobject_cast<QModbusRtuSerialClient*>(
         m_transport->property("client").value<QObject*>());
 
-    if (!modbusTransport) return;
+    if (!modbusTransport) {
+        m_poller->complete(pollBlock, ModbusPollScheduler::Result::Failed);
+        return;
+    }
 
     QModbusDataUnit::RegisterType regType = isDiscreteInputs ?
         QModbusDataUnit::DiscreteInputs : QModbusDataUnit::HoldingRegisters;
@@ -121,20 +140,24 @@ void Plc21Device::sendReadRequest(int startAddress, int count, bool isDiscreteIn
                               Q_RETURN_ARG(QModbusReply*, reply),
                               Q_ARG(QModbusDataUnit, readUnit));
 
-    if (reply) {
-        connect(reply, &QModbusReply::finished, this, [this, reply]() {
-            onModbusReplyReady(reply);
-        });
+    if (!reply) {
+        m_poller->complete(pollBlock, ModbusPollScheduler::Result::Failed);
+        return;
     }
+
+    connect(reply, &QModbusReply::finished, this, [this, reply, pollBlock]() {
+        const bool ok = reply->error() == QModbusDevice::NoError;
+        const auto before = data();
+        onModbusReplyReady(reply);
+        m_poller->complete(pollBlock, !ok ? ModbusPollScheduler::Result::Failed
+                                          : data() != before ? ModbusPollScheduler::Result::Changed
+                                                             : ModbusPollScheduler::Result::Unchanged);
+    });
 }
 
 void Plc21Device::onModbusReplyReady(QModbusReply* reply) {
     if (!reply || !m_parser) {
         if (reply) reply->deleteLater();
-        m_waitingForResponse = false;
-        m_pollCycleActive = false;  // Abort cycle on error
-        m_needsHoldingRegistersRead = false;
-        m_pollTimer->start();  // Schedule retry
         return;
     }
 
@@ -142,13 +165,21 @@ void Plc21Device::onModbusReplyReady(QModbusReply* reply) {
         qWarning() << m_identifier << "Modbus error:" << reply->errorString();
         setConnectionState(false);
         reply->deleteLater();
-        m_waitingForResponse = false;
-        m_pollCycleActive = false;  // Abort cycle on error
-        m_needsHoldingRegistersRead = false;
-        m_pollTimer->start();  // Schedule retry
         return;
     }
 
+    // Report by exception: a block identical bit for bit to the previous
+    // read of it changes nothing, so it is not parsed or merged
+    const QModbusDataUnit unit = reply->result();
+    QVector<quint16>& lastBlock = unit.registerType() == QModbusDataUnit::DiscreteInputs
+                                      ? m_lastInputsBlock : m_lastAnalogBlock;
+    if (data()->isConnected && unit.values() == lastBlock) {
+        resetCommunicationWatchdog();
+        reply->deleteLater();
+        return;
+    }
+    lastBlock = unit.values();
+
     // Parse the reply into messages
     auto messages = m_parser->parse(reply);
     reply->deleteLater();
@@ -159,10 +190,6 @@ void Plc21Device::onModbusReplyReady(QModbusReply* reply) {
             processMessage(*msg);
         }
     }
-
-    // Response received successfully - send next pending request if any
-    m_waitingForResponse = false;
-    sendNextPendingRequest();
 }
 
 void Plc21Device::processMessage(const Message& message) {
@@ -177,55 +204,36 @@ void Plc21Device::mergePartialData(const Plc21PanelData& partialData) {
     setConnectionState(true);
     resetCommunicationWatchdog();
 
+    // The parser accumulates both blocks, so partialData is the whole panel;
+    // connection state is ours, not the parser's
     auto currentData = data();
-    auto newData = std::make_shared<Plc21PanelData>(*currentData);
-
-    bool dataChanged = false;
-
-    // Merge digital inputs (always update if they're part of the partial data)
-    // Since the parser sets default values, we need a smarter merge strategy
-    // For now, we'll assume any non-default value in partialData should be merged
-
-    // Digital inputs - always merge (parser provides full set)
-    if (partialData.armGunSW != currentData->armGunSW ||
-        partialData.loadAmmunitionSW != currentData->loadAmmunitionSW ||
-        partialData.enableStationSW != currentData->enableStationSW ||
-        partialData.homePositionSW != currentData->homePositionSW ||
-        partialData.enableStabilizationSW != currentData->enableStabilizationSW ||
-        partialData.authorizeSw != currentData->authorizeSw ||
-        partialData.switchCameraSW != currentData->switchCameraSW ||
-        partialData.menuUpSW != currentData->menuUpSW ||
-        partialData.menuDownSW != currentData->menuDownSW ||
-        partialData.menuValSw != currentData->menuValSw) {
-
-        newData->armGunSW = partialData.armGunSW;
-        newData->loadAmmunitionSW = partialData.loadAmmunitionSW;
-        newData->enableStationSW = partialData.enableStationSW;
-        newData->homePositionSW = partialData.homePositionSW;
-        newData->enableStabilizationSW = partialData.enableStabilizationSW;
-        newData->authorizeSw = partialData.authorizeSw;
-        newData->switchCameraSW = partialData.switchCameraSW;
-        newData->menuUpSW = partialData.menuUpSW;
-        newData->menuDownSW = partialData.menuDownSW;
-        newData->menuValSw = partialData.menuValSw;
-        dataChanged = true;
+    Plc21PanelData merged = partialData;
+    merged.isConnected = currentData->isConnected;
+
+    Plc21PanelDelta delta = Plc21PanelDelta::between(*currentData, merged);
+    if (m_fullUpdatePending) {
+        // Every field of a block read since connect goes out; the fields of a
+        // block not read yet are parser defaults, not the panel's
+        quint32 readFields = 0;
+        if (!m_lastInputsBlock.isEmpty()) readFields |= Plc21PanelDelta::InputFields;
+        if (!m_lastAnalogBlock.isEmpty()) readFields |= Plc21PanelDelta::AnalogFields;
+        delta.changed = (delta.changed & Plc21PanelDelta::Connected) | readFields;
+        merged = *currentData;
+        delta.applyTo(merged);
+        delta.data = merged;
+
+        if (!m_lastInputsBlock.isEmpty() && !m_lastAnalogBlock.isEmpty()) {
+            m_fullUpdatePending = false;
+        }
     }
-
-    // Analog inputs - merge if different
-    if (partialData.speedSW != currentData->speedSW ||
-        partialData.fireMode != currentData->fireMode ||
-        partialData.panelTemperature != currentData->panelTemperature) {
-
-        newData->speedSW = partialData.speedSW;
-        newData->fireMode = partialData.fireMode;
-        newData->panelTemperature = partialData.panelTemperature;
-        dataChanged = true;
+    if (delta.isEmpty()) {
+        return;
     }
 
-    if (dataChanged) {
-        updateData(newData);
-        emit panelDataChanged(*newData);
-    }
+    auto newData = std::make_shared<Plc21PanelData>(merged);
+    updateData(newData);
+    emit panelDataChanged(*newData);
+    emit panelDeltaReady(delta);
 }
 
 //================================================================================
@@ -299,7 +307,8 @@ void Plc21Device::sendWriteRequest(int startAddress, const QVector<bool>& values
 }
 
 void Plc21Device::setPollInterval(int intervalMs) {
-    m_pollTimer->setInterval(intervalMs);
+    m_poller->setBlockInterval(m_inputsBlock, intervalMs);
+    m_poller->setBlockInterval(m_analogBlock, intervalMs);
 }
 
 void Plc21Device::resetCommunicationWatchdog() {
@@ -313,33 +322,21 @@ void Plc21Device::setConnectionState(bool connected) {
         newData->isConnected = connected;
         updateData(newData);
         emit panelDataChanged(*newData);
+        emit panelDeltaReady(Plc21PanelDelta::between(*currentData, *newData));
 
         if (connected) {
             qDebug() << m_identifier << "connected";
         } else {
+            // Whatever the panel shows on reconnect goes out in full
+            m_lastInputsBlock.clear();
+            m_lastAnalogBlock.clear();
+            m_fullUpdatePending = true;
+            if (m_parser) m_parser->reset();
             qWarning() << m_identifier << "disconnected";
         }
     }
 }
 
-void Plc21Device::sendNextPendingRequest() {
-    // If we need to read holding registers, send that request now
-    if (m_needsHoldingRegistersRead) {
-        m_needsHoldingRegistersRead = false;
-        m_waitingForResponse = true;
-        sendReadRequest(Plc21Registers::ANALOG_INPUTS_START_ADDR,
-                        Plc21Registers::ANALOG_INPUTS_COUNT,
-                        false);
-    } else {
-        // Poll cycle complete - mark as inactive and schedule next cycle
-        m_pollCycleActive = false;
-
-        // Start timer for next poll cycle (adaptive polling)
-        // Timer will fire after the configured interval
-        m_pollTimer->start();
-    }
-}
-
 void Plc21Device::onCommunicationWatchdogTimeout() {
     qWarning() << m_identifier << "Communication timeout - no data received for"
                << COMMUNICATION_TIMEOUT_MS << "ms";
@@ -30,6 +30,7 @@
 #include <QTimer>
 
 class Transport;
+class ModbusPollScheduler;
 class Plc21ProtocolParser;
 class QModbusReply;
 class Message;
@@ -69,38 +70,45 @@ public:
     // Configuration
     Q_INVOKABLE void setPollInterval(int intervalMs);
 
+    ModbusPollScheduler* pollScheduler() const { return m_poller; }
+
 signals:
     void panelDataChanged(const Plc21PanelData& data);
+    // Same change as panelDataChanged, carrying only the fields that moved
+    void panelDeltaReady(const Plc21PanelDelta& delta);
     void digitalOutputWritten(bool success);
 
 private slots:
-    void pollTimerTimeout();
+    void onPollDue(int block);
     void onModbusReplyReady(QModbusReply* reply);
     void processMessage(const Message& message);
     void onCommunicationWatchdogTimeout();
 
 private:
-    void sendReadRequest(int startAddress, int count, bool isDiscreteInputs = true);
+    void sendReadRequest(int startAddress, int count, bool isDiscreteInputs, int pollBlock);
     void sendWriteRequest(int startAddress, const QVector<bool>& values);
     void mergePartialData(const Plc21PanelData& partialData);
     void resetCommunicationWatchdog();
     void setConnectionState(bool connected);
-    void sendNextPendingRequest();
-    void startPollCycle();  // Start a new poll cycle
 
     QString m_identifier;
     Transport* m_transport = nullptr;
     Plc21ProtocolParser* m_parser = nullptr;
 
-    QTimer* m_pollTimer;
+    // Reads are sequenced by the scheduler: one request on the bus at a time
+    ModbusPollScheduler* m_poller;
+    int m_inputsBlock = -1;
+    int m_analogBlock = -1;
+
+    // Raw values of the last read of each block, for report-by-exception
+    QVector<quint16> m_lastInputsBlock;
+    QVector<quint16> m_lastAnalogBlock;
+    // Until both blocks have been read after connect, every field is sent:
+    // the state model's defaults are not the panel's
+    bool m_fullUpdatePending = true;
     QTimer* m_communicationWatchdog = nullptr;
     QVector<bool> m_digitalOutputs; // Cached output state for writing
 
-    // Request sequencing to prevent concurrent Modbus requests
-    bool m_waitingForResponse = false;
-    bool m_needsHoldingRegistersRead = false;
-    bool m_pollCycleActive = false;  // Track if a poll cycle is in progress
-
     static constexpr int COMMUNICATION_TIMEOUT_MS = 3000;  // 3 seconds without data = disconnected
 };
 
@@ -2,6 +2,7 @@
 #include "../interfaces/Transport.h"
 #include "../protocols/Plc42ProtocolParser.h"
 #include "../messages/Plc42Message.h"
+#include "../communication/modbuspollscheduler.h"
 #include <QModbusRtuSerialClient>
 #include <QModbusDataUnit>
 #include <QModbusReply>
@@ -10,10 +11,10 @@
 Plc42Device::Plc42Device(const QString& identifier, QObject* parent)
     : TemplatedDevice<Plc42Data>(parent),
       m_identifier(identifier),
-      m_pollTimer(new QTimer(this)),
+      m_poller(new ModbusPollScheduler(identifier, this)),
       m_communicationWatchdog(new QTimer(this))
 {
-    connect(m_pollTimer, &QTimer::timeout, this, &Plc42Device::pollTimerTimeout);
+    connect(m_poller, &ModbusPollScheduler::pollDue, this, &Plc42Device::onPollDue);
 
     m_communicationWatchdog->setSingleShot(false);
     m_communicationWatchdog->setInterval(COMMUNICATION_TIMEOUT_MS);
@@ -22,7 +23,7 @@ Plc42Device::Plc42Device(const QString& identifier, QObject* parent)
 }
 
 Plc42Device::~Plc42Device() {
-    m_pollTimer->stop();
+    m_poller->stop();
     m_communicationWatchdog->stop();
 }
 
@@ -50,25 +51,59 @@ bool Plc42Device::initialize() {
     // Transport should already be opened by SystemController
     qDebug() << m_identifier << "initializing...";
 
-    // Get poll interval from config (default 50ms)
+    // Get poll intervals from config (default 50ms inputs, 1s environment).
+    // Holding registers only change when we write them and the station
+    // environment drifts slowly, so both back off while unchanged. The
+    // environment registers are an assumed map and are read only on request.
     QJsonObject config = property("config").toJsonObject();
     int pollInterval = config["pollIntervalMs"].toInt(50);
-    m_pollTimer->setInterval(pollInterval);
+    int slowInterval = config["slowIntervalMs"].toInt(1000);
+
+    m_poller->stop();
+    m_poller->clearBlocks();
+    m_poller->configureBus(config["baudRate"].toInt(115200),
+                           config["busBudget"].toDouble(0.6),
+                           config["turnaroundMs"].toDouble(1.0));
+
+    ModbusPollScheduler::Block inputs;
+    inputs.name = "inputs";
+    inputs.registerType = QModbusDataUnit::DiscreteInputs;
+    inputs.count = 7;  // Read 7 discrete inputs
+    inputs.intervalMs = pollInterval;
+    m_inputsBlock = m_poller->addBlock(inputs);
+
+    ModbusPollScheduler::Block holding;
+    holding.name = "holding";
+    holding.count = Plc42Registers::HOLDING_REGISTERS_COUNT;
+    holding.intervalMs = pollInterval;
+    holding.backoffMaxIntervalMs = slowInterval;
+    m_holdingBlock = m_poller->addBlock(holding);
+
+    m_environmentBlock = -1;
+    if (config["readEnvironment"].toBool(false)) {
+        ModbusPollScheduler::Block environment;
+        environment.name = "environment";
+        environment.registerType = QModbusDataUnit::InputRegisters;
+        environment.count = Plc42Registers::STATION_ENV_COUNT;
+        environment.intervalMs = slowInterval;
+        environment.backoffMaxIntervalMs = config["slowMaxIntervalMs"].toInt(5000);
+        m_environmentBlock = m_poller->addBlock(environment);
+    }
 
     setState(DeviceState::Online);
 
     // Start watchdog
     m_communicationWatchdog->start();
 
-    // Start first poll cycle immediately
-    startPollCycle();
+    // First reads go out immediately
+    m_poller->start();
 
     qDebug() << m_identifier << "initialized successfully with poll interval:" << pollInterval << "ms";
     return true;
 }
 
 void Plc42Device::shutdown() {
-    m_pollTimer->stop();
+    m_poller->stop();
     m_communicationWatchdog->stop();
 
     if (m_transport) {
@@ -78,39 +113,36 @@ void Plc42Device::shutdown() {
     setState(DeviceState::Offline);
 }
 
-void Plc42Device::pollTimerTimeout() {
-    // Timer fired - start a new poll cycle
-    startPollCycle();
+void Plc42Device::onPollDue(int block) {
+    if (block == m_inputsBlock) {
+        sendReadRequest(Plc42Registers::DIGITAL_INPUTS_START_ADDR,
+                        7,  // Read 7 discrete inputs
+                        QModbusDataUnit::DiscreteInputs, block);
+    } else if (block == m_holdingBlock) {
+        sendReadRequest(Plc42Registers::HOLDING_REGISTERS_START_ADDR,
+                        Plc42Registers::HOLDING_REGISTERS_COUNT,
+                        QModbusDataUnit::HoldingRegisters, block);
+    } else if (block == m_environmentBlock) {
+        sendReadRequest(Plc42Registers::STATION_ENV_START_ADDR,
+                        Plc42Registers::STATION_ENV_COUNT,
+                        QModbusDataUnit::InputRegisters, block);
+    }
 }
 
-void Plc42Device::startPollCycle() {
-    // Don't start a new cycle if one is already in progress
-    // This implements adaptive polling - we wait for the previous cycle to complete
-    if (m_pollCycleActive) {
+void Plc42Device::sendReadRequest(int startAddress, int count, QModbusDataUnit::RegisterType regType, int pollBlock) {
+    if (state() != DeviceState::Online || !m_transport) {
+        m_poller->complete(pollBlock, ModbusPollScheduler::Result::Failed);
         return;
     }
 
-    m_pollCycleActive = true;
-    m_needsHoldingRegistersRead = true;
-    m_waitingForResponse = true;
-
-    // Start the request sequence: first read digital inputs
-    sendReadRequest(Plc42Registers::DIGITAL_INPUTS_START_ADDR,
-                    7,  // Read 7 discrete inputs
-                    true);
-}
-
-void Plc42Device::sendReadRequest(int startAddress, int count, bool isDiscreteInputs) {
-    if (state() != DeviceState::Online || !m_transport) return;
-
     // Cast to ModbusTransport to access Modbus-specific methods
     auto modbusTransport = qobject_cast<QModbusRtuSerialClient*>(
         m_transport->property("client").value<QObject*>());
 
-    if (!modbusTransport) return;
-
-    QModbusDataUnit::RegisterType regType = isDiscreteInputs ?
-        QModbusDataUnit::DiscreteInputs : QModbusDataUnit::HoldingRegisters;
+    if (!modbusTransport) {
+        m_poller->complete(pollBlock, ModbusPollScheduler::Result::Failed);
+        return;
+    }
 
     QModbusDataUnit readUnit(regType, startAddress, count);
 
@@ -120,20 +152,34 @@ void Plc42Device::sendReadRequest(int startAddress, int count, bool isDiscreteIn
                               Q_RETURN_ARG(QModbusReply*, reply),
                               Q_ARG(QModbusDataUnit, readUnit));
 
-    if (reply) {
-        connect(reply, &QModbusReply::finished, this, [this, reply]() {
-            onModbusReplyReady(reply);
-        });
+    if (!reply) {
+        m_poller->complete(pollBlock, ModbusPollScheduler::Result::Failed);
+        return;
     }
+
+    connect(reply, &QModbusReply::finished, this, [this, reply, pollBlock]() {
+        const bool ok = reply->error() == QModbusDevice::NoError;
+
+        // The environment block is optional: a PLC that does not serve it
+        // says nothing about the link, which the other blocks vouch for
+        if (!ok && pollBlock == m_environmentBlock) {
+            qWarning() << m_identifier << "environment read failed:" << reply->errorString();
+            reply->deleteLater();
+            m_poller->complete(pollBlock, ModbusPollScheduler::Result::Failed);
+            return;
+        }
+
+        const auto before = data();
+        onModbusReplyReady(reply);
+        m_poller->complete(pollBlock, !ok ? ModbusPollScheduler::Result::Failed
+                                          : data() != before ? ModbusPollScheduler::Result::Changed
+                                                             : ModbusPollScheduler::Result::Unchanged);
+    });
 }
 
 void Plc42Device::onModbusReplyReady(QModbusReply* reply) {
     if (!reply || !m_parser) {
         if (reply) reply->deleteLater();
-        m_waitingForResponse = false;
-        m_pollCycleActive = false;  // Abort cycle on error
-        m_needsHoldingRegistersRead = false;
-        m_pollTimer->start();  // Schedule retry
         return;
     }
 
@@ -141,10 +187,6 @@ void Plc42Device::onModbusReplyReady(QModbusReply* reply) {
         qWarning() << m_identifier << "Modbus error:" << reply->errorString();
         setConnectionState(false);
         reply->deleteLater();
-        m_waitingForResponse = false;
-        m_pollCycleActive = false;  // Abort cycle on error
-        m_needsHoldingRegistersRead = false;
-        m_pollTimer->start();  // Schedule retry
         return;
     }
 
@@ -158,10 +200,6 @@ void Plc42Device::onModbusReplyReady(QModbusReply* reply) {
             processMessage(*msg);
         }
     }
-
-    // Response received successfully - send next pending request if any
-    m_waitingForResponse = false;
-    sendNextPendingRequest();
 }
 
 void Plc42Device::processMessage(const Message& message) {
@@ -223,6 +261,15 @@ void Plc42Device::mergePartialData(const Plc42Data& partialData) {
         dataChanged = true;
     }
 
+    // Merge station environment
+    if (partialData.stationTemperature != currentData->stationTemperature ||
+        partialData.stationPressure != currentData->stationPressure) {
+
+        newData->stationTemperature = partialData.stationTemperature;
+        newData->stationPressure = partialData.stationPressure;
+        dataChanged = true;
+    }
+
     if (dataChanged) {
         updateData(newData);
         emit plc42DataChanged(*newData);
@@ -346,7 +393,8 @@ void Plc42Device::sendWriteHoldingRegisters() {
 }
 
 void Plc42Device::setPollInterval(int intervalMs) {
-    m_pollTimer->setInterval(intervalMs);
+    m_poller->setBlockInterval(m_inputsBlock, intervalMs);
+    m_poller->setBlockInterval(m_holdingBlock, intervalMs);
 }
 
 void Plc42Device::resetCommunicationWatchdog() {
@@ -369,24 +417,6 @@ void Plc42Device::setConnectionState(bool connected) {
     }
 }
 
-void Plc42Device::sendNextPendingRequest() {
-    // If we need to read holding registers, send that request now
-    if (m_needsHoldingRegistersRead) {
-        m_needsHoldingRegistersRead = false;
-        m_waitingForResponse = true;
-        sendReadRequest(Plc42Registers::HOLDING_REGISTERS_START_ADDR,
-                        Plc42Registers::HOLDING_REGISTERS_COUNT,
-                        false);
-    } else {
-        // Poll cycle complete - mark as inactive and schedule next cycle
-        m_pollCycleActive = false;
-
-        // Start timer for next poll cycle (adaptive polling)
-        // Timer will fire after the configured interval
-        m_pollTimer->start();
-    }
-}
-
 void Plc42Device::onCommunicationWatchdogTimeout() {
     qWarning() << m_identifier << "Communication timeout - no data received for"
                << COMMUNICATION_TIMEOUT_MS << "ms";
@@ -27,9 +27,11 @@
 
 #include "../devices/TemplatedDevice.h"
 #include "../data/DataTypes.h"
+#include <QModbusDataUnit>
 #include <QTimer>
 
 class Transport;
+class ModbusPollScheduler;
 class Plc42ProtocolParser;
 class QModbusReply;
 class Message;
@@ -72,39 +74,38 @@ public:
     // Configuration
     Q_INVOKABLE void setPollInterval(int intervalMs);
 
+    ModbusPollScheduler* pollScheduler() const { return m_poller; }
+
 signals:
     void plc42DataChanged(const Plc42Data& data);
     void registerWritten(bool success);
 
 private slots:
-    void pollTimerTimeout();
+    void onPollDue(int block);
     void onModbusReplyReady(QModbusReply* reply);
     void processMessage(const Message& message);
     void onCommunicationWatchdogTimeout();
 
 private:
-    void sendReadRequest(int startAddress, int count, bool isDiscreteInputs = true);
+    void sendReadRequest(int startAddress, int count, QModbusDataUnit::RegisterType regType, int pollBlock);
     void sendWriteHoldingRegisters();
     void mergePartialData(const Plc42Data& partialData);
     void resetCommunicationWatchdog();
     void setConnectionState(bool connected);
-    void sendNextPendingRequest();
-    void startPollCycle();  // Start a new poll cycle
 
     QString m_identifier;
     Transport* m_transport = nullptr;
     Plc42ProtocolParser* m_parser = nullptr;
 
-    QTimer* m_pollTimer;
+    // Reads are sequenced by the scheduler: one request on the bus at a time
+    ModbusPollScheduler* m_poller;
+    int m_inputsBlock = -1;
+    int m_holdingBlock = -1;
+    int m_environmentBlock = -1;
     QTimer* m_communicationWatchdog = nullptr;
     Plc42Data m_pendingWrites; // Data to be written on next write cycle
     bool m_hasPendingWrites = false;
 
-    // Request sequencing to prevent concurrent Modbus requests
-    bool m_waitingForResponse = false;
-    bool m_needsHoldingRegistersRead = false;
-    bool m_pollCycleActive = false;  // Track if a poll cycle is in progress
-
     static constexpr int COMMUNICATION_TIMEOUT_MS = 3000;  // 3 seconds without data = disconnected
 };
 
@@ -2,20 +2,19 @@
 #include "../interfaces/Transport.h"
 #include "../protocols/ServoDriverProtocolParser.h"
 #include "../messages/ServoDriverMessage.h"
-#include <QModbusRtuSerialClient>
+#include "../communication/modbuspollscheduler.h"
 #include <QModbusDataUnit>
 #include <QModbusReply>
 #include <QDebug>
+#include <cmath>
 
 ServoDriverDevice::ServoDriverDevice(const QString& identifier, QObject* parent)
     : TemplatedDevice<ServoDriverData>(parent),
       m_identifier(identifier),
-      m_pollTimer(new QTimer(this)),
-      m_temperatureTimer(new QTimer(this)),
+      m_poller(new ModbusPollScheduler(identifier, this)),
       m_communicationWatchdog(new QTimer(this))
 {
-    connect(m_pollTimer, &QTimer::timeout, this, &ServoDriverDevice::pollTimerTimeout);
-    connect(m_temperatureTimer, &QTimer::timeout, this, &ServoDriverDevice::temperatureTimerTimeout);
+    connect(m_poller, &ModbusPollScheduler::pollDue, this, &ServoDriverDevice::onPollDue);
 
     m_communicationWatchdog->setSingleShot(true);
     m_communicationWatchdog->setInterval(COMMUNICATION_TIMEOUT_MS);
@@ -24,8 +23,7 @@ ServoDriverDevice::ServoDriverDevice(const QString& identifier, QObject* parent)
 }
 
 ServoDriverDevice::~ServoDriverDevice() {
-    m_pollTimer->stop();
-    m_temperatureTimer->stop();
+    m_poller->stop();
     m_communicationWatchdog->stop();
 }
 
@@ -55,10 +53,38 @@ bool ServoDriverDevice::initialize() {
     // Transport should already be opened by SystemController
     qDebug() << m_identifier << "initializing...";
 
-    // Get polling intervals from config (defaults: 50ms poll, 5s temperature)
+    // Polling schedule from config (defaults: position 20/50/200 ms active/normal/idle,
+    // temperature every 2 s backing off to 10 s while it holds steady)
     QJsonObject config = property("config").toJsonObject();
     int pollInterval = config["pollIntervalMs"].toInt(50);
-    int tempInterval = config["temperatureIntervalMs"].toInt(2000);
+    int tempInterval = config["slowIntervalMs"].toInt(2000);
+    m_idleAfterMs = config["idleAfterMs"].toInt(5000);
+
+    m_poller->stop();
+    m_poller->clearBlocks();
+    m_poller->configureBus(config["baudRate"].toInt(230400),
+                           config["busBudget"].toDouble(0.6),
+                           config["turnaroundMs"].toDouble(1.0));
+
+    ModbusPollScheduler::Block position;
+    position.name = "position";
+    position.count = ServoDriverRegisters::POSITION_REG_COUNT;
+    position.intervalMs = pollInterval;
+    position.activeIntervalMs = config["activeIntervalMs"].toInt(20);
+    position.idleIntervalMs = config["idleIntervalMs"].toInt(200);
+    m_positionBlock = m_poller->addBlock(position);
+
+    ModbusPollScheduler::Block temperature;
+    temperature.name = "temperature";
+    temperature.count = ServoDriverRegisters::TEMPERATURE_REG_COUNT;
+    temperature.intervalMs = tempInterval;
+    temperature.backoffMaxIntervalMs = config["slowMaxIntervalMs"].toInt(10000);
+    m_temperatureBlock = m_poller->addBlock(temperature);
+    m_poller->setBlockEnabled(m_temperatureBlock, m_temperatureEnabled);
+
+    m_hasPolledPosition = false;
+    m_lastMotion.invalidate();
+    updatePollActivity();
 
     setState(DeviceState::Online);
 
@@ -66,19 +92,17 @@ bool ServoDriverDevice::initialize() {
     m_communicationWatchdog->start();
 
     // Start polling
-    m_pollTimer->start(pollInterval);
-    m_temperatureTimer->setInterval(tempInterval);
-    if (m_temperatureEnabled) {
-        m_temperatureTimer->start();
-    }
+    m_poller->start();
 
-    qDebug() << m_identifier << "initialized successfully with poll interval:" << pollInterval << "ms";
+    qDebug().noquote() << QString("%1 initialized successfully, position poll %2 ms, bus load %3%")
+                              .arg(m_identifier)
+                              .arg(m_poller->effectiveIntervalMs(m_positionBlock))
+                              .arg(m_poller->busLoad() * 100.0, 0, 'f', 1);
     return true;
 }
 
 void ServoDriverDevice::shutdown() {
-    m_pollTimer->stop();
-    m_temperatureTimer->stop();
+    m_poller->stop();
     m_communicationWatchdog->stop();
 
     if (m_transport) {
@@ -89,26 +113,21 @@ void ServoDriverDevice::shutdown() {
     setState(DeviceState::Offline);
 }
 
-void ServoDriverDevice::pollTimerTimeout() {
-    // Read position data every poll cycle
-    sendReadRequest(ServoDriverRegisters::POSITION_START_ADDR, 
-                    ServoDriverRegisters::POSITION_REG_COUNT);
-}
-
-void ServoDriverDevice::temperatureTimerTimeout() {
-    // Read temperature data periodically
-    sendReadRequest(ServoDriverRegisters::TEMPERATURE_START_ADDR, 
-                    ServoDriverRegisters::TEMPERATURE_REG_COUNT);
+void ServoDriverDevice::onPollDue(int block) {
+    if (block == m_positionBlock) {
+        sendReadRequest(ServoDriverRegisters::POSITION_START_ADDR,
+                        ServoDriverRegisters::POSITION_REG_COUNT, block);
+    } else if (block == m_temperatureBlock) {
+        sendReadRequest(ServoDriverRegisters::TEMPERATURE_START_ADDR,
+                        ServoDriverRegisters::TEMPERATURE_REG_COUNT, block);
+    }
 }
 
-void ServoDriverDevice::sendReadRequest(int startAddress, int count) {
-    if (state() != DeviceState::Online || !m_transport) return;
-
-    // Cast to ModbusTransport to access Modbus-specific methods
-    auto modbusTransport = qobject_cast<QModbusRtuSerialClient*>(
-        m_transport->property("client").value<QObject*>());
-    
-    if (!modbusTransport) return;
+void ServoDriverDevice::sendReadRequest(int startAddress, int count, int pollBlock) {
+    if (state() != DeviceState::Online || !m_transport) {
+        if (pollBlock >= 0) m_poller->complete(pollBlock, ModbusPollScheduler::Result::Failed);
+        return;
+    }
 
     QModbusDataUnit readUnit(QModbusDataUnit::HoldingRegisters, startAddress, count);
     
@@ -122,11 +141,50 @@ void ServoDriverDevice::sendReadRequest(int startAddress, int count) {
                               Q_RETURN_ARG(QModbusReply*, reply),
                               Q_ARG(QModbusDataUnit, readUnit));
     
-    if (reply) {
-        connect(reply, &QModbusReply::finished, this, [this, reply]() {
+    if (!reply) {
+        if (pollBlock >= 0) m_poller->complete(pollBlock, ModbusPollScheduler::Result::Failed);
+        return;
+    }
+
+    connect(reply, &QModbusReply::finished, this, [this, reply, pollBlock]() {
+        if (pollBlock < 0) {
             onModbusReplyReady(reply);
-        });
+            return;
+        }
+
+        // Unchanged replies let the scheduler back the block off
+        const bool ok = reply->error() == QModbusDevice::NoError;
+        const auto before = data();
+        onModbusReplyReady(reply);
+        if (pollBlock == m_positionBlock && ok) {
+            onPositionPolled();
+        }
+        m_poller->complete(pollBlock, !ok ? ModbusPollScheduler::Result::Failed
+                                          : data() != before ? ModbusPollScheduler::Result::Changed
+                                                             : ModbusPollScheduler::Result::Unchanged);
+    });
+}
+
+void ServoDriverDevice::onPositionPolled() {
+    const float position = data()->position;
+    if (m_hasPolledPosition && std::abs(position - m_lastPolledPosition) >= MOTION_THRESHOLD_STEPS) {
+        m_lastMotion.restart();
     }
+    m_lastPolledPosition = position;
+    m_hasPolledPosition = true;
+    updatePollActivity();
+}
+
+void ServoDriverDevice::updatePollActivity() {
+    using Activity = ModbusPollScheduler::Activity;
+
+    Activity activity = Activity::Normal;
+    if (m_trackingActive || (m_lastMotion.isValid() && m_lastMotion.elapsed() < ACTIVE_HOLD_MS)) {
+        activity = Activity::Active;
+    } else if (!m_lastMotion.isValid() || m_lastMotion.elapsed() >= m_idleAfterMs) {
+        activity = Activity::Idle;
+    }
+    m_poller->setActivity(activity);
 }
 
 void ServoDriverDevice::onModbusReplyReady(QModbusReply* reply) {
@@ -285,15 +343,17 @@ void ServoDriverDevice::clearAlarmHistory() {
 
 void ServoDriverDevice::enableTemperatureReading(bool enable) {
     m_temperatureEnabled = enable;
-    if (enable && state() == DeviceState::Online) {
-        m_temperatureTimer->start();
-    } else {
-        m_temperatureTimer->stop();
-    }
+    m_poller->setBlockEnabled(m_temperatureBlock, enable);
 }
 
 void ServoDriverDevice::setTemperatureInterval(int intervalMs) {
-    m_temperatureTimer->setInterval(intervalMs);
+    m_poller->setBlockInterval(m_temperatureBlock, intervalMs);
+}
+
+void ServoDriverDevice::setTrackingActive(bool active) {
+    if (m_trackingActive == active) return;
+    m_trackingActive = active;
+    updatePollActivity();
 }
 
 void ServoDriverDevice::sendWriteRequest(int startAddress, const QVector<quint16>& values) {
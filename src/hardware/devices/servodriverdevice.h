@@ -27,9 +27,11 @@
 
 #include "../devices/TemplatedDevice.h"
 #include "../data/DataTypes.h"
+#include <QElapsedTimer>
 #include <QTimer>
 
 class Transport;
+class ModbusPollScheduler;
 class ServoDriverProtocolParser;
 class QModbusReply;
 class Message;
@@ -76,6 +78,11 @@ public:
     Q_INVOKABLE void enableTemperatureReading(bool enable);
     Q_INVOKABLE void setTemperatureInterval(int intervalMs);
 
+    // Tracking or identification in progress: poll position at the active rate even when the axis is still
+    Q_INVOKABLE void setTrackingActive(bool active);
+
+    ModbusPollScheduler* pollScheduler() const { return m_poller; }
+
 signals:
     void servoDataChanged(const ServoDriverData& data);
     void alarmDetected(uint16_t alarmCode, const QString& description);
@@ -83,14 +90,15 @@ signals:
     void alarmHistoryRead(const QList<uint16_t>& history);
 
 private slots:
-    void pollTimerTimeout();
-    void temperatureTimerTimeout();
+    void onPollDue(int block);
     void onModbusReplyReady(QModbusReply* reply);
     void processMessage(const Message& message);
     void onCommunicationWatchdogTimeout();
 
 private:
-    void sendReadRequest(int startAddress, int count);
+    void sendReadRequest(int startAddress, int count, int pollBlock = -1);
+    void onPositionPolled();
+    void updatePollActivity();
     void sendWriteRequest(int startAddress, const QVector<quint16>& values);
     void resetCommunicationWatchdog();
     void setConnectionState(bool connected);
@@ -99,12 +107,22 @@ private:
     Transport* m_transport = nullptr;
     ServoDriverProtocolParser* m_parser = nullptr;
 
-    QTimer* m_pollTimer;
-    QTimer* m_temperatureTimer;
+    ModbusPollScheduler* m_poller;
+    int m_positionBlock = -1;
+    int m_temperatureBlock = -1;
     QTimer* m_communicationWatchdog;
     bool m_temperatureEnabled = true;
 
+    // Poll activity: active while the axis moves or a track is engaged, idle once parked
+    QElapsedTimer m_lastMotion;
+    float m_lastPolledPosition = 0.0f;
+    bool m_hasPolledPosition = false;
+    bool m_trackingActive = false;
+    int m_idleAfterMs = 5000;
+
     static constexpr int COMMUNICATION_TIMEOUT_MS = 3000;  // 3 seconds without data = disconnected
+    static constexpr int ACTIVE_HOLD_MS = 1000;            // Stay on the active rate this long after the last motion
+    static constexpr float MOTION_THRESHOLD_STEPS = 5.0f;  // Encoder jitter below this is not motion
 };
 
 #endif // SERVODRIVERDEVICE_H
@@ -32,6 +32,13 @@ std::vector<MessagePtr> Plc21ProtocolParser::parse(QModbusReply* reply) {
     return messages;
 }
 
+void Plc21ProtocolParser::reset()
+{
+    // A block not yet read after reconnect must not report pre-disconnect values
+    m_data = Plc21PanelData();
+    m_data.isConnected = false;
+}
+
 MessagePtr Plc21ProtocolParser::parseDigitalInputsReply(const QModbusDataUnit& unit) {
     // ⭐ Update ONLY digital input fields in the accumulated m_data
     m_data.isConnected = true;
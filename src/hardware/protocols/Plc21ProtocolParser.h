@@ -40,6 +40,11 @@ public:
     // Primary parsing method for Modbus replies
     std::vector<MessagePtr> parse(QModbusReply* reply) override;
 
+    /**
+     * @brief Forget the accumulated panel state (on disconnect)
+     */
+    void reset();
+
 private:
     // Helper methods to create specific messages from a reply
     MessagePtr parseDigitalInputsReply(const QModbusDataUnit& unit);
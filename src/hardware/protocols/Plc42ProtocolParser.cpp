@@ -28,6 +28,10 @@ std::vector<MessagePtr> Plc42ProtocolParser::parse(QModbusReply* reply) {
              unit.startAddress() == Plc42Registers::HOLDING_REGISTERS_START_ADDR) {
         messages.push_back(parseHoldingRegistersReply(unit));
     }
+    else if (unit.registerType() == QModbusDataUnit::InputRegisters &&
+             unit.startAddress() == Plc42Registers::STATION_ENV_START_ADDR) {
+        messages.push_back(parseStationEnvironmentReply(unit));
+    }
 
     return messages;
 }
@@ -83,3 +87,15 @@ MessagePtr Plc42ProtocolParser::parseHoldingRegistersReply(const QModbusDataUnit
     // Return the accumulated data (digital inputs retain previous values)
     return std::make_unique<Plc42DataMessage>(m_data);
 }
+
+MessagePtr Plc42ProtocolParser::parseStationEnvironmentReply(const QModbusDataUnit& unit) {
+    m_data.isConnected = true;
+
+    if (unit.valueCount() >= Plc42Registers::STATION_ENV_COUNT) {
+        // Temperature is a signed register in whole degrees Celsius, pressure in hPa
+        m_data.stationTemperature = static_cast<int16_t>(unit.value(0));
+        m_data.stationPressure    = unit.value(1);
+    }
+
+    return std::make_unique<Plc42DataMessage>(m_data);
+}
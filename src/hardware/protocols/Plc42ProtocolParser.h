@@ -15,13 +15,19 @@ namespace Plc42Registers {
     constexpr int DIGITAL_INPUTS_COUNT = 13;
     constexpr int HOLDING_REGISTERS_START_ADDR = 0;
     constexpr int HOLDING_REGISTERS_COUNT = 10;
+    // Assumed map, not in the PLC42 register document: input registers 0-1 as
+    // temperature and pressure. Only read when devices.json sets
+    // plc.plc42.readEnvironment on a PLC whose program serves them.
+    constexpr int STATION_ENV_START_ADDR = 0;
+    constexpr int STATION_ENV_COUNT = 2;
 }
 
 /**
  * @brief Parser for Modbus RTU PLC42 protocol
  *
  * Converts QModbusReply objects into typed Message objects.
- * Handles digital inputs (discrete inputs) and holding registers.
+ * Handles digital inputs (discrete inputs), holding registers and the station
+ * environment input registers (ambient temperature and pressure).
  *
  * IMPORTANT: Maintains accumulated state in m_data since PLC42 data comes from
  * multiple separate Modbus read operations (digital inputs + holding registers).
@@ -42,6 +48,7 @@ private:
     // Helper methods to create specific messages from a reply
     MessagePtr parseDigitalInputsReply(const QModbusDataUnit& unit);
     MessagePtr parseHoldingRegistersReply(const QModbusDataUnit& unit);
+    MessagePtr parseStationEnvironmentReply(const QModbusDataUnit& unit);
 
     // ⭐ Accumulated data state (persists between poll cycles)
     Plc42Data m_data;
@@ -24,6 +24,30 @@ namespace ServoDriverRegisters {
     constexpr int ALARM_HISTORY_CLEAR_ADDR = 386;
 }
 
+/**
+ * @brief AZD-KX direct data operation registers (written by the motion modes)
+ */
+namespace AzdReg {
+    // These are all 16-bit register addresses
+    constexpr quint16 OpType      = 0x005A; // Operation Type (2 registers)
+    constexpr quint16 OpPosition  = 0x005C; // Position (2 registers, signed steps)
+    constexpr quint16 OpSpeed     = 0x005E; // Operating Speed (2 registers, signed +/- 4,000,000 Hz)
+    constexpr quint16 OpAccel     = 0x0060; // Starting/Changing Speed Rate (2 registers)
+    constexpr quint16 OpDecel     = 0x0062; // Stopping Deceleration (2 registers)
+    constexpr quint16 OpCurrent   = 0x0064; // Operating Current (2 registers, 1 = 0.1%)
+    constexpr quint16 OpTrigger   = 0x0066; // Trigger (2 registers)
+
+    // Operation types
+    constexpr quint32 TypeAbsolutePositioning = 1;
+    constexpr quint32 TypeContinuousSpeed     = 16;
+
+    // Trigger values
+    constexpr qint32 TriggerAllData   = 1;   // Reflect all direct data and start the operation
+    constexpr qint32 TriggerSpeedOnly = -4;  // Update the operating speed only
+
+    constexpr quint32 FullCurrent = 1000;    // 100.0%
+}
+
 /**
  * @brief Parser for Modbus RTU servo driver protocol
  *
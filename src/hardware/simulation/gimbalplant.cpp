@@ -0,0 +1,357 @@
+#include "gimbalplant.h"
+#include "../protocols/ServoDriverProtocolParser.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+constexpr double kDegToRad = M_PI / 180.0;
+constexpr double kRadToDeg = 180.0 / M_PI;
+constexpr double kPositionLoopGain = 8.0;      // 1/s, driver position loop in positioning operation
+constexpr double kArrivalDeg = 1e-4;
+
+static_assert(AzdReg::OpTrigger - AzdReg::OpType + 2 == 14, "direct data register block size");
+
+void toVector(double azDeg, double elDeg, double &x, double &y, double &z)
+{
+    const double az = azDeg * kDegToRad;
+    const double el = elDeg * kDegToRad;
+    x = std::cos(el) * std::cos(az);
+    y = std::cos(el) * std::sin(az);
+    z = std::sin(el);
+}
+
+void fromVector(double x, double y, double z, double &azDeg, double &elDeg)
+{
+    azDeg = std::atan2(y, x) * kRadToDeg;
+    elDeg = std::atan2(z, std::sqrt(x * x + y * y)) * kRadToDeg;
+}
+
+double moveToward(double value, double target, double maxStep)
+{
+    if (maxStep <= 0.0) return target;
+    if (value < target) return std::min(value + maxStep, target);
+    return std::max(value - maxStep, target);
+}
+}
+
+// =========================== SimulatedServoAxis ===========================
+
+SimulatedServoAxis::SimulatedServoAxis(const SimulatedAxisParams &params)
+    : m_params(params)
+{
+}
+
+void SimulatedServoAxis::setPosition(double positionDeg)
+{
+    m_positionDeg = positionDeg;
+    m_velocityDegS = 0.0;
+    m_accelerationDegS2 = 0.0;
+    m_profilePositionDeg = positionDeg;
+    m_profileVelocityDegS = 0.0;
+}
+
+int32_t SimulatedServoAxis::positionSteps() const
+{
+    return static_cast<int32_t>(std::lround(m_positionDeg * m_params.stepsPerDegree));
+}
+
+int32_t SimulatedServoAxis::directValue(int address) const
+{
+    const int index = address - AzdReg::OpType;
+    const uint32_t value = (static_cast<uint32_t>(m_direct[index]) << 16) | m_direct[index + 1];
+    return static_cast<int32_t>(value);
+}
+
+void SimulatedServoAxis::writeRegisters(int startAddress, const std::vector<uint16_t> &values)
+{
+    bool triggered = false;
+    for (size_t i = 0; i < values.size(); ++i) {
+        const int address = startAddress + static_cast<int>(i);
+        const int index = address - AzdReg::OpType;
+        if (index < 0 || index >= DirectRegCount)
+            continue;   // Only direct data operation is modelled
+        m_direct[index] = values[i];
+        triggered |= (address == AzdReg::OpTrigger + 1);
+    }
+    if (triggered)
+        trigger(directValue(AzdReg::OpTrigger));
+}
+
+void SimulatedServoAxis::trigger(int32_t value)
+{
+    const double stepsPerDegree = std::abs(m_params.stepsPerDegree);
+    m_accelDegS2 = std::abs(directValue(AzdReg::OpAccel)) / stepsPerDegree;
+    m_decelDegS2 = std::abs(directValue(AzdReg::OpDecel)) / stepsPerDegree;
+    const double speedDegS = directValue(AzdReg::OpSpeed) / m_params.stepsPerDegree;
+    const int32_t type = directValue(AzdReg::OpType);
+
+    if (value == AzdReg::TriggerSpeedOnly) {
+        // Speed updates act on a continuous operation (and start one after configuration)
+        if (type == static_cast<int32_t>(AzdReg::TypeContinuousSpeed) && m_operation != Operation::Positioning) {
+            if (m_operation == Operation::Stopped) m_rampSpeedDegS = 0.0;
+            m_operation = Operation::ContinuousSpeed;
+            m_targetSpeedDegS = speedDegS;
+        }
+        return;
+    }
+    if (value != AzdReg::TriggerAllData)
+        return;
+
+    if (type == static_cast<int32_t>(AzdReg::TypeAbsolutePositioning)) {
+        m_operation = Operation::Positioning;
+        m_moveTargetDeg = directValue(AzdReg::OpPosition) / m_params.stepsPerDegree;
+        m_moveSpeedDegS = std::abs(speedDegS);
+        m_profilePositionDeg = m_positionDeg;
+        m_profileVelocityDegS = m_velocityDegS;
+    } else if (type == static_cast<int32_t>(AzdReg::TypeContinuousSpeed)) {
+        if (m_operation != Operation::ContinuousSpeed) m_rampSpeedDegS = m_velocityDegS;
+        m_operation = Operation::ContinuousSpeed;
+        m_targetSpeedDegS = speedDegS;
+    }
+}
+
+double SimulatedServoAxis::referenceVelocity(double dt)
+{
+    switch (m_operation) {
+    case Operation::Stopped:
+        return 0.0;
+
+    case Operation::ContinuousSpeed: {
+        const bool speedingUp = std::abs(m_targetSpeedDegS) > std::abs(m_rampSpeedDegS) &&
+                                m_targetSpeedDegS * m_rampSpeedDegS >= 0.0;
+        const double rate = speedingUp ? m_accelDegS2 : m_decelDegS2;
+        m_rampSpeedDegS = moveToward(m_rampSpeedDegS, m_targetSpeedDegS, rate * dt);
+        return m_rampSpeedDegS;
+    }
+
+    case Operation::Positioning: {
+        const double remaining = m_moveTargetDeg - m_profilePositionDeg;
+        const double direction = remaining >= 0.0 ? 1.0 : -1.0;
+        const double decel = m_decelDegS2 > 0.0 ? m_decelDegS2 : 1e9;
+        const double stopping = m_profileVelocityDegS * m_profileVelocityDegS / (2.0 * decel);
+        const bool braking = std::abs(remaining) <= stopping && m_profileVelocityDegS * direction > 0.0;
+
+        if (braking) {
+            m_profileVelocityDegS = moveToward(m_profileVelocityDegS, 0.0, decel * dt);
+        } else {
+            const double rate = m_accelDegS2 > 0.0 ? m_accelDegS2 : 1e9;
+            m_profileVelocityDegS = moveToward(m_profileVelocityDegS, direction * m_moveSpeedDegS, rate * dt);
+        }
+        m_profilePositionDeg += m_profileVelocityDegS * dt;
+
+        const double after = m_moveTargetDeg - m_profilePositionDeg;
+        if (after * remaining <= 0.0 || (std::abs(after) < kArrivalDeg && std::abs(m_profileVelocityDegS) < 0.01)) {
+            m_profilePositionDeg = m_moveTargetDeg;
+            m_profileVelocityDegS = 0.0;
+        }
+        return m_profileVelocityDegS + kPositionLoopGain * (m_profilePositionDeg - m_positionDeg);
+    }
+    }
+    return 0.0;
+}
+
+void SimulatedServoAxis::step(double dt)
+{
+    const double command = referenceVelocity(dt);
+
+    // Second-order speed response: a' = wn² (K u - v) - 2 zeta wn a
+    const double wn = 2.0 * M_PI * m_params.naturalFrequencyHz;
+    const double jerk = wn * wn * (m_params.velocityGain * command - m_velocityDegS)
+                        - 2.0 * m_params.dampingRatio * wn * m_accelerationDegS2;
+    m_accelerationDegS2 = std::clamp(m_accelerationDegS2 + jerk * dt,
+                                     -m_params.maxAccelerationDegS2, m_params.maxAccelerationDegS2);
+    m_velocityDegS += m_accelerationDegS2 * dt;
+    m_positionDeg += m_velocityDegS * dt;
+
+    if (m_positionDeg < m_params.minDeg || m_positionDeg > m_params.maxDeg) {
+        m_positionDeg = std::clamp(m_positionDeg, m_params.minDeg, m_params.maxDeg);
+        m_velocityDegS = 0.0;
+        m_accelerationDegS2 = 0.0;
+    }
+}
+
+std::vector<uint16_t> SimulatedServoAxis::readRegisters(int startAddress, int count) const
+{
+    auto split = [](int32_t value, bool upper) {
+        const uint32_t raw = static_cast<uint32_t>(value);
+        return static_cast<uint16_t>(upper ? (raw >> 16) & 0xFFFF : raw & 0xFFFF);
+    };
+
+    std::vector<uint16_t> values(static_cast<size_t>(std::max(0, count)), 0);
+    for (int i = 0; i < count; ++i) {
+        const int address = startAddress + i;
+        const int index = address - AzdReg::OpType;
+        if (address == ServoDriverRegisters::POSITION_START_ADDR ||
+            address == ServoDriverRegisters::POSITION_START_ADDR + 1) {
+            values[i] = split(positionSteps(), address == ServoDriverRegisters::POSITION_START_ADDR);
+        } else if (address >= ServoDriverRegisters::TEMPERATURE_START_ADDR &&
+                   address < ServoDriverRegisters::TEMPERATURE_START_ADDR + 4) {
+            const int offset = address - ServoDriverRegisters::TEMPERATURE_START_ADDR;
+            const double tempC = offset < 2 ? m_params.driverTempC : m_params.motorTempC;
+            values[i] = split(static_cast<int32_t>(std::lround(tempC * 10.0)), offset % 2 == 0);
+        } else if (index >= 0 && index < DirectRegCount) {
+            values[i] = m_direct[index];
+        }
+    }
+    return values;
+}
+
+// =========================== ModbusLinkModel ===========================
+
+void ModbusLinkModel::configure(int baudRate, double turnaroundS)
+{
+    m_baudRate = std::max(1200, baudRate);
+    m_turnaroundS = std::max(0.0, turnaroundS);
+}
+
+void ModbusLinkModel::reset(double nowS)
+{
+    m_stats = Stats();
+    m_startS = nowS;
+    m_busyUntilS = std::max(m_busyUntilS, nowS);     // A transaction in progress still occupies the line
+}
+
+double ModbusLinkModel::frameTime(int bytes) const
+{
+    return (bytes + 3.5) * 11.0 / m_baudRate;     // Start, 8 data, parity/stop, stop + t3.5 gap
+}
+
+double ModbusLinkModel::schedule(double nowS, int requestBytes, int responseBytes)
+{
+    const double start = std::max(nowS, m_busyUntilS);
+    const double duration = frameTime(requestBytes) + m_turnaroundS + frameTime(responseBytes);
+    m_busyUntilS = start + duration;
+
+    m_stats.busyS += duration;
+    m_stats.bytes += requestBytes + responseBytes;
+    ++m_stats.transactions;
+    m_stats.maxQueueDelayS = std::max(m_stats.maxQueueDelayS, start - nowS);
+    return m_busyUntilS;
+}
+
+void ModbusLinkModel::advanceTo(double nowS)
+{
+    m_stats.elapsedS = std::max(m_stats.elapsedS, nowS - m_startS);
+}
+
+// =========================== GimbalPlant ===========================
+
+GimbalPlant::GimbalPlant(const SimulatedAxisParams &azimuth, const SimulatedAxisParams &elevation,
+                         const VehicleMotionParams &vehicle, const SyntheticTargetParams &target,
+                         double gyroNoiseDps, unsigned seed)
+    : m_azimuth(azimuth)
+    , m_elevation(elevation)
+    , m_vehicle(vehicle)
+    , m_target(target)
+    , m_gyroNoiseDps(gyroNoiseDps)
+    , m_random(seed)
+{
+}
+
+void GimbalPlant::advanceTo(double timeS)
+{
+    while (m_timeS + PhysicsStepS <= timeS + 1e-12) {
+        m_azimuth.step(PhysicsStepS);
+        m_elevation.step(PhysicsStepS);
+        m_timeS += PhysicsStepS;
+    }
+}
+
+VehicleAttitude GimbalPlant::attitude(double timeS) const
+{
+    auto sine = [timeS](double amplitude, double periodS, double &angle, double &rate) {
+        const double w = periodS > 0.0 ? 2.0 * M_PI / periodS : 0.0;
+        angle = amplitude * std::sin(w * timeS);
+        rate = amplitude * w * std::cos(w * timeS);
+    };
+
+    VehicleAttitude a;
+    double rollDot, pitchDot, yawDot;
+    sine(m_vehicle.rollAmplitudeDeg, m_vehicle.rollPeriodS, a.rollDeg, rollDot);
+    sine(m_vehicle.pitchAmplitudeDeg, m_vehicle.pitchPeriodS, a.pitchDeg, pitchDot);
+    sine(m_vehicle.yawAmplitudeDeg, m_vehicle.yawPeriodS, a.yawDeg, yawDot);
+    a.yawDeg = wrap180(a.yawDeg + m_vehicle.yawRateDegS * timeS);
+    yawDot += m_vehicle.yawRateDegS;
+
+    // Euler angle rates to body rates
+    const double phi = a.rollDeg * kDegToRad;
+    const double theta = a.pitchDeg * kDegToRad;
+    a.rollRateDps = rollDot - yawDot * std::sin(theta);
+    a.pitchRateDps = pitchDot * std::cos(phi) + yawDot * std::cos(theta) * std::sin(phi);
+    a.yawRateDps = -pitchDot * std::sin(phi) + yawDot * std::cos(theta) * std::cos(phi);
+    return a;
+}
+
+VehicleAttitude GimbalPlant::imuSample()
+{
+    VehicleAttitude a = attitude(m_timeS);
+    if (m_gyroNoiseDps > 0.0) {
+        a.rollRateDps += m_gyroNoiseDps * m_noise(m_random);
+        a.pitchRateDps += m_gyroNoiseDps * m_noise(m_random);
+        a.yawRateDps += m_gyroNoiseDps * m_noise(m_random);
+    }
+    return a;
+}
+
+void GimbalPlant::targetWorld(double timeS, double &azDeg, double &elDeg) const
+{
+    const double w = m_target.weavePeriodS > 0.0 ? 2.0 * M_PI / m_target.weavePeriodS : 0.0;
+    azDeg = m_target.azDeg + m_target.azRateDegS * timeS + m_target.weaveAmplitudeDeg * std::sin(w * timeS);
+    elDeg = m_target.elDeg + m_target.elRateDegS * timeS;
+}
+
+void GimbalPlant::platformToWorld(double azDeg, double elDeg, const VehicleAttitude &attitude,
+                                  double &worldAzDeg, double &worldElDeg)
+{
+    double x, y, z;
+    toVector(azDeg, elDeg, x, y, z);
+
+    const double cr = std::cos(attitude.rollDeg * kDegToRad), sr = std::sin(attitude.rollDeg * kDegToRad);
+    const double cp = std::cos(attitude.pitchDeg * kDegToRad), sp = std::sin(attitude.pitchDeg * kDegToRad);
+    const double cy = std::cos(attitude.yawDeg * kDegToRad), sy = std::sin(attitude.yawDeg * kDegToRad);
+
+    const double y1 = y * cr - z * sr;
+    const double z1 = y * sr + z * cr;
+    const double x2 = x * cp + z1 * sp;
+    const double z2 = -x * sp + z1 * cp;
+    fromVector(x2 * cy - y1 * sy, x2 * sy + y1 * cy, z2, worldAzDeg, worldElDeg);
+}
+
+void GimbalPlant::worldToPlatform(double worldAzDeg, double worldElDeg, const VehicleAttitude &attitude,
+                                  double &azDeg, double &elDeg)
+{
+    double x, y, z;
+    toVector(worldAzDeg, worldElDeg, x, y, z);
+
+    const double cr = std::cos(attitude.rollDeg * kDegToRad), sr = std::sin(attitude.rollDeg * kDegToRad);
+    const double cp = std::cos(attitude.pitchDeg * kDegToRad), sp = std::sin(attitude.pitchDeg * kDegToRad);
+    const double cy = std::cos(attitude.yawDeg * kDegToRad), sy = std::sin(attitude.yawDeg * kDegToRad);
+
+    // Inverse rotations in reverse order: yaw, pitch, roll
+    const double x2 = x * cy + y * sy;
+    const double y1 = -x * sy + y * cy;
+    const double x1 = x2 * cp - z * sp;
+    const double z1 = x2 * sp + z * cp;
+    fromVector(x1, y1 * cr + z1 * sr, -y1 * sr + z1 * cr, azDeg, elDeg);
+}
+
+double GimbalPlant::angleBetween(double az1Deg, double el1Deg, double az2Deg, double el2Deg)
+{
+    double x1, y1, z1, x2, y2, z2;
+    toVector(az1Deg, el1Deg, x1, y1, z1);
+    toVector(az2Deg, el2Deg, x2, y2, z2);
+    // atan2 of cross and dot stays accurate for the small angles of interest
+    const double cx = y1 * z2 - z1 * y2;
+    const double cy = z1 * x2 - x1 * z2;
+    const double cz = x1 * y2 - y1 * x2;
+    return std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), x1 * x2 + y1 * y2 + z1 * z2) * kRadToDeg;
+}
+
+double GimbalPlant::wrap180(double deg)
+{
+    deg = std::fmod(deg + 180.0, 360.0);
+    if (deg < 0.0)
+        deg += 360.0;
+    return deg - 180.0;
+}
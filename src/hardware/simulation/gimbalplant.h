@@ -0,0 +1,198 @@
+#ifndef GIMBALPLANT_H
+#define GIMBALPLANT_H
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * @file gimbalplant.h
+ * @brief Physics of the simulated gimbal: AZD-KX axes, the RTU line, vehicle and target.
+ *
+ * No QObjects, so it steps at 1 ms without signal overhead. The Qt side
+ * (SimulatedModbusTransport, GimbalSimulation) connects it to the devices.
+ */
+
+struct SimulatedAxisParams {
+    double stepsPerDegree = 222500.0 / 360.0;  // Signed: encoder counts per gimbal degree
+    double naturalFrequencyHz = 4.0;           // Driver speed loop + motor + payload
+    double dampingRatio = 0.7;
+    double velocityGain = 1.0;                 // Achieved / commanded speed
+    double maxAccelerationDegS2 = 300.0;       // Torque limit
+    double minDeg = -1.0e9;                    // Hard stops (unbounded by default)
+    double maxDeg = 1.0e9;
+    double driverTempC = 35.0;
+    double motorTempC = 40.0;
+};
+
+/**
+ * @brief One AZD-KX driver and its axis.
+ *
+ * Implements the registers the application uses: direct data operation
+ * (continuous speed and absolute positioning, speed-only trigger), detected
+ * position and temperatures. The driver's speed loop and the mechanics are a
+ * second-order lag on the commanded speed with an acceleration limit.
+ */
+class SimulatedServoAxis
+{
+public:
+    explicit SimulatedServoAxis(const SimulatedAxisParams &params = SimulatedAxisParams());
+
+    void setPosition(double positionDeg);
+    void step(double dt);
+
+    void writeRegisters(int startAddress, const std::vector<uint16_t> &values);
+    std::vector<uint16_t> readRegisters(int startAddress, int count) const;
+
+    double positionDeg() const { return m_positionDeg; }
+    double velocityDegS() const { return m_velocityDegS; }
+    int32_t positionSteps() const;
+    const SimulatedAxisParams &params() const { return m_params; }
+
+private:
+    enum class Operation { Stopped, ContinuousSpeed, Positioning };
+
+    static constexpr int DirectRegCount = 14;       // AzdReg::OpType .. OpTrigger
+
+    int32_t directValue(int address) const;
+    void trigger(int32_t value);
+    double referenceVelocity(double dt);
+
+    SimulatedAxisParams m_params;
+    std::array<uint16_t, DirectRegCount> m_direct{};
+
+    Operation m_operation = Operation::Stopped;
+    double m_targetSpeedDegS = 0.0;
+    double m_rampSpeedDegS = 0.0;               // Continuous speed after the driver's ramp
+    double m_accelDegS2 = 0.0;
+    double m_decelDegS2 = 0.0;
+    double m_moveTargetDeg = 0.0;               // Positioning: trapezoid generator
+    double m_moveSpeedDegS = 0.0;
+    double m_profilePositionDeg = 0.0;
+    double m_profileVelocityDegS = 0.0;
+
+    double m_positionDeg = 0.0;
+    double m_velocityDegS = 0.0;
+    double m_accelerationDegS2 = 0.0;
+};
+
+/**
+ * @brief Timing of one Modbus RTU line (half duplex, one master).
+ *
+ * Frames are sent back to back; each takes its bytes at 11 bits/char plus the
+ * 3.5 character silent interval, and the slave answers after a turnaround
+ * delay. Requests queue behind the transaction in progress.
+ */
+class ModbusLinkModel
+{
+public:
+    struct Stats {
+        double busyS = 0.0;
+        double elapsedS = 0.0;
+        long long bytes = 0;
+        long long transactions = 0;
+        double maxQueueDelayS = 0.0;
+        double utilisation() const { return elapsedS > 0.0 ? busyS / elapsedS : 0.0; }
+    };
+
+    static int readRequestBytes() { return 8; }
+    static int readResponseBytes(int registerCount) { return 5 + 2 * registerCount; }
+    static int writeRequestBytes(int registerCount) { return 9 + 2 * registerCount; }
+    static int writeResponseBytes() { return 8; }
+
+    void configure(int baudRate, double turnaroundS);
+    void reset(double nowS);
+
+    // Completion time of a transaction submitted at nowS
+    double schedule(double nowS, int requestBytes, int responseBytes);
+    void advanceTo(double nowS);
+
+    const Stats &stats() const { return m_stats; }
+
+private:
+    double frameTime(int bytes) const;
+
+    int m_baudRate = 230400;
+    double m_turnaroundS = 0.002;
+    double m_startS = 0.0;
+    double m_busyUntilS = 0.0;
+    Stats m_stats;
+};
+
+struct VehicleMotionParams {
+    double rollAmplitudeDeg = 0.0;
+    double rollPeriodS = 4.0;
+    double pitchAmplitudeDeg = 0.0;
+    double pitchPeriodS = 5.0;
+    double yawAmplitudeDeg = 0.0;
+    double yawPeriodS = 8.0;
+    double yawRateDegS = 0.0;                  // Steady turn on top of the yaw oscillation
+};
+
+struct VehicleAttitude {
+    double rollDeg = 0.0;
+    double pitchDeg = 0.0;
+    double yawDeg = 0.0;
+    double rollRateDps = 0.0;                  // Body rates p, q, r as the IMU measures them
+    double pitchRateDps = 0.0;
+    double yawRateDps = 0.0;
+};
+
+struct SyntheticTargetParams {
+    bool enabled = false;
+    double azDeg = 0.0;                        // World frame at t = 0
+    double elDeg = 5.0;
+    double azRateDegS = 0.0;
+    double elRateDegS = 0.0;
+    double weaveAmplitudeDeg = 0.0;            // Azimuth weave on top of the constant rate
+    double weavePeriodS = 6.0;
+    double sizeDeg = 0.5;
+};
+
+/**
+ * @brief Both axes, the vehicle and the target on a common simulated time.
+ */
+class GimbalPlant
+{
+public:
+    static constexpr double PhysicsStepS = 0.001;
+
+    GimbalPlant(const SimulatedAxisParams &azimuth, const SimulatedAxisParams &elevation,
+                const VehicleMotionParams &vehicle, const SyntheticTargetParams &target,
+                double gyroNoiseDps = 0.0, unsigned seed = 1);
+
+    void advanceTo(double timeS);
+    double timeS() const { return m_timeS; }
+
+    SimulatedServoAxis &azimuth() { return m_azimuth; }
+    SimulatedServoAxis &elevation() { return m_elevation; }
+    const SimulatedServoAxis &azimuth() const { return m_azimuth; }
+    const SimulatedServoAxis &elevation() const { return m_elevation; }
+
+    VehicleAttitude attitude(double timeS) const;
+    VehicleAttitude imuSample();                // Attitude now with gyro noise
+    bool targetEnabled() const { return m_target.enabled; }
+    double targetSizeDeg() const { return m_target.sizeDeg; }
+    void targetWorld(double timeS, double &azDeg, double &elDeg) const;
+
+    // Same rotation order as GimbalMotionModeBase::convertGimbalToWorldFrame (roll, pitch, yaw)
+    static void platformToWorld(double azDeg, double elDeg, const VehicleAttitude &attitude,
+                                double &worldAzDeg, double &worldElDeg);
+    static void worldToPlatform(double worldAzDeg, double worldElDeg, const VehicleAttitude &attitude,
+                                double &azDeg, double &elDeg);
+    static double angleBetween(double az1Deg, double el1Deg, double az2Deg, double el2Deg);
+    static double wrap180(double deg);
+
+private:
+    SimulatedServoAxis m_azimuth;
+    SimulatedServoAxis m_elevation;
+    VehicleMotionParams m_vehicle;
+    SyntheticTargetParams m_target;
+    double m_gyroNoiseDps;
+    std::mt19937 m_random;
+    std::normal_distribution<double> m_noise{0.0, 1.0};
+    double m_timeS = 0.0;
+};
+
+#endif // GIMBALPLANT_H
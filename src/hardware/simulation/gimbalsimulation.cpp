@@ -0,0 +1,215 @@
+#include "gimbalsimulation.h"
+#include "hardware/communication/simulatedmodbustransport.h"
+#include "controllers/motion_modes/motionclock.h"
+#include "models/domain/systemstatemodel.h"
+
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+constexpr int kLiveStepMs = 2;
+constexpr double kHardStopMarginDeg = 5.0;     // Mechanical stops beyond the soft elevation limits
+
+SimulatedAxisParams axisParams(const DeviceConfiguration::SimulatedAxisConfig& config, double stepsPerDegree)
+{
+    SimulatedAxisParams params;
+    params.stepsPerDegree = stepsPerDegree;
+    params.naturalFrequencyHz = config.naturalFrequencyHz;
+    params.dampingRatio = config.dampingRatio;
+    params.velocityGain = config.velocityGain;
+    params.maxAccelerationDegS2 = config.maxAccelerationDegS2;
+    return params;
+}
+
+SimulatedAxisParams elevationParams(const DeviceConfiguration::SimulationConfig& config)
+{
+    // Encoder counts up as the gun goes down (gimbalEl = -0.0018 deg per count)
+    SimulatedAxisParams params = axisParams(config.elevation, -200000.0 / 360.0);
+    params.minDeg = DeviceConfiguration::gimbal().elevationMin - kHardStopMarginDeg;
+    params.maxDeg = DeviceConfiguration::gimbal().elevationMax + kHardStopMarginDeg;
+    return params;
+}
+
+VehicleMotionParams vehicleParams(const DeviceConfiguration::SimulationConfig& config)
+{
+    VehicleMotionParams params;
+    params.rollAmplitudeDeg = config.rollAmplitudeDeg;
+    params.rollPeriodS = config.rollPeriodS;
+    params.pitchAmplitudeDeg = config.pitchAmplitudeDeg;
+    params.pitchPeriodS = config.pitchPeriodS;
+    params.yawAmplitudeDeg = config.yawAmplitudeDeg;
+    params.yawPeriodS = config.yawPeriodS;
+    params.yawRateDegS = config.yawRateDegS;
+    return params;
+}
+
+SyntheticTargetParams targetParams(const DeviceConfiguration::SimulationConfig& config)
+{
+    SyntheticTargetParams params;
+    params.enabled = config.targetEnabled;
+    params.azDeg = config.targetAzDeg;
+    params.elDeg = config.targetElDeg;
+    params.azRateDegS = config.targetAzRateDegS;
+    params.elRateDegS = config.targetElRateDegS;
+    params.weaveAmplitudeDeg = config.targetWeaveAmplitudeDeg;
+    params.weavePeriodS = config.targetWeavePeriodS;
+    return params;
+}
+}
+
+GimbalSimulation::GimbalSimulation(const DeviceConfiguration::SimulationConfig& config,
+                                   SystemStateModel* stateModel, QObject* parent)
+    : QObject(parent)
+    , m_plant(axisParams(config.azimuth, 222500.0 / 360.0), elevationParams(config),
+              vehicleParams(config), targetParams(config),
+              config.gyroNoiseDps, static_cast<unsigned>(config.seed))
+    , m_stateModel(stateModel)
+    , m_imuPeriodS(1.0 / std::max(1, config.imuRateHz))
+    , m_framePeriodS(1.0 / std::max(1.0, config.cameraFrameRateHz))
+    , m_cameraLatencyS(config.cameraLatencyMs / 1000.0)
+    , m_nextFrameS(m_framePeriodS)
+    , m_epochNs(MotionClock::nowNs())
+{
+    const double turnaroundS = config.busTurnaroundMs / 1000.0;
+    m_azTransport = new SimulatedModbusTransport(&m_plant.azimuth(), turnaroundS, this);
+    m_elTransport = new SimulatedModbusTransport(&m_plant.elevation(), turnaroundS, this);
+
+    connect(&m_timer, &QTimer::timeout, this, [this]() {
+        advanceTo(m_wallClock.nsecsElapsed() * 1e-9);
+    });
+}
+
+GimbalSimulation::~GimbalSimulation()
+{
+    // The servo devices own the transports once wired and may outlive the plant
+    m_timer.stop();
+    if (m_azTransport) m_azTransport->close();
+    if (m_elTransport) m_elTransport->close();
+}
+
+void GimbalSimulation::setGimbalPosition(double azDeg, double elDeg)
+{
+    m_plant.azimuth().setPosition(azDeg);
+    m_plant.elevation().setPosition(elDeg);
+}
+
+void GimbalSimulation::start()
+{
+    qInfo() << "GimbalSimulation: Running simulated servos, IMU and tracker";
+    m_epochNs = MotionClock::nowNs() - static_cast<qint64>(m_plant.timeS() * 1e9);
+    m_wallClock.start();
+    m_timer.start(kLiveStepMs);
+}
+
+void GimbalSimulation::stop()
+{
+    m_timer.stop();
+}
+
+void GimbalSimulation::advanceTo(double timeS)
+{
+    // Sensor events fall on their own schedule between physics steps
+    while (std::min(m_nextImuS, m_nextFrameS) <= timeS) {
+        const bool imuFirst = m_nextImuS <= m_nextFrameS;
+        const double eventS = imuFirst ? m_nextImuS : m_nextFrameS;
+        m_plant.advanceTo(eventS);
+        if (imuFirst) {
+            publishImu();
+            m_nextImuS += m_imuPeriodS;
+        } else {
+            captureFrame(eventS);
+            m_nextFrameS += m_framePeriodS;
+        }
+    }
+    m_plant.advanceTo(timeS);
+
+    if (m_azTransport) m_azTransport->advanceTo(timeS);
+    if (m_elTransport) m_elTransport->advanceTo(timeS);
+    deliverFrames(timeS);
+}
+
+void GimbalSimulation::publishImu()
+{
+    const VehicleAttitude attitude = m_plant.imuSample();
+    const double phi = attitude.rollDeg * M_PI / 180.0;
+    const double theta = attitude.pitchDeg * M_PI / 180.0;
+
+    ImuData data;
+    data.isConnected = true;
+    data.rollDeg = attitude.rollDeg;
+    data.pitchDeg = attitude.pitchDeg;
+    data.yawDeg = attitude.yawDeg;
+    data.temperature = 30.0;
+    // Gravity only: level and at rest reads (0, 0, -1) g
+    data.accelX_g = std::sin(theta);
+    data.accelY_g = -std::sin(phi) * std::cos(theta);
+    data.accelZ_g = -std::cos(phi) * std::cos(theta);
+    data.angRateX_dps = attitude.rollRateDps;
+    data.angRateY_dps = attitude.pitchRateDps;
+    data.angRateZ_dps = attitude.yawRateDps;
+    emit imuDataChanged(data);
+}
+
+void GimbalSimulation::captureFrame(double captureS)
+{
+    if (!m_stateModel || !m_plant.targetEnabled())
+        return;
+
+    const SystemStateData state = m_stateModel->data();
+    const double hfov = state.activeCameraIsDay ? state.dayCurrentHFOV : state.nightCurrentHFOV;
+    const int width = state.currentImageWidthPx;
+    const int height = state.currentImageHeightPx;
+    if (hfov <= 0.01 || width <= 0 || height <= 0)
+        return;
+    const double aspect = static_cast<double>(width) / height;
+    const double vfov = 2.0 * std::atan(std::tan(hfov * M_PI / 360.0) / aspect) * 180.0 / M_PI;
+
+    // Target relative to where the gimbal actually points at capture
+    double worldAz, worldEl, targetAz, targetEl;
+    m_plant.targetWorld(captureS, worldAz, worldEl);
+    GimbalPlant::worldToPlatform(worldAz, worldEl, m_plant.attitude(captureS), targetAz, targetEl);
+    const double errorAz = GimbalPlant::wrap180(targetAz - m_plant.azimuth().positionDeg());
+    const double errorEl = targetEl - m_plant.elevation().positionDeg();
+
+    Frame frame;
+    frame.deliverS = captureS + m_cameraLatencyS;
+    frame.captureNs = m_epochNs + static_cast<qint64>(std::llround(captureS * 1e9));
+    frame.visible = std::abs(errorAz) < hfov / 2.0 && std::abs(errorEl) < vfov / 2.0;
+    frame.centerX = static_cast<float>(width / 2.0 + errorAz * width / hfov);
+    frame.centerY = static_cast<float>(height / 2.0 - errorEl * height / vfov);
+    frame.size = static_cast<float>(m_plant.targetSizeDeg() * width / hfov);
+    // Image-plane velocity, as the tracker estimates it between frames
+    frame.velocityX = m_hasPreviousFrame ? static_cast<float>((frame.centerX - m_previousCenterX) / m_framePeriodS) : 0.0f;
+    frame.velocityY = m_hasPreviousFrame ? static_cast<float>((frame.centerY - m_previousCenterY) / m_framePeriodS) : 0.0f;
+    // Capture pose is the last encoder read the application has, as for the real cameras
+    frame.captureGimbalAz = state.gimbalAz;
+    frame.captureGimbalEl = state.gimbalEl;
+
+    m_hasPreviousFrame = frame.visible;
+    m_previousCenterX = frame.centerX;
+    m_previousCenterY = frame.centerY;
+    m_frames.push_back(frame);
+}
+
+void GimbalSimulation::deliverFrames(double timeS)
+{
+    while (!m_frames.empty() && m_frames.front().deliverS <= timeS) {
+        const Frame frame = m_frames.front();
+        m_frames.pop_front();
+        if (!m_stateModel)
+            continue;
+
+        const SystemStateData state = m_stateModel->data();
+        if (state.currentTrackingPhase != TrackingPhase::Tracking_LockPending &&
+            state.currentTrackingPhase != TrackingPhase::Tracking_ActiveLock)
+            continue;   // Tracker not initialised
+
+        const int cameraIndex = state.activeCameraIsDay ? 0 : 1;
+        m_stateModel->updateTrackingResult(cameraIndex, frame.visible,
+                                           frame.centerX, frame.centerY, frame.size, frame.size,
+                                           frame.velocityX, frame.velocityY,
+                                           frame.visible ? TRACKING_STATE_TRACKED : TRACKING_STATE_LOST,
+                                           frame.captureNs, frame.captureGimbalAz, frame.captureGimbalEl);
+    }
+}
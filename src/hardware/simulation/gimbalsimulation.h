@@ -0,0 +1,82 @@
+#ifndef GIMBALSIMULATION_H
+#define GIMBALSIMULATION_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+#include <deque>
+
+#include "controllers/deviceconfiguration.h"
+#include "hardware/data/DataTypes.h"
+#include "gimbalplant.h"
+
+class SimulatedModbusTransport;
+class SystemStateModel;
+
+/**
+ * @brief Simulated servo drivers, IMU and video tracker around a GimbalPlant.
+ *
+ * The two transports replace the servo ModbusTransports, imuDataChanged
+ * replaces ImuDevice, and tracking results go to
+ * SystemStateModel::updateTrackingResult while a lock is pending or active,
+ * from frames captured at cameraFrameRateHz and delivered cameraLatencyMs
+ * later. start() runs the plant on wall-clock time; the scenario runner calls
+ * advanceTo() with simulated time instead.
+ */
+class GimbalSimulation : public QObject
+{
+    Q_OBJECT
+public:
+    GimbalSimulation(const DeviceConfiguration::SimulationConfig& config, SystemStateModel* stateModel,
+                     QObject* parent = nullptr);
+    ~GimbalSimulation() override;
+
+    SimulatedModbusTransport* azimuthTransport() const { return m_azTransport; }
+    SimulatedModbusTransport* elevationTransport() const { return m_elTransport; }
+    const GimbalPlant& plant() const { return m_plant; }
+
+    void setGimbalPosition(double azDeg, double elDeg);
+    void advanceTo(double timeS);
+    double timeS() const { return m_plant.timeS(); }
+
+    void start();
+    void stop();
+
+signals:
+    void imuDataChanged(const ImuData& data);
+
+private:
+    struct Frame {
+        double deliverS;
+        qint64 captureNs;
+        bool visible;
+        float centerX, centerY, size, velocityX, velocityY;
+        double captureGimbalAz, captureGimbalEl;
+    };
+
+    void publishImu();
+    void captureFrame(double captureS);
+    void deliverFrames(double timeS);
+
+    GimbalPlant m_plant;
+    QPointer<SimulatedModbusTransport> m_azTransport;
+    QPointer<SimulatedModbusTransport> m_elTransport;
+    QPointer<SystemStateModel> m_stateModel;
+
+    double m_imuPeriodS;
+    double m_framePeriodS;
+    double m_cameraLatencyS;
+    double m_nextImuS = 0.0;
+    double m_nextFrameS;
+    std::deque<Frame> m_frames;
+    bool m_hasPreviousFrame = false;
+    float m_previousCenterX = 0.0f;
+    float m_previousCenterY = 0.0f;
+
+    qint64 m_epochNs;                   // MotionClock time at simulated t = 0
+    QTimer m_timer;
+    QElapsedTimer m_wallClock;
+};
+
+#endif // GIMBALSIMULATION_H
@@ -1,37 +1,252 @@
 #include <QGuiApplication>
 #include <QQmlApplicationEngine>
+#include <QCommandLineParser>
+#include <cstring>
 #include "controllers/systemcontroller.h"
 #include "controllers/deviceconfiguration.h"
+#include "services/zonestore.h"
+#include "utils/startupprofiler.h"
+#include "utils/ballisticsbenchmark.h"
+#include "utils/gimbalsimulationbenchmark.h"
+#include "utils/pidtuningbenchmark.h"
+#include "video/pipelinebenchmark.h"
 #include <gst/gst.h>
 
+static bool hasArgument(int argc, char *argv[], const char *name)
+{
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], name) == 0) return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// HEADLESS PIPELINE BENCHMARK (no cameras, no QML, no serial hardware)
+// ============================================================================
+static int runPipelineBenchmark(QGuiApplication &app)
+{
+    const auto& videoConf = DeviceConfiguration::video();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("RCWS video pipeline benchmark");
+    parser.addHelpOption();
+    parser.addOption({"benchmark", "Run the headless video pipeline benchmark."});
+    parser.addOption({"day", "Day camera replay source (video file or \"videotestsrc ...\").", "source", videoConf.dayReplaySource});
+    parser.addOption({"night", "Night camera replay source, \"none\" to disable.", "source", videoConf.nightReplaySource});
+    parser.addOption({"day-state", "Day camera sidecar state CSV.", "file", videoConf.dayReplayStateFile});
+    parser.addOption({"night-state", "Night camera sidecar state CSV.", "file", videoConf.nightReplayStateFile});
+    parser.addOption({"fast", "Replay as fast as possible instead of at the recorded frame rate."});
+    parser.addOption({"duration", "Run time in seconds, 0 = until end of stream.", "seconds", "30"});
+    parser.addOption({"detection", "Enable object detection."});
+    parser.addOption({"model", "Detection ONNX model.", "path", "./models/yolov8s.onnx"});
+    parser.addOption({"tracking", "Lock the tracker on a centred box (day camera)."});
+    parser.addOption({"tracker", "Tracking backend: VPI_BACKEND_CUDA, VPI_BACKEND_PVA, OPENCV_KCF, OPENCV_CSRT.", "name", videoConf.trackingBackend});
+    parser.addOption({"report", "Write the JSON report to a file instead of stdout.", "path"});
+    parser.process(app);
+
+    PipelineBenchmark::Options options;
+    options.day = {parser.value("day"), parser.value("day-state"), !parser.isSet("fast")};
+    options.night = {parser.value("night"), parser.value("night-state"), !parser.isSet("fast")};
+    if (options.day.source.isEmpty()) options.day.source = "videotestsrc pattern=ball";
+    if (options.night.source == "none") options.night.source.clear();
+    options.sourceWidth = videoConf.sourceWidth;
+    options.sourceHeight = videoConf.sourceHeight;
+    options.durationSec = parser.value("duration").toInt();
+    options.detection = parser.isSet("detection");
+    options.detectionModelPath = parser.value("model");
+    options.tracking = parser.isSet("tracking");
+    options.trackingBackend = parser.value("tracker");
+    options.reportPath = parser.value("report");
+
+    PipelineBenchmark benchmark(options);
+    QObject::connect(&benchmark, &PipelineBenchmark::finished, &app, &QCoreApplication::exit);
+    benchmark.start();
+    return app.exec();
+}
+
+// ============================================================================
+// BALLISTICS TABLE BENCHMARK AND ACCURACY REPORT
+// ============================================================================
+static int runBallisticsBenchmark(QGuiApplication &app)
+{
+    const auto& ballisticsConf = DeviceConfiguration::ballistics();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("RCWS ballistics table benchmark");
+    parser.addHelpOption();
+    parser.addOption({"ballistics-benchmark", "Compare the drag-model tables against the reference integration."});
+    parser.addOption({"drag-model", "Drag model: G1 or G7.", "model", ballisticsConf.dragModel});
+    parser.addOption({"bc", "Ballistic coefficient (lb/in²) for the drag model.", "value", QString::number(ballisticsConf.ballisticCoefficient)});
+    parser.addOption({"mv", "Muzzle velocity in m/s.", "mps", QString::number(ballisticsConf.defaultBulletSpeed)});
+    parser.addOption({"lookups", "Timed table lookups per atmosphere.", "count", "1000000"});
+    parser.addOption({"report", "Write the JSON report to a file instead of stdout.", "path"});
+    parser.process(app);
+
+    BallisticsBenchmark::Options options;
+    options.ammunition.dragModel = (parser.value("drag-model").toUpper() == "G1") ? DragModel::G1 : DragModel::G7;
+    options.ammunition.ballisticCoefficient = parser.value("bc").toFloat();
+    options.ammunition.muzzleVelocityMps = parser.value("mv").toFloat();
+    options.tableMaxRange = ballisticsConf.tableMaxRange;
+    options.tableStep = ballisticsConf.tableStep;
+    options.lookups = parser.value("lookups").toInt();
+    options.reportPath = parser.value("report");
+
+    return BallisticsBenchmark::writeReport(BallisticsBenchmark::run(options), options.reportPath);
+}
+
+// ============================================================================
+// GIMBAL PID TUNING REPLAY (configured plant, no servos)
+// ============================================================================
+static int runTuningBenchmark(QGuiApplication &app)
+{
+    const auto& gimbalConf = DeviceConfiguration::gimbal();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("RCWS gimbal PID tuning benchmark");
+    parser.addHelpOption();
+    parser.addOption({"tuning-benchmark", "Replay the configured gimbal plants with configured and retuned gains."});
+    parser.addOption({"duration", "Simulated seconds per step response.", "seconds", "60"});
+    parser.addOption({"report", "Write the JSON report to a file instead of stdout.", "path"});
+    parser.process(app);
+
+    PidTuningBenchmark::Options options;
+    options.azimuth = gimbalConf.azimuthTuning;
+    options.elevation = gimbalConf.elevationTuning;
+    options.durationS = parser.value("duration").toDouble();
+    options.reportPath = parser.value("report");
+
+    return PidTuningBenchmark::writeReport(PidTuningBenchmark::run(options), options.reportPath);
+}
+
+// ============================================================================
+// GIMBAL SIMULATION SCENARIOS (motion modes on the simulated plant)
+// ============================================================================
+static int runGimbalSimBenchmark(QGuiApplication &app)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("RCWS gimbal simulation scenario runner");
+    parser.addHelpOption();
+    parser.addOption({"gimbal-sim-benchmark", "Run motion-mode scenarios against the simulated servos, IMU and tracker."});
+    parser.addOption({"report", "Write the JSON report to a file instead of stdout.", "path"});
+    parser.addPositionalArgument("scenarios", "Scenario files (JSON), e.g. config/sim_scenarios/*.json.", "[files...]");
+    parser.process(app);
+
+    GimbalSimulationBenchmark::Options options;
+    options.scenarioFiles = parser.positionalArguments();
+    options.reportPath = parser.value("report");
+
+    return GimbalSimulationBenchmark::writeReport(GimbalSimulationBenchmark::run(options), options.reportPath);
+}
+
+// ============================================================================
+// ZONE STORE IMPORT / EXPORT (zones.json <-> zones.bin)
+// ============================================================================
+static int runZoneStoreTool(QGuiApplication &app)
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription("RCWS zone store import/export");
+    parser.addHelpOption();
+    parser.addOption({"zones-import", "Replace the zone store with the zones of a JSON file.", "json"});
+    parser.addOption({"zones-export", "Write the zone store to a JSON file.", "json"});
+    parser.addOption({"store", "Zone store file.", "path", ZoneStore::DefaultFilePath});
+    parser.process(app);
+
+    ZoneStore store(parser.value("store"));
+    ZoneStore::Snapshot zones;
+    QString error;
+
+    if (parser.isSet("zones-import")) {
+        if (!ZoneStore::importJson(parser.value("zones-import"), &zones, &error)
+            || !store.writeSnapshot(zones, &error)) {
+            qCritical().noquote() << error;
+            return 1;
+        }
+        qInfo().noquote() << "Imported" << parser.value("zones-import") << "into" << store.filePath();
+        return 0;
+    }
+
+    const ZoneStore::LoadResult result = store.load();
+    if (!result.ok || !result.found) {
+        qCritical().noquote() << (result.found ? result.error : store.filePath() + " does not exist");
+        return 1;
+    }
+    if (!ZoneStore::exportJson(result.zones, parser.value("zones-export"), &error)) {
+        qCritical().noquote() << error;
+        return 1;
+    }
+    qInfo().noquote() << "Exported" << store.filePath() << "to" << parser.value("zones-export");
+    return 0;
+}
+
 int main(int argc, char *argv[])
 {
+    StartupProfiler& profiler = StartupProfiler::instance();    // Startup clock starts here
+
+    // The benchmarks and the zone tool must run on CI machines without a display
+    const bool benchmarkMode = hasArgument(argc, argv, "--benchmark");
+    const bool ballisticsBenchmarkMode = hasArgument(argc, argv, "--ballistics-benchmark");
+    const bool tuningBenchmarkMode = hasArgument(argc, argv, "--tuning-benchmark");
+    const bool gimbalSimBenchmarkMode = hasArgument(argc, argv, "--gimbal-sim-benchmark");
+    const bool zoneStoreMode = hasArgument(argc, argv, "--zones-import") || hasArgument(argc, argv, "--zones-export");
+    if ((benchmarkMode || ballisticsBenchmarkMode || tuningBenchmarkMode || gimbalSimBenchmarkMode || zoneStoreMode)
+        && qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    profiler.begin("application", "phase");
     QGuiApplication app(argc, argv);
     gst_init(&argc, &argv);
+    profiler.end("application");
+
+    if (zoneStoreMode) {
+        return runZoneStoreTool(app);
+    }
 
     // ========================================================================
     // LOAD DEVICE CONFIGURATION
     // ========================================================================
+    profiler.begin("configuration", "phase");
     if (!DeviceConfiguration::load("./config/devices.json")) {
         qCritical() << "Failed to load device configuration!";
         return -1;
     }
+    profiler.end("configuration");
+
+    if (benchmarkMode) {
+        return runPipelineBenchmark(app);
+    }
+    if (ballisticsBenchmarkMode) {
+        return runBallisticsBenchmark(app);
+    }
+    if (tuningBenchmarkMode) {
+        return runTuningBenchmark(app);
+    }
+    if (gimbalSimBenchmarkMode) {
+        return runGimbalSimBenchmark(app);
+    }
+
     // ========================================================================
     // PHASE 1: Initialize Hardware
     // ========================================================================
     SystemController sysCtrl;
+    profiler.begin("initializeHardware", "phase");
     sysCtrl.initializeHardware();
+    profiler.end("initializeHardware");
 
     // ========================================================================
     // PHASE 2: Initialize QML System
     // ========================================================================
     QQmlApplicationEngine engine;
+    profiler.begin("initializeQmlSystem", "phase");
     sysCtrl.initializeQmlSystem(&engine);
+    profiler.end("initializeQmlSystem");
 
     // ========================================================================
     // PHASE 3: Load QML UI
     // ========================================================================
+    profiler.begin("loadQml", "phase");
     engine.load(QUrl(QStringLiteral("qrc:/qml/views/main.qml")));
+    profiler.end("loadQml", !engine.rootObjects().isEmpty());
 
     if (engine.rootObjects().isEmpty()) {
         qCritical() << "Failed to load QML!";
@@ -41,7 +256,9 @@ int main(int argc, char *argv[])
     // ========================================================================
     // PHASE 4: Start System (devices, threads, video)
     // ========================================================================
+    profiler.begin("startSystem", "phase");
     sysCtrl.startSystem();
+    profiler.end("startSystem");
 
     return app.exec();
 }
@@ -153,6 +153,7 @@ bool ControllerRegistry::createQmlControllers()
         m_osdController = new OsdController(this);
         m_osdController->setViewModel(m_viewModelRegistry->osdViewModel());
         m_osdController->setStateModel(m_systemStateModel);
+        m_osdController->setUpdateScheduler(m_viewModelRegistry->updateScheduler());
 
         // Main Menu Controller
         m_mainMenuController = new MainMenuController(this);
@@ -196,6 +197,7 @@ bool ControllerRegistry::createQmlControllers()
         m_systemStatusController = new SystemStatusController();
         m_systemStatusController->setViewModel(m_viewModelRegistry->systemStatusViewModel());
         m_systemStatusController->setStateModel(m_systemStateModel);
+        m_systemStatusController->setUpdateScheduler(m_viewModelRegistry->updateScheduler());
 
         // About Controller
         m_aboutController = new AboutController();
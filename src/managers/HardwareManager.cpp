@@ -16,6 +16,7 @@
 // Transport & Protocol Parsers
 #include "hardware/communication/modbustransport.h"
 #include "hardware/communication/serialporttransport.h"
+#include "hardware/communication/simulatedmodbustransport.h"
 #include "hardware/protocols/Imu3DMGX3ProtocolParser.h"
 #include "hardware/protocols/DayCameraProtocolParser.h"
 #include "hardware/protocols/NightCameraProtocolParser.h"
@@ -40,9 +41,17 @@
 #include "models/domain/servodriverdatamodel.h"
 #include "models/domain/systemstatemodel.h"
 
+// Services
+#include "services/detectionservice.h"
+#include "hardware/simulation/gimbalsimulation.h"
+
 // Configuration
 #include "controllers/deviceconfiguration.h"
 
+// Startup
+#include "utils/startupprofiler.h"
+#include "utils/startuptaskgraph.h"
+
 #include <QDebug>
 #include <QJsonObject>
 #include <QSerialPort>
@@ -153,8 +162,13 @@ bool HardwareManager::connectDevicesToModels()
     connect(m_dayCamControl, &DayCameraControlDevice::dayCameraDataChanged,
             m_dayCamControlModel, &DayCameraDataModel::updateData);
 
-    connect(m_gyroDevice, &ImuDevice::imuDataChanged,
-            m_gyroModel, &GyroDataModel::updateData);
+    if (m_gimbalSimulation) {
+        connect(m_gimbalSimulation, &GimbalSimulation::imuDataChanged,
+                m_gyroModel, &GyroDataModel::updateData);
+    } else {
+        connect(m_gyroDevice, &ImuDevice::imuDataChanged,
+                m_gyroModel, &GyroDataModel::updateData);
+    }
 
     connect(m_joystickDevice, &JoystickDevice::axisMoved,
             m_joystickModel, &JoystickDataModel::onRawAxisMoved);
@@ -174,8 +188,9 @@ bool HardwareManager::connectDevicesToModels()
     connect(m_nightCamControl, &NightCameraControlDevice::nightCameraDataChanged,
             m_nightCamControlModel, &NightCameraDataModel::updateData);
 
-    connect(m_plc21Device, &Plc21Device::panelDataChanged,
-            m_plc21Model, &Plc21DataModel::updateData);
+    // PLC21 reports by exception: only polls that changed a field get this far
+    connect(m_plc21Device, &Plc21Device::panelDeltaReady,
+            m_plc21Model, &Plc21DataModel::applyDelta);
 
     connect(m_plc42Device, &Plc42Device::plc42DataChanged,
             m_plc42Model, &Plc42DataModel::updateData);
@@ -221,8 +236,8 @@ bool HardwareManager::connectModelsToSystemState()
     connect(m_nightCamControlModel, &NightCameraDataModel::dataChanged,
             m_systemStateModel, &SystemStateModel::onNightCameraDataChanged);
 
-    connect(m_plc21Model, &Plc21DataModel::dataChanged,
-            m_systemStateModel, &SystemStateModel::onPlc21DataChanged);
+    connect(m_plc21Model, &Plc21DataModel::deltaApplied,
+            m_systemStateModel, &SystemStateModel::onPlc21DeltaChanged);
 
     connect(m_plc42Model, &Plc42DataModel::dataChanged,
             m_systemStateModel, &SystemStateModel::onPlc42DataChanged);
@@ -236,6 +251,17 @@ bool HardwareManager::connectModelsToSystemState()
     connect(m_servoElModel, &ServoDriverDataModel::dataChanged,
             m_systemStateModel, &SystemStateModel::onServoElDataChanged);
 
+    // Engagements want fresh gimbal position even while the axis holds still
+    connect(m_systemStateModel, &SystemStateModel::dataChanged, this, [this](const SystemStateData& data) {
+        const bool engaged = data.trackingActive
+                             || data.motionMode == MotionMode::AutoTrack
+                             || data.motionMode == MotionMode::ManualTrack
+                             || data.motionMode == MotionMode::RadarTracking
+                             || data.motionMode == MotionMode::SystemIdentification;
+        m_servoAzDevice->setTrackingActive(engaged);
+        m_servoElDevice->setTrackingActive(engaged);
+    });
+
     // Connect SystemStateModel back to cameras
     if (m_dayVideoProcessor) {
         connect(m_systemStateModel, &SystemStateModel::dataChanged,
@@ -257,32 +283,40 @@ bool HardwareManager::startHardware()
 {
     qInfo() << "=== HardwareManager: Starting Hardware ===";
 
-    try {
-        openTransports();
-        initializeDevices();
-        configureCameraDefaults();
+    if (m_startupGraph) {
+        qWarning() << "HardwareManager: Hardware already started";
+        return false;
+    }
 
-        // Start video processing threads
-        if (m_dayVideoProcessor) {
-            m_dayVideoProcessor->start();
-            qInfo() << "  ✓ Day camera thread started";
-        }
+    // Devices come up as their dependencies complete: startHardware() returns
+    // once the graph is running and hardwareStarted() follows when every
+    // device task has finished (the detection network may still be warming up)
+    m_startupGraph = new StartupTaskGraph("hardware", this);
+    m_pendingStartupTasks = addStartupTasks(m_startupGraph);
 
-        if (m_nightVideoProcessor) {
-            m_nightVideoProcessor->start();
-            qInfo() << "  ✓ Night camera thread started";
+    connect(m_startupGraph, &StartupTaskGraph::taskFinished, this, [this](const QString& name, bool ok) {
+        if (name == "detection") {
+            if (ok) StartupProfiler::instance().milestone("detectionReady");
+            return;
+        }
+        if (!m_pendingStartupTasks.removeOne(name) || !m_pendingStartupTasks.isEmpty()) {
+            return;
         }
 
-        qInfo() << "  ✓ Hardware started successfully";
+        // A device that failed to come up is reported, the rest keep running
+        QStringList failed = m_startupGraph->failedTasks();
+        failed.removeAll("detection");
+        if (!failed.isEmpty()) {
+            const QString errorMsg = QString("Hardware startup incomplete: %1").arg(failed.join(", "));
+            qCritical() << errorMsg;
+            emit hardwareError(errorMsg);
+        }
+        qInfo() << "  ✓ Hardware started";
         emit hardwareStarted();
-        return true;
+    });
 
-    } catch (const std::exception& e) {
-        QString errorMsg = QString("Hardware startup failed: %1").arg(e.what());
-        qCritical() << errorMsg;
-        emit hardwareError(errorMsg);
-        return false;
-    }
+    m_startupGraph->start();
+    return true;
 }
 
 // ============================================================================
@@ -300,10 +334,22 @@ void HardwareManager::createTransportLayer()
     m_radarTransport = new SerialPortTransport(this);
     m_plc21Transport = new ModbusTransport(this);
     m_plc42Transport = new ModbusTransport(this);
-    m_servoAzTransport = new ModbusTransport(this);
-    m_servoElTransport = new ModbusTransport(this);
+    if (DeviceConfiguration::simulation().enabled) {
+        m_gimbalSimulation = new GimbalSimulation(DeviceConfiguration::simulation(), m_systemStateModel, this);
+        m_servoAzTransport = m_gimbalSimulation->azimuthTransport();
+        m_servoElTransport = m_gimbalSimulation->elevationTransport();
+    } else {
+        m_servoAzTransport = new ModbusTransport(this);
+        m_servoElTransport = new ModbusTransport(this);
+    }
     m_servoActuatorTransport = new SerialPortTransport(this);
 
+    // Bus metrics and poll schedules are reported under the device identifier
+    m_plc21Transport->setObjectName("plc21");
+    m_plc42Transport->setObjectName("plc42");
+    m_servoAzTransport->setObjectName(DeviceConfiguration::servoAz().name);
+    m_servoElTransport->setObjectName(DeviceConfiguration::servoEl().name);
+
     qInfo() << "    ✓ Transport layer created";
 }
 
@@ -379,14 +425,33 @@ void HardwareManager::createDevices()
     m_servoElDevice = new ServoDriverDevice(servoElConf.name, nullptr);
     m_servoElDevice->setDependencies(m_servoElTransport, m_servoElParser);
 
+    // Single detection network shared by both video processors
+    m_detectionService = new DetectionService("/home/rapit/yolov8s.onnx",
+                                              cv::Size(640, 640),
+                                              false, // use CUDA
+                                              this);
+
     // Video processors with configuration
     m_dayVideoProcessor = new CameraVideoStreamDevice(
         0, videoConf.dayDevicePath, videoConf.sourceWidth,
-        videoConf.sourceHeight, m_systemStateModel, nullptr);
+        videoConf.sourceHeight, m_systemStateModel, m_detectionService, nullptr);
 
     m_nightVideoProcessor = new CameraVideoStreamDevice(
         1, videoConf.nightDevicePath, videoConf.sourceWidth,
-        videoConf.sourceHeight, m_systemStateModel, nullptr);
+        videoConf.sourceHeight, m_systemStateModel, m_detectionService, nullptr);
+
+    m_dayVideoProcessor->setTrackingBackend(videoConf.trackingBackend);
+    m_nightVideoProcessor->setTrackingBackend(videoConf.trackingBackend);
+
+    // Recorded video instead of the cameras (benchmarking without hardware)
+    if (videoConf.replayEnabled) {
+        m_dayVideoProcessor->setReplayOptions({videoConf.dayReplaySource,
+                                               videoConf.dayReplayStateFile,
+                                               videoConf.replayRealtime});
+        m_nightVideoProcessor->setReplayOptions({videoConf.nightReplaySource,
+                                                 videoConf.nightReplayStateFile,
+                                                 videoConf.replayRealtime});
+    }
 
     qInfo() << "    ✓ Devices created with dependency injection";
 }
@@ -410,10 +475,49 @@ void HardwareManager::createDataModels()
     qInfo() << "    ✓ Data models created";
 }
 
-void HardwareManager::openTransports()
+namespace {
+QJsonObject serialConfig(const QString& port, int baudRate, int parity = QSerialPort::NoParity)
 {
-    qInfo() << "  Opening transport connections...";
+    QJsonObject config;
+    config["port"] = port;
+    config["baudRate"] = baudRate;
+    config["parity"] = parity;
+    return config;
+}
+
+QJsonObject modbusConfig(const QString& port, int baudRate, int parity, int slaveId)
+{
+    QJsonObject config = serialConfig(port, baudRate, parity);
+    config["slaveId"] = slaveId;
+    return config;
+}
 
+// Transport keys plus the device's read schedule (see ModbusPollScheduler)
+QJsonObject pollingConfig(QJsonObject config, const DeviceConfiguration::ModbusPollingConfig& polling)
+{
+    config["pollIntervalMs"] = polling.intervalMs;
+    config["activeIntervalMs"] = polling.activeIntervalMs;
+    config["idleIntervalMs"] = polling.idleIntervalMs;
+    config["idleAfterMs"] = polling.idleAfterMs;
+    config["slowIntervalMs"] = polling.slowIntervalMs;
+    config["slowMaxIntervalMs"] = polling.slowMaxIntervalMs;
+    config["busBudget"] = polling.busBudget;
+    config["turnaroundMs"] = polling.turnaroundMs;
+    return config;
+}
+
+// A port that fails to open is reported but does not stop the device: the
+// watchdogs flag it and the operator sees it offline, as before the graph
+void openTransport(Transport* transport, const QJsonObject& config, const char* name)
+{
+    if (!transport->open(config)) {
+        qWarning() << "    ✗" << name << "transport failed to open on" << config["port"].toString();
+    }
+}
+}
+
+QStringList HardwareManager::addStartupTasks(StartupTaskGraph* graph)
+{
     const auto& videoConf = DeviceConfiguration::video();
     const auto& imuConf = DeviceConfiguration::imu();
     const auto& lrfConf = DeviceConfiguration::lrf();
@@ -423,95 +527,117 @@ void HardwareManager::openTransports()
     const auto& servoAzConf = DeviceConfiguration::servoAz();
     const auto& servoElConf = DeviceConfiguration::servoEl();
 
-    // IMU Transport (Serial Binary - 3DM-GX3-25)
-    QJsonObject imuTransportConfig;
-    imuTransportConfig["port"] = imuConf.port;
-    imuTransportConfig["baudRate"] = imuConf.baudRate;
-    imuTransportConfig["parity"] = static_cast<int>(QSerialPort::NoParity);
-    // Note: No slaveId for serial binary protocol (not Modbus)
-    m_imuTransport->open(imuTransportConfig);
-
-    // Day Camera Transport (Serial)
-    QJsonObject dayCameraTransportConfig;
-    dayCameraTransportConfig["port"] = videoConf.dayControlPort;
-    dayCameraTransportConfig["baudRate"] = 9600;  // Pelco-D standard
-    dayCameraTransportConfig["parity"] = static_cast<int>(QSerialPort::NoParity);
-    m_dayCameraTransport->open(dayCameraTransportConfig);
-
-    // Night Camera Transport (Serial)
-    QJsonObject nightCameraTransportConfig;
-    nightCameraTransportConfig["port"] = videoConf.nightControlPort;
-    nightCameraTransportConfig["baudRate"] = 57600;  // TAU2 standard
-    nightCameraTransportConfig["parity"] = static_cast<int>(QSerialPort::NoParity);
-    m_nightCameraTransport->open(nightCameraTransportConfig);
-
-    // PLC21 Transport (Modbus RTU)
-    QJsonObject plc21TransportConfig;
-    plc21TransportConfig["port"] = plc21Conf.port;
-    plc21TransportConfig["baudRate"] = plc21Conf.baudRate;
-    plc21TransportConfig["parity"] = static_cast<int>(plc21Conf.parity);
-    plc21TransportConfig["slaveId"] = plc21Conf.slaveId;
-    m_plc21Transport->open(plc21TransportConfig);
-
-    // PLC42 Transport (Modbus RTU)
-    QJsonObject plc42TransportConfig;
-    plc42TransportConfig["port"] = plc42Conf.port;
-    plc42TransportConfig["baudRate"] = plc42Conf.baudRate;
-    plc42TransportConfig["parity"] = static_cast<int>(plc42Conf.parity);
-    plc42TransportConfig["slaveId"] = plc42Conf.slaveId;
-    m_plc42Transport->open(plc42TransportConfig);
-
-    // Servo Azimuth Transport (Modbus RTU)
-    QJsonObject servoAzTransportConfig;
-    servoAzTransportConfig["port"] = servoAzConf.port;
-    servoAzTransportConfig["baudRate"] = servoAzConf.baudRate;
-    servoAzTransportConfig["parity"] = static_cast<int>(servoAzConf.parity);
-    servoAzTransportConfig["slaveId"] = servoAzConf.slaveId;
-    m_servoAzTransport->open(servoAzTransportConfig);
-
-    // Servo Elevation Transport (Modbus RTU)
-    QJsonObject servoElTransportConfig;
-    servoElTransportConfig["port"] = servoElConf.port;
-    servoElTransportConfig["baudRate"] = servoElConf.baudRate;
-    servoElTransportConfig["parity"] = static_cast<int>(servoElConf.parity);
-    servoElTransportConfig["slaveId"] = servoElConf.slaveId;
-    m_servoElTransport->open(servoElTransportConfig);
-
-    // Servo Actuator Transport (Serial)
-    QJsonObject servoActuatorTransportConfig;
-    servoActuatorTransportConfig["port"] = actuatorConf.port;
-    servoActuatorTransportConfig["baudRate"] = actuatorConf.baudRate;
-    servoActuatorTransportConfig["parity"] = static_cast<int>(QSerialPort::NoParity);
-    m_servoActuatorTransport->open(servoActuatorTransportConfig);
-
-    // LRF Transport (Serial binary protocol)
-    QJsonObject lrfTransportConfig;
-    lrfTransportConfig["port"] = lrfConf.port;
-    lrfTransportConfig["baudRate"] = lrfConf.baudRate;
-    lrfTransportConfig["parity"] = static_cast<int>(QSerialPort::NoParity);
-    m_lrfTransport->open(lrfTransportConfig);
-
-    qInfo() << "    ✓ Transport connections opened";
-}
+    // Serial ports and Modbus clients live on this thread (their socket
+    // notifiers are created in open()), so device tasks run on the main
+    // thread, one per event. The camera pipelines negotiate on their own
+    // threads and the network loads on a worker, alongside all of them.
 
-void HardwareManager::initializeDevices()
-{
-    qInfo() << "  Initializing devices...";
-
-    m_dayCamControl->initialize();
-    m_gyroDevice->initialize();
-    m_joystickDevice->initialize();
-    m_nightCamControl->initialize();
-    m_plc21Device->initialize();
-    m_plc42Device->initialize();
-    m_lrfDevice->initialize();
-    m_radarDevice->initialize();
-    m_servoActuatorDevice->initialize();
-
-    if (m_servoAzDevice) m_servoAzDevice->initialize();
-    if (m_servoElDevice) m_servoElDevice->initialize();
-
-    qInfo() << "    ✓ All devices initialized";
+    // Video first: pipeline negotiation is the longest path to live video
+    graph->addTask("video.day", [this]() {
+        m_dayVideoProcessor->start();
+        return true;
+    });
+    graph->addTask("video.night", [this]() {
+        m_nightVideoProcessor->start();
+        return true;
+    });
+
+    graph->addTask("detection", [this]() {
+        return m_detectionService->loadModel();
+    }, {}, StartupTaskGraph::Affinity::Worker);
+
+    // Gimbal path next: the operator cannot traverse until both drivers answer
+    const QJsonObject servoAzConfig = modbusConfig(servoAzConf.port, servoAzConf.baudRate,
+                                                   static_cast<int>(servoAzConf.parity), servoAzConf.slaveId);
+    m_servoAzDevice->setProperty("config", pollingConfig(servoAzConfig, servoAzConf.polling));
+    graph->addTask("servoAz", [this, servoAzConfig]() {
+        openTransport(m_servoAzTransport, servoAzConfig, "Servo azimuth");
+        return m_servoAzDevice->initialize();
+    });
+
+    const QJsonObject servoElConfig = modbusConfig(servoElConf.port, servoElConf.baudRate,
+                                                   static_cast<int>(servoElConf.parity), servoElConf.slaveId);
+    m_servoElDevice->setProperty("config", pollingConfig(servoElConfig, servoElConf.polling));
+    graph->addTask("servoEl", [this, servoElConfig]() {
+        openTransport(m_servoElTransport, servoElConfig, "Servo elevation");
+        return m_servoElDevice->initialize();
+    });
+
+    const QJsonObject plc42Config = modbusConfig(plc42Conf.port, plc42Conf.baudRate,
+                                                 static_cast<int>(plc42Conf.parity), plc42Conf.slaveId);
+    QJsonObject plc42DeviceConfig = pollingConfig(plc42Config, plc42Conf.polling);
+    plc42DeviceConfig["readEnvironment"] = plc42Conf.readEnvironment;
+    m_plc42Device->setProperty("config", plc42DeviceConfig);
+    graph->addTask("plc42", [this, plc42Config]() {
+        openTransport(m_plc42Transport, plc42Config, "PLC42");
+        return m_plc42Device->initialize();
+    });
+
+    const QJsonObject plc21Config = modbusConfig(plc21Conf.port, plc21Conf.baudRate,
+                                                 static_cast<int>(plc21Conf.parity), plc21Conf.slaveId);
+    m_plc21Device->setProperty("config", pollingConfig(plc21Config, plc21Conf.polling));
+    graph->addTask("plc21", [this, plc21Config]() {
+        openTransport(m_plc21Transport, plc21Config, "PLC21");
+        return m_plc21Device->initialize();
+    });
+
+    graph->addTask("joystick", [this]() {
+        return m_joystickDevice->initialize();
+    });
+
+    // 3DM-GX3-25 uses serial binary, not Modbus (no slaveId)
+    const QJsonObject imuConfig = serialConfig(imuConf.port, imuConf.baudRate);
+    graph->addTask("imu", [this, imuConfig]() {
+        openTransport(m_imuTransport, imuConfig, "IMU");
+        return m_gyroDevice->initialize();
+    });
+
+    const QJsonObject dayCameraConfig = serialConfig(videoConf.dayControlPort, 9600);  // Pelco-D standard
+    graph->addTask("dayCamera", [this, dayCameraConfig]() {
+        openTransport(m_dayCameraTransport, dayCameraConfig, "Day camera");
+        return m_dayCamControl->initialize();
+    });
+
+    const QJsonObject nightCameraConfig = serialConfig(videoConf.nightControlPort, 57600);  // TAU2 standard
+    graph->addTask("nightCamera", [this, nightCameraConfig]() {
+        openTransport(m_nightCameraTransport, nightCameraConfig, "Night camera");
+        return m_nightCamControl->initialize();
+    });
+
+    graph->addTask("cameraDefaults", [this]() {
+        configureCameraDefaults();
+        return true;
+    }, {"dayCamera", "nightCamera"});
+
+    const QJsonObject lrfConfig = serialConfig(lrfConf.port, lrfConf.baudRate);
+    graph->addTask("lrf", [this, lrfConfig]() {
+        openTransport(m_lrfTransport, lrfConfig, "LRF");
+        return m_lrfDevice->initialize();
+    });
+
+    graph->addTask("radar", [this]() {
+        return m_radarDevice->initialize();
+    });
+
+    const QJsonObject actuatorConfig = serialConfig(actuatorConf.port, actuatorConf.baudRate);
+    graph->addTask("servoActuator", [this, actuatorConfig]() {
+        openTransport(m_servoActuatorTransport, actuatorConfig, "Servo actuator");
+        return m_servoActuatorDevice->initialize();
+    });
+
+    QStringList devices = {"video.day", "video.night", "servoAz", "servoEl", "plc42", "plc21", "joystick",
+                           "imu", "dayCamera", "nightCamera", "cameraDefaults", "lrf", "radar", "servoActuator"};
+
+    if (m_gimbalSimulation) {
+        // The plant answers the servo drivers' first polls
+        graph->addTask("simulation", [this]() {
+            m_gimbalSimulation->start();
+            return true;
+        }, {"servoAz", "servoEl", "imu"});
+        devices.append("simulation");
+    }
+
+    return devices;
 }
 
 void HardwareManager::configureCameraDefaults()
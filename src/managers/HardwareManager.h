@@ -2,6 +2,7 @@
 #define HARDWAREMANAGER_H
 
 #include <QObject>
+#include <QStringList>
 #include <QThread>
 
 // Forward declarations - Transport & Parsers
@@ -32,6 +33,9 @@ class Plc42Device;
 class RadarDevice;
 class ServoActuatorDevice;
 class ServoDriverDevice;
+class DetectionService;
+class GimbalSimulation;
+class StartupTaskGraph;
 
 // Forward declarations - Data Models
 class DayCameraDataModel;
@@ -90,7 +94,10 @@ public:
 
     /**
      * @brief Phase 4: Open transport connections and initialize devices
-     * @return true if successful
+     *
+     * Starts the bring-up task graph and returns; hardwareStarted() (or
+     * hardwareError()) follows once every device task has completed.
+     * @return true if the bring-up was started
      */
     bool startHardware();
 
@@ -134,8 +141,7 @@ private:
     void createProtocolParsers();
     void createDevices();
     void createDataModels();
-    void openTransports();
-    void initializeDevices();
+    QStringList addStartupTasks(StartupTaskGraph* graph);  // Returns the device tasks
     void configureCameraDefaults();
 
     // ========================================================================
@@ -148,8 +154,8 @@ private:
     SerialPortTransport* m_radarTransport = nullptr;
     ModbusTransport* m_plc21Transport = nullptr;
     ModbusTransport* m_plc42Transport = nullptr;
-    ModbusTransport* m_servoAzTransport = nullptr;
-    ModbusTransport* m_servoElTransport = nullptr;
+    Transport* m_servoAzTransport = nullptr;      // ModbusTransport, or simulated when simulation.enabled
+    Transport* m_servoElTransport = nullptr;
     SerialPortTransport* m_servoActuatorTransport = nullptr;
 
     // ========================================================================
@@ -185,6 +191,16 @@ private:
     ServoDriverDevice* m_servoAzDevice = nullptr;
     ServoDriverDevice* m_servoElDevice = nullptr;
 
+    // Shared by both video processors (one network, batched day + night frames)
+    DetectionService* m_detectionService = nullptr;
+
+    // Simulated servos and IMU (simulation.enabled in devices.json)
+    GimbalSimulation* m_gimbalSimulation = nullptr;
+
+    // Device bring-up (startHardware)
+    StartupTaskGraph* m_startupGraph = nullptr;
+    QStringList m_pendingStartupTasks;     // Device tasks not finished yet
+
     // ========================================================================
     // DEVICE THREADS
     // ========================================================================
@@ -12,6 +12,7 @@
 #include "models/windageviewmodel.h"
 #include "models/systemstatusviewmodel.h"
 #include "models/aboutviewmodel.h"
+#include "models/viewmodelupdatescheduler.h"
 
 #include <QQmlContext>
 #include <QDebug>
@@ -54,6 +55,9 @@ bool ViewModelRegistry::createViewModels()
         m_systemStatusViewModel = new SystemStatusViewModel(this);
         m_aboutViewModel = new AboutViewModel(this);
 
+        // Update scheduler (attached to the window once QML is loaded)
+        m_updateScheduler = new ViewModelUpdateScheduler(this);
+
         qInfo() << "  ✓ All ViewModels created";
         emit viewModelsCreated();
         return true;
@@ -15,6 +15,7 @@ class ZeroingViewModel;
 class WindageViewModel;
 class SystemStatusViewModel;
 class AboutViewModel;
+class ViewModelUpdateScheduler;
 
 class QQmlContext;
 
@@ -78,6 +79,9 @@ public:
     SystemStatusViewModel* systemStatusViewModel() const { return m_systemStatusViewModel; }
     AboutViewModel* aboutViewModel() const { return m_aboutViewModel; }
 
+    // Frame-synchronised update batching shared by the controllers
+    ViewModelUpdateScheduler* updateScheduler() const { return m_updateScheduler; }
+
 signals:
     void viewModelsCreated();
     void viewModelsRegistered();
@@ -109,6 +113,8 @@ private:
     // System Info
     SystemStatusViewModel* m_systemStatusViewModel = nullptr;
     AboutViewModel* m_aboutViewModel = nullptr;
+
+    ViewModelUpdateScheduler* m_updateScheduler = nullptr;
 };
 
 #endif // VIEWMODELREGISTRY_H
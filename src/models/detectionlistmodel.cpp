@@ -0,0 +1,212 @@
+#include "detectionlistmodel.h"
+#include "utils/inference.h"
+
+#include <QtMath>
+
+namespace {
+// Minimum overlap for a detection to be considered the same object as a row
+constexpr double kMinMatchIoU = 0.3;
+
+double intersectionOverUnion(const QRectF& a, const QRectF& b)
+{
+    const QRectF inter = a.intersected(b);
+    if (inter.isEmpty()) return 0.0;
+    const double interArea = inter.width() * inter.height();
+    const double unionArea = a.width() * a.height() + b.width() * b.height() - interArea;
+    return unionArea > 0.0 ? interArea / unionArea : 0.0;
+}
+
+QRectF toRect(const YoloDetection& det)
+{
+    return QRectF(det.box.x, det.box.y, det.box.width, det.box.height);
+}
+}
+
+DetectionListModel::DetectionListModel(QObject *parent)
+    : QAbstractListModel(parent)
+{
+}
+
+int DetectionListModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_entries.size();
+}
+
+QVariant DetectionListModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() < 0 || index.row() >= m_entries.size()) {
+        return QVariant();
+    }
+
+    const Entry& entry = m_entries.at(index.row());
+    switch (role) {
+    case IdRole:         return entry.id;
+    case XRole:          return entry.box.x();
+    case YRole:          return entry.box.y();
+    case WidthRole:      return entry.box.width();
+    case HeightRole:     return entry.box.height();
+    case ClassNameRole:  return entry.className;
+    case ConfidenceRole: return entry.confidence;
+    case ColorRole:      return entry.color;
+    case LabelTextRole:  return entry.labelText;
+    default:             return QVariant();
+    }
+}
+
+QHash<int, QByteArray> DetectionListModel::roleNames() const
+{
+    return {
+        { IdRole, "detectionId" },
+        { XRole, "boxX" },
+        { YRole, "boxY" },
+        { WidthRole, "boxWidth" },
+        { HeightRole, "boxHeight" },
+        { ClassNameRole, "className" },
+        { ConfidenceRole, "confidence" },
+        { ColorRole, "boxColor" },
+        { LabelTextRole, "labelText" }
+    };
+}
+
+void DetectionListModel::setDetections(const std::vector<YoloDetection>& detections)
+{
+    const int oldCount = m_entries.size();
+    bool changed = false;
+
+    // 1. Match each detection to the row it most likely continues
+    std::vector<bool> taken(oldCount, false);
+    std::vector<int> match(detections.size(), -1);
+    for (size_t i = 0; i < detections.size(); ++i) {
+        match[i] = findMatch(detections[i], taken);
+        if (match[i] >= 0) {
+            taken[match[i]] = true;
+        }
+    }
+
+    // 2. Remove rows whose object is gone (contiguous runs, last first) and
+    //    remember where the surviving rows end up
+    std::vector<int> newRow(oldCount, -1);
+    int surviving = 0;
+    for (int row = 0; row < oldCount; ++row) {
+        if (taken[row]) newRow[row] = surviving++;
+    }
+    for (int last = oldCount - 1; last >= 0; ) {
+        if (taken[last]) { --last; continue; }
+        int first = last;
+        while (first > 0 && !taken[first - 1]) --first;
+        beginRemoveRows(QModelIndex(), first, last);
+        m_entries.remove(first, last - first + 1);
+        endRemoveRows();
+        changed = true;
+        last = first - 1;
+    }
+
+    // 3. Update matched rows in place
+    int added = 0;
+    for (size_t i = 0; i < detections.size(); ++i) {
+        if (match[i] < 0) {
+            ++added;
+            continue;
+        }
+        const int row = newRow[match[i]];
+        const QVector<int> roles = updateEntry(m_entries[row], detections[i]);
+        if (!roles.isEmpty()) {
+            const QModelIndex idx = index(row);
+            emit dataChanged(idx, idx, roles);
+            changed = true;
+        }
+    }
+
+    // 4. Append new objects
+    if (added > 0) {
+        const int first = m_entries.size();
+        beginInsertRows(QModelIndex(), first, first + added - 1);
+        for (size_t i = 0; i < detections.size(); ++i) {
+            if (match[i] >= 0) continue;
+            Entry entry;
+            entry.id = m_nextId++;
+            fillEntry(entry, detections[i]);
+            m_entries.append(entry);
+        }
+        endInsertRows();
+        changed = true;
+    }
+
+    if (m_entries.size() != oldCount) {
+        emit countChanged();
+    }
+    if (changed) {
+        emit detectionsUpdated();
+    }
+}
+
+void DetectionListModel::clear()
+{
+    if (m_entries.isEmpty()) return;
+
+    beginResetModel();
+    m_entries.clear();
+    endResetModel();
+    emit countChanged();
+    emit detectionsUpdated();
+}
+
+const QString& DetectionListModel::internClassName(int classId, const std::string& name)
+{
+    auto it = m_classNames.find(classId);
+    if (it == m_classNames.end() || it->size() != static_cast<qsizetype>(name.size())) {
+        it = m_classNames.insert(classId, QString::fromStdString(name));
+    }
+    return it.value();
+}
+
+int DetectionListModel::findMatch(const YoloDetection& det, const std::vector<bool>& taken) const
+{
+    const QRectF box = toRect(det);
+    int best = -1;
+    double bestIoU = kMinMatchIoU;
+    for (int row = 0; row < m_entries.size(); ++row) {
+        if (taken[row] || m_entries[row].classId != det.class_id) continue;
+        const double iou = intersectionOverUnion(box, m_entries[row].box);
+        if (iou >= bestIoU) {
+            bestIoU = iou;
+            best = row;
+        }
+    }
+    return best;
+}
+
+QVector<int> DetectionListModel::updateEntry(Entry& entry, const YoloDetection& det)
+{
+    QVector<int> roles;
+
+    const QRectF box = toRect(det);
+    if (box.x() != entry.box.x()) roles << XRole;
+    if (box.y() != entry.box.y()) roles << YRole;
+    if (box.width() != entry.box.width()) roles << WidthRole;
+    if (box.height() != entry.box.height()) roles << HeightRole;
+    entry.box = box;
+
+    // Labels show whole percent; sub-percent jitter is not a change
+    const int percent = qRound(det.confidence * 100.0f);
+    if (percent != entry.confidencePercent) {
+        entry.confidence = det.confidence;
+        entry.confidencePercent = percent;
+        entry.labelText = entry.className + QLatin1Char(' ') + QString::number(percent) + QLatin1Char('%');
+        roles << ConfidenceRole << LabelTextRole;
+    }
+
+    return roles;
+}
+
+void DetectionListModel::fillEntry(Entry& entry, const YoloDetection& det)
+{
+    entry.classId = det.class_id;
+    entry.className = internClassName(det.class_id, det.className);
+    entry.confidence = det.confidence;
+    entry.confidencePercent = qRound(det.confidence * 100.0f);
+    entry.color = QColor(det.color.r, det.color.g, det.color.b);
+    entry.box = toRect(det);
+    entry.labelText = entry.className + QLatin1Char(' ')
+                      + QString::number(entry.confidencePercent) + QLatin1Char('%');
+}
@@ -0,0 +1,82 @@
+#ifndef DETECTIONLISTMODEL_H
+#define DETECTIONLISTMODEL_H
+
+#include <QAbstractListModel>
+#include <QColor>
+#include <QHash>
+#include <QRectF>
+#include <QString>
+#include <QVector>
+#include <vector>
+
+struct YoloDetection;
+
+/**
+ * @brief List model of the YOLO detections shown on the OSD.
+ *
+ * Rows keep their identity across frames: each new detection is matched to
+ * the existing row of the same class it overlaps most, and that row is
+ * updated in place (dataChanged with only the roles that moved). Unmatched
+ * rows are removed and new detections appended, so QML delegates are only
+ * created or destroyed when objects actually appear or disappear.
+ *
+ * Class names are converted from std::string once per class id and shared.
+ */
+class DetectionListModel : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+
+public:
+    enum Roles {
+        IdRole = Qt::UserRole + 1,
+        XRole,
+        YRole,
+        WidthRole,
+        HeightRole,
+        ClassNameRole,
+        ConfidenceRole,
+        ColorRole,
+        LabelTextRole
+    };
+
+    struct Entry {
+        quint32 id = 0;
+        int classId = 0;
+        QString className;
+        float confidence = 0.0f;
+        int confidencePercent = 0;
+        QColor color;
+        QRectF box;
+        QString labelText;
+    };
+
+    explicit DetectionListModel(QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    int count() const { return m_entries.size(); }
+    const QVector<Entry>& entries() const { return m_entries; }
+
+    void setDetections(const std::vector<YoloDetection>& detections);
+    void clear();
+
+signals:
+    void countChanged();
+    // Emitted once per setDetections()/clear() that changed anything
+    void detectionsUpdated();
+
+private:
+    const QString& internClassName(int classId, const std::string& name);
+    int findMatch(const YoloDetection& det, const std::vector<bool>& taken) const;
+    QVector<int> updateEntry(Entry& entry, const YoloDetection& det);
+    void fillEntry(Entry& entry, const YoloDetection& det);
+
+    QVector<Entry> m_entries;
+    QHash<int, QString> m_classNames;
+    quint32 m_nextId = 1;
+};
+
+#endif // DETECTIONLISTMODEL_H
@@ -15,6 +15,7 @@ public:
 
 signals:
     void dataChanged(const Plc21PanelData &updatedData);
+    void deltaApplied(const Plc21PanelDelta &delta);
 
 public slots:
     void updateData(const Plc21PanelData &newData)
@@ -25,6 +26,17 @@ public slots:
         }
     }
 
+    // Report-by-exception path: only the flagged fields are touched
+    void applyDelta(const Plc21PanelDelta &delta)
+    {
+        if (delta.isEmpty()) {
+            return;
+        }
+        delta.applyTo(m_data);
+        emit deltaApplied(delta);
+        emit dataChanged(m_data);
+    }
+
 private:
     Plc21PanelData m_data;
 };
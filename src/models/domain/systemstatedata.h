@@ -46,7 +46,7 @@
 #include <QtGlobal> // For qFuzzyCompare
 #include <vector>
 #include "utils/colorutils.h" // For ColorUtils
-#include <vpi/algo/DCFTracker.h> // VPITrackingState, VPIDCFTrackedBoundingBox
+#include "video/trackingstate.h"
 
 // =================================
 // CONSTANTS
@@ -111,7 +111,8 @@ enum class MotionMode {
     Idle,          ///< No motion, idle state
     AutoSectorScan,///< Automatic sector scanning
     TRPScan,        ///< Target Reference Point scanning
-    RadarSlew
+    RadarSlew,
+    SystemIdentification ///< Axis identification and PID retuning
 };
 
 enum class TrackingPhase {
@@ -493,7 +494,7 @@ struct SystemStateData {
     // Environmental Monitoring
     int panelTemperature = 0;            ///< Control panel temperature in Celsius
     int stationTemperature = 0;          ///< Station ambient temperature in Celsius
-    int stationPressure = 0;             ///< Station atmospheric pressure
+    int stationPressure = 0;             ///< Station atmospheric pressure in hPa (0 = not reported)
     
     // Control States
     uint16_t solenoidMode = 0;           ///< Solenoid valve mode setting
@@ -527,9 +528,20 @@ struct SystemStateData {
     float trackedTargetCenterY_px = 0.0f;
     float trackedTargetWidth_px = 0.0f;
     float trackedTargetHeight_px = 0.0f;
-    VPITrackingState trackedTargetState = VPI_TRACKING_STATE_LOST; // Store the raw tracker state
+    TrackingState trackedTargetState = TRACKING_STATE_LOST; // Store the raw tracker state
+    qint64 trackedTargetTimestampNs = 0;  ///< Capture time of the frame the tracker result came from (monotonic ns)
+    double trackedTargetGimbalAz = 0.0;   ///< Gimbal azimuth at that capture time, degrees
+    double trackedTargetGimbalEl = 0.0;   ///< Gimbal elevation at that capture time, degrees
     TrackingPhase currentTrackingPhase = TrackingPhase::Off;
 
+    // Kalman-filtered target (TrackingMotionMode), predicted to the current gimbal update
+    bool predictedTargetValid = false;
+    bool predictedTargetCoasting = false; ///< No recent tracker measurement, prediction only
+    double predictedTargetAz = 0.0;       ///< Predicted target azimuth, degrees
+    double predictedTargetEl = 0.0;       ///< Predicted target elevation, degrees
+    float predictedTargetAzRate = 0.0f;   ///< Target azimuth rate, deg/s
+    float predictedTargetElRate = 0.0f;   ///< Target elevation rate, deg/s
+
     // The acquisition gate/box, defined by user before lock-on.
     // In IMAGE PIXEL coordinates.
     float acquisitionBoxX_px = 512.0f;
@@ -802,7 +814,16 @@ struct SystemStateData {
                qFuzzyCompare(trackedTargetWidth_px, other.trackedTargetWidth_px) &&
                qFuzzyCompare(trackedTargetHeight_px, other.trackedTargetHeight_px) &&
                trackedTargetState == other.trackedTargetState &&
+               trackedTargetTimestampNs == other.trackedTargetTimestampNs &&
+               qFuzzyCompare(trackedTargetGimbalAz, other.trackedTargetGimbalAz) &&
+               qFuzzyCompare(trackedTargetGimbalEl, other.trackedTargetGimbalEl) &&
                currentTrackingPhase == other.currentTrackingPhase &&
+               predictedTargetValid == other.predictedTargetValid &&
+               predictedTargetCoasting == other.predictedTargetCoasting &&
+               qFuzzyCompare(predictedTargetAz, other.predictedTargetAz) &&
+               qFuzzyCompare(predictedTargetEl, other.predictedTargetEl) &&
+               qFuzzyCompare(predictedTargetAzRate, other.predictedTargetAzRate) &&
+               qFuzzyCompare(predictedTargetElRate, other.predictedTargetElRate) &&
                qFuzzyCompare(acquisitionBoxX_px, other.acquisitionBoxX_px) &&
                qFuzzyCompare(acquisitionBoxY_px, other.acquisitionBoxY_px) &&
                qFuzzyCompare(acquisitionBoxW_px, other.acquisitionBoxW_px) &&
@@ -36,9 +36,7 @@
 #include "systemstatemodel.h"
 #include <QDebug>
 #include <QFile>
-#include <QJsonDocument>
-#include <QJsonObject>
-#include <QJsonArray>
+#include <QtConcurrent>
 #include <algorithm> // For std::find_if, std::sort (if needed)
 #include <set>       // For getting unique page numbers
 
@@ -51,8 +49,7 @@ SystemStateModel::SystemStateModel(QObject *parent)
     // Initialize m_currentStateData with defaults if needed
     clearZeroing(); // Zero is lost on power down
     clearWindage(); // Windage is zero on startup
-    // Connect signals from sub-models to slots here (as was likely intended)
-    loadZonesFromFile("zones.json"); // Load initial zones from file if exists
+    // Zones are loaded off the startup path, see loadZonesAsync()
 
     // --- POPULATE DUMMY RADAR DATA FOR TESTING ---
     QVector<SimpleRadarPlot> dummyPlots;
@@ -89,6 +86,15 @@ void SystemStateModel::updateData(const SystemStateData &newState) {
                              !qFuzzyCompare(m_currentStateData.gimbalEl, newState.gimbalEl);
 
         m_currentStateData = newState;
+        if (!(oldData.areaZones == m_currentStateData.areaZones)) {
+            rebuildZoneGeometry();
+        }
+        if (!(oldData.areaZones == m_currentStateData.areaZones)
+            || !(oldData.sectorScanZones == m_currentStateData.sectorScanZones)
+            || !(oldData.targetReferencePoints == m_currentStateData.targetReferencePoints)) {
+            // Not journaled edit by edit: rewrite the store on the next save
+            m_zoneStore.requestCompaction();
+        }
         processStateTransitions(oldData, m_currentStateData);
         emit dataChanged(m_currentStateData);
 
@@ -163,6 +169,8 @@ AreaZone* SystemStateModel::getAreaZoneById(int id) {
 bool SystemStateModel::addAreaZone(AreaZone zone) {
     zone.id = getNextAreaZoneId(); // Assign next ID
     m_currentStateData.areaZones.push_back(zone);
+    recordZoneEdit(ZoneStore::Op::Upsert, ZoneStore::Kind::AreaZone, zone.id);
+    rebuildZoneGeometry();
     qDebug() << "Added AreaZone with ID:" << zone.id;
     emit zonesChanged();
     return true;
@@ -173,6 +181,8 @@ bool SystemStateModel::modifyAreaZone(int id, const AreaZone& updatedZoneData) {
     if (zonePtr) {
         *zonePtr = updatedZoneData; // Copy data
         zonePtr->id = id; // Ensure ID remains the same
+        recordZoneEdit(ZoneStore::Op::Upsert, ZoneStore::Kind::AreaZone, id);
+        rebuildZoneGeometry();
         qDebug() << "Modified AreaZone with ID:" << id;
         emit zonesChanged();
         return true;
@@ -187,6 +197,8 @@ bool SystemStateModel::deleteAreaZone(int id) {
                              [id](const AreaZone& z){ return z.id == id; });
     if (it != m_currentStateData.areaZones.end()) {
         m_currentStateData.areaZones.erase(it, m_currentStateData.areaZones.end());
+        recordZoneEdit(ZoneStore::Op::Delete, ZoneStore::Kind::AreaZone, id);
+        rebuildZoneGeometry();
         qDebug() << "Deleted AreaZone with ID:" << id;
         emit zonesChanged();
         return true;
@@ -210,6 +222,7 @@ AutoSectorScanZone* SystemStateModel::getSectorScanZoneById(int id) {
 bool SystemStateModel::addSectorScanZone(AutoSectorScanZone zone) {
     zone.id = getNextSectorScanId();
     m_currentStateData.sectorScanZones.push_back(zone);
+    recordZoneEdit(ZoneStore::Op::Upsert, ZoneStore::Kind::SectorScan, zone.id);
     qDebug() << "Added SectorScanZone with ID:" << zone.id;
     emit zonesChanged();
     return true;
@@ -220,6 +233,7 @@ bool SystemStateModel::modifySectorScanZone(int id, const AutoSectorScanZone& up
     if (zonePtr) {
         *zonePtr = updatedZoneData;
         zonePtr->id = id;
+        recordZoneEdit(ZoneStore::Op::Upsert, ZoneStore::Kind::SectorScan, id);
         qDebug() << "Modified SectorScanZone with ID:" << id;
         emit zonesChanged();
         return true;
@@ -234,6 +248,7 @@ bool SystemStateModel::deleteSectorScanZone(int id) {
                              [id](const AutoSectorScanZone& z){ return z.id == id; });
     if (it != m_currentStateData.sectorScanZones.end()) {
         m_currentStateData.sectorScanZones.erase(it, m_currentStateData.sectorScanZones.end());
+        recordZoneEdit(ZoneStore::Op::Delete, ZoneStore::Kind::SectorScan, id);
         qDebug() << "Deleted SectorScanZone with ID:" << id;
         emit zonesChanged();
         return true;
@@ -257,6 +272,7 @@ TargetReferencePoint* SystemStateModel::getTRPById(int id) {
 bool SystemStateModel::addTRP(TargetReferencePoint trp) {
     trp.id = getNextTRPId();
     m_currentStateData.targetReferencePoints.push_back(trp);
+    recordZoneEdit(ZoneStore::Op::Upsert, ZoneStore::Kind::TRP, trp.id);
     qDebug() << "Added TRP with ID:" << trp.id;
     emit zonesChanged();
     return true;
@@ -267,6 +283,7 @@ bool SystemStateModel::modifyTRP(int id, const TargetReferencePoint& updatedTRPD
     if (trpPtr) {
         *trpPtr = updatedTRPData;
         trpPtr->id = id;
+        recordZoneEdit(ZoneStore::Op::Upsert, ZoneStore::Kind::TRP, id);
         qDebug() << "Modified TRP with ID:" << id;
         emit zonesChanged();
         return true;
@@ -281,6 +298,7 @@ bool SystemStateModel::deleteTRP(int id) {
                              [id](const TargetReferencePoint& z){ return z.id == id; });
     if (it != m_currentStateData.targetReferencePoints.end()) {
         m_currentStateData.targetReferencePoints.erase(it, m_currentStateData.targetReferencePoints.end());
+        recordZoneEdit(ZoneStore::Op::Delete, ZoneStore::Kind::TRP, id);
         qDebug() << "Deleted TRP with ID:" << id;
         emit zonesChanged();
         return true;
@@ -292,201 +310,189 @@ bool SystemStateModel::deleteTRP(int id) {
 
 // --- Save/Load Zones Implementation ---
 
-bool SystemStateModel::saveZonesToFile(const QString& filePath) {
-    QJsonObject rootObject;
-    rootObject["zoneFileVersion"] = 1; // Versioning
-
-    // Save next IDs
-    rootObject["nextAreaZoneId"] = m_nextAreaZoneId;
-    rootObject["nextSectorScanId"] = m_nextSectorScanId;
-    rootObject["nextTRPId"] = m_nextTRPId;
-
-    // Save Area Zones
-    QJsonArray areaZonesArray;
-    for (const auto& zone : m_currentStateData.areaZones) {
-        QJsonObject zoneObj;
-        zoneObj["id"] = zone.id;
-        zoneObj["type"] = static_cast<int>(zone.type); // Assuming type is always AreaZone type
-        zoneObj["isEnabled"] = zone.isEnabled;
-        zoneObj["isFactorySet"] = zone.isFactorySet;
-        zoneObj["isOverridable"] = zone.isOverridable;
-        zoneObj["startAzimuth"] = zone.startAzimuth;
-        zoneObj["endAzimuth"] = zone.endAzimuth;
-        zoneObj["minElevation"] = zone.minElevation;
-        zoneObj["maxElevation"] = zone.maxElevation;
-        zoneObj["minRange"] = zone.minRange;
-        zoneObj["maxRange"] = zone.maxRange;
-        zoneObj["name"] = zone.name;
-        areaZonesArray.append(zoneObj);
-    }
-    rootObject["areaZones"] = areaZonesArray;
-
-    // Save Sector Scan Zones
-    QJsonArray sectorScanZonesArray;
-    for (const auto& zone : m_currentStateData.sectorScanZones) {
-        QJsonObject zoneObj;
-        zoneObj["id"] = zone.id;
-        zoneObj["isEnabled"] = zone.isEnabled;
-        zoneObj["az1"] = zone.az1;
-        zoneObj["el1"] = zone.el1;
-        zoneObj["az2"] = zone.az2;
-        zoneObj["el2"] = zone.el2;
-        zoneObj["scanSpeed"] = zone.scanSpeed;
-        sectorScanZonesArray.append(zoneObj);
-    }
-    rootObject["sectorScanZones"] = sectorScanZonesArray;
-
-    // Save Target Reference Points
-    QJsonArray trpsArray;
-    for (const auto& trp : m_currentStateData.targetReferencePoints) {
-        QJsonObject trpObj;
-        trpObj["id"] = trp.id;
-        trpObj["locationPage"] = trp.locationPage;
-        trpObj["trpInPage"] = trp.trpInPage;
-        trpObj["azimuth"] = trp.azimuth;
-        trpObj["elevation"] = trp.elevation;
-        trpObj["haltTime"] = trp.haltTime;
-        trpsArray.append(trpObj);
-    }
-    rootObject["targetReferencePoints"] = trpsArray;
-
-    // Write to file
-    QJsonDocument doc(rootObject);
-    QFile file(filePath);
-    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        qWarning() << "Could not open file for writing:" << filePath << file.errorString();
-        return false;
+void SystemStateModel::loadZonesAsync() {
+    if (m_zoneLoadWatcher) {
+        return; // Already loading
+    }
+
+    // The store is only read on the worker; migrating zones.json writes a new
+    // store file that nothing else touches until applyLoadedZones() attaches it
+    const QString storePath = m_zoneStore.filePath();
+    m_zoneLoadWatcher = new QFutureWatcher<ZoneStore::LoadResult>(this);
+    connect(m_zoneLoadWatcher, &QFutureWatcher<ZoneStore::LoadResult>::finished, this, [this]() {
+        const ZoneStore::LoadResult result = m_zoneLoadWatcher->result();
+        m_zoneLoadWatcher->deleteLater();
+        m_zoneLoadWatcher = nullptr;
+        applyLoadedZones(result);
+    });
+    m_zoneLoadWatcher->setFuture(QtConcurrent::run([storePath]() {
+        ZoneStore store(storePath);
+        ZoneStore::LoadResult result = store.load();
+        if (result.ok && !result.found && QFile::exists(ZoneStore::LegacyJsonPath)) {
+            ZoneStore::Snapshot zones;
+            QString error;
+            if (ZoneStore::importJson(ZoneStore::LegacyJsonPath, &zones, &error)
+                && store.writeSnapshot(zones, &error)) {
+                qInfo() << "Migrated" << ZoneStore::LegacyJsonPath << "to" << storePath;
+                result = store.load();
+            } else {
+                qWarning() << "Zone migration failed:" << error;
+            }
+        }
+        return result;
+    }));
+}
+
+namespace {
+// Merges zones entered before the store finished loading into the stored set.
+// The entered zones keep their IDs, which the UI may already hold; a stored
+// zone whose ID is taken moves to a new one.
+template <typename Zone>
+void mergeEnteredZones(std::vector<Zone>& stored, const std::vector<Zone>& entered, int& nextId,
+                       int enteredNextId, ZoneStore::Kind kind, QVector<ZoneStore::Edit>& edits)
+{
+    nextId = std::max(nextId, enteredNextId);
+    for (const Zone& zone : stored) {
+        nextId = std::max(nextId, zone.id + 1);
+    }
+    for (const Zone& zone : entered) {
+        nextId = std::max(nextId, zone.id + 1);
     }
 
-    file.write(doc.toJson(QJsonDocument::Indented));
-    file.close();
-    qDebug() << "Zones saved successfully to" << filePath;
-    return true;
+    for (Zone& zone : stored) {
+        const bool taken = std::any_of(entered.begin(), entered.end(),
+                                       [&zone](const Zone& e) { return e.id == zone.id; });
+        if (taken) {
+            qInfo() << "Stored zone" << zone.id << "renumbered to" << nextId;
+            zone.id = nextId++;
+            edits.append({ZoneStore::Op::Upsert, kind, zone.id});
+        }
+    }
+    // Upserting an entered zone also replaces the stored record under its ID
+    for (const Zone& zone : entered) {
+        stored.push_back(zone);
+        edits.append({ZoneStore::Op::Upsert, kind, zone.id});
+    }
+}
 }
 
-bool SystemStateModel::loadZonesFromFile(const QString& filePath) {
-    QFile file(filePath);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        qWarning() << "Could not open file for reading:" << filePath << file.errorString();
-        return false; // File doesn't exist or cannot be opened
+void SystemStateModel::applyLoadedZones(const ZoneStore::LoadResult& result) {
+    if (!result.ok) {
+        // Keep the damaged file for inspection and carry on with the zones in memory
+        QString error;
+        const QString movedTo = m_zoneStore.moveAside(&error);
+        if (movedTo.isEmpty()) {
+            // Saving now would overwrite the only copy of the stored zones
+            qWarning() << "Failed to load zones:" << result.error << "-" << error;
+            setZoneStoreAlert("ZONE FILE UNREADABLE - Zone changes will not be saved");
+            return;
+        }
+        qWarning() << "Failed to load zones:" << result.error << "- moved to" << movedTo;
+        setZoneStoreAlert("ZONE FILE DAMAGED - Stored zones lost, re-enter and save");
+        m_pendingZoneEdits.clear();     // The next save writes a new store from memory
+        m_zonesLoaded = true;
+        return;
+    }
+
+    // The startup set is empty, so everything in memory was entered while loading
+    ZoneStore::Snapshot zones = result.zones;
+    const ZoneStore::Snapshot entered = zoneSnapshot();
+    QVector<ZoneStore::Edit> edits;
+    mergeEnteredZones(zones.areaZones, entered.areaZones, zones.nextAreaZoneId, entered.nextAreaZoneId,
+                      ZoneStore::Kind::AreaZone, edits);
+    mergeEnteredZones(zones.sectorScanZones, entered.sectorScanZones, zones.nextSectorScanId,
+                      entered.nextSectorScanId, ZoneStore::Kind::SectorScan, edits);
+    mergeEnteredZones(zones.targetReferencePoints, entered.targetReferencePoints, zones.nextTRPId,
+                      entered.nextTRPId, ZoneStore::Kind::TRP, edits);
+    if (!edits.isEmpty()) {
+        qInfo() << "Merged zones entered before the zone store finished loading (" << edits.size() << "records)";
     }
 
-    QByteArray jsonData = file.readAll();
-    file.close();
+    m_zoneStore.attach(result);
+    applyZoneSnapshot(zones);
+    m_pendingZoneEdits = edits;
+    m_zonesLoaded = true;
+    qDebug() << "Zones loaded from" << m_zoneStore.filePath() << "(" << result.journalRecords << "journal records)";
+}
 
-    QJsonParseError parseError;
-    QJsonDocument doc = QJsonDocument::fromJson(jsonData, &parseError);
-    if (parseError.error != QJsonParseError::NoError) {
-        qWarning() << "Failed to parse zones file:" << filePath << parseError.errorString();
+void SystemStateModel::setZoneStoreAlert(const QString& text) {
+    m_zoneStoreAlert = !text.isEmpty();
+    m_currentStateData.alertsWarnings = text;
+    emit dataChanged(m_currentStateData);
+}
+
+bool SystemStateModel::saveZones() {
+    if (!m_zonesLoaded) {
+        // Writing now would replace the stored zones with the (empty) startup set
+        qWarning() << "saveZones: zone store not loaded yet";
         return false;
     }
 
-    if (!doc.isObject()) {
-        qWarning() << "Invalid format: Root is not a JSON object in" << filePath;
+    QString error;
+    if (!m_zoneStore.appendEdits(zoneSnapshot(), m_pendingZoneEdits, &error)) {
+        qWarning() << "Failed to save zones:" << error;
         return false;
     }
-
-    QJsonObject rootObject = doc.object();
-
-    // Optional: Check version
-    int fileVersion = rootObject.value("zoneFileVersion").toInt(0);
-    if (fileVersion > 1) {
-        qWarning() << "Warning: Loading zones from a newer file version (" << fileVersion << "). Compatibility not guaranteed.";
-        // Add specific handling for future versions if needed
-    }
-
-    // Clear existing zones before loading
-    m_currentStateData.areaZones.clear();
-    m_currentStateData.sectorScanZones.clear();
-    m_currentStateData.targetReferencePoints.clear();
-
-    // Load next IDs (use defaults if not present for backward compatibility)
-    m_nextAreaZoneId = rootObject.value("nextAreaZoneId").toInt(1);
-    m_nextSectorScanId = rootObject.value("nextSectorScanId").toInt(1);
-    m_nextTRPId = rootObject.value("nextTRPId").toInt(1);
-
-    // Load Area Zones
-    if (rootObject.contains("areaZones") && rootObject["areaZones"].isArray()) {
-        QJsonArray areaZonesArray = rootObject["areaZones"].toArray();
-        for (const QJsonValue &value : areaZonesArray) {
-            if (value.isObject()) {
-                QJsonObject zoneObj = value.toObject();
-                AreaZone zone;
-                zone.id = zoneObj.value("id").toInt(-1);
-                zone.type = static_cast<ZoneType>(zoneObj.value("type").toInt(static_cast<int>(ZoneType::Safety))); // Type is implicit
-                zone.isEnabled = zoneObj.value("isEnabled").toBool(false);
-                zone.isFactorySet = zoneObj.value("isFactorySet").toBool(false);
-                zone.isOverridable = zoneObj.value("isOverridable").toBool(false);
-                zone.startAzimuth = static_cast<float>(zoneObj.value("startAzimuth").toDouble(0.0));
-                zone.endAzimuth = static_cast<float>(zoneObj.value("endAzimuth").toDouble(0.0));
-                zone.minElevation = static_cast<float>(zoneObj.value("minElevation").toDouble(0.0));
-                zone.maxElevation = static_cast<float>(zoneObj.value("maxElevation").toDouble(0.0));
-                zone.minRange = static_cast<float>(zoneObj.value("minRange").toDouble(0.0));
-                zone.maxRange = static_cast<float>(zoneObj.value("maxRange").toDouble(0.0));
-                zone.name = zoneObj.value("name").toString("");
-
-                if (zone.id != -1) { // Basic validation: require an ID
-                    m_currentStateData.areaZones.push_back(zone);
-                } else {
-                    qWarning() << "Skipping invalid AreaZone entry during load (missing or invalid ID).";
-                }
-            }
-        }
+    m_pendingZoneEdits.clear();
+    if (m_zoneStoreAlert) {
+        setZoneStoreAlert(QString());   // A new store is on disk again
     }
+    return true;
+}
 
-    // Load Sector Scan Zones
-    if (rootObject.contains("sectorScanZones") && rootObject["sectorScanZones"].isArray()) {
-        QJsonArray sectorScanZonesArray = rootObject["sectorScanZones"].toArray();
-        for (const QJsonValue &value : sectorScanZonesArray) {
-            if (value.isObject()) {
-                QJsonObject zoneObj = value.toObject();
-                AutoSectorScanZone zone;
-                zone.id = zoneObj.value("id").toInt(-1);
-                zone.isEnabled = zoneObj.value("isEnabled").toBool(false);
-                zone.az1 = static_cast<float>(zoneObj.value("az1").toDouble(0.0));
-                zone.el1 = static_cast<float>(zoneObj.value("el1").toDouble(0.0));
-                zone.az2 = static_cast<float>(zoneObj.value("az2").toDouble(0.0));
-                zone.el2 = static_cast<float>(zoneObj.value("el2").toDouble(0.0));
-                zone.scanSpeed = static_cast<float>(zoneObj.value("scanSpeed").toDouble(50.0));
-
-                if (zone.id != -1) {
-                    m_currentStateData.sectorScanZones.push_back(zone);
-                } else {
-                    qWarning() << "Skipping invalid SectorScanZone entry during load (missing or invalid ID).";
-                }
-            }
-        }
+bool SystemStateModel::saveZonesToFile(const QString& filePath) {
+    QString error;
+    if (!ZoneStore::exportJson(zoneSnapshot(), filePath, &error)) {
+        qWarning() << error;
+        return false;
     }
+    qDebug() << "Zones saved successfully to" << filePath;
+    return true;
+}
 
-    // Load Target Reference Points
-    if (rootObject.contains("targetReferencePoints") && rootObject["targetReferencePoints"].isArray()) {
-        QJsonArray trpsArray = rootObject["targetReferencePoints"].toArray();
-        for (const QJsonValue &value : trpsArray) {
-            if (value.isObject()) {
-                QJsonObject trpObj = value.toObject();
-                TargetReferencePoint trp;
-                trp.id = trpObj.value("id").toInt(-1);
-                trp.locationPage = trpObj.value("locationPage").toInt(1);
-                trp.trpInPage = trpObj.value("trpInPage").toInt(1);
-                trp.azimuth = static_cast<float>(trpObj.value("azimuth").toDouble(0.0));
-                trp.elevation = static_cast<float>(trpObj.value("elevation").toDouble(0.0));
-                trp.haltTime = static_cast<float>(trpObj.value("haltTime").toDouble(0.0));
-
-                if (trp.id != -1) {
-                    m_currentStateData.targetReferencePoints.push_back(trp);
-                } else {
-                    qWarning() << "Skipping invalid TRP entry during load (missing or invalid ID).";
-                }
-            }
-        }
+bool SystemStateModel::loadZonesFromFile(const QString& filePath) {
+    ZoneStore::Snapshot zones;
+    QString error;
+    if (!ZoneStore::importJson(filePath, &zones, &error)) {
+        qWarning() << error;
+        return false;
     }
 
+    applyZoneSnapshot(zones);
+    // The journal no longer describes the difference to the store
+    m_pendingZoneEdits.clear();
+    m_zoneStore.requestCompaction();
+    qDebug() << "Zones loaded successfully from" << filePath;
+    return true;
+}
+
+ZoneStore::Snapshot SystemStateModel::zoneSnapshot() const {
+    ZoneStore::Snapshot zones;
+    zones.areaZones = m_currentStateData.areaZones;
+    zones.sectorScanZones = m_currentStateData.sectorScanZones;
+    zones.targetReferencePoints = m_currentStateData.targetReferencePoints;
+    zones.nextAreaZoneId = m_nextAreaZoneId;
+    zones.nextSectorScanId = m_nextSectorScanId;
+    zones.nextTRPId = m_nextTRPId;
+    return zones;
+}
+
+void SystemStateModel::applyZoneSnapshot(const ZoneStore::Snapshot& zones) {
+    m_currentStateData.areaZones = zones.areaZones;
+    m_currentStateData.sectorScanZones = zones.sectorScanZones;
+    m_currentStateData.targetReferencePoints = zones.targetReferencePoints;
+    m_nextAreaZoneId = zones.nextAreaZoneId;
+    m_nextSectorScanId = zones.nextSectorScanId;
+    m_nextTRPId = zones.nextTRPId;
+
     // Ensure next IDs are correctly set after loading
     updateNextIdsAfterLoad();
-
-    qDebug() << "Zones loaded successfully from" << filePath;
+    rebuildZoneGeometry();
     emit zonesChanged(); // Notify UI about the loaded zones
-    return true;
+}
+
+void SystemStateModel::recordZoneEdit(ZoneStore::Op op, ZoneStore::Kind kind, int id) {
+    m_pendingZoneEdits.append({op, kind, id});
 }
 
 // Helper to update ID counters after loading zones
@@ -578,6 +584,24 @@ void SystemStateModel::setMotionMode(MotionMode newMode) {
         }
     }
 }
+bool SystemStateModel::startSystemIdentification() {
+    const SystemStateData& data = m_currentStateData;
+    QString refused;
+    if (!data.stationEnabled || data.emergencyStopActive) refused = "station disabled or emergency stop";
+    else if (data.gunArmed) refused = "weapon armed";
+    else if (data.trackingActive) refused = "tracking active";
+    else if (!data.azServoConnected || !data.elServoConnected || data.azFault || data.elFault)
+        refused = "servo disconnected or faulted";
+
+    if (!refused.isEmpty()) {
+        qWarning() << "System identification refused:" << refused;
+        return false;
+    }
+    qInfo() << "System identification started";
+    setMotionMode(MotionMode::SystemIdentification);
+    return true;
+}
+
 void SystemStateModel::setOpMode(OperationalMode newOpMode) { if(m_currentStateData.opMode != newOpMode) { m_currentStateData.previousOpMode = m_currentStateData.opMode; m_currentStateData.opMode = newOpMode; emit dataChanged(m_currentStateData); } }
 void SystemStateModel::setTrackingRestartRequested(bool restart) { if(m_currentStateData.requestTrackingRestart != restart) { m_currentStateData.requestTrackingRestart = restart; emit dataChanged(m_currentStateData); } }
 void SystemStateModel::setTrackingStarted(bool start) { if(m_currentStateData.startTracking != start) { m_currentStateData.startTracking = start; emit dataChanged(m_currentStateData); } }
@@ -602,6 +626,7 @@ void SystemStateModel::onGyroDataChanged(const ImuData &gyroData)
      updateStationaryStatus(newData);
  
     updateData(newData);
+    emit imuSampleReceived(gyroData);
 }
 
 void SystemStateModel::updateStationaryStatus(SystemStateData& data)
@@ -717,39 +742,54 @@ void SystemStateModel::onNightCameraDataChanged(const NightCameraData &nightData
 
 void SystemStateModel::onPlc21DataChanged(const Plc21PanelData &pData)
 {
+    onPlc21DeltaChanged(Plc21PanelDelta::full(pData));
+}
+
+void SystemStateModel::onPlc21DeltaChanged(const Plc21PanelDelta &delta)
+{
+    if (delta.isEmpty()) {
+        return;
+    }
+
+    using Field = Plc21PanelDelta::Field;
+    const Plc21PanelData &pData = delta.data;
     SystemStateData newData = m_currentStateData;
 
-    newData.menuUp = pData.menuUpSW;
-    newData.menuDown = pData.menuDownSW;
-    newData.menuVal = pData.menuValSw;
-
-    newData.stationEnabled =  pData.enableStationSW;
-    newData.gunArmed = pData.armGunSW;
-    newData.gotoHomePosition = pData.homePositionSW;
-    newData.ammoLoaded = pData.loadAmmunitionSW;
-
-    newData.authorized = pData.authorizeSw;
-    newData.enableStabilization = pData.enableStabilizationSW;
-    newData.activeCameraIsDay = pData.switchCameraSW;
-    newData.emergencyStopActive = pData.authorizeSw;            
-
-    switch (pData.fireMode) {
-    case 0:
-        newData.fireMode =FireMode::SingleShot;
-        break;
-    case 1:
-        newData.fireMode =FireMode::ShortBurst;
-        break;
-    case 2:
-        newData.fireMode =FireMode::LongBurst;
-        break;
-    default:
-        newData.fireMode =FireMode::Unknown;
-        break;
-    }
-
-    newData.gimbalSpeed = pData.speedSW;
-    newData.plc21Connected = pData.isConnected;
+    if (delta.has(Field::MenuUp)) newData.menuUp = pData.menuUpSW;
+    if (delta.has(Field::MenuDown)) newData.menuDown = pData.menuDownSW;
+    if (delta.has(Field::MenuVal)) newData.menuVal = pData.menuValSw;
+
+    if (delta.has(Field::EnableStation)) newData.stationEnabled = pData.enableStationSW;
+    if (delta.has(Field::ArmGun)) newData.gunArmed = pData.armGunSW;
+    if (delta.has(Field::HomePosition)) newData.gotoHomePosition = pData.homePositionSW;
+    if (delta.has(Field::LoadAmmunition)) newData.ammoLoaded = pData.loadAmmunitionSW;
+
+    if (delta.has(Field::Authorize)) {
+        newData.authorized = pData.authorizeSw;
+        newData.emergencyStopActive = pData.authorizeSw;
+    }
+    if (delta.has(Field::Stabilization)) newData.enableStabilization = pData.enableStabilizationSW;
+    if (delta.has(Field::SwitchCamera)) newData.activeCameraIsDay = pData.switchCameraSW;
+
+    if (delta.has(Field::FireMode)) {
+        switch (pData.fireMode) {
+        case 0:
+            newData.fireMode =FireMode::SingleShot;
+            break;
+        case 1:
+            newData.fireMode =FireMode::ShortBurst;
+            break;
+        case 2:
+            newData.fireMode =FireMode::LongBurst;
+            break;
+        default:
+            newData.fireMode =FireMode::Unknown;
+            break;
+        }
+    }
+
+    if (delta.has(Field::Speed)) newData.gimbalSpeed = pData.speedSW;
+    if (delta.has(Field::Connected)) newData.plc21Connected = pData.isConnected;
 
     // Auto-disable detection when switching to night camera
     if (!newData.activeCameraIsDay && m_currentStateData.activeCameraIsDay) {
@@ -785,6 +825,9 @@ void SystemStateModel::onPlc42DataChanged(const Plc42Data &pData)
     newData.solenoidState = pData.solenoidState;
     newData.resetAlarm = pData.resetAlarm;
 
+    newData.stationTemperature = pData.stationTemperature;
+    newData.stationPressure = pData.stationPressure;
+
     newData.plc42Connected = pData.isConnected;
 
     updateData(newData);
@@ -1075,37 +1118,14 @@ void SystemStateModel::updateCalculatedLeadOffsets(float angularLeadAz, float an
 }
 
 
-// Helper for Azimuth checks considering wrap-around
-bool isAzimuthInRange(float targetAz, float startAz, float endAz) {
-    // Normalize all to 0-360
-    targetAz = std::fmod(targetAz + 360.0f, 360.0f);
-    startAz = std::fmod(startAz + 360.0f, 360.0f);
-    endAz = std::fmod(endAz + 360.0f, 360.0f);
-
-    if (startAz <= endAz) { // Normal case, e.g., 30 to 60
-        return targetAz >= startAz && targetAz <= endAz;
-    } else { // Wraps around 360, e.g., 350 to 10
-        return targetAz >= startAz || targetAz <= endAz;
-    }
+void SystemStateModel::rebuildZoneGeometry() {
+    m_zoneGeometry.rebuild(m_currentStateData.areaZones);
 }
 
 bool SystemStateModel::isPointInNoFireZone(float targetAz, float targetEl, float targetRange) const {
-    for (const auto& zone : m_currentStateData.areaZones) {
-        if (zone.isEnabled && zone.type == ZoneType::NoFire) {
-            bool azMatch = isAzimuthInRange(targetAz, zone.startAzimuth, zone.endAzimuth);
-            bool elMatch = (targetEl >= zone.minElevation && targetEl <= zone.maxElevation);
-            bool rangeMatch = true; // Assume range matches if not specified or zone has no range limits
-            /*if (targetRange != -1.0f && (zone.minRange > 0 || zone.maxRange > 0)) {
-                rangeMatch = (targetRange >= zone.minRange && (zone.maxRange == 0 || targetRange <= zone.maxRange));
-            }*/
-
-            if (azMatch && elMatch && rangeMatch) {
-                // TODO: Consider 'isOverridable' if you have an override switch state
-                return true;
-            }
-        }
-    }
-    return false;
+    Q_UNUSED(targetRange) // Zone range limits are not applied yet
+    // TODO: Consider 'isOverridable' if you have an override switch state
+    return m_zoneGeometry.isPointInZone(ZoneType::NoFire, targetAz, targetEl);
 }
 
 void SystemStateModel::setPointInNoFireZone(bool inZone) {
@@ -1117,19 +1137,15 @@ void SystemStateModel::setPointInNoFireZone(bool inZone) {
 }
 
 bool SystemStateModel::isPointInNoTraverseZone(float targetAz, float currentEl) const {
-    for (const auto& zone : m_currentStateData.areaZones) {
-        if (zone.isEnabled && zone.type == ZoneType::NoTraverse) {
-            // No Traverse Zones often apply across all elevations or a very wide range
-            // For simplicity, let's assume they apply if currentEl is within zone's El range
-            bool elInRange = (currentEl >= zone.minElevation && currentEl <= zone.maxElevation);
-            if (elInRange && isAzimuthInRange(targetAz, zone.startAzimuth, zone.endAzimuth)) {
-                // TODO: Consider 'isOverridable'
-                return true;
-            }
-        }
-    }
-    return false;
+    // No Traverse Zones apply if currentEl is within the zone's El range
+    // TODO: Consider 'isOverridable'
+    return m_zoneGeometry.isPointInZone(ZoneType::NoTraverse, targetAz, currentEl);
+}
+
+bool SystemStateModel::isAtNoTraverseZoneLimit(float currentAz, float currentEl, float intendedMoveAz) const {
+    return m_zoneGeometry.sweep(ZoneType::NoTraverse, currentAz, intendedMoveAz, currentEl).hit;
 }
+
 void SystemStateModel::setPointInNoTraverseZone(bool inZone) {
     // Similar to No Fire Zone, this can be used to track if the current azimuth is in a No Traverse Zone
     m_currentStateData.isReticleInNoTraverseZone = inZone;
@@ -1432,7 +1448,7 @@ void SystemStateModel::enterEmergencyStopMode() {
 /*void SystemStateModel::updateTrackedTargetInfo(int cameraIndex, bool isValid, float centerX_px, float centerY_px,
                                  float width_px, float height_px,
                                  float velocityX_px_s, float velocityY_px_s,
-                                 VPITrackingState state)
+                                 TrackingState state)
 {
     // Check which camera is supposed to be active (e.g., 0 for Day, 1 for Night)
     int activeCameraIndex = m_currentStateData.activeCameraIsDay ? 0 : 1;
@@ -1493,11 +1509,14 @@ void SystemStateModel::enterEmergencyStopMode() {
 // Rename/replace updateTrackedTargetInfo with this one.
 void SystemStateModel::updateTrackingResult(
     int cameraIndex,
-    bool hasLock, // This parameter might become less relevant as we use VPITrackingState directly
+    bool hasLock, // This parameter might become less relevant as we use TrackingState directly
     float centerX_px, float centerY_px,
     float width_px, float height_px,
     float velocityX_px_s, float velocityY_px_s,
-    VPITrackingState trackerState)
+    TrackingState trackerState,
+    qint64 captureTimestampNs,
+    double captureGimbalAz,
+    double captureGimbalEl)
 {
     //QMutexLocker locker(&m_mutex); // Protect shared state
 
@@ -1514,7 +1533,7 @@ void SystemStateModel::updateTrackingResult(
     // --- 1. Update the raw tracked target data fields ---
     // The 'hasLock' parameter from CameraVideoStreamDevice is derived from its internal logic.
     // We will primarily rely on 'trackerState' for the model's state machine.
-    bool newTrackerHasValidTarget = (trackerState == VPI_TRACKING_STATE_TRACKED);
+    bool newTrackerHasValidTarget = (trackerState == TRACKING_STATE_TRACKED);
 
     if (data.trackerHasValidTarget != newTrackerHasValidTarget) { data.trackerHasValidTarget = newTrackerHasValidTarget; stateDataChanged = true; }
     if (!qFuzzyCompare(data.trackedTargetCenterX_px, centerX_px)) { data.trackedTargetCenterX_px = centerX_px; stateDataChanged = true; }
@@ -1524,6 +1543,12 @@ void SystemStateModel::updateTrackingResult(
     if (!qFuzzyCompare(data.trackedTargetVelocityX_px_s, velocityX_px_s)) { data.trackedTargetVelocityX_px_s = velocityX_px_s; stateDataChanged = true; }
     if (!qFuzzyCompare(data.trackedTargetVelocityY_px_s, velocityY_px_s)) { data.trackedTargetVelocityY_px_s = velocityY_px_s; stateDataChanged = true; }
     if (data.trackedTargetState != trackerState) { data.trackedTargetState = trackerState; stateDataChanged = true; }
+    if (data.trackedTargetTimestampNs != captureTimestampNs) {
+        data.trackedTargetTimestampNs = captureTimestampNs;
+        data.trackedTargetGimbalAz = captureGimbalAz;
+        data.trackedTargetGimbalEl = captureGimbalEl;
+        stateDataChanged = true;
+    }
 
     // --- 2. REFINED High-Level TrackingPhase state machine ---
     TrackingPhase oldPhase = data.currentTrackingPhase;
@@ -1535,10 +1560,10 @@ void SystemStateModel::updateTrackingResult(
             // The transition from Off to Acquisition is typically triggered by a UI event (e.g., TRACK button press),
             // not directly by the CameraVideoStreamDevice reporting a state.
             // This block should primarily handle resetting if we somehow get tracking data while Off.
-            if (trackerState != VPI_TRACKING_STATE_LOST) {
+            if (trackerState != TRACKING_STATE_LOST) {
                 qWarning() << "[MODEL] Received tracking data while in Off phase. Resetting model tracking state.";
                 data.trackerHasValidTarget = false;
-                data.trackedTargetState = VPI_TRACKING_STATE_LOST;
+                data.trackedTargetState = TRACKING_STATE_LOST;
                 data.motionMode = MotionMode::Manual; // Ensure gimbal is manual
             }
             break;
@@ -1550,7 +1575,7 @@ void SystemStateModel::updateTrackingResult(
             // The transition from Acquisition to LockPending is triggered by a UI event (TRACK button press).
             // This model should primarily update the OSD box based on user input (if any) during this phase.
             // No direct VPI tracker state handling here for phase transition.
-            if (trackerState != VPI_TRACKING_STATE_LOST) {
+            if (trackerState != TRACKING_STATE_LOST) {
                 qWarning() << "[MODEL] Received tracking data (" << static_cast<int>(trackerState) << ") while in Acquisition phase. Ignoring for phase transition.";
             }
             break;
@@ -1558,13 +1583,13 @@ void SystemStateModel::updateTrackingResult(
         case TrackingPhase::Tracking_LockPending:
          qDebug() << "Ttracker State " << static_cast<int>(trackerState) << " in LockPending phase.";
             // This is the critical phase where we wait for the tracker to lock.
-            if (trackerState == VPI_TRACKING_STATE_TRACKED) {
+            if (trackerState == TRACKING_STATE_TRACKED) {
                 // Success! Tracker has locked onto the target.
                 data.currentTrackingPhase = TrackingPhase::Tracking_ActiveLock;
                 data.opMode = OperationalMode::Tracking;
                 data.motionMode = MotionMode::AutoTrack; // Activate gimbal tracking
                 qInfo() << "[MODEL] Valid Lock Acquired! Phase -> ActiveLock (" << static_cast<int>(data.currentTrackingPhase) << ")";
-            } else if (trackerState == VPI_TRACKING_STATE_LOST) {
+            } else if (trackerState == TRACKING_STATE_LOST) {
                 // Tracker failed to lock or lost target immediately after initialization.
                 // This can happen if the initial box was bad or target moved too fast.
                 data.currentTrackingPhase = TrackingPhase::Off; // Go back to Off
@@ -1572,7 +1597,7 @@ void SystemStateModel::updateTrackingResult(
                 data.motionMode = MotionMode::Manual; // Deactivate gimbal tracking
                 data.trackerHasValidTarget = false; // Ensure model reflects no valid target
                 qWarning() << "[MODEL] Tracker failed to acquire lock (LOST). Returning to Off (" << static_cast<int>(data.currentTrackingPhase) << ").";
-            } else if (trackerState == VPI_TRACKING_STATE_NEW) {
+            } else if (trackerState == TRACKING_STATE_NEW) {
                 // Tracker is initialized and attempting to lock. This is expected.
                 // Stay in LockPending and wait for TRACKED or LOST.
                 qDebug() << "[MODEL] In LockPending, tracker initialized (NEW). Waiting for lock.";
@@ -1584,14 +1609,18 @@ void SystemStateModel::updateTrackingResult(
 
         case TrackingPhase::Tracking_ActiveLock:
             // We are actively tracking. Monitor the tracker's state.
-            if (trackerState == VPI_TRACKING_STATE_LOST) {
+            if (trackerState == TRACKING_STATE_LOST) {
                 // Target lost during active tracking.
                 data.currentTrackingPhase = TrackingPhase::Tracking_Coast; // Transition to Coast
                 data.opMode = OperationalMode::Tracking; // Still in tracking op mode
-                data.motionMode = MotionMode::Manual; // Gimbal goes to manual in Coast
+                // The gimbal keeps following the target filter's prediction while it is valid,
+                // so short occlusions do not drop the track; otherwise go to manual.
+                if (!data.predictedTargetValid) {
+                    data.motionMode = MotionMode::Manual;
+                }
                 data.trackerHasValidTarget = false; // Ensure model reflects no valid target
                 qWarning() << "[MODEL] Target lost during active tracking. Transitioning to Coast (" << static_cast<int>(data.currentTrackingPhase) << ").";
-            } else if (trackerState == VPI_TRACKING_STATE_TRACKED) {
+            } else if (trackerState == TRACKING_STATE_TRACKED) {
                 // All good, continue tracking.
                 qDebug() << "[MODEL] ActiveLock: Target still tracked.";
             } else {
@@ -1602,16 +1631,22 @@ void SystemStateModel::updateTrackingResult(
 
         case TrackingPhase::Tracking_Coast:
             // In Coast phase, we are trying to re-acquire or waiting for user input.
-            if (trackerState == VPI_TRACKING_STATE_TRACKED) {
+            if (trackerState == TRACKING_STATE_TRACKED) {
                 // Target re-acquired!
                 data.currentTrackingPhase = TrackingPhase::Tracking_ActiveLock;
                 data.opMode = OperationalMode::Tracking;
                 data.motionMode = MotionMode::AutoTrack;
                 qInfo() << "[MODEL] Target Re-acquired! Phase -> ActiveLock (" << static_cast<int>(data.currentTrackingPhase) << ")";
-            } else if (trackerState == VPI_TRACKING_STATE_LOST) {
+            } else if (trackerState == TRACKING_STATE_LOST) {
                 // Still lost, remain in Coast.
                 qDebug() << "[MODEL] In Coast: Target still lost.";
-            } else if (trackerState == VPI_TRACKING_STATE_NEW) {
+                if (data.motionMode == MotionMode::AutoTrack && !data.predictedTargetValid) {
+                    // Prediction expired: hand the gimbal back to the operator
+                    data.motionMode = MotionMode::Manual;
+                    stateDataChanged = true;
+                    qWarning() << "[MODEL] In Coast: target prediction expired. Gimbal to Manual.";
+                }
+            } else if (trackerState == TRACKING_STATE_NEW) {
                 // If we get NEW in Coast, it means a re-initialization happened. Stay in Coast and wait.
                 qDebug() << "[MODEL] In Coast: Tracker re-initialized (NEW). Waiting for re-acquisition.";
             }
@@ -47,6 +47,8 @@
 #include <QJsonArray>
 #include <QIODevice>
 #include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QVector>
 #include <QDateTime>
 #include <cmath>
 #include <algorithm>
@@ -64,6 +66,8 @@
 #include "servoactuatordatamodel.h"
 #include "servodriverdatamodel.h"
 #include "utils/reticleaimpointcalculator.h"
+#include "services/zonegeometryservice.h"
+#include "services/zonestore.h"
 
 // =================================
 // CONSTANTS
@@ -214,6 +218,12 @@ public:
      */
     bool isAtNoTraverseZoneLimit(float currentAz, float currentEl, float intendedMoveAz) const;
 
+    /**
+     * @brief Compiled area-zone index, rebuilt whenever the zones change.
+     * @return Reference to the zone geometry index for point and sweep queries.
+     */
+    const ZoneGeometryService& zoneGeometry() const { return m_zoneGeometry; }
+
     // =================================
     // LEAD ANGLE COMPENSATION
     // =================================
@@ -374,14 +384,31 @@ public:
     // =================================
     
     /**
-     * @brief Saves all zones (area, sector scan, TRP) to a configuration file.
+     * @brief Loads the zone store (zones.bin) on a worker thread.
+     *
+     * Migrates zones.json on first run. The zones are applied on this thread
+     * when the load finishes and zonesChanged() is emitted; zones entered
+     * before then are added to the loaded set under new IDs. A store that
+     * fails to load is moved aside and reported in alertsWarnings, and the
+     * next save starts a new one.
+     */
+    void loadZonesAsync();
+
+    /**
+     * @brief Persists the zone edits made since the last save to the zone store.
+     * @return True if the edits were written, false on error or before the store is loaded.
+     */
+    bool saveZones();
+
+    /**
+     * @brief Exports all zones (area, sector scan, TRP) to a JSON file.
      * @param filePath The path to the file where zones will be saved.
      * @return True if the save operation was successful, false otherwise.
      */
     bool saveZonesToFile(const QString& filePath);
     
     /**
-     * @brief Loads all zones (area, sector scan, TRP) from a configuration file.
+     * @brief Replaces all zones (area, sector scan, TRP) with those of a JSON file.
      * @param filePath The path to the file from which zones will be loaded.
      * @return True if the load operation was successful, false otherwise.
      */
@@ -459,12 +486,18 @@ public:
      * @param velocityX_px_s Target velocity in X direction (pixels per second).
      * @param velocityY_px_s Target velocity in Y direction (pixels per second).
      * @param state Raw VPI tracking state.
+     * @param captureTimestampNs Capture time of the frame (monotonic ns), 0 if unknown.
+     * @param captureGimbalAz Gimbal azimuth at capture time in degrees.
+     * @param captureGimbalEl Gimbal elevation at capture time in degrees.
      */
     void updateTrackingResult(int cameraIndex, bool hasLock,
                               float centerX_px, float centerY_px,
                               float width_px, float height_px,
                               float velocityX_px_s, float velocityY_px_s,
-                              VPITrackingState state);
+                              TrackingState state,
+                              qint64 captureTimestampNs = 0,
+                              double captureGimbalAz = 0.0,
+                              double captureGimbalEl = 0.0);
 
     /**
      * @brief Starts tracking acquisition mode (user positioning gate).
@@ -591,6 +624,13 @@ signals:
      */
     void gimbalPositionChanged(float az, float el);
 
+    /**
+     * @brief Emitted for every IMU sample, after the state has been updated.
+     *        Lets the gimbal stabilization run at the IMU rate.
+     * @param sample The IMU sample.
+     */
+    void imuSampleReceived(const ImuData &sample);
+
     // =================================
     // BALLISTIC COMPENSATION SIGNALS
     // =================================
@@ -630,6 +670,12 @@ public slots:
      * @param pData The new PLC21 panel data.
      */
     void onPlc21DataChanged(const Plc21PanelData &pData);
+
+    /**
+     * @brief Applies only the PLC21 fields flagged in the delta.
+     * @param delta Changed panel fields from the last poll.
+     */
+    void onPlc21DeltaChanged(const Plc21PanelDelta &delta);
     
     /**
      * @brief Handles changes in PLC42 data.
@@ -717,6 +763,13 @@ public slots:
      * @param newMode The new motion mode to apply.
      */
     virtual void setMotionMode(MotionMode newMode);
+
+    /**
+     * @brief Starts axis identification and PID retuning (MotionMode::SystemIdentification).
+     * @return False (mode unchanged) unless the station is enabled, not in emergency stop,
+     *         disarmed, not tracking and both servos are connected without fault.
+     */
+    bool startSystemIdentification();
     
     /**
      * @brief Sets the operational mode of the system.
@@ -748,6 +801,14 @@ private:
     int m_nextSectorScanId;     ///< Counter for assigning unique sector scan zone IDs
     int m_nextTRPId;            ///< Counter for assigning unique TRP IDs
 
+    ZoneGeometryService m_zoneGeometry; ///< Spatial index of the enabled area zones
+
+    ZoneStore m_zoneStore{ZoneStore::DefaultFilePath};  ///< Binary zone file (snapshot + edit journal)
+    QVector<ZoneStore::Edit> m_pendingZoneEdits;        ///< Edits not yet written to the store
+    QFutureWatcher<ZoneStore::LoadResult>* m_zoneLoadWatcher = nullptr;
+    bool m_zonesLoaded = false;                         ///< Store loaded; saving allowed
+    bool m_zoneStoreAlert = false;                      ///< alertsWarnings set by a failed load
+
     // =================================
     // PRIVATE HELPER METHODS
     // =================================
@@ -757,6 +818,11 @@ private:
      * @return The next available area zone ID.
      */
     int getNextAreaZoneId() { return m_nextAreaZoneId++; }
+
+    /**
+     * @brief Recompiles the zone geometry index from the current area zones.
+     */
+    void rebuildZoneGeometry();
     
     /**
      * @brief Gets the next available sector scan zone ID and increments the counter.
@@ -774,6 +840,31 @@ private:
      * @brief Updates the next ID counters after loading data from file.
      */
     void updateNextIdsAfterLoad();
+
+    /**
+     * @brief Returns the zones and ID counters in the zone store layout.
+     */
+    ZoneStore::Snapshot zoneSnapshot() const;
+
+    /**
+     * @brief Replaces the zones and ID counters and notifies listeners.
+     */
+    void applyZoneSnapshot(const ZoneStore::Snapshot& zones);
+
+    /**
+     * @brief Installs the result of loadZonesAsync() (main thread).
+     */
+    void applyLoadedZones(const ZoneStore::LoadResult& result);
+
+    /**
+     * @brief Shows (or clears, when empty) a zone store problem to the operator.
+     */
+    void setZoneStoreAlert(const QString& text);
+
+    /**
+     * @brief Queues a zone edit for the next saveZones().
+     */
+    void recordZoneEdit(ZoneStore::Op op, ZoneStore::Kind kind, int id);
     
     /**
      * @brief Recalculates derived aimpoint data based on current system state.
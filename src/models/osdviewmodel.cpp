@@ -22,6 +22,9 @@ OsdViewModel::OsdViewModel(QObject *parent)
     , m_trackingBoxDashed(false)
     , m_acquisitionBox(0, 0, 0, 0)
     , m_acquisitionBoxVisible(false)
+    , m_predictedTargetPos(0, 0)
+    , m_predictedTargetVisible(false)
+    , m_coastVisible(false)
     , m_reticleType(ReticleType::BoxCrosshair)
     , m_reticleOffsetX(0.0f)
     , m_reticleOffsetY(0.0f)
@@ -49,6 +52,7 @@ OsdViewModel::OsdViewModel(QObject *parent)
     , m_startupMessageVisible(false)
     , m_errorMessageText("")
     , m_errorMessageVisible(false)
+    , m_notify(this)
 
 {
 }
@@ -57,7 +61,7 @@ void OsdViewModel::setAccentColor(const QColor& color)
 {
     if (m_accentColor != color) {
         m_accentColor = color;
-        emit accentColorChanged();
+        m_notify.notify(&OsdViewModel::accentColorChanged);
     }
 }
 
@@ -75,7 +79,7 @@ void OsdViewModel::updateMode(OperationalMode mode)
 
     if (m_modeText != newText) {
         m_modeText = newText;
-        emit modeTextChanged();
+        m_notify.notify(&OsdViewModel::modeTextChanged);
     }
 }
 
@@ -89,12 +93,13 @@ void OsdViewModel::updateMotionMode(MotionMode mode)
     case MotionMode::ManualTrack: newText = "MOTION: TRACK"; break;
     case MotionMode::AutoTrack: newText = "MOTION: AUTO TRACK"; break;
     case MotionMode::RadarSlew: newText = "MOTION: RADAR"; break;
+    case MotionMode::SystemIdentification: newText = "MOTION: SYS ID"; break;
     default: newText = "MOTION: N/A"; break;
     }
 
     if (m_motionText != newText) {
         m_motionText = newText;
-        emit motionTextChanged();
+        m_notify.notify(&OsdViewModel::motionTextChanged);
     }
 }
 
@@ -103,7 +108,7 @@ void OsdViewModel::updateStabilization(bool enabled)
     QString newText = enabled ? "STAB: ON" : "STAB: OFF";
     if (m_stabText != newText) {
         m_stabText = newText;
-        emit stabTextChanged();
+        m_notify.notify(&OsdViewModel::stabTextChanged);
     }
 }
 
@@ -112,16 +117,15 @@ void OsdViewModel::updateCameraType(const QString& type)
     QString newText = QString("CAM: %1").arg(type.toUpper());
     if (m_cameraText != newText) {
         m_cameraText = newText;
-        emit cameraTextChanged();
+        m_notify.notify(&OsdViewModel::cameraTextChanged);
     }
 }
 
 void OsdViewModel::updateSpeed(double speed)
 {
-    QString newText = QString("SPD: %1%").arg(speed, 0, 'f', 1);
-    if (m_speedText != newText) {
-        m_speedText = newText;
-        emit speedTextChanged();
+    if (m_speedFormat.update(speed)) {
+        m_speedText = m_speedFormat.text();
+        m_notify.notify(&OsdViewModel::speedTextChanged);
     }
 }
 
@@ -133,7 +137,7 @@ void OsdViewModel::updateAzimuth(float azimuth)
 
     if (m_azimuth != azimuth) {
         m_azimuth = azimuth;
-        emit azimuthChanged();
+        m_notify.notify(&OsdViewModel::azimuthChanged);
     }
 }
 
@@ -141,7 +145,7 @@ void OsdViewModel::updateElevation(float elevation)
 {
     if (m_elevation != elevation) {
         m_elevation = elevation;
-        emit elevationChanged();
+        m_notify.notify(&OsdViewModel::elevationChanged);
     }
 }
 
@@ -151,31 +155,31 @@ void OsdViewModel::updateImuData(bool connected, double yaw, double pitch, doubl
 
         if (m_imuConnected != connected) {
             m_imuConnected = connected;
-            emit imuConnectedChanged();
+            m_notify.notify(&OsdViewModel::imuConnectedChanged);
             changed = true;
         }
 
         if (!qFuzzyCompare(m_vehicleHeading, yaw)) {
             m_vehicleHeading = yaw;
-            emit vehicleHeadingChanged();
+            m_notify.notify(&OsdViewModel::vehicleHeadingChanged);
             changed = true;
         }
 
         if (!qFuzzyCompare(m_vehicleRoll, roll)) {
             m_vehicleRoll = roll;
-            emit vehicleRollChanged();
+            m_notify.notify(&OsdViewModel::vehicleRollChanged);
             changed = true;
         }
 
         if (!qFuzzyCompare(m_vehiclePitch, pitch)) {
             m_vehiclePitch = pitch;
-            emit vehiclePitchChanged();
+            m_notify.notify(&OsdViewModel::vehiclePitchChanged);
             changed = true;
         }
 
         if (!qFuzzyCompare(m_imuTemperature, temp)) {
             m_imuTemperature = temp;
-            emit imuTemperatureChanged();
+            m_notify.notify(&OsdViewModel::imuTemperatureChanged);
             changed = true;
         }
 
@@ -197,7 +201,7 @@ void OsdViewModel::updateSystemStatus(bool charged, bool armed, bool ready)
 
     if (m_statusText != newStatusText) {
         m_statusText = newStatusText;
-        emit statusTextChanged();
+        m_notify.notify(&OsdViewModel::statusTextChanged);
     }
 }
 
@@ -215,19 +219,25 @@ void OsdViewModel::updateFiringMode(FireMode mode)
 
     if (m_rateText != newRateText) {
         m_rateText = newRateText;
-        emit rateTextChanged();
+        m_notify.notify(&OsdViewModel::rateTextChanged);
     }
 }
 
 void OsdViewModel::updateLrfDistance(float distance)
 {
-    QString newText = (distance > 0.1f)
-    ? QString::number(distance, 'f', 1) + " m"
-    : "LRF: --- m";
+    if (distance <= 0.1f) {
+        // Next valid range must re-format even if it matches the last one
+        m_lrfFormat.invalidate();
+        if (m_lrfText != QLatin1String("LRF: --- m")) {
+            m_lrfText = QStringLiteral("LRF: --- m");
+            m_notify.notify(&OsdViewModel::lrfTextChanged);
+        }
+        return;
+    }
 
-    if (m_lrfText != newText) {
-        m_lrfText = newText;
-        emit lrfTextChanged();
+    if (m_lrfFormat.update(distance)) {
+        m_lrfText = m_lrfFormat.text();
+        m_notify.notify(&OsdViewModel::lrfTextChanged);
     }
 }
 
@@ -235,11 +245,10 @@ void OsdViewModel::updateFov(float fov)
 {
     m_currentFov = fov;
 
-    QString newText = QString("FOV: %1°").arg(fov, 0, 'f', 1);
-    if (m_fovText != newText) {
-        m_fovText = newText;
-        emit fovTextChanged();
-        emit currentFovChanged();
+    if (m_fovFormat.update(fov)) {
+        m_fovText = m_fovFormat.text();
+        m_notify.notify(&OsdViewModel::fovTextChanged);
+        m_notify.notify(&OsdViewModel::currentFovChanged);
     }
 }
 
@@ -254,26 +263,26 @@ void OsdViewModel::updateTrackingBox(float x, float y, float width, float height
 
     if (m_trackingBox != newBox) {
         m_trackingBox = newBox;
-        emit trackingBoxChanged();
+        m_notify.notify(&OsdViewModel::trackingBoxChanged);
     }
 
     if (m_trackingBoxVisible != newVisible) {
         m_trackingBoxVisible = newVisible;
-        emit trackingBoxVisibleChanged();
+        m_notify.notify(&OsdViewModel::trackingBoxVisibleChanged);
     }
 }
 
-void OsdViewModel::updateTrackingState(VPITrackingState state)
+void OsdViewModel::updateTrackingState(TrackingState state)
 {
     QColor newColor;
     bool newDashed = false;
 
     switch (state) {
-    case VPI_TRACKING_STATE_TRACKED:
+    case TRACKING_STATE_TRACKED:
         newColor = QColor(0, 255, 0); // Green - tracked
         newDashed = true;
         break;
-    case VPI_TRACKING_STATE_LOST:
+    case TRACKING_STATE_LOST:
         newColor = QColor(255, 255, 0); // Yellow - lost
         newDashed = true;
         break;
@@ -285,12 +294,12 @@ void OsdViewModel::updateTrackingState(VPITrackingState state)
 
     if (m_trackingBoxColor != newColor) {
         m_trackingBoxColor = newColor;
-        emit trackingBoxColorChanged();
+        m_notify.notify(&OsdViewModel::trackingBoxColorChanged);
     }
 
     if (m_trackingBoxDashed != newDashed) {
         m_trackingBoxDashed = newDashed;
-        emit trackingBoxDashedChanged();
+        m_notify.notify(&OsdViewModel::trackingBoxDashedChanged);
     }
 }
 
@@ -345,28 +354,51 @@ void OsdViewModel::updateTrackingPhase(TrackingPhase phase, bool hasValidTarget,
     // Update acquisition box
     if (m_acquisitionBox != acquisitionBox) {
         m_acquisitionBox = acquisitionBox;
-        emit acquisitionBoxChanged();
+        m_notify.notify(&OsdViewModel::acquisitionBoxChanged);
     }
 
     if (m_acquisitionBoxVisible != showAcquisition) {
         m_acquisitionBoxVisible = showAcquisition;
-        emit acquisitionBoxVisibleChanged();
+        m_notify.notify(&OsdViewModel::acquisitionBoxVisibleChanged);
     }
 
     // Update tracking box visibility based on phase
     if (m_trackingBoxVisible != showTracking) {
         m_trackingBoxVisible = showTracking;
-        emit trackingBoxVisibleChanged();
+        m_notify.notify(&OsdViewModel::trackingBoxVisibleChanged);
     }
 
     if (m_trackingBoxColor != boxColor) {
         m_trackingBoxColor = boxColor;
-        emit trackingBoxColorChanged();
+        m_notify.notify(&OsdViewModel::trackingBoxColorChanged);
     }
 
     if (m_trackingBoxDashed != boxDashed) {
         m_trackingBoxDashed = boxDashed;
-        emit trackingBoxDashedChanged();
+        m_notify.notify(&OsdViewModel::trackingBoxDashedChanged);
+    }
+}
+
+void OsdViewModel::updatePredictedTarget(bool valid, bool coasting, float x_px, float y_px)
+{
+    if (valid) {
+        QPointF pos(x_px, y_px);
+        if (m_predictedTargetPos != pos) {
+            m_predictedTargetPos = pos;
+            m_notify.notify(&OsdViewModel::predictedTargetPosChanged);
+        }
+    }
+
+    if (m_predictedTargetVisible != valid) {
+        m_predictedTargetVisible = valid;
+        m_notify.notify(&OsdViewModel::predictedTargetVisibleChanged);
+    }
+
+    // Coasting only means something while a prediction is being shown
+    bool showCoast = valid && coasting;
+    if (m_coastVisible != showCoast) {
+        m_coastVisible = showCoast;
+        m_notify.notify(&OsdViewModel::coastVisibleChanged);
     }
 }
 
@@ -378,7 +410,7 @@ void OsdViewModel::updateReticleType(ReticleType type)
 {
     if (m_reticleType != type) {
         m_reticleType = type;
-        emit reticleTypeChanged();
+        m_notify.notify(&OsdViewModel::reticleTypeChanged);
     }
 }
 
@@ -394,7 +426,7 @@ void OsdViewModel::updateReticleOffset(float screen_x_px, float screen_y_px)
     if (m_reticleOffsetX != offsetX || m_reticleOffsetY != offsetY) {
         m_reticleOffsetX = offsetX;
         m_reticleOffsetY = offsetY;
-        emit reticleOffsetChanged();
+        m_notify.notify(&OsdViewModel::reticleOffsetChanged);
 
         qDebug() << "Reticle Offset:"
                  << "Screen(" << screen_x_px << "," << screen_y_px << ")"
@@ -420,36 +452,35 @@ void OsdViewModel::updateZeroingDisplay(bool modeActive, bool applied, float azO
 
     if (m_zeroingText != newText) {
         m_zeroingText = newText;
-        emit zeroingTextChanged();
+        m_notify.notify(&OsdViewModel::zeroingTextChanged);
     }
 
     if (m_zeroingVisible != newVisible) {
         m_zeroingVisible = newVisible;
-        emit zeroingVisibleChanged();
+        m_notify.notify(&OsdViewModel::zeroingVisibleChanged);
     }
 }
 
 void OsdViewModel::updateWindageDisplay(bool modeActive, bool applied, float speedKnots)
 {
-    QString newText;
-    bool newVisible = false;
-
-    if (modeActive) {
-        newText = QString("W: %1 kt").arg(speedKnots, 0, 'f', 0);
-        newVisible = true;
-    } else if (applied) {
-        newText = QString("W: %1 kt").arg(speedKnots, 0, 'f', 0);
-        newVisible = true;
-    }
+    const bool newVisible = modeActive || applied;
 
-    if (m_windageText != newText) {
-        m_windageText = newText;
-        emit windageTextChanged();
+    if (newVisible) {
+        if (m_windageFormat.update(speedKnots)) {
+            m_windageText = m_windageFormat.text();
+            m_notify.notify(&OsdViewModel::windageTextChanged);
+        }
+    } else {
+        m_windageFormat.invalidate();
+        if (!m_windageText.isEmpty()) {
+            m_windageText.clear();
+            m_notify.notify(&OsdViewModel::windageTextChanged);
+        }
     }
 
     if (m_windageVisible != newVisible) {
         m_windageVisible = newVisible;
-        emit windageVisibleChanged();
+        m_notify.notify(&OsdViewModel::windageVisibleChanged);
     }
 }
 
@@ -465,38 +496,19 @@ void OsdViewModel::updateDetectionDisplay(bool enabled)
 
     if (m_detectionText != newText) {
         m_detectionText = newText;
-        emit detectionTextChanged();
+        m_notify.notify(&OsdViewModel::detectionTextChanged);
     }
 
     if (m_detectionVisible != newVisible) {
         m_detectionVisible = newVisible;
-        emit detectionVisibleChanged();
+        m_notify.notify(&OsdViewModel::detectionVisibleChanged);
     }
 }
 
 void OsdViewModel::updateDetectionBoxes(const std::vector<YoloDetection>& detections)
 {
-    // Convert YoloDetections to QVariantList for QML
-    QVariantList newBoxes;
-
-    for (const auto& det : detections) {
-        QVariantMap box;
-        box["x"] = det.box.x;
-        box["y"] = det.box.y;
-        box["width"] = det.box.width;
-        box["height"] = det.box.height;
-        box["className"] = QString::fromStdString(det.className);
-        box["confidence"] = det.confidence;
-        box["colorR"] = det.color.r;
-        box["colorG"] = det.color.g;
-        box["colorB"] = det.color.b;
-
-        newBoxes.append(box);
-    }
-
-    // Always update (even if empty to clear old boxes)
-    m_detectionBoxes = newBoxes;
-    emit detectionBoxesChanged();
+    // Diffed against the previous frame; rows only change where boxes moved
+    m_detectionModel.setDetections(detections);
 }
 
 // ============================================================================
@@ -518,12 +530,12 @@ void OsdViewModel::updateZoneWarning(bool inNoFireZone, bool inNoTraverseLimit)
 
     if (m_zoneWarningText != newText) {
         m_zoneWarningText = newText;
-        emit zoneWarningTextChanged();
+        m_notify.notify(&OsdViewModel::zoneWarningTextChanged);
     }
 
     if (m_zoneWarningVisible != newVisible) {
         m_zoneWarningVisible = newVisible;
-        emit zoneWarningVisibleChanged();
+        m_notify.notify(&OsdViewModel::zoneWarningVisibleChanged);
     }
 }
 
@@ -533,12 +545,12 @@ void OsdViewModel::updateLeadAngleDisplay(const QString& statusText)
 
     if (m_leadAngleText != statusText) {
         m_leadAngleText = statusText;
-        emit leadAngleTextChanged();
+        m_notify.notify(&OsdViewModel::leadAngleTextChanged);
     }
 
     if (m_leadAngleVisible != newVisible) {
         m_leadAngleVisible = newVisible;
-        emit leadAngleVisibleChanged();
+        m_notify.notify(&OsdViewModel::leadAngleVisibleChanged);
     }
 }
 
@@ -548,12 +560,12 @@ void OsdViewModel::updateCurrentScanName(const QString& scanName)
 
     if (m_scanNameText != scanName) {
         m_scanNameText = scanName;
-        emit scanNameTextChanged();
+        m_notify.notify(&OsdViewModel::scanNameTextChanged);
     }
 
     if (m_scanNameVisible != newVisible) {
         m_scanNameVisible = newVisible;
-        emit scanNameVisibleChanged();
+        m_notify.notify(&OsdViewModel::scanNameVisibleChanged);
     }
 }
 
@@ -561,7 +573,7 @@ void OsdViewModel::updateLacActive(bool active)
 {
     if (m_lacActive != active) {
         m_lacActive = active;
-        emit lacActiveChanged();
+        m_notify.notify(&OsdViewModel::lacActiveChanged);
     }
 }
 
@@ -569,7 +581,7 @@ void OsdViewModel::updateRangeMeters(float range)
 {
     if (m_rangeMeters != range) {
         m_rangeMeters = range;
-        emit rangeMetersChanged();
+        m_notify.notify(&OsdViewModel::rangeMetersChanged);
     }
 }
 
@@ -577,7 +589,7 @@ void OsdViewModel::updateConfidenceLevel(float confidence)
 {
     if (m_confidenceLevel != confidence) {
         m_confidenceLevel = confidence;
-        emit confidenceLevelChanged();
+        m_notify.notify(&OsdViewModel::confidenceLevelChanged);
     }
 }
 
@@ -591,13 +603,13 @@ void OsdViewModel::updateStartupMessage(const QString& message, bool visible)
 
     if (m_startupMessageText != message) {
         m_startupMessageText = message;
-        emit startupMessageTextChanged();
+        m_notify.notify(&OsdViewModel::startupMessageTextChanged);
         changed = true;
     }
 
     if (m_startupMessageVisible != visible) {
         m_startupMessageVisible = visible;
-        emit startupMessageVisibleChanged();
+        m_notify.notify(&OsdViewModel::startupMessageVisibleChanged);
         changed = true;
     }
 
@@ -614,13 +626,13 @@ void OsdViewModel::updateErrorMessage(const QString& message, bool visible)
 
     if (m_errorMessageText != message) {
         m_errorMessageText = message;
-        emit errorMessageTextChanged();
+        m_notify.notify(&OsdViewModel::errorMessageTextChanged);
         changed = true;
     }
 
     if (m_errorMessageVisible != visible) {
         m_errorMessageVisible = visible;
-        emit errorMessageVisibleChanged();
+        m_notify.notify(&OsdViewModel::errorMessageVisibleChanged);
         changed = true;
     }
 
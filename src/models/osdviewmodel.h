@@ -3,11 +3,15 @@
 
 #include <QObject>
 #include <QColor>
+#include <QPointF>
 #include <QRectF>
 #include <QString>
 #include <QVariantList>
 #include "models/domain/systemstatedata.h" // For enums
 #include "utils/inference.h" // For YoloDetection
+#include "utils/fixedpointtext.h"
+#include "propertynotifybatch.h"
+#include "detectionlistmodel.h"
 
 class OsdViewModel : public QObject
 {
@@ -54,6 +58,11 @@ class OsdViewModel : public QObject
     Q_PROPERTY(QRectF acquisitionBox READ acquisitionBox NOTIFY acquisitionBoxChanged)
     Q_PROPERTY(bool acquisitionBoxVisible READ acquisitionBoxVisible NOTIFY acquisitionBoxVisibleChanged)
 
+    // Kalman-predicted target position and coast state (TrackingMotionMode)
+    Q_PROPERTY(QPointF predictedTargetPos READ predictedTargetPos NOTIFY predictedTargetPosChanged)
+    Q_PROPERTY(bool predictedTargetVisible READ predictedTargetVisible NOTIFY predictedTargetVisibleChanged)
+    Q_PROPERTY(bool coastVisible READ coastVisible NOTIFY coastVisibleChanged)
+
     // ========================================================================
     // RETICLE
     // ========================================================================
@@ -73,7 +82,7 @@ class OsdViewModel : public QObject
 
     Q_PROPERTY(QString detectionText READ detectionText NOTIFY detectionTextChanged)
     Q_PROPERTY(bool detectionVisible READ detectionVisible NOTIFY detectionVisibleChanged)
-    Q_PROPERTY(QVariantList detectionBoxes READ detectionBoxes NOTIFY detectionBoxesChanged)
+    Q_PROPERTY(DetectionListModel* detectionModel READ detectionModel CONSTANT)
 
     // ========================================================================
     // ZONE WARNINGS
@@ -107,6 +116,10 @@ class OsdViewModel : public QObject
 public:
     explicit OsdViewModel(QObject *parent = nullptr);
 
+    // Group property updates: each NOTIFY signal is emitted once at endUpdate()
+    void beginUpdate() { m_notify.begin(); }
+    void endUpdate() { m_notify.end(); }
+
     // Getters
     QColor accentColor() const { return m_accentColor; }
     QString modeText() const { return m_modeText; }
@@ -137,6 +150,10 @@ public:
     QRectF acquisitionBox() const { return m_acquisitionBox; }
     bool acquisitionBoxVisible() const { return m_acquisitionBoxVisible; }
 
+    QPointF predictedTargetPos() const { return m_predictedTargetPos; }
+    bool predictedTargetVisible() const { return m_predictedTargetVisible; }
+    bool coastVisible() const { return m_coastVisible; }
+
     int reticleType() const { return static_cast<int>(m_reticleType); }
     float reticleOffsetX() const { return m_reticleOffsetX; }
     float reticleOffsetY() const { return m_reticleOffsetY; }
@@ -150,7 +167,7 @@ public:
 
     QString detectionText() const { return m_detectionText; }
     bool detectionVisible() const { return m_detectionVisible; }
-    QVariantList detectionBoxes() const { return m_detectionBoxes; }
+    DetectionListModel* detectionModel() { return &m_detectionModel; }
 
     QString zoneWarningText() const { return m_zoneWarningText; }
     bool zoneWarningVisible() const { return m_zoneWarningVisible; }
@@ -192,8 +209,9 @@ public slots:
     void updateFov(float fov);
 
     void updateTrackingBox(float x, float y, float width, float height);
-    void updateTrackingState(VPITrackingState state);
+    void updateTrackingState(TrackingState state);
     void updateTrackingPhase(TrackingPhase phase, bool hasValidTarget, const QRectF& acquisitionBox);
+    void updatePredictedTarget(bool valid, bool coasting, float x_px, float y_px);
 
     void updateReticleType(ReticleType type);
     void updateReticleOffset(float x_px, float y_px);
@@ -247,6 +265,10 @@ signals:
     void acquisitionBoxChanged();
     void acquisitionBoxVisibleChanged();
 
+    void predictedTargetPosChanged();
+    void predictedTargetVisibleChanged();
+    void coastVisibleChanged();
+
     void reticleTypeChanged();
     void reticleOffsetChanged();
     void currentFovChanged();
@@ -259,7 +281,6 @@ signals:
 
     void detectionTextChanged();
     void detectionVisibleChanged();
-    void detectionBoxesChanged();
 
     void zoneWarningTextChanged();
     void zoneWarningVisibleChanged();
@@ -314,6 +335,10 @@ private:
     QRectF m_acquisitionBox;
     bool m_acquisitionBoxVisible;
 
+    QPointF m_predictedTargetPos;
+    bool m_predictedTargetVisible;
+    bool m_coastVisible;
+
     ReticleType m_reticleType;
     float m_reticleOffsetX;
     float m_reticleOffsetY;
@@ -327,7 +352,7 @@ private:
 
     QString m_detectionText;
     bool m_detectionVisible;
-    QVariantList m_detectionBoxes;
+    DetectionListModel m_detectionModel;
 
     QString m_zoneWarningText;
     bool m_zoneWarningVisible;
@@ -358,7 +383,13 @@ private:
     QString m_errorMessageText;
     bool m_errorMessageVisible;
 
+    // Cached numeric text (re-formatted only when the displayed digits change)
+    FixedPointText m_speedFormat{1, QStringLiteral("%"), QStringLiteral("SPD: ")};
+    FixedPointText m_lrfFormat{1, QStringLiteral(" m")};
+    FixedPointText m_fovFormat{1, QStringLiteral("°"), QStringLiteral("FOV: ")};
+    FixedPointText m_windageFormat{0, QStringLiteral(" kt"), QStringLiteral("W: ")};
 
+    PropertyNotifyBatch<OsdViewModel> m_notify;
 };
 
 #endif // OSDVIEWMODEL_H
@@ -0,0 +1,58 @@
+#ifndef PROPERTYNOTIFYBATCH_H
+#define PROPERTYNOTIFYBATCH_H
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief Per-property dirty flags for a view model's NOTIFY signals.
+ *
+ * Between begin() and end() a changed property only flags its NOTIFY signal;
+ * end() emits every flagged signal once. A property written several times
+ * while one update batch is applied (the OSD tracking box visibility is set
+ * from the box size and again from the tracking phase) then reaches QML as a
+ * single notification. Outside a batch notify() emits immediately, so setters
+ * called from menus and QML keep their direct behaviour.
+ */
+template <typename Owner>
+class PropertyNotifyBatch
+{
+public:
+    using Signal = void (Owner::*)();
+
+    explicit PropertyNotifyBatch(Owner* owner) : m_owner(owner) {}
+
+    void begin() { ++m_depth; }
+
+    void end()
+    {
+        if (m_depth == 0 || --m_depth > 0) return;
+
+        // Swap first: a slot bound to one of the signals may start another batch
+        std::vector<Signal> dirty;
+        dirty.swap(m_dirty);
+        for (Signal signal : dirty) {
+            (m_owner->*signal)();
+        }
+    }
+
+    void notify(Signal signal)
+    {
+        if (m_depth == 0) {
+            (m_owner->*signal)();
+            return;
+        }
+        if (std::find(m_dirty.begin(), m_dirty.end(), signal) == m_dirty.end()) {
+            m_dirty.push_back(signal);
+        }
+    }
+
+    bool isBatching() const { return m_depth > 0; }
+
+private:
+    Owner* m_owner;
+    int m_depth = 0;
+    std::vector<Signal> m_dirty;
+};
+
+#endif // PROPERTYNOTIFYBATCH_H
@@ -46,9 +46,13 @@ SystemStatusViewModel::SystemStatusViewModel(QObject *parent)
     , m_plc42Connected(false)
     , m_stationEnabled(false)
     , m_gunArmed(false)
+    , m_modbusBusText("N/A")
+    , m_modbusErrorText("N/A")
+    , m_modbusDegraded(false)
     , m_hasAlarms(false)
     , m_visible(false)
     , m_accentColor(QColor(70, 226, 165))
+    , m_notify(this)
 {
 }
 
@@ -56,7 +60,7 @@ void SystemStatusViewModel::setVisible(bool visible)
 {
     if (m_visible != visible) {
         m_visible = visible;
-        emit visibleChanged();
+        m_notify.notify(&SystemStatusViewModel::visibleChanged);
     }
 }
 
@@ -64,7 +68,7 @@ void SystemStatusViewModel::setAccentColor(const QColor& color)
 {
     if (m_accentColor != color) {
         m_accentColor = color;
-        emit accentColorChanged();
+        m_notify.notify(&SystemStatusViewModel::accentColorChanged);
     }
 }
 
@@ -77,49 +81,44 @@ void SystemStatusViewModel::updateAzimuthServo(bool connected, float position, f
 {
     if (m_azConnected != connected) {
         m_azConnected = connected;
-        emit azConnectedChanged();
+        m_notify.notify(&SystemStatusViewModel::azConnectedChanged);
     }
 
-    QString newPos = QString::number(position, 'f', 2) + "°";
-    if (m_azPositionText != newPos) {
-        m_azPositionText = newPos;
-        emit azPositionTextChanged();
+    if (m_azPositionFormat.update(position)) {
+        m_azPositionText = m_azPositionFormat.text();
+        m_notify.notify(&SystemStatusViewModel::azPositionTextChanged);
     }
 
-    QString newRpm = QString::number(rpm, 'f', 0);
-    if (m_azRpmText != newRpm) {
-        m_azRpmText = newRpm;
-        emit azRpmTextChanged();
+    if (m_azRpmFormat.update(rpm)) {
+        m_azRpmText = m_azRpmFormat.text();
+        m_notify.notify(&SystemStatusViewModel::azRpmTextChanged);
     }
 
-    QString newTorque = QString::number(torque, 'f', 1) + "%";
-    if (m_azTorqueText != newTorque) {
-        m_azTorqueText = newTorque;
-        emit azTorqueTextChanged();
+    if (m_azTorqueFormat.update(torque)) {
+        m_azTorqueText = m_azTorqueFormat.text();
+        m_notify.notify(&SystemStatusViewModel::azTorqueTextChanged);
     }
 
-    QString newMotorTemp = QString::number(motorTemp, 'f', 1) + "°C";
-    if (m_azMotorTempText != newMotorTemp) {
-        m_azMotorTempText = newMotorTemp;
-        emit azMotorTempTextChanged();
+    if (m_azMotorTempFormat.update(motorTemp)) {
+        m_azMotorTempText = m_azMotorTempFormat.text();
+        m_notify.notify(&SystemStatusViewModel::azMotorTempTextChanged);
     }
 
-    QString newDriverTemp = QString::number(driverTemp, 'f', 1) + "°C";
-    if (m_azDriverTempText != newDriverTemp) {
-        m_azDriverTempText = newDriverTemp;
-        emit azDriverTempTextChanged();
+    if (m_azDriverTempFormat.update(driverTemp)) {
+        m_azDriverTempText = m_azDriverTempFormat.text();
+        m_notify.notify(&SystemStatusViewModel::azDriverTempTextChanged);
     }
 
     if (m_azFault != fault) {
         m_azFault = fault;
-        emit azFaultChanged();
+        m_notify.notify(&SystemStatusViewModel::azFaultChanged);
     }
 
     QString statusText = connected ? (fault ? "⚠ FAULT" : "✓ OK") : "N/A";
     
     if (m_azStatusText != statusText) {
         m_azStatusText = statusText;
-        emit azStatusTextChanged();
+        m_notify.notify(&SystemStatusViewModel::azStatusTextChanged);
     }
 }
 
@@ -132,49 +131,44 @@ void SystemStatusViewModel::updateElevationServo(bool connected, float position,
 {
     if (m_elConnected != connected) {
         m_elConnected = connected;
-        emit elConnectedChanged();
+        m_notify.notify(&SystemStatusViewModel::elConnectedChanged);
     }
 
-    QString newPos = QString::number(position, 'f', 2) + "°";
-    if (m_elPositionText != newPos) {
-        m_elPositionText = newPos;
-        emit elPositionTextChanged();
+    if (m_elPositionFormat.update(position)) {
+        m_elPositionText = m_elPositionFormat.text();
+        m_notify.notify(&SystemStatusViewModel::elPositionTextChanged);
     }
 
-    QString newRpm = QString::number(rpm, 'f', 0);
-    if (m_elRpmText != newRpm) {
-        m_elRpmText = newRpm;
-        emit elRpmTextChanged();
+    if (m_elRpmFormat.update(rpm)) {
+        m_elRpmText = m_elRpmFormat.text();
+        m_notify.notify(&SystemStatusViewModel::elRpmTextChanged);
     }
 
-    QString newTorque = QString::number(torque, 'f', 1) + "%";
-    if (m_elTorqueText != newTorque) {
-        m_elTorqueText = newTorque;
-        emit elTorqueTextChanged();
+    if (m_elTorqueFormat.update(torque)) {
+        m_elTorqueText = m_elTorqueFormat.text();
+        m_notify.notify(&SystemStatusViewModel::elTorqueTextChanged);
     }
 
-    QString newMotorTemp = QString::number(motorTemp, 'f', 1) + "°C";
-    if (m_elMotorTempText != newMotorTemp) {
-        m_elMotorTempText = newMotorTemp;
-        emit elMotorTempTextChanged();
+    if (m_elMotorTempFormat.update(motorTemp)) {
+        m_elMotorTempText = m_elMotorTempFormat.text();
+        m_notify.notify(&SystemStatusViewModel::elMotorTempTextChanged);
     }
 
-    QString newDriverTemp = QString::number(driverTemp, 'f', 1) + "°C";
-    if (m_elDriverTempText != newDriverTemp) {
-        m_elDriverTempText = newDriverTemp;
-        emit elDriverTempTextChanged();
+    if (m_elDriverTempFormat.update(driverTemp)) {
+        m_elDriverTempText = m_elDriverTempFormat.text();
+        m_notify.notify(&SystemStatusViewModel::elDriverTempTextChanged);
     }
 
     if (m_elFault != fault) {
         m_elFault = fault;
-        emit elFaultChanged();
+        m_notify.notify(&SystemStatusViewModel::elFaultChanged);
     }
 
     QString statusText = connected ? (fault ? "⚠ FAULT" : "✓ OK") : "N/A";
     
     if (m_azStatusText != statusText) {
         m_azStatusText = statusText;
-        emit azStatusTextChanged();
+        m_notify.notify(&SystemStatusViewModel::azStatusTextChanged);
     }
 }
 
@@ -186,38 +180,34 @@ void SystemStatusViewModel::updateImu(bool connected, double roll, double pitch,
 {
     if (m_imuConnected != connected) {
         m_imuConnected = connected;
-        emit imuConnectedChanged();
+        m_notify.notify(&SystemStatusViewModel::imuConnectedChanged);
     }
 
-    QString newRoll = QString::number(roll, 'f', 2) + "°";
-    if (m_imuRollText != newRoll) {
-        m_imuRollText = newRoll;
-        emit imuRollTextChanged();
+    if (m_imuRollFormat.update(roll)) {
+        m_imuRollText = m_imuRollFormat.text();
+        m_notify.notify(&SystemStatusViewModel::imuRollTextChanged);
     }
 
-    QString newPitch = QString::number(pitch, 'f', 2) + "°";
-    if (m_imuPitchText != newPitch) {
-        m_imuPitchText = newPitch;
-        emit imuPitchTextChanged();
+    if (m_imuPitchFormat.update(pitch)) {
+        m_imuPitchText = m_imuPitchFormat.text();
+        m_notify.notify(&SystemStatusViewModel::imuPitchTextChanged);
     }
 
-    QString newYaw = QString::number(yaw, 'f', 2) + "°";
-    if (m_imuYawText != newYaw) {
-        m_imuYawText = newYaw;
-        emit imuYawTextChanged();
+    if (m_imuYawFormat.update(yaw)) {
+        m_imuYawText = m_imuYawFormat.text();
+        m_notify.notify(&SystemStatusViewModel::imuYawTextChanged);
     }
 
-    QString newTemp = QString::number(temp, 'f', 1) + "°C";
-    if (m_imuTempText != newTemp) {
-        m_imuTempText = newTemp;
-        emit imuTempTextChanged();
+    if (m_imuTempFormat.update(temp)) {
+        m_imuTempText = m_imuTempFormat.text();
+        m_notify.notify(&SystemStatusViewModel::imuTempTextChanged);
     }
 
     QString statusText = connected ? "✓ OK" : "N/A";
     
     if (m_imuStatusText != statusText) {
         m_imuStatusText = statusText;
-        emit imuStatusTextChanged();
+        m_notify.notify(&SystemStatusViewModel::imuStatusTextChanged);
     }
 }
 
@@ -230,36 +220,32 @@ void SystemStatusViewModel::updateLrf(bool connected, float distance, float temp
 {
     if (m_lrfConnected != connected) {
         m_lrfConnected = connected;
-        emit lrfConnectedChanged();
+        m_notify.notify(&SystemStatusViewModel::lrfConnectedChanged);
     }
 
-    QString newDist = QString::number(distance, 'f', 1) + "m";
-    if (m_lrfDistanceText != newDist) {
-        m_lrfDistanceText = newDist;
-        emit lrfDistanceTextChanged();
+    if (m_lrfDistanceFormat.update(distance)) {
+        m_lrfDistanceText = m_lrfDistanceFormat.text();
+        m_notify.notify(&SystemStatusViewModel::lrfDistanceTextChanged);
     }
 
-    QString newTemp = QString::number(temp, 'f', 1) + "°C";
-    if (m_lrfTempText != newTemp) {
-        m_lrfTempText = newTemp;
-        emit lrfTempTextChanged();
+    if (m_lrfTempFormat.update(temp)) {
+        m_lrfTempText = m_lrfTempFormat.text();
+        m_notify.notify(&SystemStatusViewModel::lrfTempTextChanged);
     }
 
-    QString newCount = QString::number(laserCount);
-    if (m_lrfLaserCountText != newCount) {
-        m_lrfLaserCountText = newCount;
-        emit lrfLaserCountTextChanged();
+    if (m_lrfLaserCountFormat.update(laserCount)) {
+        m_lrfLaserCountText = m_lrfLaserCountFormat.text();
+        m_notify.notify(&SystemStatusViewModel::lrfLaserCountTextChanged);
     }
 
-    QString newRawStatusByte = QString::number(rawStatusByte);
-    if (m_lrfRawStatusByteText != newRawStatusByte) {
-        m_lrfRawStatusByteText = newRawStatusByte;
-        emit lrfRawStatusByteTextChanged();
+    if (m_lrfRawStatusByteFormat.update(rawStatusByte)) {
+        m_lrfRawStatusByteText = m_lrfRawStatusByteFormat.text();
+        m_notify.notify(&SystemStatusViewModel::lrfRawStatusByteTextChanged);
     }
 
     if (m_lrfFault != fault) {
         m_lrfFault = fault;
-        emit lrfFaultChanged();
+        m_notify.notify(&SystemStatusViewModel::lrfFaultChanged);
     }
 
 
@@ -281,7 +267,7 @@ void SystemStatusViewModel::updateLrf(bool connected, float distance, float temp
 
     if (m_lrfFaultText != newFaultText) {
         m_lrfFaultText = newFaultText;
-        emit lrfFaultTextChanged();
+        m_notify.notify(&SystemStatusViewModel::lrfFaultTextChanged);
     }
 }
 
@@ -294,45 +280,42 @@ void SystemStatusViewModel::updateDayCamera(bool connected, bool isActive, float
 {
     if (m_dayCamConnected != connected) {
         m_dayCamConnected = connected;
-        emit dayCamConnectedChanged();
+        m_notify.notify(&SystemStatusViewModel::dayCamConnectedChanged);
     }
 
     if (m_dayCamActive != isActive) {
         m_dayCamActive = isActive;
-        emit dayCamActiveChanged();
+        m_notify.notify(&SystemStatusViewModel::dayCamActiveChanged);
     }
 
-    QString newFov = QString::number(fov, 'f', 1) + "°";
-    if (m_dayCamFovText != newFov) {
-        m_dayCamFovText = newFov;
-        emit dayCamFovTextChanged();
+    if (m_dayCamFovFormat.update(fov)) {
+        m_dayCamFovText = m_dayCamFovFormat.text();
+        m_notify.notify(&SystemStatusViewModel::dayCamFovTextChanged);
     }
 
-    QString newZoom = QString::number(zoom);
-    if (m_dayCamZoomText != newZoom) {
-        m_dayCamZoomText = newZoom;
-        emit dayCamZoomTextChanged();
+    if (m_dayCamZoomFormat.update(zoom)) {
+        m_dayCamZoomText = m_dayCamZoomFormat.text();
+        m_notify.notify(&SystemStatusViewModel::dayCamZoomTextChanged);
     }
 
-    QString newFocus = QString::number(focus);
-    if (m_dayCamFocusText != newFocus) {
-        m_dayCamFocusText = newFocus;
-        emit dayCamFocusTextChanged();
+    if (m_dayCamFocusFormat.update(focus)) {
+        m_dayCamFocusText = m_dayCamFocusFormat.text();
+        m_notify.notify(&SystemStatusViewModel::dayCamFocusTextChanged);
     }
 
     if (m_dayCamAutofocus != autofocus) {
         m_dayCamAutofocus = autofocus;
-        emit dayCamAutofocusChanged();
+        m_notify.notify(&SystemStatusViewModel::dayCamAutofocusChanged);
     }
 
     if (m_dayCamError != error) {
         m_dayCamError = error;
-        emit dayCamErrorChanged();
+        m_notify.notify(&SystemStatusViewModel::dayCamErrorChanged);
     }
     QString newStatusText = connected ? (error ? getDayCameraErrorDescription(errorCode) : "✓ OK") : "N/A";
     if (m_dayCamStatusText != newStatusText) {
         m_dayCamStatusText = newStatusText;
-        emit dayCamStatusTextChanged();
+        m_notify.notify(&SystemStatusViewModel::dayCamStatusTextChanged);
     }
 }
 
@@ -345,46 +328,43 @@ void SystemStatusViewModel::updateNightCamera(bool connected, bool isActive, flo
 {
     if (m_nightCamConnected != connected) {
         m_nightCamConnected = connected;
-        emit nightCamConnectedChanged();
+        m_notify.notify(&SystemStatusViewModel::nightCamConnectedChanged);
     }
 
     if (m_nightCamActive != isActive) {
         m_nightCamActive = isActive;
-        emit nightCamActiveChanged();
+        m_notify.notify(&SystemStatusViewModel::nightCamActiveChanged);
     }
 
-    QString newFov = QString::number(fov, 'f', 1) + "°";
-    if (m_nightCamFovText != newFov) {
-        m_nightCamFovText = newFov;
-        emit nightCamFovTextChanged();
+    if (m_nightCamFovFormat.update(fov)) {
+        m_nightCamFovText = m_nightCamFovFormat.text();
+        m_notify.notify(&SystemStatusViewModel::nightCamFovTextChanged);
     }
 
-    QString newZoom = QString::number(digitalZoom) + "x";
-    if (m_nightCamZoomText != newZoom) {
-        m_nightCamZoomText = newZoom;
-        emit nightCamZoomTextChanged();
+    if (m_nightCamZoomFormat.update(digitalZoom)) {
+        m_nightCamZoomText = m_nightCamZoomFormat.text();
+        m_notify.notify(&SystemStatusViewModel::nightCamZoomTextChanged);
     }
 
-    QString newVideoMode = QString("LUT %1").arg(videoMode);
-    if (m_nightCamVideoModeText != newVideoMode) {
-        m_nightCamVideoModeText = newVideoMode;
-        emit nightCamVideoModeTextChanged();
+    if (m_nightCamVideoModeFormat.update(videoMode)) {
+        m_nightCamVideoModeText = m_nightCamVideoModeFormat.text();
+        m_notify.notify(&SystemStatusViewModel::nightCamVideoModeTextChanged);
     }
 
     if (m_nightCamFfcInProgress != ffcInProgress) {
         m_nightCamFfcInProgress = ffcInProgress;
-        emit nightCamFfcInProgressChanged();
+        m_notify.notify(&SystemStatusViewModel::nightCamFfcInProgressChanged);
     }
 
     if (m_nightCamError != error) {
         m_nightCamError = error;
-        emit nightCamErrorChanged();
+        m_notify.notify(&SystemStatusViewModel::nightCamErrorChanged);
     }
 
     QString newStatusText = connected ? (error ? getNightCameraErrorDescription(errorCode) : "✓ OK") : "N/A";
     if (m_nightCamStatusText != newStatusText) {
         m_nightCamStatusText = newStatusText;
-        emit nightCamStatusTextChanged();
+        m_notify.notify(&SystemStatusViewModel::nightCamStatusTextChanged);
     }
 }
 
@@ -396,38 +376,73 @@ void SystemStatusViewModel::updatePlcStatus(bool plc21Conn, bool plc42Conn,
 {
     if (m_plc21Connected != plc21Conn) {
         m_plc21Connected = plc21Conn;
-        emit plc21ConnectedChanged();
+        m_notify.notify(&SystemStatusViewModel::plc21ConnectedChanged);
     }
 
     if (m_plc42Connected != plc42Conn) {
         m_plc42Connected = plc42Conn;
-        emit plc42ConnectedChanged();
+        m_notify.notify(&SystemStatusViewModel::plc42ConnectedChanged);
     }
 
     if (m_stationEnabled != stationEn) {
         m_stationEnabled = stationEn;
-        emit stationEnabledChanged();
+        m_notify.notify(&SystemStatusViewModel::stationEnabledChanged);
     }
 
     if (m_gunArmed != gunArm) {
         m_gunArmed = gunArm;
-        emit gunArmedChanged();
+        m_notify.notify(&SystemStatusViewModel::gunArmedChanged);
     }
     QString plc21Status = plc21Conn ? "✓ OK" : "N/A";
     QString plc42Status = plc42Conn ? "✓ OK" : "N/A";
     
     if (m_plc21StatusText != plc21Status) {
         m_plc21StatusText = plc21Status;
-        emit plc21StatusTextChanged();
+        m_notify.notify(&SystemStatusViewModel::plc21StatusTextChanged);
     }
     
     if (m_plc42StatusText != plc42Status) {
         m_plc42StatusText = plc42Status;
-        emit plc42StatusTextChanged();
+        m_notify.notify(&SystemStatusViewModel::plc42StatusTextChanged);
     }
         
 }
 
+// ============================================================================
+// MODBUS BUSES
+// ============================================================================
+void SystemStatusViewModel::updateModbusBuses(const QString& busiestBus, double utilisation,
+                                              double roundTripP95Ms, quint64 timeouts,
+                                              quint64 retries, quint64 errors)
+{
+    QString busText = "N/A";
+    QString errorText = "N/A";
+    if (!busiestBus.isEmpty()) {
+        busText = QString("%1 %2% · %3 ms")
+                      .arg(busiestBus)
+                      .arg(utilisation * 100.0, 0, 'f', 0)
+                      .arg(roundTripP95Ms, 0, 'f', 1);
+        errorText = QString("%1 TO · %2 RT · %3 ERR").arg(timeouts).arg(retries).arg(errors);
+    }
+
+    if (m_modbusBusText != busText) {
+        m_modbusBusText = busText;
+        m_notify.notify(&SystemStatusViewModel::modbusBusTextChanged);
+    }
+
+    if (m_modbusErrorText != errorText) {
+        m_modbusErrorText = errorText;
+        m_notify.notify(&SystemStatusViewModel::modbusErrorTextChanged);
+    }
+
+    // Past 80% of the line a retry burst no longer fits; any timeout is worth a look
+    const bool degraded = utilisation > 0.8 || timeouts > 0 || errors > 0;
+    if (m_modbusDegraded != degraded) {
+        m_modbusDegraded = degraded;
+        m_notify.notify(&SystemStatusViewModel::modbusDegradedChanged);
+    }
+}
+
 // ===========================================================================
 // Servo Actuator
 // ============================================================================ 
@@ -437,47 +452,42 @@ void SystemStatusViewModel::updateServoActuator(bool connected, double position,
 {
     if (m_actuatorConnected != connected) {
         m_actuatorConnected = connected;
-        emit actuatorConnectedChanged();
+        m_notify.notify(&SystemStatusViewModel::actuatorConnectedChanged);
     }
 
-    QString newPos = QString::number(position, 'f', 2) + "mm";
-    if (m_actuatorPositionText != newPos) {
-        m_actuatorPositionText = newPos;
-        emit actuatorPositionTextChanged();
+    if (m_actuatorPositionFormat.update(position)) {
+        m_actuatorPositionText = m_actuatorPositionFormat.text();
+        m_notify.notify(&SystemStatusViewModel::actuatorPositionTextChanged);
     }
 
-    QString newVel = QString::number(velocity, 'f', 1) + "mm/s";
-    if (m_actuatorVelocityText != newVel) {
-        m_actuatorVelocityText = newVel;
-        emit actuatorVelocityTextChanged();
+    if (m_actuatorVelocityFormat.update(velocity)) {
+        m_actuatorVelocityText = m_actuatorVelocityFormat.text();
+        m_notify.notify(&SystemStatusViewModel::actuatorVelocityTextChanged);
     }
 
-    QString newTemp = QString::number(temp, 'f', 1) + "°C";
-    if (m_actuatorTempText != newTemp) {
-        m_actuatorTempText = newTemp;
-        emit actuatorTempTextChanged();
+    if (m_actuatorTempFormat.update(temp)) {
+        m_actuatorTempText = m_actuatorTempFormat.text();
+        m_notify.notify(&SystemStatusViewModel::actuatorTempTextChanged);
     }
 
-    QString newVoltage = QString::number(voltage, 'f', 2) + "V";
-    if (m_actuatorVoltageText != newVoltage) {
-        m_actuatorVoltageText = newVoltage;
-        emit actuatorVoltageTextChanged();
+    if (m_actuatorVoltageFormat.update(voltage)) {
+        m_actuatorVoltageText = m_actuatorVoltageFormat.text();
+        m_notify.notify(&SystemStatusViewModel::actuatorVoltageTextChanged);
     }
 
-    QString newTorque = QString::number(torque, 'f', 1) + "%";
-    if (m_actuatorTorqueText != newTorque) {
-        m_actuatorTorqueText = newTorque;
-        emit actuatorTorqueTextChanged();
+    if (m_actuatorTorqueFormat.update(torque)) {
+        m_actuatorTorqueText = m_actuatorTorqueFormat.text();
+        m_notify.notify(&SystemStatusViewModel::actuatorTorqueTextChanged);
     }
 
     if (m_actuatorMotorOff != motorOff) {
         m_actuatorMotorOff = motorOff;
-        emit actuatorMotorOffChanged();
+        m_notify.notify(&SystemStatusViewModel::actuatorMotorOffChanged);
     }
 
     if (m_actuatorFault != fault) {
         m_actuatorFault = fault;
-        emit actuatorFaultChanged();
+        m_notify.notify(&SystemStatusViewModel::actuatorFaultChanged);
     }
 
     QString statusText;
@@ -491,7 +501,7 @@ void SystemStatusViewModel::updateServoActuator(bool connected, double position,
     
     if (m_actuatorStatusText != statusText) {
         m_actuatorStatusText = statusText;
-        emit actuatorStatusTextChanged();
+        m_notify.notify(&SystemStatusViewModel::actuatorStatusTextChanged);
     }
 }
 
@@ -502,12 +512,12 @@ void SystemStatusViewModel::updateAlarms(const QStringList& alarms)
 {
     if (m_alarmsList != alarms) {
         m_alarmsList = alarms;
-        emit alarmsListChanged();
+        m_notify.notify(&SystemStatusViewModel::alarmsListChanged);
 
         bool newHasAlarms = !alarms.isEmpty();
         if (m_hasAlarms != newHasAlarms) {
             m_hasAlarms = newHasAlarms;
-            emit hasAlarmsChanged();
+            m_notify.notify(&SystemStatusViewModel::hasAlarmsChanged);
         }
     }
 }
@@ -5,6 +5,8 @@
 #include <QString>
 #include <QStringList>
 #include <QColor>
+#include "propertynotifybatch.h"
+#include "utils/fixedpointtext.h"
 
 /**
  * @brief SystemStatusViewModel - Exposes comprehensive device health status to QML
@@ -13,7 +15,7 @@
  * - Motion Systems (Azimuth/Elevation servos, Servo Actuator)
  * - Sensors (IMU, LRF)
  * - Cameras (Day/Night)
- * - Control Systems (PLCs)
+ * - Control Systems (PLCs, Modbus bus load and errors)
  * - Active alarms
  * 
  * All status text properties follow the pattern:
@@ -104,6 +106,13 @@ class SystemStatusViewModel : public QObject
     Q_PROPERTY(QString plc21StatusText READ plc21StatusText NOTIFY plc21StatusTextChanged)
     Q_PROPERTY(QString plc42StatusText READ plc42StatusText NOTIFY plc42StatusTextChanged)
 
+    // ========================================================================
+    // MODBUS BUSES
+    // ========================================================================
+    Q_PROPERTY(QString modbusBusText READ modbusBusText NOTIFY modbusBusTextChanged)
+    Q_PROPERTY(QString modbusErrorText READ modbusErrorText NOTIFY modbusErrorTextChanged)
+    Q_PROPERTY(bool modbusDegraded READ modbusDegraded NOTIFY modbusDegradedChanged)
+
     // ========================================================================
     // SERVO ACTUATOR
     // ========================================================================
@@ -132,6 +141,10 @@ class SystemStatusViewModel : public QObject
 public:
     explicit SystemStatusViewModel(QObject *parent = nullptr);
 
+    // Group property updates: each NOTIFY signal is emitted once at endUpdate()
+    void beginUpdate() { m_notify.begin(); }
+    void endUpdate() { m_notify.end(); }
+
     // ========================================================================
     // GETTERS - AZIMUTH SERVO
     // ========================================================================
@@ -211,6 +224,13 @@ public:
     QString plc21StatusText() const { return m_plc21StatusText; }
     QString plc42StatusText() const { return m_plc42StatusText; }
 
+    // ========================================================================
+    // GETTERS - MODBUS BUSES
+    // ========================================================================
+    QString modbusBusText() const { return m_modbusBusText; }
+    QString modbusErrorText() const { return m_modbusErrorText; }
+    bool modbusDegraded() const { return m_modbusDegraded; }
+
     // ========================================================================
     // GETTERS - SERVO ACTUATOR
     // ========================================================================
@@ -262,6 +282,10 @@ public slots:
 
     void updatePlcStatus(bool plc21Conn, bool plc42Conn, bool stationEn, bool gunArm);
 
+    // Busiest bus over the last second, and errors summed over all buses
+    void updateModbusBuses(const QString& busiestBus, double utilisation, double roundTripP95Ms,
+                           quint64 timeouts, quint64 retries, quint64 errors);
+
     void updateServoActuator(bool connected, double position, double velocity,
                              double temp, double voltage, double torque,
                              bool motorOff, bool fault);
@@ -348,6 +372,13 @@ signals:
     void plc21StatusTextChanged();
     void plc42StatusTextChanged();
 
+    // ========================================================================
+    // SIGNALS - MODBUS BUSES
+    // ========================================================================
+    void modbusBusTextChanged();
+    void modbusErrorTextChanged();
+    void modbusDegradedChanged();
+
     // ========================================================================
     // SIGNALS - SERVO ACTUATOR
     // ========================================================================
@@ -464,6 +495,13 @@ private:
     QString m_plc21StatusText;
     QString m_plc42StatusText;
 
+    // ========================================================================
+    // PRIVATE MEMBERS - MODBUS BUSES
+    // ========================================================================
+    QString m_modbusBusText;
+    QString m_modbusErrorText;
+    bool m_modbusDegraded;
+
     // ========================================================================
     // PRIVATE MEMBERS - SERVO ACTUATOR
     // ========================================================================
@@ -488,6 +526,42 @@ private:
     // ========================================================================
     bool m_visible;
     QColor m_accentColor;
+
+    // ========================================================================
+    // PRIVATE MEMBERS - TEXT FORMATTING
+    // ========================================================================
+    // Only re-format when the value changes at the displayed precision
+    FixedPointText m_azPositionFormat{2, QStringLiteral("°")};
+    FixedPointText m_azRpmFormat{0};
+    FixedPointText m_azTorqueFormat{1, QStringLiteral("%")};
+    FixedPointText m_azMotorTempFormat{1, QStringLiteral("°C")};
+    FixedPointText m_azDriverTempFormat{1, QStringLiteral("°C")};
+    FixedPointText m_elPositionFormat{2, QStringLiteral("°")};
+    FixedPointText m_elRpmFormat{0};
+    FixedPointText m_elTorqueFormat{1, QStringLiteral("%")};
+    FixedPointText m_elMotorTempFormat{1, QStringLiteral("°C")};
+    FixedPointText m_elDriverTempFormat{1, QStringLiteral("°C")};
+    FixedPointText m_imuRollFormat{2, QStringLiteral("°")};
+    FixedPointText m_imuPitchFormat{2, QStringLiteral("°")};
+    FixedPointText m_imuYawFormat{2, QStringLiteral("°")};
+    FixedPointText m_imuTempFormat{1, QStringLiteral("°C")};
+    FixedPointText m_lrfDistanceFormat{1, QStringLiteral("m")};
+    FixedPointText m_lrfTempFormat{1, QStringLiteral("°C")};
+    FixedPointText m_lrfLaserCountFormat{0};
+    FixedPointText m_lrfRawStatusByteFormat{0};
+    FixedPointText m_dayCamFovFormat{1, QStringLiteral("°")};
+    FixedPointText m_dayCamZoomFormat{0};
+    FixedPointText m_dayCamFocusFormat{0};
+    FixedPointText m_nightCamFovFormat{1, QStringLiteral("°")};
+    FixedPointText m_nightCamZoomFormat{0, QStringLiteral("x")};
+    FixedPointText m_nightCamVideoModeFormat{0, QString(), QStringLiteral("LUT ")};
+    FixedPointText m_actuatorPositionFormat{2, QStringLiteral("mm")};
+    FixedPointText m_actuatorVelocityFormat{1, QStringLiteral("mm/s")};
+    FixedPointText m_actuatorTempFormat{1, QStringLiteral("°C")};
+    FixedPointText m_actuatorVoltageFormat{2, QStringLiteral("V")};
+    FixedPointText m_actuatorTorqueFormat{1, QStringLiteral("%")};
+
+    PropertyNotifyBatch<SystemStatusViewModel> m_notify;
 };
 
 #endif // SYSTEMSTATUSVIEWMODEL_H
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "viewmodelupdatescheduler.h"
+
+#include <QDebug>
+#include <QQuickWindow>
+
+namespace {
+constexpr int kFallbackFrameMs = 16;
+}
+
+ViewModelUpdateScheduler::ViewModelUpdateScheduler(QObject* parent)
+    : QObject(parent)
+{
+    m_fallbackTimer.setSingleShot(true);
+    m_fallbackTimer.setInterval(kFallbackFrameMs);
+    connect(&m_fallbackTimer, &QTimer::timeout, this, &ViewModelUpdateScheduler::onFrame);
+}
+
+void ViewModelUpdateScheduler::attachWindow(QQuickWindow* window)
+{
+    if (!window || window == m_window) return;
+
+    if (m_window) {
+        disconnect(m_window, nullptr, this, nullptr);
+    }
+    m_window = window;
+    m_fallbackTimer.stop();
+    m_frameRequested = false;
+
+    // Emitted on the GUI thread before the render thread synchronises the scene graph
+    connect(window, &QQuickWindow::afterAnimating, this, &ViewModelUpdateScheduler::onFrame);
+    qInfo() << "ViewModelUpdateScheduler: Updates synchronised to window frames";
+
+    requestFrame();
+}
+
+int ViewModelUpdateScheduler::registerClient(const QString& name, FlushFunction flush, bool visible)
+{
+    Client client;
+    client.name = name;
+    client.flush = std::move(flush);
+    client.visible = visible;
+    m_clients.push_back(std::move(client));
+    return static_cast<int>(m_clients.size()) - 1;
+}
+
+void ViewModelUpdateScheduler::markDirty(int clientId)
+{
+    if (clientId < 0 || clientId >= static_cast<int>(m_clients.size())) return;
+
+    Client& client = m_clients[clientId];
+    ++client.marks;
+    client.dirty = true;
+    if (client.visible) {
+        requestFrame();
+    }
+}
+
+void ViewModelUpdateScheduler::setClientVisible(int clientId, bool visible)
+{
+    if (clientId < 0 || clientId >= static_cast<int>(m_clients.size())) return;
+
+    Client& client = m_clients[clientId];
+    if (client.visible == visible) return;
+    client.visible = visible;
+    if (visible && client.dirty) {
+        requestFrame();
+    }
+}
+
+void ViewModelUpdateScheduler::flushPending()
+{
+    m_frameRequested = false;
+
+    // Index loop: a flush may register or mark clients
+    for (size_t i = 0; i < m_clients.size(); ++i) {
+        if (!m_clients[i].dirty || !m_clients[i].visible) continue;
+        m_clients[i].dirty = false;
+        ++m_clients[i].flushes;
+        FlushFunction flush = m_clients[i].flush;
+        flush();
+    }
+}
+
+std::vector<ViewModelUpdateScheduler::ClientStats> ViewModelUpdateScheduler::stats() const
+{
+    std::vector<ClientStats> result;
+    result.reserve(m_clients.size());
+    for (const Client& client : m_clients) {
+        result.push_back({client.name, client.marks, client.flushes});
+    }
+    return result;
+}
+
+void ViewModelUpdateScheduler::onFrame()
+{
+    flushPending();
+}
+
+void ViewModelUpdateScheduler::requestFrame()
+{
+    if (m_frameRequested) return;
+    m_frameRequested = true;
+
+    if (m_window) {
+        // Usually already scheduled by the video item; this only covers a static scene
+        m_window->update();
+    } else {
+        m_fallbackTimer.start();
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef VIEWMODELUPDATESCHEDULER_H
+#define VIEWMODELUPDATESCHEDULER_H
+
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QTimer>
+#include <functional>
+#include <vector>
+
+class QQuickWindow;
+
+/**
+ * @brief Applies pending view-model updates once per displayed frame.
+ *
+ * Controllers register a flush function and call markDirty() when new data
+ * arrives (camera frames, state changes). Marks are coalesced: each dirty
+ * client is flushed at most once per frame, on the GUI thread right before
+ * the scene graph is synchronised (QQuickWindow::afterAnimating), so the
+ * property changes land in the frame that is about to be rendered. Clients
+ * that are not visible stay dirty and are flushed when they are shown.
+ *
+ * Until a window is attached (startup, offscreen benchmarks) a ~60 Hz timer
+ * stands in for the frame cadence.
+ */
+class ViewModelUpdateScheduler : public QObject
+{
+    Q_OBJECT
+public:
+    using FlushFunction = std::function<void()>;
+
+    struct ClientStats {
+        QString name;
+        quint64 marks = 0;          // markDirty() calls
+        quint64 flushes = 0;        // Batches actually applied
+    };
+
+    explicit ViewModelUpdateScheduler(QObject* parent = nullptr);
+
+    void attachWindow(QQuickWindow* window);
+
+    // Returns the client id used with markDirty() and setClientVisible()
+    int registerClient(const QString& name, FlushFunction flush, bool visible = true);
+    void markDirty(int clientId);
+    void setClientVisible(int clientId, bool visible);
+
+    // Flushes every dirty, visible client now
+    void flushPending();
+
+    std::vector<ClientStats> stats() const;
+
+private slots:
+    void onFrame();
+
+private:
+    struct Client {
+        QString name;
+        FlushFunction flush;
+        bool visible = true;
+        bool dirty = false;
+        quint64 marks = 0;
+        quint64 flushes = 0;
+    };
+
+    void requestFrame();
+
+    std::vector<Client> m_clients;
+    QPointer<QQuickWindow> m_window;
+    QTimer m_fallbackTimer;
+    bool m_frameRequested = false;
+};
+
+#endif // VIEWMODELUPDATESCHEDULER_H
@@ -0,0 +1,179 @@
+#include "zonemaplistmodels.h"
+
+#include <QtMath>
+
+namespace {
+template <typename T>
+bool validRow(const QModelIndex& index, const QVector<T>& rows)
+{
+    return index.isValid() && index.row() >= 0 && index.row() < rows.size();
+}
+}
+
+// ============================================================================
+// AREA ZONES
+// ============================================================================
+
+AreaZoneListModel::AreaZoneListModel(QObject *parent)
+    : ZoneMapListModel(parent)
+{
+}
+
+int AreaZoneListModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_zones.size();
+}
+
+QVariant AreaZoneListModel::data(const QModelIndex &index, int role) const
+{
+    if (!validRow(index, m_zones)) return QVariant();
+
+    const AreaZone& zone = m_zones.at(index.row());
+    switch (role) {
+    case ZoneIdRole:       return zone.id;
+    case TypeRole:         return static_cast<int>(zone.type);
+    case EnabledRole:      return zone.isEnabled;
+    case OverridableRole:  return zone.isOverridable;
+    case StartAzimuthRole: return zone.startAzimuth;
+    case EndAzimuthRole:   return zone.endAzimuth;
+    case MinElevationRole: return zone.minElevation;
+    case MaxElevationRole: return zone.maxElevation;
+    default:               return QVariant();
+    }
+}
+
+QHash<int, QByteArray> AreaZoneListModel::roleNames() const
+{
+    return {
+        { ZoneIdRole, "zoneId" },
+        { TypeRole, "type" },
+        { EnabledRole, "isEnabled" },
+        { OverridableRole, "isOverridable" },
+        { StartAzimuthRole, "startAzimuth" },
+        { EndAzimuthRole, "endAzimuth" },
+        { MinElevationRole, "minElevation" },
+        { MaxElevationRole, "maxElevation" }
+    };
+}
+
+void AreaZoneListModel::setZones(const std::vector<AreaZone>& zones)
+{
+    syncRows(m_zones, zones, [](const AreaZone& a, const AreaZone& b) {
+        QVector<int> roles;
+        if (a.type != b.type) roles << TypeRole;
+        if (a.isEnabled != b.isEnabled) roles << EnabledRole;
+        if (a.isOverridable != b.isOverridable) roles << OverridableRole;
+        if (!qFuzzyCompare(a.startAzimuth, b.startAzimuth)) roles << StartAzimuthRole;
+        if (!qFuzzyCompare(a.endAzimuth, b.endAzimuth)) roles << EndAzimuthRole;
+        if (!qFuzzyCompare(a.minElevation, b.minElevation)) roles << MinElevationRole;
+        if (!qFuzzyCompare(a.maxElevation, b.maxElevation)) roles << MaxElevationRole;
+        return roles;
+    });
+}
+
+// ============================================================================
+// SECTOR SCANS
+// ============================================================================
+
+SectorScanListModel::SectorScanListModel(QObject *parent)
+    : ZoneMapListModel(parent)
+{
+}
+
+int SectorScanListModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_zones.size();
+}
+
+QVariant SectorScanListModel::data(const QModelIndex &index, int role) const
+{
+    if (!validRow(index, m_zones)) return QVariant();
+
+    const AutoSectorScanZone& zone = m_zones.at(index.row());
+    switch (role) {
+    case ZoneIdRole:  return zone.id;
+    case EnabledRole: return zone.isEnabled;
+    case Az1Role:     return zone.az1;
+    case El1Role:     return zone.el1;
+    case Az2Role:     return zone.az2;
+    case El2Role:     return zone.el2;
+    default:          return QVariant();
+    }
+}
+
+QHash<int, QByteArray> SectorScanListModel::roleNames() const
+{
+    return {
+        { ZoneIdRole, "zoneId" },
+        { EnabledRole, "isEnabled" },
+        { Az1Role, "az1" },
+        { El1Role, "el1" },
+        { Az2Role, "az2" },
+        { El2Role, "el2" }
+    };
+}
+
+void SectorScanListModel::setZones(const std::vector<AutoSectorScanZone>& zones)
+{
+    syncRows(m_zones, zones, [](const AutoSectorScanZone& a, const AutoSectorScanZone& b) {
+        QVector<int> roles;
+        if (a.isEnabled != b.isEnabled) roles << EnabledRole;
+        if (!qFuzzyCompare(a.az1, b.az1)) roles << Az1Role;
+        if (!qFuzzyCompare(a.el1, b.el1)) roles << El1Role;
+        if (!qFuzzyCompare(a.az2, b.az2)) roles << Az2Role;
+        if (!qFuzzyCompare(a.el2, b.el2)) roles << El2Role;
+        return roles;
+    });
+}
+
+// ============================================================================
+// TARGET REFERENCE POINTS
+// ============================================================================
+
+TrpListModel::TrpListModel(QObject *parent)
+    : ZoneMapListModel(parent)
+{
+}
+
+int TrpListModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_zones.size();
+}
+
+QVariant TrpListModel::data(const QModelIndex &index, int role) const
+{
+    if (!validRow(index, m_zones)) return QVariant();
+
+    const TargetReferencePoint& trp = m_zones.at(index.row());
+    switch (role) {
+    case ZoneIdRole:       return trp.id;
+    case AzimuthRole:      return trp.azimuth;
+    case ElevationRole:    return trp.elevation;
+    case LocationPageRole: return trp.locationPage;
+    case TrpInPageRole:    return trp.trpInPage;
+    default:               return QVariant();
+    }
+}
+
+QHash<int, QByteArray> TrpListModel::roleNames() const
+{
+    return {
+        { ZoneIdRole, "zoneId" },
+        { AzimuthRole, "azimuth" },
+        { ElevationRole, "elevation" },
+        { LocationPageRole, "locationPage" },
+        { TrpInPageRole, "trpInPage" }
+    };
+}
+
+void TrpListModel::setZones(const std::vector<TargetReferencePoint>& zones)
+{
+    syncRows(m_zones, zones, [](const TargetReferencePoint& a, const TargetReferencePoint& b) {
+        QVector<int> roles;
+        if (!qFuzzyCompare(a.azimuth, b.azimuth)) roles << AzimuthRole;
+        if (!qFuzzyCompare(a.elevation, b.elevation)) roles << ElevationRole;
+        if (a.locationPage != b.locationPage) roles << LocationPageRole;
+        if (a.trpInPage != b.trpInPage) roles << TrpInPageRole;
+        return roles;
+    });
+}
@@ -0,0 +1,206 @@
+#ifndef ZONEMAPLISTMODELS_H
+#define ZONEMAPLISTMODELS_H
+
+#include <QAbstractListModel>
+#include <QSet>
+#include <QVector>
+#include <vector>
+#include "models/domain/systemstatedata.h"
+
+/**
+ * @brief Common base of the zone map list models.
+ *
+ * Each model mirrors one zone vector of SystemStateModel. setZones() diffs the
+ * new vector against the current rows by zone id: rows whose id disappeared
+ * are removed, rows that moved are moved, rows whose displayed fields changed
+ * get a dataChanged with only those roles and new ids are inserted in place.
+ * An unchanged zone set costs one compare per zone and emits nothing.
+ */
+class ZoneMapListModel : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+
+public:
+    using QAbstractListModel::QAbstractListModel;
+
+    int count() const { return rowCount(); }
+
+signals:
+    void countChanged();
+    // Emitted once per setZones() that changed anything visible
+    void zonesUpdated();
+
+protected:
+    // changedRoles(oldRow, newRow) returns the roles that differ
+    template <typename T, typename RolesFn>
+    void syncRows(QVector<T>& rows, const std::vector<T>& target, RolesFn changedRoles);
+};
+
+template <typename T, typename RolesFn>
+void ZoneMapListModel::syncRows(QVector<T>& rows, const std::vector<T>& target, RolesFn changedRoles)
+{
+    const int oldCount = rows.size();
+    bool changed = false;
+
+    QSet<int> targetIds;
+    targetIds.reserve(static_cast<int>(target.size()));
+    for (const T& zone : target) {
+        targetIds.insert(zone.id);
+    }
+
+    // 1. Remove rows whose id is gone, one contiguous run at a time
+    for (int last = rows.size() - 1; last >= 0; ) {
+        if (targetIds.contains(rows.at(last).id)) {
+            --last;
+            continue;
+        }
+        int first = last;
+        while (first > 0 && !targetIds.contains(rows.at(first - 1).id)) {
+            --first;
+        }
+        beginRemoveRows(QModelIndex(), first, last);
+        rows.remove(first, last - first + 1);
+        endRemoveRows();
+        changed = true;
+        last = first - 1;
+    }
+
+    // 2. Walk the target order: insert new ids, move reordered ones, update in place
+    for (int i = 0; i < static_cast<int>(target.size()); ++i) {
+        const T& zone = target[i];
+
+        int from = -1;
+        for (int j = i; j < rows.size(); ++j) {
+            if (rows.at(j).id == zone.id) {
+                from = j;
+                break;
+            }
+        }
+
+        if (from < 0) {
+            beginInsertRows(QModelIndex(), i, i);
+            rows.insert(i, zone);
+            endInsertRows();
+            changed = true;
+            continue;
+        }
+
+        if (from != i) {
+            beginMoveRows(QModelIndex(), from, from, QModelIndex(), i);
+            rows.move(from, i);
+            endMoveRows();
+            changed = true;
+        }
+
+        if (rows.at(i) != zone) {
+            const QVector<int> roles = changedRoles(rows.at(i), zone);
+            rows[i] = zone;
+            if (!roles.isEmpty()) {
+                const QModelIndex idx = index(i);
+                emit dataChanged(idx, idx, roles);
+                changed = true;
+            }
+        }
+    }
+
+    if (rows.size() != oldCount) {
+        emit countChanged();
+    }
+    if (changed) {
+        emit zonesUpdated();
+    }
+}
+
+/**
+ * @brief Area zones (safety / no-traverse / no-fire rectangles)
+ */
+class AreaZoneListModel : public ZoneMapListModel
+{
+    Q_OBJECT
+
+public:
+    enum Roles {
+        ZoneIdRole = Qt::UserRole + 1,
+        TypeRole,
+        EnabledRole,
+        OverridableRole,
+        StartAzimuthRole,
+        EndAzimuthRole,
+        MinElevationRole,
+        MaxElevationRole
+    };
+
+    explicit AreaZoneListModel(QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    const QVector<AreaZone>& zones() const { return m_zones; }
+    void setZones(const std::vector<AreaZone>& zones);
+
+private:
+    QVector<AreaZone> m_zones;
+};
+
+/**
+ * @brief Auto sector scan lines
+ */
+class SectorScanListModel : public ZoneMapListModel
+{
+    Q_OBJECT
+
+public:
+    enum Roles {
+        ZoneIdRole = Qt::UserRole + 1,
+        EnabledRole,
+        Az1Role,
+        El1Role,
+        Az2Role,
+        El2Role
+    };
+
+    explicit SectorScanListModel(QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    const QVector<AutoSectorScanZone>& zones() const { return m_zones; }
+    void setZones(const std::vector<AutoSectorScanZone>& zones);
+
+private:
+    QVector<AutoSectorScanZone> m_zones;
+};
+
+/**
+ * @brief Target reference points
+ */
+class TrpListModel : public ZoneMapListModel
+{
+    Q_OBJECT
+
+public:
+    enum Roles {
+        ZoneIdRole = Qt::UserRole + 1,
+        AzimuthRole,
+        ElevationRole,
+        LocationPageRole,
+        TrpInPageRole
+    };
+
+    explicit TrpListModel(QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    const QVector<TargetReferencePoint>& zones() const { return m_zones; }
+    void setZones(const std::vector<TargetReferencePoint>& zones);
+
+private:
+    QVector<TargetReferencePoint> m_zones;
+};
+
+#endif // ZONEMAPLISTMODELS_H
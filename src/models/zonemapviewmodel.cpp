@@ -26,36 +26,34 @@ void ZoneMapViewModel::setGimbalPosition(float az, float el) {
 void ZoneMapViewModel::updateZones(SystemStateModel* model) {
     if (!model) return;
 
-    QVariantList newAreaZones = convertAreaZonesToVariant(model);
-    QVariantList newSectorScans = convertSectorScansToVariant(model);
-    QVariantList newTRPs = convertTRPsToVariant(model);
+    // Each model diffs by zone id and only signals the rows that changed
+    m_areaZoneModel.setZones(model->getAreaZones());
+    m_sectorScanModel.setZones(model->getSectorScanZones());
+    m_trpModel.setZones(model->getTargetReferencePoints());
+}
 
-    if (m_areaZones != newAreaZones) {
-        m_areaZones = newAreaZones;
-        emit areaZonesChanged();
+void ZoneMapViewModel::setWipZone(const QVariantMap& zone, int type, bool definingStart, bool definingEnd) {
+    // Called at servo rate while aiming, so only signal what actually moved
+    if (m_wipZone != zone) {
+        m_wipZone = zone;
+        emit wipZoneChanged();
     }
-    if (m_sectorScans != newSectorScans) {
-        m_sectorScans = newSectorScans;
-        emit sectorScansChanged();
+    if (m_wipZoneType != type) {
+        m_wipZoneType = type;
+        emit wipZoneTypeChanged();
     }
-    if (m_trps != newTRPs) {
-        m_trps = newTRPs;
-        emit trpsChanged();
+    if (m_isDefiningStart != definingStart) {
+        m_isDefiningStart = definingStart;
+        emit isDefiningStartChanged();
+    }
+    if (m_isDefiningEnd != definingEnd) {
+        m_isDefiningEnd = definingEnd;
+        emit isDefiningEndChanged();
+    }
+    if (!m_hasWipZone) {
+        m_hasWipZone = true;
+        emit hasWipZoneChanged();
     }
-}
-
-void ZoneMapViewModel::setWipZone(const QVariantMap& zone, int type, bool definingStart, bool definingEnd) {
-    m_wipZone = zone;
-    m_wipZoneType = type;
-    m_isDefiningStart = definingStart;
-    m_isDefiningEnd = definingEnd;
-    m_hasWipZone = true;
-
-    emit wipZoneChanged();
-    emit wipZoneTypeChanged();
-    emit isDefiningStartChanged();
-    emit isDefiningEndChanged();
-    emit hasWipZoneChanged();
 }
 
 void ZoneMapViewModel::clearWipZone() {
@@ -96,61 +94,6 @@ float ZoneMapViewModel::normalizeAzimuth(float az) const {
     return normalized;
 }
 
-QVariantList ZoneMapViewModel::convertAreaZonesToVariant(SystemStateModel* model) {
-    QVariantList result;
-    const auto& zones = model->getAreaZones();
-
-    for (const auto& zone : zones) {
-        QVariantMap zoneMap;
-        zoneMap["id"] = zone.id;
-        zoneMap["type"] = static_cast<int>(zone.type);
-        zoneMap["isEnabled"] = zone.isEnabled;
-        zoneMap["isOverridable"] = zone.isOverridable;
-        zoneMap["startAzimuth"] = zone.startAzimuth;
-        zoneMap["endAzimuth"] = zone.endAzimuth;
-        zoneMap["minElevation"] = zone.minElevation;
-        zoneMap["maxElevation"] = zone.maxElevation;
-        result.append(zoneMap);
-    }
-
-    return result;
-}
-
-QVariantList ZoneMapViewModel::convertSectorScansToVariant(SystemStateModel* model) {
-    QVariantList result;
-    const auto& zones = model->getSectorScanZones();
-
-    for (const auto& zone : zones) {
-        QVariantMap zoneMap;
-        zoneMap["id"] = zone.id;
-        zoneMap["isEnabled"] = zone.isEnabled;
-        zoneMap["az1"] = zone.az1;
-        zoneMap["el1"] = zone.el1;
-        zoneMap["az2"] = zone.az2;
-        zoneMap["el2"] = zone.el2;
-        result.append(zoneMap);
-    }
-
-    return result;
-}
-
-QVariantList ZoneMapViewModel::convertTRPsToVariant(SystemStateModel* model) {
-    QVariantList result;
-    const auto& zones = model->getTargetReferencePoints();
-
-    for (const auto& zone : zones) {
-        QVariantMap zoneMap;
-        zoneMap["id"] = zone.id;
-        zoneMap["azimuth"] = zone.azimuth;
-        zoneMap["elevation"] = zone.elevation;
-        zoneMap["locationPage"] = zone.locationPage;
-        zoneMap["trpInPage"] = zone.trpInPage;
-        result.append(zoneMap);
-    }
-
-    return result;
-}
-
 void ZoneMapViewModel::setAccentColor(const QColor& color) {
     if (m_accentColor != color) {
         m_accentColor = color;
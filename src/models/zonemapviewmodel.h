@@ -6,11 +6,16 @@
 #include <QVariantMap>
 #include <QPointF>
 #include <QColor>
+#include "zonemaplistmodels.h"
 
 class SystemStateModel;
 
 /**
  * @brief ViewModel for ZoneMapCanvas - provides zone data for rendering
+ *
+ * Saved zones are exposed as list models that are diffed by zone id on every
+ * updateZones(), so the map only rebuilds its static layer when a zone was
+ * actually added, removed or edited.
  */
 class ZoneMapViewModel : public QObject
 {
@@ -20,10 +25,10 @@ class ZoneMapViewModel : public QObject
     Q_PROPERTY(float gimbalAz READ gimbalAz NOTIFY gimbalAzChanged)
     Q_PROPERTY(float gimbalEl READ gimbalEl NOTIFY gimbalElChanged)
 
-    // Zone data for rendering (as QVariantList for QML)
-    Q_PROPERTY(QVariantList areaZones READ areaZones NOTIFY areaZonesChanged)
-    Q_PROPERTY(QVariantList sectorScans READ sectorScans NOTIFY sectorScansChanged)
-    Q_PROPERTY(QVariantList trps READ trps NOTIFY trpsChanged)
+    // Saved zones (incrementally updated list models)
+    Q_PROPERTY(AreaZoneListModel* areaZoneModel READ areaZoneModel CONSTANT)
+    Q_PROPERTY(SectorScanListModel* sectorScanModel READ sectorScanModel CONSTANT)
+    Q_PROPERTY(TrpListModel* trpModel READ trpModel CONSTANT)
 
     // WIP zone
     Q_PROPERTY(bool hasWipZone READ hasWipZone NOTIFY hasWipZoneChanged)
@@ -43,9 +48,9 @@ public:
     // Getters
     float gimbalAz() const { return m_gimbalAz; }
     float gimbalEl() const { return m_gimbalEl; }
-    QVariantList areaZones() const { return m_areaZones; }
-    QVariantList sectorScans() const { return m_sectorScans; }
-    QVariantList trps() const { return m_trps; }
+    AreaZoneListModel* areaZoneModel() { return &m_areaZoneModel; }
+    SectorScanListModel* sectorScanModel() { return &m_sectorScanModel; }
+    TrpListModel* trpModel() { return &m_trpModel; }
     bool hasWipZone() const { return m_hasWipZone; }
     QVariantMap wipZone() const { return m_wipZone; }
     int wipZoneType() const { return m_wipZoneType; }
@@ -69,9 +74,6 @@ public slots:
 signals:
     void gimbalAzChanged();
     void gimbalElChanged();
-    void areaZonesChanged();
-    void sectorScansChanged();
-    void trpsChanged();
     void hasWipZoneChanged();
     void wipZoneChanged();
     void wipZoneTypeChanged();
@@ -81,15 +83,11 @@ signals:
     void accentColorChanged();
 
 private:
-    QVariantList convertAreaZonesToVariant(SystemStateModel* model);
-    QVariantList convertSectorScansToVariant(SystemStateModel* model);
-    QVariantList convertTRPsToVariant(SystemStateModel* model);
-
     float m_gimbalAz = 0.0f;
     float m_gimbalEl = 0.0f;
-    QVariantList m_areaZones;
-    QVariantList m_sectorScans;
-    QVariantList m_trps;
+    AreaZoneListModel m_areaZoneModel;
+    SectorScanListModel m_sectorScanModel;
+    TrpListModel m_trpModel;
     bool m_hasWipZone = false;
     QVariantMap m_wipZone;
     int m_wipZoneType = 0; // 0=None, 1=AreaZone, 2=SectorScan, 3=TRP
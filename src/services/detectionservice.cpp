@@ -0,0 +1,152 @@
+#include "detectionservice.h"
+
+#include <QDebug>
+#include <exception>
+
+DetectionService::DetectionService(const std::string &onnxModelPath,
+                                   const cv::Size &modelInputShape,
+                                   bool runWithCuda,
+                                   QObject *parent)
+    : QObject(parent),
+      m_modelPath(onnxModelPath),
+      m_inputShape(modelInputShape),
+      m_runWithCuda(runWithCuda)
+{
+    m_clock.start();
+}
+
+DetectionService::~DetectionService()
+{
+    // A warm-up still running on a worker uses this object
+    QMutexLocker loadLocker(&m_loadMutex);
+    qInfo() << "DetectionService: Shutting down. Batched forwards:" << m_batchedForwards
+            << "Single forwards:" << m_singleForwards;
+}
+
+bool DetectionService::loadModel()
+{
+    QMutexLocker loadLocker(&m_loadMutex);
+    if (isReady()) {
+        return true;
+    }
+
+    std::unique_ptr<YoloInference> inference;
+    try {
+        inference = std::make_unique<YoloInference>(m_modelPath, m_inputShape,
+                                                    "", // classes.txt path
+                                                    m_runWithCuda);
+    } catch (const std::exception &e) {
+        qCritical() << "DetectionService: Failed to load" << QString::fromStdString(m_modelPath) << "-" << e.what();
+        return false;
+    }
+
+    {
+        QMutexLocker locker(&m_mutex);
+        m_inference = std::move(inference);
+    }
+    m_ready.store(true, std::memory_order_release);
+    qInfo() << "DetectionService: Shared YOLO network loaded from"
+            << QString::fromStdString(m_modelPath);
+    return true;
+}
+
+std::vector<YoloDetection> DetectionService::detect(int cameraIndex, const cv::Mat &tensor,
+                                                    const YoloLetterbox &letterbox)
+{
+    if (cameraIndex < 0 || cameraIndex >= MaxCameras || tensor.empty()) {
+        qWarning() << "DetectionService: Rejecting frame from camera" << cameraIndex;
+        return {};
+    }
+
+    if (!isReady()) {
+        return {};  // Network still loading
+    }
+
+    QMutexLocker locker(&m_mutex);
+
+    Slot &slot = m_slots[cameraIndex];
+    const qint64 submitMs = m_clock.elapsed();
+    slot.tensor = tensor;
+    slot.letterbox = letterbox;
+    slot.result.clear();
+    slot.pending = true;
+    slot.done = false;
+    slot.lastSubmitMs = submitMs;
+
+    const qint64 deadlineMs = submitMs + m_batchWindowMs;
+    const int partnerIndex = (cameraIndex + 1) % MaxCameras;
+
+    while (!slot.done) {
+        if (m_forwardRunning || !slot.pending) {
+            // Either the network is busy, or our frame was claimed by the
+            // partner's batch - wait for the forward pass to finish.
+            m_cond.wait(&m_mutex);
+            continue;
+        }
+
+        const qint64 nowMs = m_clock.elapsed();
+        if (m_slots[partnerIndex].pending || nowMs >= deadlineMs || !partnerIsActive(cameraIndex, nowMs)) {
+            runPendingBatch(locker);
+            continue;
+        }
+
+        // Give the other camera a short window to join the batch
+        m_cond.wait(&m_mutex, static_cast<unsigned long>(deadlineMs - nowMs));
+    }
+
+    slot.tensor.release();
+    return std::move(slot.result);
+}
+
+bool DetectionService::partnerIsActive(int cameraIndex, qint64 nowMs) const
+{
+    const Slot &partner = m_slots[(cameraIndex + 1) % MaxCameras];
+    return partner.lastSubmitMs >= 0 && (nowMs - partner.lastSubmitMs) < m_partnerActiveMs;
+}
+
+void DetectionService::runPendingBatch(QMutexLocker<QMutex> &locker)
+{
+    std::vector<int> batchCameras;
+    std::vector<cv::Mat> batchTensors;
+    std::vector<YoloLetterbox> batchLetterbox;
+    batchCameras.reserve(MaxCameras);
+    batchTensors.reserve(MaxCameras);
+    batchLetterbox.reserve(MaxCameras);
+
+    for (int i = 0; i < MaxCameras; ++i) {
+        if (m_slots[i].pending) {
+            m_slots[i].pending = false;
+            batchCameras.push_back(i);
+            batchTensors.push_back(m_slots[i].tensor);
+            batchLetterbox.push_back(m_slots[i].letterbox);
+        }
+    }
+    if (batchCameras.empty())
+        return;
+
+    m_forwardRunning = true;
+    locker.unlock();
+
+    std::vector<std::vector<YoloDetection>> results;
+    try {
+        results = m_inference->runInferenceOnTensors(batchTensors, batchLetterbox);
+    } catch (const std::exception &e) {
+        qWarning() << "DetectionService: Inference failed:" << e.what();
+        results.assign(batchCameras.size(), {});
+    }
+
+    locker.relock();
+
+    for (size_t i = 0; i < batchCameras.size(); ++i) {
+        Slot &slot = m_slots[batchCameras[i]];
+        slot.result = std::move(results[i]);
+        slot.done = true;
+    }
+    if (batchCameras.size() > 1)
+        ++m_batchedForwards;
+    else
+        ++m_singleForwards;
+
+    m_forwardRunning = false;
+    m_cond.wakeAll();
+}
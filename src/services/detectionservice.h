@@ -0,0 +1,118 @@
+#ifndef DETECTIONSERVICE_H
+#define DETECTIONSERVICE_H
+
+#include <QObject>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "utils/inference.h"
+
+/**
+ * @brief Shared YOLO detection service for the day and night video pipelines.
+ *
+ * Owns the single YoloInference instance (and therefore the single cv::dnn::Net)
+ * used by both CameraVideoStreamDevice threads. Each camera thread calls detect()
+ * with its letterboxed detection tensor and blocks until its result is ready.
+ *
+ * Batching policy:
+ *  - When both cameras have a frame pending, the frames are stacked into one
+ *    N=2 blob and run in a single forward pass.
+ *  - A camera arriving alone waits at most batchWindowMs for its partner, and
+ *    only if the partner has submitted recently (i.e. detection is active on it).
+ *    Otherwise it runs as N=1 without delay.
+ *  - Results are routed back by camera index.
+ *
+ * The network is not loaded by the constructor: loadModel() reads and warms
+ * it up (seconds, longer when a TensorRT engine is built) and is run on a
+ * worker during startup. Until it completes detect() returns no detections,
+ * so video is live before detection is.
+ *
+ * Thread-safe. The network is only ever touched by one thread at a time.
+ */
+class DetectionService : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr int MaxCameras = 2;
+
+    explicit DetectionService(const std::string &onnxModelPath,
+                              const cv::Size &modelInputShape,
+                              bool runWithCuda,
+                              QObject *parent = nullptr);
+    ~DetectionService() override;
+
+    /**
+     * @brief Loads and warms up the network. Blocking; call once, from any thread.
+     * @return True when the network is ready for detect().
+     */
+    bool loadModel();
+
+    bool isReady() const { return m_ready.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Runs detection on a frame from the given camera.
+     * @param cameraIndex 0 = day, 1 = night.
+     * @param tensor 1x3xHxW normalised RGB tensor of size inputShape()
+     *        (the service keeps a shallow reference until done).
+     * @param letterbox Letterbox used to build the tensor.
+     * @return Detections in the coordinate space of the source frame.
+     */
+    std::vector<YoloDetection> detect(int cameraIndex, const cv::Mat &tensor, const YoloLetterbox &letterbox);
+
+    cv::Size inputShape() const { return m_inputShape; }
+
+    /**
+     * @brief Maximum time a lone frame waits for the other camera's frame.
+     */
+    void setBatchWindowMs(int ms) { m_batchWindowMs = ms; }
+    int batchWindowMs() const { return m_batchWindowMs; }
+
+    // Counters for diagnostics
+    quint64 batchedForwards() const { return m_batchedForwards; }
+    quint64 singleForwards() const { return m_singleForwards; }
+
+private:
+    struct Slot {
+        cv::Mat tensor;
+        YoloLetterbox letterbox;
+        std::vector<YoloDetection> result;
+        bool pending = false;   // Frame submitted, not yet claimed by a forward pass
+        bool done = false;      // Result ready for the submitting thread
+        qint64 lastSubmitMs = -1;
+    };
+
+    bool partnerIsActive(int cameraIndex, qint64 nowMs) const;
+    void runPendingBatch(QMutexLocker<QMutex> &locker);
+
+    const std::string m_modelPath;
+    const cv::Size m_inputShape;
+    const bool m_runWithCuda;
+
+    std::unique_ptr<YoloInference> m_inference;
+    std::atomic<bool> m_ready{false};
+    QMutex m_loadMutex;     // Held for the whole load; the destructor waits on it
+
+    QMutex m_mutex;
+    QWaitCondition m_cond;
+    std::array<Slot, MaxCameras> m_slots;
+    bool m_forwardRunning = false;
+    QElapsedTimer m_clock;
+
+    int m_batchWindowMs = 8;
+    int m_partnerActiveMs = 200; // Partner counts as active if it submitted this recently
+
+    quint64 m_batchedForwards = 0;
+    quint64 m_singleForwards = 0;
+};
+
+#endif // DETECTIONSERVICE_H
@@ -1,4 +1,8 @@
 #include "telemetryapiservice.h"
+#include "utils/latencyhistogram.h"
+#include "utils/startupprofiler.h"
+#include "hardware/communication/modbuslinkmetrics.h"
+#include "hardware/communication/modbuspollscheduler.h"
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
@@ -270,6 +274,21 @@ void TelemetryApiService::registerStatisticsEndpoints()
                    [this](const QHttpServerRequest &request) {
         return handleGetTimeRangeStats(request);
     });
+
+    m_server->route("/api/telemetry/stats/latency", QHttpServerRequest::Method::Get,
+                   [this](const QHttpServerRequest &request) {
+        return handleGetLatencyStats(request);
+    });
+
+    m_server->route("/api/telemetry/stats/startup", QHttpServerRequest::Method::Get,
+                   [this](const QHttpServerRequest &request) {
+        return handleGetStartupStats(request);
+    });
+
+    m_server->route("/api/telemetry/stats/modbus", QHttpServerRequest::Method::Get,
+                   [this](const QHttpServerRequest &request) {
+        return handleGetModbusStats(request);
+    });
 }
 
 void TelemetryApiService::registerExportEndpoints()
@@ -798,6 +817,58 @@ QHttpServerResponse TelemetryApiService::handleGetTimeRangeStats(const QHttpServ
     return createJsonResponse(jsonStats);
 }
 
+QHttpServerResponse TelemetryApiService::handleGetLatencyStats(const QHttpServerRequest &request)
+{
+    QHttpServerResponse authResponse = checkAuthentication(request, Permission::ReadSystemHealth);
+    if (authResponse.statusCode() != QHttpServerResponse::StatusCode::Ok) {
+        return authResponse;
+    }
+
+    QJsonObject jsonStats = FrameLatencyMonitor::instance().toJson();
+
+    QString clientIp = getClientIp(request);
+    logRequest("GET", "/api/telemetry/stats/latency", clientIp, "", 200);
+
+    return createJsonResponse(jsonStats);
+}
+
+QHttpServerResponse TelemetryApiService::handleGetStartupStats(const QHttpServerRequest &request)
+{
+    QHttpServerResponse authResponse = checkAuthentication(request, Permission::ReadSystemHealth);
+    if (authResponse.statusCode() != QHttpServerResponse::StatusCode::Ok) {
+        return authResponse;
+    }
+
+    QJsonObject jsonStats = StartupProfiler::instance().toJson();
+
+    QString clientIp = getClientIp(request);
+    logRequest("GET", "/api/telemetry/stats/startup", clientIp, "", 200);
+
+    return createJsonResponse(jsonStats);
+}
+
+QHttpServerResponse TelemetryApiService::handleGetModbusStats(const QHttpServerRequest &request)
+{
+    QHttpServerResponse authResponse = checkAuthentication(request, Permission::ReadSystemHealth);
+    if (authResponse.statusCode() != QHttpServerResponse::StatusCode::Ok) {
+        return authResponse;
+    }
+
+    // Poll schedule and measured link statistics side by side, per bus
+    QJsonObject jsonStats = ModbusPollScheduler::allToJson();
+    const QJsonObject links = ModbusLinkMetrics::allToJson();
+    for (auto it = links.constBegin(); it != links.constEnd(); ++it) {
+        QJsonObject bus = jsonStats[it.key()].toObject();
+        bus["link"] = it.value();
+        jsonStats[it.key()] = bus;
+    }
+
+    QString clientIp = getClientIp(request);
+    logRequest("GET", "/api/telemetry/stats/modbus", clientIp, "", 200);
+
+    return createJsonResponse(jsonStats);
+}
+
 // ============================================================================
 // EXPORT HANDLERS
 // ============================================================================
@@ -44,6 +44,9 @@
  *   GET    /api/telemetry/stats/memory      - Memory usage statistics
  *   GET    /api/telemetry/stats/samples     - Sample counts per category
  *   GET    /api/telemetry/stats/timerange   - Available time ranges
+ *   GET    /api/telemetry/stats/latency     - Video pipeline latency histograms
+ *   GET    /api/telemetry/stats/startup     - Startup phase timings and milestones
+ *   GET    /api/telemetry/stats/modbus      - Modbus poll rates, latency, errors and utilisation per bus
  *
  * Export:
  *   GET    /api/telemetry/export/csv        - Export category data to CSV
@@ -213,6 +216,9 @@ private:
     QHttpServerResponse handleGetMemoryStats(const QHttpServerRequest &request);
     QHttpServerResponse handleGetSampleStats(const QHttpServerRequest &request);
     QHttpServerResponse handleGetTimeRangeStats(const QHttpServerRequest &request);
+    QHttpServerResponse handleGetLatencyStats(const QHttpServerRequest &request);
+    QHttpServerResponse handleGetStartupStats(const QHttpServerRequest &request);
+    QHttpServerResponse handleGetModbusStats(const QHttpServerRequest &request);
 
     // ========================================================================
     // Export Endpoint Handlers
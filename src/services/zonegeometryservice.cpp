@@ -1,3 +1,322 @@
 #include "zonegeometryservice.h"
 
+#include <algorithm>
+#include <cmath>
+
 ZoneGeometryService::ZoneGeometryService() {}
+
+float ZoneGeometryService::normalizeAzimuth(float az)
+{
+    if (az >= 0.0f && az < 360.0f)
+        return az;
+    az = std::fmod(az, 360.0f);
+    if (az < 0.0f)
+        az += 360.0f;
+    return az >= 360.0f ? 0.0f : az;    // -tiny + 360 rounds up to 360 in float
+}
+
+int ZoneGeometryService::binOf(float normalizedAz)
+{
+    const int bin = static_cast<int>(normalizedAz);
+    return bin < BinCount ? bin : BinCount - 1;
+}
+
+bool ZoneGeometryService::containsAz(const CompiledZone &zone, float az)
+{
+    return zone.wraps ? (az >= zone.startAz || az <= zone.endAz)
+                      : (az >= zone.startAz && az <= zone.endAz);
+}
+
+bool ZoneGeometryService::containsEl(const CompiledZone &zone, float el)
+{
+    return el >= zone.minEl && el <= zone.maxEl;
+}
+
+bool ZoneGeometryService::touchesBin(const CompiledZone &zone, int bin)
+{
+    // Bin covers [bin, bin + 1)
+    const float lo = static_cast<float>(bin);
+    const float hi = lo + 1.0f;
+    return zone.wraps ? (zone.startAz < hi || zone.endAz >= lo)
+                      : (zone.startAz < hi && zone.endAz >= lo);
+}
+
+bool ZoneGeometryService::coversBin(const CompiledZone &zone, int bin)
+{
+    const float lo = static_cast<float>(bin);
+    const float hi = lo + 1.0f;
+    return zone.wraps ? (zone.startAz <= lo || zone.endAz >= hi)
+                      : (zone.startAz <= lo && zone.endAz >= hi);
+}
+
+void ZoneGeometryService::clear()
+{
+    for (TypeIndex &index : m_index) {
+        index.zones.clear();
+        index.elEdges.clear();
+        index.azRows.clear();
+        index.azEdges.clear();
+        index.elColumns.clear();
+        index.binned = false;
+        index.candidates.fill(0);
+        index.covered.fill(0);
+    }
+}
+
+void ZoneGeometryService::rebuild(const std::vector<AreaZone> &zones)
+{
+    clear();
+
+    for (const AreaZone &zone : zones) {
+        const int type = static_cast<int>(zone.type);
+        if (!zone.isEnabled || type < 0 || type >= TypeCount)
+            continue;
+
+        CompiledZone compiled;
+        compiled.id = zone.id;
+        compiled.startAz = normalizeAzimuth(zone.startAzimuth);
+        compiled.endAz = normalizeAzimuth(zone.endAzimuth);
+        compiled.wraps = compiled.startAz > compiled.endAz;
+        compiled.minEl = zone.minElevation;
+        compiled.maxEl = zone.maxElevation;
+        m_index[type].zones.push_back(compiled);
+    }
+
+    for (TypeIndex &index : m_index) {
+        buildDistanceField(index);
+        index.binned = index.zones.size() <= static_cast<size_t>(MaxIndexedZones);
+        if (!index.binned)
+            continue;
+        for (size_t k = 0; k < index.zones.size(); ++k) {
+            const uint64_t bit = uint64_t(1) << k;
+            for (int bin = 0; bin < BinCount; ++bin) {
+                if (touchesBin(index.zones[k], bin))
+                    index.candidates[bin] |= bit;
+                if (coversBin(index.zones[k], bin))
+                    index.covered[bin] |= bit;
+            }
+        }
+    }
+}
+
+void ZoneGeometryService::mergeIntervals(IntervalList &intervals)
+{
+    std::sort(intervals.begin(), intervals.end(),
+              [](const Interval &a, const Interval &b) { return a.lo < b.lo; });
+    IntervalList merged;
+    for (const Interval &interval : intervals) {
+        if (!merged.empty() && interval.lo <= merged.back().hi)
+            merged.back().hi = std::max(merged.back().hi, interval.hi);
+        else
+            merged.push_back(interval);
+    }
+    intervals.swap(merged);
+}
+
+void ZoneGeometryService::buildDistanceField(TypeIndex &index)
+{
+    if (index.zones.empty())
+        return;
+
+    // Elevation bands split at every zone elevation limit; each holds the restricted azimuths
+    for (const CompiledZone &zone : index.zones) {
+        index.elEdges.push_back(zone.minEl);
+        index.elEdges.push_back(zone.maxEl);
+    }
+    std::sort(index.elEdges.begin(), index.elEdges.end());
+    index.elEdges.erase(std::unique(index.elEdges.begin(), index.elEdges.end()), index.elEdges.end());
+
+    const size_t elEdgeCount = index.elEdges.size();
+    index.azRows.resize(elEdgeCount + 1);
+    for (size_t band = 0; band <= elEdgeCount; ++band) {
+        const float el = band == 0 ? index.elEdges.front() - 1.0f
+                       : band == elEdgeCount ? index.elEdges.back() + 1.0f
+                       : 0.5f * (index.elEdges[band - 1] + index.elEdges[band]);
+        IntervalList &row = index.azRows[band];
+        for (const CompiledZone &zone : index.zones) {
+            if (!containsEl(zone, el))
+                continue;
+            if (zone.wraps) {
+                row.push_back({zone.startAz, 360.0f});
+                row.push_back({0.0f, zone.endAz});
+            } else {
+                row.push_back({zone.startAz, zone.endAz});
+            }
+        }
+        mergeIntervals(row);
+    }
+
+    // Azimuth bands split at every zone azimuth limit; each holds the restricted elevations
+    for (const CompiledZone &zone : index.zones) {
+        index.azEdges.push_back(zone.startAz);
+        index.azEdges.push_back(zone.endAz);
+    }
+    std::sort(index.azEdges.begin(), index.azEdges.end());
+    index.azEdges.erase(std::unique(index.azEdges.begin(), index.azEdges.end()), index.azEdges.end());
+
+    const size_t azEdgeCount = index.azEdges.size();
+    index.elColumns.resize(azEdgeCount);
+    for (size_t band = 0; band < azEdgeCount; ++band) {
+        // Band 0 runs from the last edge across north to the first one
+        const float az = band == 0
+            ? normalizeAzimuth(0.5f * (index.azEdges.back() + index.azEdges.front() + 360.0f))
+            : 0.5f * (index.azEdges[band - 1] + index.azEdges[band]);
+        IntervalList &column = index.elColumns[band];
+        for (const CompiledZone &zone : index.zones) {
+            if (containsAz(zone, az))
+                column.push_back({zone.minEl, zone.maxEl});
+        }
+        mergeIntervals(column);
+    }
+}
+
+ZoneGeometryService::BoundaryDistance ZoneGeometryService::distanceToBoundary(ZoneType type, float az, float el) const
+{
+    BoundaryDistance distance;
+    const TypeIndex *index = indexFor(type);
+    if (!index || index->zones.empty())
+        return distance;
+
+    if (isPointInZone(type, az, el)) {
+        distance.inside = true;
+        distance.azIncreasing = distance.azDecreasing = 0.0f;
+        distance.elUp = distance.elDown = 0.0f;
+        return distance;
+    }
+    az = normalizeAzimuth(az);
+
+    // Azimuth: restricted intervals of this elevation band, wrapping at 360
+    const auto elBand = std::upper_bound(index->elEdges.begin(), index->elEdges.end(), el) - index->elEdges.begin();
+    const IntervalList &row = index->azRows[elBand];
+    if (!row.empty()) {
+        const auto next = std::upper_bound(row.begin(), row.end(), az,
+                                           [](float value, const Interval &i) { return value < i.lo; });
+        distance.azIncreasing = next != row.end() ? next->lo - az : row.front().lo + 360.0f - az;
+        distance.azDecreasing = next != row.begin() ? az - std::prev(next)->hi : az + 360.0f - row.back().hi;
+        distance.azIncreasing = std::max(distance.azIncreasing, 0.0f);
+        distance.azDecreasing = std::max(distance.azDecreasing, 0.0f);
+    }
+
+    // Elevation: restricted intervals of this azimuth band, no wrap
+    auto azBand = std::upper_bound(index->azEdges.begin(), index->azEdges.end(), az) - index->azEdges.begin();
+    if (azBand == static_cast<long>(index->azEdges.size()))
+        azBand = 0;
+    const IntervalList &column = index->elColumns[azBand];
+    const auto above = std::upper_bound(column.begin(), column.end(), el,
+                                        [](float value, const Interval &i) { return value < i.lo; });
+    if (above != column.end())
+        distance.elUp = std::max(above->lo - el, 0.0f);
+    if (above != column.begin())
+        distance.elDown = std::max(el - std::prev(above)->hi, 0.0f);
+    return distance;
+}
+
+const ZoneGeometryService::TypeIndex *ZoneGeometryService::indexFor(ZoneType type) const
+{
+    const int t = static_cast<int>(type);
+    return (t >= 0 && t < TypeCount) ? &m_index[t] : nullptr;
+}
+
+int ZoneGeometryService::zoneCount(ZoneType type) const
+{
+    const TypeIndex *index = indexFor(type);
+    return index ? static_cast<int>(index->zones.size()) : 0;
+}
+
+bool ZoneGeometryService::isPointInZone(ZoneType type, float az, float el) const
+{
+    const TypeIndex *index = indexFor(type);
+    if (!index || index->zones.empty())
+        return false;
+
+    az = normalizeAzimuth(az);
+    if (!index->binned) {
+        for (const CompiledZone &zone : index->zones) {
+            if (containsEl(zone, el) && containsAz(zone, az))
+                return true;
+        }
+        return false;
+    }
+
+    const int bin = binOf(az);
+    const uint64_t covered = index->covered[bin];
+    for (uint64_t mask = index->candidates[bin]; mask; mask &= mask - 1) {
+        const int k = __builtin_ctzll(mask);
+        const CompiledZone &zone = index->zones[k];
+        if (containsEl(zone, el) && ((covered >> k) & 1u || containsAz(zone, az)))
+            return true;
+    }
+    return false;
+}
+
+void ZoneGeometryService::checkSweepCandidate(const CompiledZone &zone, float fromAz, float travel,
+                                              bool clockwise, float minEl, float maxEl, SweepHit &best) const
+{
+    if (maxEl < zone.minEl || minEl > zone.maxEl)
+        return;
+
+    float distance = 0.0f;
+    float entryAz = fromAz;
+    if (!containsAz(zone, fromAz)) {
+        // Travel to the first boundary met in the direction of motion
+        distance = clockwise ? zone.startAz - fromAz : fromAz - zone.endAz;
+        if (distance < 0.0f)
+            distance += 360.0f;
+        entryAz = clockwise ? zone.startAz : zone.endAz;
+    }
+
+    if (distance <= travel && (!best.hit || distance < best.distanceDeg)) {
+        best.hit = true;
+        best.zoneId = zone.id;
+        best.entryAz = entryAz;
+        best.distanceDeg = distance;
+    }
+}
+
+ZoneGeometryService::SweepHit ZoneGeometryService::sweep(ZoneType type, float fromAz, float deltaAz, float el) const
+{
+    return sweepBand(type, fromAz, deltaAz, el, el);
+}
+
+ZoneGeometryService::SweepHit ZoneGeometryService::sweepBand(ZoneType type, float fromAz, float deltaAz,
+                                                             float minEl, float maxEl) const
+{
+    SweepHit best;
+    const TypeIndex *index = indexFor(type);
+    if (!index || index->zones.empty())
+        return best;
+
+    fromAz = normalizeAzimuth(fromAz);
+    const bool clockwise = deltaAz >= 0.0f;
+    const float travel = std::min(std::abs(deltaAz), 360.0f);
+
+    // Union of the candidate masks of every bin the sweep crosses
+    uint64_t mask = 0;
+    const int binsCrossed = static_cast<int>(std::ceil(travel)) + 1;
+    if (index->binned && binsCrossed < BinCount) {
+        const int step = clockwise ? 1 : BinCount - 1;
+        for (int i = 0, bin = binOf(fromAz); i <= binsCrossed; ++i, bin = (bin + step) % BinCount)
+            mask |= index->candidates[bin];
+    } else if (index->binned) {
+        mask = index->zones.size() == MaxIndexedZones ? ~uint64_t(0) : (uint64_t(1) << index->zones.size()) - 1;
+    } else {
+        for (const CompiledZone &zone : index->zones)
+            checkSweepCandidate(zone, fromAz, travel, clockwise, minEl, maxEl, best);
+        return best;
+    }
+
+    for (; mask; mask &= mask - 1)
+        checkSweepCandidate(index->zones[__builtin_ctzll(mask)], fromAz, travel, clockwise, minEl, maxEl, best);
+    return best;
+}
+
+bool ZoneGeometryService::segmentEntersZone(ZoneType type, float fromAz, float toAz, float el, SweepHit *hit) const
+{
+    float delta = normalizeAzimuth(toAz - fromAz);
+    if (delta > 180.0f)
+        delta -= 360.0f;
+    const SweepHit result = sweep(type, fromAz, delta, el);
+    if (hit)
+        *hit = result;
+    return result.hit;
+}
@@ -1,10 +1,125 @@
 #ifndef ZONEGEOMETRYSERVICE_H
 #define ZONEGEOMETRYSERVICE_H
 
+#include "models/domain/systemstatedata.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * @brief Compiled spatial index of the area zones for fast point and sweep queries.
+ *
+ * rebuild() is called whenever the zone list changes. It pre-normalises every
+ * enabled zone's azimuth interval to [0, 360) and fills 1-degree azimuth bins
+ * with two 64-bit zone masks per zone type:
+ *   - candidates: zones whose azimuth interval touches the bin
+ *   - covered:    zones that contain the whole bin, so only elevation is tested
+ *
+ * A point query normalises the azimuth once and inspects the handful of
+ * candidates in its bin, independent of the total zone count. The sweep query
+ * answers "does moving from az by deltaAz enter a zone of this type?", which
+ * lets the gimbal decelerate before it reaches a no-traverse boundary.
+ *
+ * A type with more than MaxIndexedZones enabled zones is still answered
+ * correctly, by a linear scan over its compiled intervals.
+ *
+ * distanceToBoundary() serves a per-axis distance field. Zones are axis
+ * aligned, so the set of zones active at an elevation only changes at zone
+ * elevation limits: each elevation band stores the merged azimuth intervals
+ * restricted in it, and each azimuth band the merged elevation intervals.
+ * A query picks its bands by binary search and reads the exact travel to the
+ * nearest boundary in each direction.
+ */
 class ZoneGeometryService
 {
 public:
+    static constexpr int BinCount = 360;            // 1 degree azimuth bins
+    static constexpr int MaxIndexedZones = 64;      // Per type, one bit per zone
+
+    struct SweepHit {
+        bool hit = false;
+        int zoneId = -1;
+        float entryAz = 0.0f;       // Azimuth where the sweep enters the zone, [0, 360)
+        float distanceDeg = 0.0f;   // Travel along the sweep until entry, 0 if already inside
+    };
+
+    struct BoundaryDistance {
+        static constexpr float Unbounded = std::numeric_limits<float>::infinity();
+        bool inside = false;                // Point already in a zone, all distances 0
+        float azIncreasing = Unbounded;     // Azimuth travel to the nearest zone, degrees
+        float azDecreasing = Unbounded;
+        float elUp = Unbounded;             // Elevation travel to the nearest zone, degrees
+        float elDown = Unbounded;
+    };
+
     ZoneGeometryService();
+
+    void rebuild(const std::vector<AreaZone> &zones);
+    void clear();
+
+    bool isPointInZone(ZoneType type, float az, float el) const;
+
+    // Sweep by a signed azimuth travel (positive = clockwise) at constant elevation
+    SweepHit sweep(ZoneType type, float fromAz, float deltaAz, float el) const;
+
+    // Same, for a move whose elevation stays within [minEl, maxEl] (axes driven independently)
+    SweepHit sweepBand(ZoneType type, float fromAz, float deltaAz, float minEl, float maxEl) const;
+
+    // Shortest-path motion from az1 to az2
+    bool segmentEntersZone(ZoneType type, float fromAz, float toAz, float el, SweepHit *hit = nullptr) const;
+
+    // Travel along each axis from (az, el) until a zone of this type is entered
+    BoundaryDistance distanceToBoundary(ZoneType type, float az, float el) const;
+
+    int zoneCount(ZoneType type) const;
+
+    static float normalizeAzimuth(float az);
+
+private:
+    struct CompiledZone {
+        int id = -1;
+        float startAz = 0.0f;       // Normalised to [0, 360)
+        float endAz = 0.0f;
+        bool wraps = false;         // Interval crosses north (start > end)
+        float minEl = 0.0f;
+        float maxEl = 0.0f;
+    };
+
+    struct Interval {
+        float lo = 0.0f;
+        float hi = 0.0f;
+    };
+    using IntervalList = std::vector<Interval>;    // Sorted, merged
+
+    struct TypeIndex {
+        std::vector<CompiledZone> zones;
+        // Distance field: restricted azimuths per elevation band and vice versa
+        std::vector<float> elEdges;             // Band i lies below elEdges[i]
+        std::vector<IntervalList> azRows;       // elEdges.size() + 1 bands
+        std::vector<float> azEdges;             // Band i lies below azEdges[i], band 0 wraps north
+        std::vector<IntervalList> elColumns;    // azEdges.size() bands
+        bool binned = false;        // False when the type exceeds MaxIndexedZones
+        std::array<uint64_t, BinCount> candidates{};
+        std::array<uint64_t, BinCount> covered{};
+    };
+
+    static constexpr int TypeCount = static_cast<int>(ZoneType::TargetReferencePoint) + 1;
+
+    static bool containsAz(const CompiledZone &zone, float az);
+    static bool containsEl(const CompiledZone &zone, float el);
+    static bool coversBin(const CompiledZone &zone, int bin);
+    static bool touchesBin(const CompiledZone &zone, int bin);
+    static int binOf(float normalizedAz);
+    static void mergeIntervals(IntervalList &intervals);
+    static void buildDistanceField(TypeIndex &index);
+
+    void checkSweepCandidate(const CompiledZone &zone, float fromAz, float travel, bool clockwise,
+                             float minEl, float maxEl, SweepHit &best) const;
+    const TypeIndex *indexFor(ZoneType type) const;
+
+    std::array<TypeIndex, TypeCount> m_index;
 };
 
 #endif // ZONEGEOMETRYSERVICE_H
@@ -0,0 +1,690 @@
+#include "zonestore.h"
+
+#include <QByteArrayView>
+#include <QDateTime>
+#include <QDebug>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QSaveFile>
+#include <QtEndian>
+#include <algorithm>
+#include <cstring>
+
+namespace {
+// File header (little-endian):
+//   0  char[4] magic "RZNS"
+//   4  u16     format version
+//   6  u16     header size
+//   8  i32     next area zone id
+//  12  i32     next sector scan id
+//  16  i32     next TRP id
+//  20  u32     snapshot record count
+//  24  u32[2]  reserved
+constexpr char kMagic[4] = {'R', 'Z', 'N', 'S'};
+constexpr int kHeaderSize = 32;
+
+// Record header: u32 checksum (CRC-16 of the rest of the record), u8 op,
+// u8 kind, u16 payload size, then the payload
+constexpr int kRecordHeaderSize = 8;
+
+// Minimum payload sizes (later format revisions may append fields)
+constexpr int kAreaZoneSize = 32;       // + UTF-8 name
+constexpr int kSectorScanSize = 28;
+constexpr int kTrpSize = 24;
+constexpr int kDeleteSize = 4;
+constexpr int kNextIdsSize = 12;
+
+// Compact once the journal holds more records than the snapshot (and at least this many)
+constexpr int kMinRecordsBeforeCompaction = 64;
+
+void setError(QString* error, const QString& message)
+{
+    if (error) *error = message;
+}
+
+// ============================================================================
+// ENCODING
+// ============================================================================
+
+class RecordWriter
+{
+public:
+    explicit RecordWriter(QByteArray* out) : m_out(out) {}
+
+    void begin(ZoneStore::Op op, ZoneStore::Kind kind)
+    {
+        m_start = m_out->size();
+        putU32(0);      // Checksum, filled in by end()
+        putU8(static_cast<quint8>(op));
+        putU8(static_cast<quint8>(kind));
+        putU16(0);      // Payload size, filled in by end()
+    }
+
+    void end()
+    {
+        const qsizetype payloadSize = m_out->size() - m_start - kRecordHeaderSize;
+        char* record = m_out->data() + m_start;
+        qToLittleEndian<quint16>(static_cast<quint16>(payloadSize), record + 6);
+        const quint16 checksum = qChecksum(QByteArrayView(record + 4, 4 + payloadSize));
+        qToLittleEndian<quint32>(checksum, record);
+    }
+
+    void putU8(quint8 v) { m_out->append(static_cast<char>(v)); }
+    void putU16(quint16 v) { put(v); }
+    void putU32(quint32 v) { put(v); }
+    void putI32(qint32 v) { put(v); }
+    void putF32(float v)
+    {
+        quint32 bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        put(bits);
+    }
+    void putBytes(const QByteArray& bytes) { m_out->append(bytes); }
+
+private:
+    template <typename T>
+    void put(T v)
+    {
+        char buffer[sizeof(T)];
+        qToLittleEndian<T>(v, buffer);
+        m_out->append(buffer, sizeof(T));
+    }
+
+    QByteArray* m_out;
+    qsizetype m_start = 0;
+};
+
+void writeHeader(QByteArray* out, const ZoneStore::Snapshot& zones, quint32 snapshotRecords)
+{
+    out->append(kMagic, sizeof(kMagic));
+    char buffer[kHeaderSize - sizeof(kMagic)] = {};
+    qToLittleEndian<quint16>(ZoneStore::FormatVersion, buffer + 0);
+    qToLittleEndian<quint16>(kHeaderSize, buffer + 2);
+    qToLittleEndian<qint32>(zones.nextAreaZoneId, buffer + 4);
+    qToLittleEndian<qint32>(zones.nextSectorScanId, buffer + 8);
+    qToLittleEndian<qint32>(zones.nextTRPId, buffer + 12);
+    qToLittleEndian<quint32>(snapshotRecords, buffer + 16);
+    out->append(buffer, sizeof(buffer));
+}
+
+void writeAreaZone(RecordWriter& w, const AreaZone& zone)
+{
+    const QByteArray name = zone.name.toUtf8().left(0xffff - kAreaZoneSize);
+    w.begin(ZoneStore::Op::Upsert, ZoneStore::Kind::AreaZone);
+    w.putI32(zone.id);
+    w.putU8(static_cast<quint8>(zone.type));
+    w.putU8((zone.isEnabled ? 0x1 : 0) | (zone.isFactorySet ? 0x2 : 0) | (zone.isOverridable ? 0x4 : 0));
+    w.putU16(static_cast<quint16>(name.size()));
+    w.putF32(zone.startAzimuth);
+    w.putF32(zone.endAzimuth);
+    w.putF32(zone.minElevation);
+    w.putF32(zone.maxElevation);
+    w.putF32(zone.minRange);
+    w.putF32(zone.maxRange);
+    w.putBytes(name);
+    w.end();
+}
+
+void writeSectorScan(RecordWriter& w, const AutoSectorScanZone& zone)
+{
+    w.begin(ZoneStore::Op::Upsert, ZoneStore::Kind::SectorScan);
+    w.putI32(zone.id);
+    w.putU8(zone.isEnabled ? 1 : 0);
+    w.putU8(0);
+    w.putU16(0);
+    w.putF32(zone.az1);
+    w.putF32(zone.el1);
+    w.putF32(zone.az2);
+    w.putF32(zone.el2);
+    w.putF32(zone.scanSpeed);
+    w.end();
+}
+
+void writeTrp(RecordWriter& w, const TargetReferencePoint& trp)
+{
+    w.begin(ZoneStore::Op::Upsert, ZoneStore::Kind::TRP);
+    w.putI32(trp.id);
+    w.putI32(trp.locationPage);
+    w.putI32(trp.trpInPage);
+    w.putF32(trp.azimuth);
+    w.putF32(trp.elevation);
+    w.putF32(trp.haltTime);
+    w.end();
+}
+
+void writeDelete(RecordWriter& w, ZoneStore::Kind kind, int id)
+{
+    w.begin(ZoneStore::Op::Delete, kind);
+    w.putI32(id);
+    w.end();
+}
+
+void writeNextIds(RecordWriter& w, const ZoneStore::Snapshot& zones)
+{
+    w.begin(ZoneStore::Op::NextIds, ZoneStore::Kind::None);
+    w.putI32(zones.nextAreaZoneId);
+    w.putI32(zones.nextSectorScanId);
+    w.putI32(zones.nextTRPId);
+    w.end();
+}
+
+// ============================================================================
+// DECODING
+// ============================================================================
+
+qint32 readI32(const uchar* p) { return qFromLittleEndian<qint32>(p); }
+quint16 readU16(const uchar* p) { return qFromLittleEndian<quint16>(p); }
+float readF32(const uchar* p)
+{
+    const quint32 bits = qFromLittleEndian<quint32>(p);
+    float v;
+    std::memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+template <typename T>
+void upsert(std::vector<T>& zones, const T& zone)
+{
+    auto it = std::find_if(zones.begin(), zones.end(), [&](const T& z) { return z.id == zone.id; });
+    if (it != zones.end()) {
+        *it = zone;
+    } else {
+        zones.push_back(zone);
+    }
+}
+
+template <typename T>
+void erase(std::vector<T>& zones, int id)
+{
+    zones.erase(std::remove_if(zones.begin(), zones.end(), [id](const T& z) { return z.id == id; }),
+                zones.end());
+}
+
+// Returns false for a record this version cannot interpret
+bool applyRecord(ZoneStore::Snapshot& zones, ZoneStore::Op op, ZoneStore::Kind kind,
+                 const uchar* p, int size)
+{
+    using Op = ZoneStore::Op;
+    using Kind = ZoneStore::Kind;
+
+    if (op == Op::NextIds) {
+        if (size < kNextIdsSize) return false;
+        zones.nextAreaZoneId = readI32(p);
+        zones.nextSectorScanId = readI32(p + 4);
+        zones.nextTRPId = readI32(p + 8);
+        return true;
+    }
+
+    if (op == Op::Delete) {
+        if (size < kDeleteSize) return false;
+        const int id = readI32(p);
+        switch (kind) {
+        case Kind::AreaZone:   erase(zones.areaZones, id); return true;
+        case Kind::SectorScan: erase(zones.sectorScanZones, id); return true;
+        case Kind::TRP:        erase(zones.targetReferencePoints, id); return true;
+        default:               return false;
+        }
+    }
+
+    if (op != Op::Upsert) return false;
+
+    switch (kind) {
+    case Kind::AreaZone: {
+        if (size < kAreaZoneSize) return false;
+        const int nameSize = readU16(p + 6);
+        if (kAreaZoneSize + nameSize > size) return false;
+        AreaZone zone;
+        zone.id = readI32(p);
+        zone.type = static_cast<ZoneType>(p[4]);
+        zone.isEnabled = p[5] & 0x1;
+        zone.isFactorySet = p[5] & 0x2;
+        zone.isOverridable = p[5] & 0x4;
+        zone.startAzimuth = readF32(p + 8);
+        zone.endAzimuth = readF32(p + 12);
+        zone.minElevation = readF32(p + 16);
+        zone.maxElevation = readF32(p + 20);
+        zone.minRange = readF32(p + 24);
+        zone.maxRange = readF32(p + 28);
+        zone.name = QString::fromUtf8(reinterpret_cast<const char*>(p + kAreaZoneSize), nameSize);
+        upsert(zones.areaZones, zone);
+        return true;
+    }
+    case Kind::SectorScan: {
+        if (size < kSectorScanSize) return false;
+        AutoSectorScanZone zone;
+        zone.id = readI32(p);
+        zone.isEnabled = p[4] != 0;
+        zone.az1 = readF32(p + 8);
+        zone.el1 = readF32(p + 12);
+        zone.az2 = readF32(p + 16);
+        zone.el2 = readF32(p + 20);
+        zone.scanSpeed = readF32(p + 24);
+        upsert(zones.sectorScanZones, zone);
+        return true;
+    }
+    case Kind::TRP: {
+        if (size < kTrpSize) return false;
+        TargetReferencePoint trp;
+        trp.id = readI32(p);
+        trp.locationPage = readI32(p + 4);
+        trp.trpInPage = readI32(p + 8);
+        trp.azimuth = readF32(p + 12);
+        trp.elevation = readF32(p + 16);
+        trp.haltTime = readF32(p + 20);
+        upsert(zones.targetReferencePoints, trp);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+template <typename T>
+const T* findById(const std::vector<T>& zones, int id)
+{
+    auto it = std::find_if(zones.begin(), zones.end(), [id](const T& z) { return z.id == id; });
+    return it != zones.end() ? &(*it) : nullptr;
+}
+}
+
+ZoneStore::ZoneStore(const QString& filePath)
+    : m_filePath(filePath)
+{
+}
+
+// ============================================================================
+// LOAD
+// ============================================================================
+
+ZoneStore::LoadResult ZoneStore::load() const
+{
+    LoadResult result;
+
+    QFile file(m_filePath);
+    if (!file.exists()) {
+        result.ok = true;
+        return result;
+    }
+    result.found = true;
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        result.error = QString("Cannot open %1: %2").arg(m_filePath, file.errorString());
+        return result;
+    }
+
+    const qint64 size = file.size();
+    if (size < kHeaderSize) {
+        result.error = QString("%1 is truncated (%2 bytes)").arg(m_filePath).arg(size);
+        return result;
+    }
+
+    // Walk the records in place; fall back to a read if mapping is not supported
+    QByteArray contents;
+    const uchar* data = file.map(0, size);
+    if (!data) {
+        contents = file.readAll();
+        data = reinterpret_cast<const uchar*>(contents.constData());
+    }
+
+    if (std::memcmp(data, kMagic, sizeof(kMagic)) != 0) {
+        result.error = QString("%1 is not a zone store").arg(m_filePath);
+        return result;
+    }
+    const quint16 version = readU16(data + 4);
+    const quint16 headerSize = readU16(data + 6);
+    if (version > FormatVersion || headerSize < kHeaderSize || headerSize > size) {
+        result.error = QString("%1 has unsupported format version %2").arg(m_filePath).arg(version);
+        return result;
+    }
+
+    Snapshot& zones = result.zones;
+    zones.nextAreaZoneId = readI32(data + 8);
+    zones.nextSectorScanId = readI32(data + 12);
+    zones.nextTRPId = readI32(data + 16);
+    const int snapshotRecords = static_cast<int>(qFromLittleEndian<quint32>(data + 20));
+
+    qint64 offset = headerSize;
+    int records = 0;
+    while (offset + kRecordHeaderSize <= size) {
+        const uchar* record = data + offset;
+        const int payloadSize = readU16(record + 6);
+        if (offset + kRecordHeaderSize + payloadSize > size) {
+            break;  // Torn append
+        }
+        const quint32 checksum = qFromLittleEndian<quint32>(record);
+        if (checksum != qChecksum(QByteArrayView(reinterpret_cast<const char*>(record + 4), 4 + payloadSize))) {
+            break;
+        }
+        if (!applyRecord(zones, static_cast<Op>(record[4]), static_cast<Kind>(record[5]),
+                         record + kRecordHeaderSize, payloadSize)) {
+            qWarning() << "ZoneStore: skipping unknown record" << record[4] << record[5] << "at" << offset;
+        }
+        offset += kRecordHeaderSize + payloadSize;
+        ++records;
+    }
+
+    if (offset != size) {
+        qWarning() << "ZoneStore: ignoring" << (size - offset) << "damaged bytes at the end of"
+                   << m_filePath << "- the file is rewritten on the next save";
+    }
+
+    result.ok = true;
+    result.journalRecords = qMax(0, records - snapshotRecords);
+    result.validSize = offset;
+    return result;
+}
+
+void ZoneStore::attach(const LoadResult& result)
+{
+    if (!result.ok || !result.found) {
+        requestCompaction();
+        return;
+    }
+
+    const Snapshot& zones = result.zones;
+    m_snapshotRecords = static_cast<int>(zones.areaZones.size() + zones.sectorScanZones.size()
+                                         + zones.targetReferencePoints.size());
+    m_journalRecords = result.journalRecords;
+    // A damaged tail makes the size mismatch, so the next save compacts
+    m_fileSize = result.validSize;
+    if (QFile(m_filePath).size() != result.validSize) {
+        requestCompaction();
+    }
+}
+
+QString ZoneStore::moveAside(QString* error)
+{
+    const QString target = QString("%1.corrupt-%2")
+                               .arg(m_filePath, QDateTime::currentDateTime().toString("yyyyMMdd-HHmmss"));
+    // Copy when the rename is refused; the next save replaces the original atomically
+    if (!QFile::rename(m_filePath, target) && !QFile::copy(m_filePath, target)) {
+        setError(error, QString("Cannot move %1 to %2").arg(m_filePath, target));
+        return QString();
+    }
+    requestCompaction();
+    return target;
+}
+
+// ============================================================================
+// WRITE
+// ============================================================================
+
+bool ZoneStore::writeSnapshot(const Snapshot& zones, QString* error)
+{
+    const quint32 records = static_cast<quint32>(zones.areaZones.size() + zones.sectorScanZones.size()
+                                                 + zones.targetReferencePoints.size());
+
+    QByteArray bytes;
+    bytes.reserve(kHeaderSize + static_cast<int>(records) * (kRecordHeaderSize + kAreaZoneSize + 16));
+    writeHeader(&bytes, zones, records);
+
+    RecordWriter w(&bytes);
+    for (const AreaZone& zone : zones.areaZones) writeAreaZone(w, zone);
+    for (const AutoSectorScanZone& zone : zones.sectorScanZones) writeSectorScan(w, zone);
+    for (const TargetReferencePoint& trp : zones.targetReferencePoints) writeTrp(w, trp);
+
+    // Written next to the target and renamed over it on commit()
+    QSaveFile file(m_filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        setError(error, QString("Cannot write %1: %2").arg(m_filePath, file.errorString()));
+        requestCompaction();
+        return false;
+    }
+    if (file.write(bytes) != bytes.size() || !file.commit()) {
+        setError(error, QString("Cannot write %1: %2").arg(m_filePath, file.errorString()));
+        requestCompaction();
+        return false;
+    }
+
+    m_snapshotRecords = static_cast<int>(records);
+    m_journalRecords = 0;
+    m_fileSize = bytes.size();
+    return true;
+}
+
+bool ZoneStore::appendEdits(const Snapshot& zones, const QVector<Edit>& edits, QString* error)
+{
+    if (m_fileSize < 0) {
+        return writeSnapshot(zones, error);
+    }
+    if (edits.isEmpty()) {
+        return true;
+    }
+
+    // +1 for the NextIds record closing the batch
+    const int journalAfter = m_journalRecords + edits.size() + 1;
+    if (journalAfter > qMax(kMinRecordsBeforeCompaction, m_snapshotRecords)) {
+        return writeSnapshot(zones, error);
+    }
+
+    QFile file(m_filePath);
+    if (file.size() != m_fileSize || !file.open(QIODevice::ReadWrite)) {
+        // Missing or changed behind our back: start over from memory
+        return writeSnapshot(zones, error);
+    }
+
+    QByteArray bytes;
+    RecordWriter w(&bytes);
+    for (const Edit& edit : edits) {
+        // The payload is the zone's current state; a zone deleted since is written as a delete
+        bool written = false;
+        if (edit.op == Op::Upsert) {
+            switch (edit.kind) {
+            case Kind::AreaZone:
+                if (const AreaZone* zone = findById(zones.areaZones, edit.id)) {
+                    writeAreaZone(w, *zone);
+                    written = true;
+                }
+                break;
+            case Kind::SectorScan:
+                if (const AutoSectorScanZone* zone = findById(zones.sectorScanZones, edit.id)) {
+                    writeSectorScan(w, *zone);
+                    written = true;
+                }
+                break;
+            case Kind::TRP:
+                if (const TargetReferencePoint* trp = findById(zones.targetReferencePoints, edit.id)) {
+                    writeTrp(w, *trp);
+                    written = true;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+        if (!written && edit.kind != Kind::None) {
+            writeDelete(w, edit.kind, edit.id);
+        }
+    }
+    writeNextIds(w, zones);
+
+    if (!file.seek(m_fileSize) || file.write(bytes) != bytes.size() || !file.flush()) {
+        setError(error, QString("Cannot append to %1: %2").arg(m_filePath, file.errorString()));
+        requestCompaction();
+        return false;
+    }
+
+    m_journalRecords = journalAfter;
+    m_fileSize += bytes.size();
+    return true;
+}
+
+// ============================================================================
+// JSON INTERCHANGE
+// ============================================================================
+
+QJsonObject ZoneStore::toJson(const Snapshot& zones)
+{
+    QJsonObject rootObject;
+    rootObject["zoneFileVersion"] = 1;
+
+    rootObject["nextAreaZoneId"] = zones.nextAreaZoneId;
+    rootObject["nextSectorScanId"] = zones.nextSectorScanId;
+    rootObject["nextTRPId"] = zones.nextTRPId;
+
+    QJsonArray areaZonesArray;
+    for (const auto& zone : zones.areaZones) {
+        QJsonObject zoneObj;
+        zoneObj["id"] = zone.id;
+        zoneObj["type"] = static_cast<int>(zone.type);
+        zoneObj["isEnabled"] = zone.isEnabled;
+        zoneObj["isFactorySet"] = zone.isFactorySet;
+        zoneObj["isOverridable"] = zone.isOverridable;
+        zoneObj["startAzimuth"] = zone.startAzimuth;
+        zoneObj["endAzimuth"] = zone.endAzimuth;
+        zoneObj["minElevation"] = zone.minElevation;
+        zoneObj["maxElevation"] = zone.maxElevation;
+        zoneObj["minRange"] = zone.minRange;
+        zoneObj["maxRange"] = zone.maxRange;
+        zoneObj["name"] = zone.name;
+        areaZonesArray.append(zoneObj);
+    }
+    rootObject["areaZones"] = areaZonesArray;
+
+    QJsonArray sectorScanZonesArray;
+    for (const auto& zone : zones.sectorScanZones) {
+        QJsonObject zoneObj;
+        zoneObj["id"] = zone.id;
+        zoneObj["isEnabled"] = zone.isEnabled;
+        zoneObj["az1"] = zone.az1;
+        zoneObj["el1"] = zone.el1;
+        zoneObj["az2"] = zone.az2;
+        zoneObj["el2"] = zone.el2;
+        zoneObj["scanSpeed"] = zone.scanSpeed;
+        sectorScanZonesArray.append(zoneObj);
+    }
+    rootObject["sectorScanZones"] = sectorScanZonesArray;
+
+    QJsonArray trpsArray;
+    for (const auto& trp : zones.targetReferencePoints) {
+        QJsonObject trpObj;
+        trpObj["id"] = trp.id;
+        trpObj["locationPage"] = trp.locationPage;
+        trpObj["trpInPage"] = trp.trpInPage;
+        trpObj["azimuth"] = trp.azimuth;
+        trpObj["elevation"] = trp.elevation;
+        trpObj["haltTime"] = trp.haltTime;
+        trpsArray.append(trpObj);
+    }
+    rootObject["targetReferencePoints"] = trpsArray;
+
+    return rootObject;
+}
+
+bool ZoneStore::fromJson(const QJsonObject& rootObject, Snapshot* zones, QString* error)
+{
+    const int fileVersion = rootObject.value("zoneFileVersion").toInt(0);
+    if (fileVersion > 1) {
+        qWarning() << "Warning: Loading zones from a newer file version (" << fileVersion << "). Compatibility not guaranteed.";
+    }
+
+    if (!zones) {
+        setError(error, "No output snapshot");
+        return false;
+    }
+
+    Snapshot result;
+    // Use defaults if not present for backward compatibility
+    result.nextAreaZoneId = rootObject.value("nextAreaZoneId").toInt(1);
+    result.nextSectorScanId = rootObject.value("nextSectorScanId").toInt(1);
+    result.nextTRPId = rootObject.value("nextTRPId").toInt(1);
+
+    for (const QJsonValue& value : rootObject.value("areaZones").toArray()) {
+        const QJsonObject zoneObj = value.toObject();
+        AreaZone zone;
+        zone.id = zoneObj.value("id").toInt(-1);
+        zone.type = static_cast<ZoneType>(zoneObj.value("type").toInt(static_cast<int>(ZoneType::Safety)));
+        zone.isEnabled = zoneObj.value("isEnabled").toBool(false);
+        zone.isFactorySet = zoneObj.value("isFactorySet").toBool(false);
+        zone.isOverridable = zoneObj.value("isOverridable").toBool(false);
+        zone.startAzimuth = static_cast<float>(zoneObj.value("startAzimuth").toDouble(0.0));
+        zone.endAzimuth = static_cast<float>(zoneObj.value("endAzimuth").toDouble(0.0));
+        zone.minElevation = static_cast<float>(zoneObj.value("minElevation").toDouble(0.0));
+        zone.maxElevation = static_cast<float>(zoneObj.value("maxElevation").toDouble(0.0));
+        zone.minRange = static_cast<float>(zoneObj.value("minRange").toDouble(0.0));
+        zone.maxRange = static_cast<float>(zoneObj.value("maxRange").toDouble(0.0));
+        zone.name = zoneObj.value("name").toString("");
+
+        if (zone.id != -1) {
+            result.areaZones.push_back(zone);
+        } else {
+            qWarning() << "Skipping invalid AreaZone entry during load (missing or invalid ID).";
+        }
+    }
+
+    for (const QJsonValue& value : rootObject.value("sectorScanZones").toArray()) {
+        const QJsonObject zoneObj = value.toObject();
+        AutoSectorScanZone zone;
+        zone.id = zoneObj.value("id").toInt(-1);
+        zone.isEnabled = zoneObj.value("isEnabled").toBool(false);
+        zone.az1 = static_cast<float>(zoneObj.value("az1").toDouble(0.0));
+        zone.el1 = static_cast<float>(zoneObj.value("el1").toDouble(0.0));
+        zone.az2 = static_cast<float>(zoneObj.value("az2").toDouble(0.0));
+        zone.el2 = static_cast<float>(zoneObj.value("el2").toDouble(0.0));
+        zone.scanSpeed = static_cast<float>(zoneObj.value("scanSpeed").toDouble(50.0));
+
+        if (zone.id != -1) {
+            result.sectorScanZones.push_back(zone);
+        } else {
+            qWarning() << "Skipping invalid SectorScanZone entry during load (missing or invalid ID).";
+        }
+    }
+
+    for (const QJsonValue& value : rootObject.value("targetReferencePoints").toArray()) {
+        const QJsonObject trpObj = value.toObject();
+        TargetReferencePoint trp;
+        trp.id = trpObj.value("id").toInt(-1);
+        trp.locationPage = trpObj.value("locationPage").toInt(1);
+        trp.trpInPage = trpObj.value("trpInPage").toInt(1);
+        trp.azimuth = static_cast<float>(trpObj.value("azimuth").toDouble(0.0));
+        trp.elevation = static_cast<float>(trpObj.value("elevation").toDouble(0.0));
+        trp.haltTime = static_cast<float>(trpObj.value("haltTime").toDouble(0.0));
+
+        if (trp.id != -1) {
+            result.targetReferencePoints.push_back(trp);
+        } else {
+            qWarning() << "Skipping invalid TRP entry during load (missing or invalid ID).";
+        }
+    }
+
+    *zones = std::move(result);
+    return true;
+}
+
+bool ZoneStore::exportJson(const Snapshot& zones, const QString& jsonPath, QString* error)
+{
+    QSaveFile file(jsonPath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        setError(error, QString("Could not open %1 for writing: %2").arg(jsonPath, file.errorString()));
+        return false;
+    }
+    file.write(QJsonDocument(toJson(zones)).toJson(QJsonDocument::Indented));
+    if (!file.commit()) {
+        setError(error, QString("Could not write %1: %2").arg(jsonPath, file.errorString()));
+        return false;
+    }
+    return true;
+}
+
+bool ZoneStore::importJson(const QString& jsonPath, Snapshot* zones, QString* error)
+{
+    QFile file(jsonPath);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        setError(error, QString("Could not open %1 for reading: %2").arg(jsonPath, file.errorString()));
+        return false;
+    }
+
+    QJsonParseError parseError;
+    const QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+    if (parseError.error != QJsonParseError::NoError) {
+        setError(error, QString("Failed to parse %1: %2").arg(jsonPath, parseError.errorString()));
+        return false;
+    }
+    if (!doc.isObject()) {
+        setError(error, QString("Invalid format: root is not a JSON object in %1").arg(jsonPath));
+        return false;
+    }
+
+    return fromJson(doc.object(), zones, error);
+}
@@ -0,0 +1,109 @@
+#ifndef ZONESTORE_H
+#define ZONESTORE_H
+
+#include "models/domain/systemstatedata.h"
+
+#include <QJsonObject>
+#include <QString>
+#include <QVector>
+#include <vector>
+
+/**
+ * @brief Versioned binary store for the area zones, sector scans and TRPs.
+ *
+ * The file is a fixed header followed by a log of little-endian records:
+ * a snapshot (one Upsert per zone) and then a journal of the edits made
+ * since. Saving an edit appends one checksummed record instead of
+ * re-serialising every zone; once the journal grows past the snapshot the
+ * whole file is rewritten (compacted) through QSaveFile, i.e. written to a
+ * temporary file and atomically renamed over the old one.
+ *
+ * load() maps the file and walks the records in place. A record whose
+ * checksum does not match (power lost half way through an append) ends the
+ * log: everything before it is kept and the next save compacts the file.
+ *
+ * zones.json remains the interchange format: toJson()/fromJson() are used by
+ * SystemStateModel::saveZonesToFile()/loadZonesFromFile() and by the
+ * --zones-export / --zones-import command line tool.
+ */
+class ZoneStore
+{
+public:
+    static constexpr quint16 FormatVersion = 1;
+    static constexpr const char* DefaultFilePath = "zones.bin";
+    static constexpr const char* LegacyJsonPath = "zones.json";    // Migrated on first load
+
+    enum class Op : quint8 {
+        Upsert = 1,     // Insert, or replace the zone with the same id
+        Delete = 2,
+        NextIds = 3     // ID counters, written after each batch of edits
+    };
+
+    enum class Kind : quint8 {
+        None = 0,
+        AreaZone = 1,
+        SectorScan = 2,
+        TRP = 3
+    };
+
+    struct Edit {
+        Op op = Op::Upsert;
+        Kind kind = Kind::None;
+        int id = -1;
+    };
+
+    struct Snapshot {
+        std::vector<AreaZone> areaZones;
+        std::vector<AutoSectorScanZone> sectorScanZones;
+        std::vector<TargetReferencePoint> targetReferencePoints;
+        int nextAreaZoneId = 1;
+        int nextSectorScanId = 1;
+        int nextTRPId = 1;
+    };
+
+    struct LoadResult {
+        bool ok = false;
+        bool found = false;         // File existed (a missing store is not an error)
+        Snapshot zones;
+        int journalRecords = 0;     // Records after the snapshot
+        qint64 validSize = 0;       // Bytes up to the last intact record
+        QString error;
+    };
+
+    explicit ZoneStore(const QString& filePath);
+
+    QString filePath() const { return m_filePath; }
+
+    // Reentrant: only reads the file, so it can run on a worker thread
+    LoadResult load() const;
+
+    // Resume appending after a load (possibly done on another thread)
+    void attach(const LoadResult& result);
+
+    // Atomic full rewrite; resets the journal
+    bool writeSnapshot(const Snapshot& zones, QString* error = nullptr);
+
+    // Appends the edits (payloads taken from zones); compacts when due
+    bool appendEdits(const Snapshot& zones, const QVector<Edit>& edits, QString* error = nullptr);
+
+    // Forces the next appendEdits() to rewrite the whole file
+    void requestCompaction() { m_fileSize = -1; }
+
+    // Renames a store that failed to load to <file>.corrupt-<timestamp> (kept for
+    // inspection); the next save starts a new file. Returns the new path, empty on error.
+    QString moveAside(QString* error = nullptr);
+
+    // zones.json interchange format (zoneFileVersion 1)
+    static QJsonObject toJson(const Snapshot& zones);
+    static bool fromJson(const QJsonObject& root, Snapshot* zones, QString* error = nullptr);
+    static bool exportJson(const Snapshot& zones, const QString& jsonPath, QString* error = nullptr);
+    static bool importJson(const QString& jsonPath, Snapshot* zones, QString* error = nullptr);
+
+private:
+    QString m_filePath;
+    int m_snapshotRecords = 0;
+    int m_journalRecords = 0;
+    qint64 m_fileSize = -1;     // Expected size on disk, -1 = unknown (rewrite on next save)
+};
+
+#endif // ZONESTORE_H
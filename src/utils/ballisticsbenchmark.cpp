@@ -0,0 +1,193 @@
+#include "ballisticsbenchmark.h"
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+namespace {
+constexpr double kGravity = 9.80665;
+constexpr float kVacuumCompareFromM = 800.0f;
+constexpr float kCompareStepM = 37.0f;      // Not a multiple of the table step: hits off-node ranges
+constexpr int kReferenceRuns = 20;
+
+struct NamedAtmosphere {
+    const char *name;
+    AtmosphericConditions air;
+};
+
+QJsonObject atmosphereReport(const BallisticsBenchmark::Options &options, const NamedAtmosphere &atmosphere)
+{
+    const AmmunitionProfile &ammo = options.ammunition;
+    const AtmosphericConditions &air = atmosphere.air;
+
+    QJsonObject json;
+    json["temperatureC"] = air.temperatureC;
+    json["pressureHpa"] = air.pressureHpa;
+    json["airDensity"] = air.airDensity();
+    json["densityAltitudeM"] = std::round(air.densityAltitude());
+
+    BallisticTable table;
+    QElapsedTimer timer;
+    timer.start();
+    if (!table.build(ammo, air, options.tableMaxRange, options.tableStep)) {
+        json["error"] = "table build failed";
+        json["pass"] = false;
+        return json;
+    }
+    json["buildUs"] = timer.nsecsElapsed() / 1000.0;
+    json["tableMaxRangeM"] = table.maxRange();
+    json["tableBytes"] = static_cast<qint64>(table.sampleCount() * sizeof(BallisticSolution));
+
+    // --- Accuracy against the reference integration ---
+    double maxTofErrMs = 0.0, maxDropErrMrad = 0.0, maxVelErr = 0.0, maxDriftErrMrad = 0.0;
+    double sumSqDropErrMrad = 0.0;
+    double maxVacuumDropErrMrad = 0.0, maxVacuumTofErrMs = 0.0;
+    int compared = 0;
+    QJsonArray samples;
+    for (float range = kCompareStepM; range <= table.maxRange(); range += kCompareStepM) {
+        BallisticSolution fast, ref;
+        if (!table.lookup(range, fast) ||
+            !ExteriorBallistics::integrateToRange(ammo, air, range, ExteriorBallistics::ReferenceStepS, ref))
+            break;
+
+        const double dropErrMrad = std::abs(fast.dropM - ref.dropM) / range * 1000.0;
+        maxTofErrMs = std::max(maxTofErrMs, std::abs(fast.timeOfFlightS - ref.timeOfFlightS) * 1000.0);
+        maxDropErrMrad = std::max(maxDropErrMrad, dropErrMrad);
+        maxVelErr = std::max(maxVelErr, static_cast<double>(std::abs(fast.velocityMps - ref.velocityMps)));
+        maxDriftErrMrad = std::max(maxDriftErrMrad,
+                                   std::abs(fast.windDriftPerMps - ref.windDriftPerMps) / range * 1000.0);
+        sumSqDropErrMrad += dropErrMrad * dropErrMrad;
+        ++compared;
+
+        if (range >= kVacuumCompareFromM) {
+            const double vacuumTof = range / ammo.muzzleVelocityMps;
+            const double vacuumDrop = 0.5 * kGravity * vacuumTof * vacuumTof;
+            maxVacuumTofErrMs = std::max(maxVacuumTofErrMs, std::abs(vacuumTof - ref.timeOfFlightS) * 1000.0);
+            maxVacuumDropErrMrad = std::max(maxVacuumDropErrMrad, std::abs(vacuumDrop - ref.dropM) / range * 1000.0);
+        }
+
+        // A coarse trajectory card in the report, every ~500 m
+        if (compared % 14 == 0) {
+            QJsonObject sample;
+            sample["rangeM"] = range;
+            sample["tofS"] = ref.timeOfFlightS;
+            sample["dropM"] = ref.dropM;
+            sample["velocityMps"] = ref.velocityMps;
+            sample["windDriftPerMps"] = ref.windDriftPerMps;
+            samples.append(sample);
+        }
+    }
+
+    QJsonObject accuracy;
+    accuracy["comparedRanges"] = compared;
+    accuracy["maxTofErrorMs"] = maxTofErrMs;
+    accuracy["maxDropErrorMrad"] = maxDropErrMrad;
+    accuracy["rmsDropErrorMrad"] = compared > 0 ? std::sqrt(sumSqDropErrMrad / compared) : 0.0;
+    accuracy["maxVelocityErrorMps"] = maxVelErr;
+    accuracy["maxWindDriftErrorMradPerMps"] = maxDriftErrMrad;
+    accuracy["vacuumMaxTofErrorMsBeyond800m"] = maxVacuumTofErrMs;
+    accuracy["vacuumMaxDropErrorMradBeyond800m"] = maxVacuumDropErrMrad;
+    json["accuracy"] = accuracy;
+    json["trajectory"] = samples;
+
+    // --- Speed: table lookups vs. reference integration ---
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> rangeDist(50.0f, table.maxRange());
+    std::vector<float> ranges(4096);
+    for (float &r : ranges)
+        r = rangeDist(rng);
+
+    volatile float sink = 0.0f;
+    BallisticSolution out;
+    timer.restart();
+    for (int i = 0; i < options.lookups; ++i) {
+        table.lookup(ranges[i & 4095], out);
+        sink = sink + out.timeOfFlightS;
+    }
+    const double lookupNs = options.lookups > 0 ? static_cast<double>(timer.nsecsElapsed()) / options.lookups : 0.0;
+
+    timer.restart();
+    for (int i = 0; i < kReferenceRuns; ++i) {
+        ExteriorBallistics::integrateToRange(ammo, air, ranges[i], ExteriorBallistics::BuildStepS, out);
+        sink = sink + out.timeOfFlightS;
+    }
+    const double integrateUs = timer.nsecsElapsed() / 1000.0 / kReferenceRuns;
+
+    QJsonObject speed;
+    speed["lookupNs"] = lookupNs;
+    speed["integrationPerQueryUs"] = integrateUs;   // Same step as the table build
+    speed["speedup"] = lookupNs > 0.0 ? integrateUs * 1000.0 / lookupNs : 0.0;
+    json["speed"] = speed;
+
+    json["pass"] = compared > 0 &&
+                   maxTofErrMs <= BallisticsBenchmark::MaxTofErrorMs &&
+                   maxDropErrMrad <= BallisticsBenchmark::MaxDropErrorMrad;
+    return json;
+}
+}
+
+QJsonObject BallisticsBenchmark::run(const Options &options)
+{
+    const NamedAtmosphere atmospheres[] = {
+        {"standard", {15.0f, 1013.25f}},
+        {"hotHigh", {40.0f, 850.0f}},
+        {"cold", {-30.0f, 1030.0f}},
+    };
+
+    QJsonObject json;
+    json["dragModel"] = options.ammunition.dragModel == DragModel::G1 ? "G1" : "G7";
+    json["ballisticCoefficient"] = options.ammunition.ballisticCoefficient;
+    json["muzzleVelocityMps"] = options.ammunition.muzzleVelocityMps;
+    json["tableStepM"] = options.tableStep;
+    json["referenceStepS"] = ExteriorBallistics::ReferenceStepS;
+
+    bool pass = true;
+    QJsonObject results;
+    for (const NamedAtmosphere &atmosphere : atmospheres) {
+        const QJsonObject result = atmosphereReport(options, atmosphere);
+        pass &= result["pass"].toBool();
+        results[atmosphere.name] = result;
+
+        const QJsonObject accuracy = result["accuracy"].toObject();
+        const QJsonObject speed = result["speed"].toObject();
+        qInfo().noquote() << QString("BallisticsBenchmark: %1 | DA %2 m | lookup %3 ns vs integrate %4 us | "
+                                     "max err TOF %5 ms drop %6 mrad | vacuum drop err >800 m %7 mrad")
+                                 .arg(atmosphere.name)
+                                 .arg(result["densityAltitudeM"].toDouble(), 0, 'f', 0)
+                                 .arg(speed["lookupNs"].toDouble(), 0, 'f', 1)
+                                 .arg(speed["integrationPerQueryUs"].toDouble(), 0, 'f', 1)
+                                 .arg(accuracy["maxTofErrorMs"].toDouble(), 0, 'f', 3)
+                                 .arg(accuracy["maxDropErrorMrad"].toDouble(), 0, 'f', 4)
+                                 .arg(accuracy["vacuumMaxDropErrorMradBeyond800m"].toDouble(), 0, 'f', 1);
+    }
+    json["atmospheres"] = results;
+    json["pass"] = pass;
+    return json;
+}
+
+int BallisticsBenchmark::writeReport(const QJsonObject &report, const QString &path)
+{
+    const int exitCode = report["pass"].toBool() ? 0 : 1;
+    const QByteArray document = QJsonDocument(report).toJson(QJsonDocument::Indented);
+    if (path.isEmpty()) {
+        std::fwrite(document.constData(), 1, static_cast<size_t>(document.size()), stdout);
+        std::fflush(stdout);
+        return exitCode;
+    }
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "BallisticsBenchmark: Cannot write report to" << path;
+        return 2;
+    }
+    file.write(document);
+    qInfo() << "BallisticsBenchmark: Report written to" << path;
+    return exitCode;
+}
@@ -0,0 +1,38 @@
+#ifndef BALLISTICSBENCHMARK_H
+#define BALLISTICSBENCHMARK_H
+
+#include <QJsonObject>
+#include <QString>
+
+#include "utils/ballisticstable.h"
+
+/**
+ * @brief Speed and accuracy report for the drag-model range tables.
+ *
+ * For a set of atmospheres (standard, hot/high, cold) the table for the given
+ * ammunition is compared against a fine-step RK4 reference integration at
+ * off-node ranges, and timed against it. The old vacuum model's error is
+ * reported alongside for ranges beyond 800 m.
+ */
+class BallisticsBenchmark
+{
+public:
+    struct Options {
+        AmmunitionProfile ammunition;
+        float tableMaxRange = 2500.0f;
+        float tableStep = 10.0f;
+        int lookups = 1000000;          // Timed table lookups per atmosphere
+        QString reportPath;             // Empty = print to stdout
+    };
+
+    // Accuracy gate for the report's "pass" flag
+    static constexpr double MaxTofErrorMs = 1.0;
+    static constexpr double MaxDropErrorMrad = 0.05;
+
+    static QJsonObject run(const Options &options);
+
+    // Writes the report and returns the process exit code (non-zero if the gate failed)
+    static int writeReport(const QJsonObject &report, const QString &path);
+};
+
+#endif // BALLISTICSBENCHMARK_H
@@ -1,12 +1,56 @@
 #include "ballisticsprocessor.h"
+#include "controllers/deviceconfiguration.h"
 
 #include <cmath>
 #include <QDebug>
+#include <QElapsedTimer>
 
 
 const float GRAVITY_MPS2 = 9.80665f; // Standard gravity
 
-BallisticsProcessor::BallisticsProcessor() {}
+BallisticsProcessor::BallisticsProcessor() {
+    const auto& cfg = DeviceConfiguration::ballistics();
+    m_tableMaxRange = cfg.tableMaxRange;
+    m_tableStep = cfg.tableStep;
+}
+
+bool BallisticsProcessor::updateConditions(const AmmunitionProfile &ammo, const AtmosphericConditions &air)
+{
+    if (m_table.isValid() && sameConditions(m_table.ammunition(), m_table.atmosphere(), ammo, air)) {
+        return false;
+    }
+    if (m_buildFailed && sameConditions(m_failedAmmo, m_failedAir, ammo, air)) {
+        return false;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    if (!m_table.build(ammo, air, m_tableMaxRange, m_tableStep)) {
+        qWarning() << "Ballistics: Failed to build range table, using vacuum model."
+                   << "MV:" << ammo.muzzleVelocityMps << "BC:" << ammo.ballisticCoefficient;
+        m_buildFailed = true;
+        m_failedAmmo = ammo;
+        m_failedAir = air;
+        return true;
+    }
+    m_buildFailed = false;
+    qInfo() << "Ballistics: Range table built in" << timer.nsecsElapsed() / 1000 << "us |"
+            << (ammo.dragModel == DragModel::G1 ? "G1" : "G7") << "BC" << ammo.ballisticCoefficient
+            << "MV" << ammo.muzzleVelocityMps << "m/s |" << air.temperatureC << "C" << air.pressureHpa << "hPa"
+            << "| density altitude" << qRound(air.densityAltitude()) << "m |"
+            << m_table.sampleCount() << "samples to" << m_table.maxRange() << "m";
+    return true;
+}
+
+bool BallisticsProcessor::sameConditions(const AmmunitionProfile &ammoA, const AtmosphericConditions &airA,
+                                         const AmmunitionProfile &ammoB, const AtmosphericConditions &airB)
+{
+    return ammoA.dragModel == ammoB.dragModel &&
+           qFuzzyCompare(ammoA.ballisticCoefficient, ammoB.ballisticCoefficient) &&
+           std::abs(ammoA.muzzleVelocityMps - ammoB.muzzleVelocityMps) < REBUILD_MUZZLE_VELOCITY_MPS &&
+           std::abs(airA.temperatureC - airB.temperatureC) < REBUILD_TEMPERATURE_C &&
+           std::abs(airA.pressureHpa - airB.pressureHpa) < REBUILD_PRESSURE_HPA;
+}
 
 LeadCalculationResult BallisticsProcessor::calculateLeadAngle(
     float targetRangeMeters,
@@ -14,7 +58,8 @@ LeadCalculationResult BallisticsProcessor::calculateLeadAngle(
     float targetAngularRateElDegS,
     float currentMuzzleVelocityMPS, // Now we might use this for a better TOF
     float projectileTimeOfFlightGuessS, // Still useful as an initial guess or if accurately provided
-    float currentCameraFovHorizontalDegrees)
+    float currentCameraFovHorizontalDegrees,
+    float crosswindMps)
 {
     LeadCalculationResult result;
     result.status = LeadAngleStatus::On; // Default to On if calculation proceeds
@@ -24,17 +69,28 @@ LeadCalculationResult BallisticsProcessor::calculateLeadAngle(
         return result;
     }
 
-    // --- Time of Flight (TOF) ---
-    // If projectileTimeOfFlightGuessS is not provided accurately, calculate a basic one.
-    // This is still very simplified as it ignores drag.
-    float tofS = projectileTimeOfFlightGuessS;
-    if (tofS <= 0.0f && currentMuzzleVelocityMPS > 0.0f) {
-        tofS = targetRangeMeters / currentMuzzleVelocityMPS;
+    // --- Time of Flight (TOF) and Drop ---
+    // Drag-model table when available (constant-time lookup), otherwise the
+    // vacuum model: TOF = range / muzzle velocity, drop = 0.5 * g * TOF^2.
+    BallisticSolution solution;
+    float tofS = 0.0f;
+    float projectileDropMeters = 0.0f;
+    if (m_table.lookup(targetRangeMeters, solution)) {
+        tofS = solution.timeOfFlightS;
+        projectileDropMeters = solution.dropM;
+        result.dragModelApplied = true;
+    } else {
+        tofS = projectileTimeOfFlightGuessS;
+        if (tofS <= 0.0f && currentMuzzleVelocityMPS > 0.0f) {
+            tofS = targetRangeMeters / currentMuzzleVelocityMPS;
+        }
+        projectileDropMeters = 0.5f * GRAVITY_MPS2 * tofS * tofS;
     }
     if (tofS <= 0.0f) { // Still no valid TOF
         result.status = LeadAngleStatus::Off;
         return result;
     }
+    result.timeOfFlightS = tofS;
 
     // --- Lead for Target Motion ---
     float targetAngularRateAzRadS = targetAngularRateAzDegS * (M_PI / 180.0);
@@ -44,19 +100,24 @@ LeadCalculationResult BallisticsProcessor::calculateLeadAngle(
     float motionLeadElRad = targetAngularRateElRadS * tofS;
 
     // --- Lead for Projectile Drop (Gravity) ---
-    // Simple calculation ignoring air resistance. Weapon bore must be elevated.
-    // Drop (meters) = 0.5 * g * TOF^2
+    // Weapon bore must be elevated.
     // Elevation angle (radians) to compensate for drop = atan(drop / range_horizontal)
     // Assuming targetRangeMeters is slant range, for very flat trajectories horizontal_range ~ slant_range.
-    float projectileDropMeters = 0.5f * GRAVITY_MPS2 * tofS * tofS;
     float dropCompensationElRad = 0.0f;
     if (targetRangeMeters > 0.1f) { // Avoid division by zero
         dropCompensationElRad = std::atan(projectileDropMeters / targetRangeMeters);
     }
 
+    // --- Crosswind Drift ---
+    // Wind from the right pushes the round left, so aim right (positive Az).
+    float windCompensationAzRad = 0.0f;
+    if (result.dragModelApplied && crosswindMps != 0.0f) {
+        windCompensationAzRad = std::atan(crosswindMps * solution.windDriftPerMps / targetRangeMeters);
+    }
+
     // --- Total Lead ---
-    // Azimuth lead is only from target motion (in this simplified model)
-    float totalLeadAzRad = motionLeadAzRad;
+    // Azimuth lead is target motion plus crosswind drift
+    float totalLeadAzRad = motionLeadAzRad + windCompensationAzRad;
     // Elevation lead is motion lead + compensation for projectile drop
     // If target is moving upwards (positive motionLeadElRad), we need to lead even higher.
     // Drop compensation always means aiming higher.
@@ -66,7 +127,52 @@ LeadCalculationResult BallisticsProcessor::calculateLeadAngle(
     result.leadAzimuthDegrees = static_cast<float>(totalLeadAzRad * (180.0 / M_PI));
     result.leadElevationDegrees = static_cast<float>(totalLeadElRad * (180.0 / M_PI));
 
-    // --- Apply Limits and Status ---
+    applyLimitsAndStatus(result, currentCameraFovHorizontalDegrees);
+
+    qDebug() << "Ballistics: R:" << targetRangeMeters << "TOF:" << tofS
+             << (result.dragModelApplied ? "(drag)" : "(vacuum)")
+             << "Rates Az:" << targetAngularRateAzDegS << "El:" << targetAngularRateElDegS
+             << "DropCompElRad:" << dropCompensationElRad
+             << "=> Lead Az:" << result.leadAzimuthDegrees << "El:" << result.leadElevationDegrees
+             << "Status:" << static_cast<int>(result.status);
+
+    return result;
+}
+
+LeadCalculationResult BallisticsProcessor::calculateInterceptLead(
+    const InterceptSolution &intercept,
+    float currentCameraFovHorizontalDegrees,
+    float crosswindMps)
+{
+    LeadCalculationResult result;
+    result.interceptStatus = intercept.status;
+
+    BallisticSolution solution;
+    if ((intercept.status != InterceptStatus::Converged && intercept.status != InterceptStatus::IterationLimit) ||
+        intercept.interceptRangeM <= 0.1f ||
+        !m_table.lookup(intercept.interceptRangeM, solution)) {
+        result.status = LeadAngleStatus::Off;
+        return result;
+    }
+
+    result.status = LeadAngleStatus::On;
+    result.dragModelApplied = true;
+    result.timeOfFlightS = intercept.timeOfFlightS;
+
+    // Motion lead comes straight from the predicted aim point; drop and drift at the intercept range
+    const float dropCompensationElDeg = static_cast<float>(std::atan(solution.dropM / intercept.interceptRangeM) * (180.0 / M_PI));
+    const float windCompensationAzDeg = static_cast<float>(
+        std::atan(crosswindMps * solution.windDriftPerMps / intercept.interceptRangeM) * (180.0 / M_PI));
+
+    result.leadAzimuthDegrees = intercept.leadAzDeg + windCompensationAzDeg;
+    result.leadElevationDegrees = intercept.leadElDeg + dropCompensationElDeg;
+
+    applyLimitsAndStatus(result, currentCameraFovHorizontalDegrees);
+    return result;
+}
+
+void BallisticsProcessor::applyLimitsAndStatus(LeadCalculationResult &result, float currentCameraFovHorizontalDegrees) const
+{
     bool lag = false;
     if (std::abs(result.leadAzimuthDegrees) > MAX_LEAD_ANGLE_DEGREES) {
         result.leadAzimuthDegrees = std::copysign(MAX_LEAD_ANGLE_DEGREES, result.leadAzimuthDegrees);
@@ -93,12 +199,4 @@ LeadCalculationResult BallisticsProcessor::calculateLeadAngle(
              }
         }
     }
-
-    qDebug() << "Ballistics: R:" << targetRangeMeters << "TOF:" << tofS
-             << "Rates Az:" << targetAngularRateAzDegS << "El:" << targetAngularRateElDegS
-             << "DropCompElRad:" << dropCompensationElRad
-             << "=> Lead Az:" << result.leadAzimuthDegrees << "El:" << result.leadElevationDegrees
-             << "Status:" << static_cast<int>(result.status);
-
-    return result;
 }
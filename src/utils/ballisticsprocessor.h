@@ -2,10 +2,11 @@
 #define BALLISTICSPROCESSOR_H
 
 #include "models/domain/systemstatemodel.h"
+#include "utils/ballisticstable.h"
+#include "utils/interceptsolver.h"
 
 // Forward declare if SystemStateData is complex or to reduce includes
 // struct SystemStateData;
-// enum class AmmunitionType;
 
  
 struct LeadCalculationResult {
@@ -13,30 +14,61 @@ struct LeadCalculationResult {
     float leadElevationDegrees = 0.0f; // The calculated lead offset in Elevation (degrees)
                                        // (This might include bullet drop + moving target lead)
     LeadAngleStatus status     = LeadAngleStatus::Off; // Status of the calculation
+    float timeOfFlightS        = 0.0f; // Time of flight used for the solution
+    bool  dragModelApplied     = false; // false = vacuum fallback (no table, or beyond table range)
+    InterceptStatus interceptStatus = InterceptStatus::NoTarget; // Only set by calculateInterceptLead()
 };
 class BallisticsProcessor
 {
 public:
     BallisticsProcessor();
 
+    // Rebuilds the range table when the ammunition or the air has changed enough
+    // to matter. Cheap to call every update; returns true if a rebuild happened.
+    // After a failed build the same conditions are not retried until they change.
+    bool updateConditions(const AmmunitionProfile &ammo, const AtmosphericConditions &air);
+    const BallisticTable &table() const { return m_table; }
+
     // Calculates lead based on current target and system parameters
     LeadCalculationResult calculateLeadAngle(
         float targetRangeMeters,
         float targetAngularRateAzDegS, // Relative angular rate of target AZ
         float targetAngularRateElDegS, // Relative angular rate of target EL
-        // AmmunitionType ammoType, // Requires ammo parameters (e.g., muzzle velocity, BC)
-        float currentMuzzleVelocityMPS, // Example input
-        float projectileTimeOfFlightGuessS, // An initial guess, can be iterative
-        float currentCameraFovHorizontalDegrees // Needed for ZOOM_OUT check
+        float currentMuzzleVelocityMPS, // Used for the vacuum fallback only
+        float projectileTimeOfFlightGuessS, // Used for the vacuum fallback only
+        float currentCameraFovHorizontalDegrees, // Needed for ZOOM_OUT check
+        float crosswindMps = 0.0f // Positive = wind from the right
+    );
+
+    // Lead from a solved intercept: motion lead from the predicted aim point,
+    // drop and drift at the intercept range. Falls back to Off when unsolved.
+    LeadCalculationResult calculateInterceptLead(
+        const InterceptSolution &intercept,
+        float currentCameraFovHorizontalDegrees,
+        float crosswindMps = 0.0f
     );
 
 private:
+    void applyLimitsAndStatus(LeadCalculationResult &result, float currentCameraFovHorizontalDegrees) const;
+    static bool sameConditions(const AmmunitionProfile &ammoA, const AtmosphericConditions &airA,
+                               const AmmunitionProfile &ammoB, const AtmosphericConditions &airB);
+
+    // Rebuild thresholds for updateConditions()
+    static constexpr float REBUILD_TEMPERATURE_C = 1.0f;
+    static constexpr float REBUILD_PRESSURE_HPA = 2.0f;
+    static constexpr float REBUILD_MUZZLE_VELOCITY_MPS = 1.0f;
+
+    BallisticTable m_table;
+    float m_tableMaxRange = 2500.0f;
+    float m_tableStep = 10.0f;
+
+    // Inputs of the last failed build (vacuum model in use until they change)
+    bool m_buildFailed = false;
+    AmmunitionProfile m_failedAmmo;
+    AtmosphericConditions m_failedAir;
+
     // Constants for calculation (simplified)
     const float MAX_LEAD_ANGLE_DEGREES = 10.0f; // Example maximum lead allowed
-
-    // Helper methods for more complex ballistics if needed
-    // float calculateTOF(float range, float muzzleVelocity, float projectileDragCoeff);
-    // Point2D predictTargetPosition(float currentRange, float angularRateAz, float angularRateEl, float tof);
 };
 
 #endif // BALLISTICSPROCESSOR_H
@@ -0,0 +1,266 @@
+#include "ballisticstable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace {
+
+constexpr double kGravity = 9.80665;
+constexpr double kGasConstantDryAir = 287.05;     // J/(kg·K)
+constexpr double kHeatCapacityRatio = 1.4;
+constexpr double kStdDensity = 1.225;             // kg/m³ at 15 °C, 1013.25 hPa
+constexpr double kLbPerIn2ToKgPerM2 = 703.0696;
+constexpr double kMaxFlightTimeS = 15.0;
+constexpr double kMinVelocityMps = 80.0;
+
+struct MachCd {
+    double mach;
+    double cd;
+};
+
+// Standard G1 drag function (Ingalls/BRL reference projectile)
+constexpr MachCd kG1[] = {
+    {0.000, 0.2629}, {0.050, 0.2558}, {0.100, 0.2487}, {0.150, 0.2413}, {0.200, 0.2344},
+    {0.250, 0.2278}, {0.300, 0.2214}, {0.350, 0.2155}, {0.400, 0.2104}, {0.450, 0.2061},
+    {0.500, 0.2032}, {0.550, 0.2020}, {0.600, 0.2034}, {0.700, 0.2165}, {0.725, 0.2230},
+    {0.750, 0.2313}, {0.775, 0.2417}, {0.800, 0.2546}, {0.825, 0.2706}, {0.850, 0.2901},
+    {0.875, 0.3136}, {0.900, 0.3415}, {0.925, 0.3734}, {0.950, 0.4084}, {0.975, 0.4448},
+    {1.000, 0.4805}, {1.025, 0.5136}, {1.050, 0.5427}, {1.075, 0.5677}, {1.100, 0.5883},
+    {1.125, 0.6053}, {1.150, 0.6191}, {1.200, 0.6393}, {1.250, 0.6518}, {1.300, 0.6589},
+    {1.350, 0.6621}, {1.400, 0.6625}, {1.450, 0.6607}, {1.500, 0.6573}, {1.550, 0.6528},
+    {1.600, 0.6474}, {1.650, 0.6413}, {1.700, 0.6347}, {1.750, 0.6280}, {1.800, 0.6210},
+    {1.850, 0.6141}, {1.900, 0.6072}, {1.950, 0.6003}, {2.000, 0.5934}, {2.050, 0.5867},
+    {2.100, 0.5804}, {2.150, 0.5743}, {2.200, 0.5685}, {2.250, 0.5630}, {2.300, 0.5577},
+    {2.350, 0.5527}, {2.400, 0.5481}, {2.450, 0.5438}, {2.500, 0.5397}, {2.600, 0.5325},
+    {2.700, 0.5264}, {2.800, 0.5211}, {2.900, 0.5168}, {3.000, 0.5133}, {3.100, 0.5105},
+    {3.200, 0.5084}, {3.300, 0.5067}, {3.400, 0.5054}, {3.500, 0.5040}, {3.600, 0.5030},
+    {3.700, 0.5022}, {3.800, 0.5016}, {3.900, 0.5010}, {4.000, 0.5006}, {4.200, 0.4998},
+    {4.400, 0.4995}, {4.600, 0.4992}, {4.800, 0.4990}, {5.000, 0.4988},
+};
+
+// Standard G7 drag function (long boat-tail reference projectile)
+constexpr MachCd kG7[] = {
+    {0.000, 0.1198}, {0.050, 0.1197}, {0.100, 0.1196}, {0.150, 0.1194}, {0.200, 0.1193},
+    {0.250, 0.1194}, {0.300, 0.1194}, {0.350, 0.1194}, {0.400, 0.1193}, {0.450, 0.1193},
+    {0.500, 0.1194}, {0.550, 0.1193}, {0.600, 0.1194}, {0.650, 0.1197}, {0.700, 0.1202},
+    {0.725, 0.1207}, {0.750, 0.1215}, {0.775, 0.1226}, {0.800, 0.1242}, {0.825, 0.1266},
+    {0.850, 0.1306}, {0.875, 0.1368}, {0.900, 0.1464}, {0.925, 0.1660}, {0.950, 0.2054},
+    {0.975, 0.2993}, {1.000, 0.3803}, {1.025, 0.4015}, {1.050, 0.4043}, {1.075, 0.4034},
+    {1.100, 0.4014}, {1.125, 0.3987}, {1.150, 0.3955}, {1.200, 0.3884}, {1.250, 0.3810},
+    {1.300, 0.3732}, {1.350, 0.3657}, {1.400, 0.3580}, {1.500, 0.3440}, {1.550, 0.3376},
+    {1.600, 0.3315}, {1.650, 0.3260}, {1.700, 0.3209}, {1.750, 0.3160}, {1.800, 0.3117},
+    {1.850, 0.3078}, {1.900, 0.3042}, {1.950, 0.3010}, {2.000, 0.2980}, {2.050, 0.2951},
+    {2.100, 0.2922}, {2.150, 0.2892}, {2.200, 0.2864}, {2.250, 0.2835}, {2.300, 0.2807},
+    {2.350, 0.2779}, {2.400, 0.2752}, {2.450, 0.2725}, {2.500, 0.2697}, {2.550, 0.2670},
+    {2.600, 0.2643}, {2.650, 0.2615}, {2.700, 0.2588}, {2.750, 0.2561}, {2.800, 0.2533},
+    {2.850, 0.2506}, {2.900, 0.2479}, {2.950, 0.2451}, {3.000, 0.2424}, {3.100, 0.2368},
+    {3.200, 0.2313}, {3.300, 0.2258}, {3.400, 0.2205}, {3.500, 0.2154}, {3.600, 0.2106},
+    {3.700, 0.2060}, {3.800, 0.2017}, {3.900, 0.1975}, {4.000, 0.1935}, {4.200, 0.1861},
+    {4.400, 0.1793}, {4.600, 0.1730}, {4.800, 0.1672}, {5.000, 0.1618},
+};
+
+template <size_t N>
+double interpolateCd(const MachCd (&table)[N], double mach)
+{
+    if (mach <= table[0].mach)
+        return table[0].cd;
+    if (mach >= table[N - 1].mach)
+        return table[N - 1].cd;
+    const MachCd *hi = std::upper_bound(std::begin(table), std::end(table), mach,
+                                        [](double m, const MachCd &e) { return m < e.mach; });
+    const MachCd *lo = hi - 1;
+    const double t = (mach - lo->mach) / (hi->mach - lo->mach);
+    return lo->cd + t * (hi->cd - lo->cd);
+}
+
+// Planar point-mass state: x downrange, y up, fired horizontally from the origin
+struct State {
+    double x, y, vx, vy;
+};
+
+class Trajectory
+{
+public:
+    Trajectory(const AmmunitionProfile &ammo, const AtmosphericConditions &air)
+        : m_model(ammo.dragModel),
+          m_invSpeedOfSound(1.0 / air.speedOfSound()),
+          // a_drag = rho * v² * Cd(M) * pi / (8 * BC)   with BC in kg/m²
+          m_dragFactor(air.airDensity() * M_PI / (8.0 * ammo.ballisticCoefficient * kLbPerIn2ToKgPerM2)),
+          m_state{0.0, 0.0, ammo.muzzleVelocityMps, 0.0}
+    {
+    }
+
+    const State &state() const { return m_state; }
+    double time() const { return m_time; }
+
+    void step(double dt)
+    {
+        const State k1 = derivative(m_state);
+        const State k2 = derivative(advance(m_state, k1, dt * 0.5));
+        const State k3 = derivative(advance(m_state, k2, dt * 0.5));
+        const State k4 = derivative(advance(m_state, k3, dt));
+        m_state.x  += dt / 6.0 * (k1.x  + 2.0 * k2.x  + 2.0 * k3.x  + k4.x);
+        m_state.y  += dt / 6.0 * (k1.y  + 2.0 * k2.y  + 2.0 * k3.y  + k4.y);
+        m_state.vx += dt / 6.0 * (k1.vx + 2.0 * k2.vx + 2.0 * k3.vx + k4.vx);
+        m_state.vy += dt / 6.0 * (k1.vy + 2.0 * k2.vy + 2.0 * k3.vy + k4.vy);
+        m_time += dt;
+    }
+
+    bool exhausted() const
+    {
+        return m_time > kMaxFlightTimeS || m_state.vx < kMinVelocityMps;
+    }
+
+private:
+    static State advance(const State &s, const State &d, double dt)
+    {
+        return {s.x + d.x * dt, s.y + d.y * dt, s.vx + d.vx * dt, s.vy + d.vy * dt};
+    }
+
+    State derivative(const State &s) const
+    {
+        const double v = std::hypot(s.vx, s.vy);
+        const double k = m_dragFactor * ExteriorBallistics::dragCoefficient(m_model, v * m_invSpeedOfSound) * v;
+        return {s.vx, s.vy, -k * s.vx, -k * s.vy - kGravity};
+    }
+
+    DragModel m_model;
+    double m_invSpeedOfSound;
+    double m_dragFactor;
+    State m_state;
+    double m_time = 0.0;
+};
+
+// Solution at rangeM, interpolated inside the last step [prev, cur]
+BallisticSolution solutionBetween(const State &prev, double prevTime, const State &cur, double curTime,
+                                  double rangeM, double muzzleVelocity)
+{
+    const double f = (rangeM - prev.x) / (cur.x - prev.x);
+    const double t = prevTime + f * (curTime - prevTime);
+    const double y = prev.y + f * (cur.y - prev.y);
+    const double v0 = std::hypot(prev.vx, prev.vy);
+    const double v1 = std::hypot(cur.vx, cur.vy);
+
+    BallisticSolution s;
+    s.timeOfFlightS = static_cast<float>(t);
+    s.dropM = static_cast<float>(-y);
+    // Didion's lag rule: crosswind drift = W * (TOF - range / V0)
+    s.windDriftPerMps = static_cast<float>(std::max(0.0, t - rangeM / muzzleVelocity));
+    s.velocityMps = static_cast<float>(v0 + f * (v1 - v0));
+    return s;
+}
+
+} // namespace
+
+double AtmosphericConditions::airDensity() const
+{
+    return (pressureHpa * 100.0) / (kGasConstantDryAir * (temperatureC + 273.15));
+}
+
+double AtmosphericConditions::speedOfSound() const
+{
+    return std::sqrt(kHeatCapacityRatio * kGasConstantDryAir * (temperatureC + 273.15));
+}
+
+double AtmosphericConditions::densityAltitude() const
+{
+    // ICAO troposphere: rho/rho0 = (1 - h / 44330.8)^(1 / 0.234969)
+    return 44330.8 * (1.0 - std::pow(airDensity() / kStdDensity, 0.234969));
+}
+
+double ExteriorBallistics::dragCoefficient(DragModel model, double mach)
+{
+    return model == DragModel::G1 ? interpolateCd(kG1, mach) : interpolateCd(kG7, mach);
+}
+
+bool ExteriorBallistics::integrateToRange(const AmmunitionProfile &ammo, const AtmosphericConditions &air,
+                                          double rangeM, double stepS, BallisticSolution &out)
+{
+    if (rangeM <= 0.0 || ammo.muzzleVelocityMps <= 0.0f || ammo.ballisticCoefficient <= 0.0f)
+        return false;
+
+    Trajectory trajectory(ammo, air);
+    while (!trajectory.exhausted()) {
+        const State prev = trajectory.state();
+        const double prevTime = trajectory.time();
+        trajectory.step(stepS);
+        if (trajectory.state().x >= rangeM) {
+            out = solutionBetween(prev, prevTime, trajectory.state(), trajectory.time(),
+                                  rangeM, ammo.muzzleVelocityMps);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool BallisticTable::build(const AmmunitionProfile &ammo, const AtmosphericConditions &air,
+                           float maxRangeM, float stepM)
+{
+    clear();
+    if (stepM <= 0.0f || maxRangeM < stepM || ammo.muzzleVelocityMps <= 0.0f || ammo.ballisticCoefficient <= 0.0f)
+        return false;
+
+    m_ammo = ammo;
+    m_air = air;
+    m_stepM = stepM;
+    m_invStep = 1.0f / stepM;
+
+    const int count = static_cast<int>(maxRangeM / stepM) + 1;
+    m_samples.reserve(count);
+
+    BallisticSolution muzzle;
+    muzzle.velocityMps = ammo.muzzleVelocityMps;
+    m_samples.push_back(muzzle);
+
+    // One pass over the trajectory, emitting every sample node crossed by each step
+    Trajectory trajectory(ammo, air);
+    while (static_cast<int>(m_samples.size()) < count && !trajectory.exhausted()) {
+        const State prev = trajectory.state();
+        const double prevTime = trajectory.time();
+        trajectory.step(ExteriorBallistics::BuildStepS);
+        double nextRange = m_samples.size() * static_cast<double>(stepM);
+        while (static_cast<int>(m_samples.size()) < count && trajectory.state().x >= nextRange) {
+            m_samples.push_back(solutionBetween(prev, prevTime, trajectory.state(), trajectory.time(),
+                                                nextRange, ammo.muzzleVelocityMps));
+            nextRange = m_samples.size() * static_cast<double>(stepM);
+        }
+    }
+
+    if (!isValid()) {
+        clear();
+        return false;
+    }
+    return true;
+}
+
+void BallisticTable::clear()
+{
+    m_samples.clear();
+    m_stepM = 0.0f;
+    m_invStep = 0.0f;
+}
+
+bool BallisticTable::lookup(float rangeM, BallisticSolution &out) const
+{
+    if (!isValid() || rangeM < 0.0f)
+        return false;
+
+    const float pos = rangeM * m_invStep;
+    const int i = static_cast<int>(pos);
+    if (i >= static_cast<int>(m_samples.size()) - 1) {
+        if (rangeM > maxRange())
+            return false;
+        out = m_samples.back();
+        return true;
+    }
+
+    const float f = pos - static_cast<float>(i);
+    const BallisticSolution &a = m_samples[i];
+    const BallisticSolution &b = m_samples[i + 1];
+    out.timeOfFlightS = a.timeOfFlightS + f * (b.timeOfFlightS - a.timeOfFlightS);
+    out.dropM = a.dropM + f * (b.dropM - a.dropM);
+    out.windDriftPerMps = a.windDriftPerMps + f * (b.windDriftPerMps - a.windDriftPerMps);
+    out.velocityMps = a.velocityMps + f * (b.velocityMps - a.velocityMps);
+    return true;
+}
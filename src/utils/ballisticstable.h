@@ -0,0 +1,84 @@
+#ifndef BALLISTICSTABLE_H
+#define BALLISTICSTABLE_H
+
+#include <vector>
+
+/**
+ * @brief Point-mass exterior ballistics with precomputed range tables.
+ *
+ * The trajectory is integrated once (RK4 against the G1 or G7 standard drag
+ * function) for the current ammunition and air, and stored as samples at a
+ * fixed range step. The fire-control hot path then only does an index
+ * computation and a linear interpolation between two samples.
+ *
+ * Air density and the speed of sound come from the station temperature and
+ * pressure; a table is rebuilt when they drift (see BallisticsProcessor).
+ */
+
+enum class DragModel {
+    G1,     // Flat-base reference projectile
+    G7      // Boat-tail reference projectile (better match for long-range ball)
+};
+
+struct AmmunitionProfile {
+    DragModel dragModel = DragModel::G7;
+    float ballisticCoefficient = 0.32f;     // lb/in², referenced to dragModel
+    float muzzleVelocityMps = 850.0f;
+};
+
+struct AtmosphericConditions {
+    float temperatureC = 15.0f;             // ICAO standard atmosphere at sea level
+    float pressureHpa = 1013.25f;
+
+    double airDensity() const;              // kg/m³
+    double speedOfSound() const;            // m/s
+    double densityAltitude() const;         // m, altitude of the same density in the standard atmosphere
+};
+
+struct BallisticSolution {
+    float timeOfFlightS = 0.0f;
+    float dropM = 0.0f;                     // Below the bore line, positive down
+    float windDriftPerMps = 0.0f;           // Lateral drift per m/s of full-value crosswind
+    float velocityMps = 0.0f;               // Remaining velocity
+};
+
+namespace ExteriorBallistics {
+    constexpr double BuildStepS = 0.001;        // Integration step for tables
+    constexpr double ReferenceStepS = 0.00005;  // Integration step for the reference solution
+
+    // Standard drag coefficient of the reference projectile at the given Mach number
+    double dragCoefficient(DragModel model, double mach);
+
+    // Integrates a horizontal shot out to rangeM. Returns false if the projectile
+    // does not get there (too slow, or the flight time limit is exceeded).
+    bool integrateToRange(const AmmunitionProfile &ammo, const AtmosphericConditions &air,
+                          double rangeM, double stepS, BallisticSolution &out);
+}
+
+class BallisticTable
+{
+public:
+    // Integrates the trajectory and samples it every stepM up to maxRangeM
+    bool build(const AmmunitionProfile &ammo, const AtmosphericConditions &air,
+               float maxRangeM, float stepM);
+    void clear();
+
+    // Constant-time lookup. Returns false outside the table's range.
+    bool lookup(float rangeM, BallisticSolution &out) const;
+
+    bool isValid() const { return m_samples.size() >= 2; }
+    float maxRange() const { return isValid() ? (m_samples.size() - 1) * m_stepM : 0.0f; }
+    float step() const { return m_stepM; }
+    int sampleCount() const { return static_cast<int>(m_samples.size()); }
+    const AmmunitionProfile &ammunition() const { return m_ammo; }
+    const AtmosphericConditions &atmosphere() const { return m_air; }
+
+private:
+    std::vector<BallisticSolution> m_samples;   // m_samples[i] is at i * m_stepM
+    float m_stepM = 0.0f;
+    float m_invStep = 0.0f;
+    AmmunitionProfile m_ammo;
+    AtmosphericConditions m_air;
+};
+
+#endif // BALLISTICSTABLE_H
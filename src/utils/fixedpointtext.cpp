@@ -0,0 +1,65 @@
+#include "fixedpointtext.h"
+
+#include <cmath>
+#include <limits>
+
+namespace {
+// Sentinel for NaN and values outside the 64-bit fixed-point range
+constexpr qint64 kInvalidValue = std::numeric_limits<qint64>::min();
+}
+
+FixedPointText::FixedPointText(int decimals, const QString& suffix, const QString& prefix)
+    : m_decimals(qBound(0, decimals, 6))
+    , m_scale(1)
+    , m_prefix(prefix)
+    , m_suffix(suffix)
+{
+    for (int i = 0; i < m_decimals; ++i) {
+        m_scale *= 10;
+    }
+}
+
+bool FixedPointText::update(double value)
+{
+    const double scaled = value * static_cast<double>(m_scale);
+    const qint64 quantised = (std::isfinite(scaled) && std::fabs(scaled) < 9.0e15)
+                                 ? static_cast<qint64>(std::llround(scaled))
+                                 : kInvalidValue;
+
+    if (m_valid && quantised == m_quantised) {
+        return false;
+    }
+
+    m_valid = true;
+    m_quantised = quantised;
+    format();
+    return true;
+}
+
+void FixedPointText::format()
+{
+    if (m_quantised == kInvalidValue) {
+        m_text = m_prefix + QStringLiteral("---") + m_suffix;
+        return;
+    }
+
+    const bool negative = m_quantised < 0;
+    const quint64 magnitude = negative ? static_cast<quint64>(-m_quantised)
+                                       : static_cast<quint64>(m_quantised);
+    const quint64 integerPart = magnitude / static_cast<quint64>(m_scale);
+    const quint64 fractionPart = magnitude % static_cast<quint64>(m_scale);
+
+    QString text;
+    text.reserve(m_prefix.size() + m_suffix.size() + 24);
+    text += m_prefix;
+    if (negative) {
+        text += QLatin1Char('-');
+    }
+    text += QString::number(integerPart);
+    if (m_decimals > 0) {
+        text += QLatin1Char('.');
+        text += QString::number(fractionPart).rightJustified(m_decimals, QLatin1Char('0'));
+    }
+    text += m_suffix;
+    m_text = text;
+}
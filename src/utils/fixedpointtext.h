@@ -0,0 +1,50 @@
+#ifndef FIXEDPOINTTEXT_H
+#define FIXEDPOINTTEXT_H
+
+#include <QString>
+#include <QtGlobal>
+
+/**
+ * @brief Cached fixed-point text for a numeric view-model property.
+ *
+ * update() rounds the value to the configured number of decimals and only
+ * formats a new string when that quantised value differs from the last one,
+ * so a servo position that moves by less than 0.01° (or a temperature that
+ * does not change at all) costs an integer compare instead of a
+ * QString::number() allocation per update.
+ *
+ * The text is built from the quantised integer, so rounding is always half
+ * away from zero and "-0.00" is never shown. NaN shows as "---".
+ *
+ *     FixedPointText m_position{2, QStringLiteral("°")};
+ *     if (m_position.update(azDeg)) { m_positionText = m_position.text(); emit ... }
+ */
+class FixedPointText
+{
+public:
+    explicit FixedPointText(int decimals, const QString& suffix = QString(),
+                            const QString& prefix = QString());
+
+    // Returns true when the text changed (always on the first call)
+    bool update(double value);
+
+    const QString& text() const { return m_text; }
+    int decimals() const { return m_decimals; }
+
+    // Forces the next update() to format again
+    void invalidate() { m_valid = false; }
+
+private:
+    void format();
+
+    int m_decimals;
+    qint64 m_scale;
+    QString m_prefix;
+    QString m_suffix;
+
+    bool m_valid = false;
+    qint64 m_quantised = 0;
+    QString m_text;
+};
+
+#endif // FIXEDPOINTTEXT_H
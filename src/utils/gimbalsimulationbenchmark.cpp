@@ -0,0 +1,406 @@
+#include "gimbalsimulationbenchmark.h"
+
+#include "controllers/deviceconfiguration.h"
+#include "controllers/gimbalcontroller.h"
+#include "controllers/motion_modes/motionclock.h"
+#include "hardware/communication/simulatedmodbustransport.h"
+#include "hardware/devices/servodriverdevice.h"
+#include "hardware/protocols/ServoDriverProtocolParser.h"
+#include "hardware/simulation/gimbalsimulation.h"
+#include "models/domain/gyrodatamodel.h"
+#include "models/domain/servodriverdatamodel.h"
+#include "models/domain/systemstatemodel.h"
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace {
+constexpr double kTemperatureIntervalS = 2.0;
+constexpr double kErrorSampleS = 0.01;
+constexpr double kUpdatePhaseS = 0.01;          // Controller update runs this long after the poll
+
+enum class Reference { None, Target, WorldHold, Point };
+
+bool parseMotionMode(const QString &name, MotionMode &mode)
+{
+    static const struct { const char *name; MotionMode mode; } modes[] = {
+        {"Idle", MotionMode::Idle},
+        {"Manual", MotionMode::Manual},
+        {"AutoTrack", MotionMode::AutoTrack},
+        {"AutoSectorScan", MotionMode::AutoSectorScan},
+        {"TRPScan", MotionMode::TRPScan},
+        {"RadarSlew", MotionMode::RadarSlew},
+    };
+    for (const auto &entry : modes) {
+        if (name == QLatin1String(entry.name)) {
+            mode = entry.mode;
+            return true;
+        }
+    }
+    return false;
+}
+
+double percentile(std::vector<double> values, double fraction)
+{
+    if (values.empty())
+        return 0.0;
+    const size_t index = std::min(values.size() - 1, static_cast<size_t>(fraction * values.size()));
+    std::nth_element(values.begin(), values.begin() + static_cast<long>(index), values.end());
+    return values[index];
+}
+
+QJsonObject busJson(const ModbusLinkModel::Stats &stats)
+{
+    QJsonObject json;
+    json["utilisation"] = stats.utilisation();
+    json["bytes"] = static_cast<double>(stats.bytes);
+    json["transactions"] = static_cast<double>(stats.transactions);
+    json["maxQueueDelayMs"] = stats.maxQueueDelayS * 1000.0;
+    return json;
+}
+
+void openLink(SimulatedModbusTransport *transport, const DeviceConfiguration::ServoConfig &conf)
+{
+    QJsonObject config;
+    config["baudRate"] = conf.baudRate;
+    config["slaveId"] = conf.slaveId;
+    transport->open(config);
+}
+}
+
+QJsonObject GimbalSimulationBenchmark::runScenario(const QJsonObject &scenario)
+{
+    QJsonObject result;
+    result["name"] = scenario["name"].toString("unnamed");
+
+    MotionMode mode = MotionMode::Idle;
+    const QString modeName = scenario["motionMode"].toString("Idle");
+    if (!parseMotionMode(modeName, mode)) {
+        result["error"] = QString("Unknown motionMode %1").arg(modeName);
+        result["pass"] = false;
+        return result;
+    }
+
+    DeviceConfiguration::SimulationConfig simConfig = DeviceConfiguration::simulation();
+    DeviceConfiguration::parseSimulation(scenario["simulation"].toObject(), simConfig);
+
+    const double durationS = scenario["durationS"].toDouble(20.0);
+    const bool stabilization = scenario["stabilization"].toBool(false);
+    const double settleThresholdDeg = scenario["settleThresholdDeg"].toDouble(DefaultSettleThresholdDeg);
+    const double metricsStartS = scenario["metricsStartS"].toDouble(0.0);
+    const QJsonObject initialGimbal = scenario["initialGimbal"].toObject();
+
+    Reference reference = simConfig.targetEnabled ? Reference::Target
+                        : stabilization ? Reference::WorldHold : Reference::None;
+    double referenceAz = 0.0, referenceEl = 0.0;
+    const QJsonValue referenceValue = scenario["reference"];
+    if (referenceValue.isObject()) {
+        reference = Reference::Point;
+        referenceAz = referenceValue.toObject()["azDeg"].toDouble();
+        referenceEl = referenceValue.toObject()["elDeg"].toDouble();
+    } else if (referenceValue.isString()) {
+        const QString name = referenceValue.toString();
+        reference = name == "target" ? Reference::Target
+                  : name == "worldHold" ? Reference::WorldHold : Reference::None;
+    }
+
+    MotionClock::setSimulatedTimeNs(0);
+
+    // ---- Application objects on simulated hardware (destroyed in reverse order) ----
+    SystemStateModel stateModel;
+    GimbalSimulation simulation(simConfig, &stateModel);
+    simulation.setGimbalPosition(initialGimbal["azDeg"].toDouble(0.0), initialGimbal["elDeg"].toDouble(0.0));
+
+    auto azServo = std::make_unique<ServoDriverDevice>("az-sim");
+    auto elServo = std::make_unique<ServoDriverDevice>("el-sim");
+    openLink(simulation.azimuthTransport(), DeviceConfiguration::servoAz());
+    openLink(simulation.elevationTransport(), DeviceConfiguration::servoEl());
+    azServo->setDependencies(simulation.azimuthTransport(), new ServoDriverProtocolParser());
+    elServo->setDependencies(simulation.elevationTransport(), new ServoDriverProtocolParser());
+
+    ServoDriverDataModel azModel;
+    ServoDriverDataModel elModel;
+    GyroDataModel gyroModel;
+    QObject::connect(azServo.get(), &ServoDriverDevice::servoDataChanged, &azModel, &ServoDriverDataModel::updateData);
+    QObject::connect(elServo.get(), &ServoDriverDevice::servoDataChanged, &elModel, &ServoDriverDataModel::updateData);
+    QObject::connect(&simulation, &GimbalSimulation::imuDataChanged, &gyroModel, &GyroDataModel::updateData);
+    QObject::connect(&azModel, &ServoDriverDataModel::dataChanged, &stateModel, &SystemStateModel::onServoAzDataChanged);
+    QObject::connect(&elModel, &ServoDriverDataModel::dataChanged, &stateModel, &SystemStateModel::onServoElDataChanged);
+    QObject::connect(&gyroModel, &GyroDataModel::dataChanged, &stateModel, &SystemStateModel::onGyroDataChanged);
+    azServo->initialize();
+    elServo->initialize();
+
+    SystemStateData data = stateModel.data();
+    data.areaZones.clear();         // zones.json in the working directory must not shape the scenario
+    data.stationEnabled = true;
+    data.deadManSwitchActive = true;
+    data.emergencyStopActive = false;
+    data.enableStabilization = stabilization;
+    data.activeCameraIsDay = true;
+    data.dayCurrentHFOV = scenario["cameraHfovDeg"].toDouble(data.dayCurrentHFOV);
+    if (scenario.contains("sectorScan")) {
+        const QJsonObject scan = scenario["sectorScan"].toObject();
+        AutoSectorScanZone zone;
+        zone.id = 1;
+        zone.isEnabled = true;
+        zone.az1 = scan["az1"].toDouble();
+        zone.el1 = scan["el1"].toDouble();
+        zone.az2 = scan["az2"].toDouble();
+        zone.el2 = scan["el2"].toDouble();
+        zone.scanSpeed = scan["scanSpeed"].toDouble(zone.scanSpeed);
+        data.sectorScanZones = {zone};
+        data.activeAutoSectorScanZoneId = zone.id;
+    }
+    if (scenario.contains("trps")) {
+        data.targetReferencePoints.clear();
+        const QJsonArray trps = scenario["trps"].toArray();
+        for (int i = 0; i < trps.size(); ++i) {
+            const QJsonObject point = trps[i].toObject();
+            TargetReferencePoint trp;
+            trp.id = i + 1;
+            trp.locationPage = 1;
+            trp.trpInPage = i + 1;
+            trp.azimuth = point["azimuth"].toDouble();
+            trp.elevation = point["elevation"].toDouble();
+            trp.haltTime = point["haltTime"].toDouble();
+            data.targetReferencePoints.push_back(trp);
+        }
+        data.activeTRPLocationPage = 1;
+    }
+    if (scenario.contains("radarPlot")) {
+        const QJsonObject plot = scenario["radarPlot"].toObject();
+        data.radarPlots = {SimpleRadarPlot{1, static_cast<float>(plot["azimuth"].toDouble()),
+                                           static_cast<float>(plot["range"].toDouble(1000.0)), 0.0f, 0.0f}};
+        data.selectedRadarTrackId = 0;
+    }
+    stateModel.updateData(data);
+
+    auto controller = std::make_unique<GimbalController>(azServo.get(), elServo.get(), nullptr, &stateModel);
+
+    // ---- Simulated-time loop ----
+    const long totalSteps = std::lround((EngageS + durationS) / SampleStepS);
+    const long controlEvery = std::lround(ControlPeriodS / SampleStepS);
+    const long updatePhase = std::lround(kUpdatePhaseS / SampleStepS);
+    const long temperatureEvery = std::lround(kTemperatureIntervalS / SampleStepS);
+    const long sampleEvery = std::lround(kErrorSampleS / SampleStepS);
+
+    bool engaged = false;
+    double holdAz = 0.0, holdEl = 0.0;
+    std::vector<double> errors;
+    double lastOutsideS = 0.0;
+    double lastErrorDeg = 0.0;
+
+    QElapsedTimer wallClock;
+    wallClock.start();
+    for (long i = 0; i <= totalSteps; ++i) {
+        const double t = i * SampleStepS;
+        MotionClock::setSimulatedTimeNs(std::llround(t * 1e9));
+        simulation.advanceTo(t);
+        const GimbalPlant &plant = simulation.plant();
+
+        if (!engaged && t >= EngageS) {
+            engaged = true;
+            SystemStateData engage = stateModel.data();
+            if (mode == MotionMode::AutoTrack) {
+                // Operator has designated the target: the model switches to AutoTrack on lock
+                engage.motionMode = MotionMode::Manual;
+                engage.currentTrackingPhase = TrackingPhase::Tracking_LockPending;
+            } else {
+                engage.motionMode = mode;
+                if (mode == MotionMode::RadarSlew) engage.selectedRadarTrackId = 1;
+            }
+            stateModel.updateData(engage);
+            GimbalPlant::platformToWorld(plant.azimuth().positionDeg(), plant.elevation().positionDeg(),
+                                         plant.attitude(t), holdAz, holdEl);
+            simulation.azimuthTransport()->resetStats();
+            simulation.elevationTransport()->resetStats();
+        }
+
+        if (i % controlEvery == 0) {
+            QMetaObject::invokeMethod(azServo.get(), "pollTimerTimeout", Qt::DirectConnection);
+            QMetaObject::invokeMethod(elServo.get(), "pollTimerTimeout", Qt::DirectConnection);
+            // Replies are released with deleteLater; there is no event loop here
+            QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+        }
+        if (i % temperatureEvery == 0) {
+            QMetaObject::invokeMethod(azServo.get(), "temperatureTimerTimeout", Qt::DirectConnection);
+            QMetaObject::invokeMethod(elServo.get(), "temperatureTimerTimeout", Qt::DirectConnection);
+        }
+        if (i % controlEvery == updatePhase) {
+            controller->update();
+        }
+
+        if (!engaged || reference == Reference::None || i % sampleEvery != 0)
+            continue;
+
+        const double gimbalAz = plant.azimuth().positionDeg();
+        const double gimbalEl = plant.elevation().positionDeg();
+        double errorDeg = 0.0;
+        switch (reference) {
+        case Reference::Target: {
+            double worldAz, worldEl, targetAz, targetEl;
+            plant.targetWorld(t, worldAz, worldEl);
+            GimbalPlant::worldToPlatform(worldAz, worldEl, plant.attitude(t), targetAz, targetEl);
+            errorDeg = GimbalPlant::angleBetween(targetAz, targetEl, gimbalAz, gimbalEl);
+            break;
+        }
+        case Reference::WorldHold: {
+            double worldAz, worldEl;
+            GimbalPlant::platformToWorld(gimbalAz, gimbalEl, plant.attitude(t), worldAz, worldEl);
+            errorDeg = GimbalPlant::angleBetween(holdAz, holdEl, worldAz, worldEl);
+            break;
+        }
+        case Reference::Point:
+            errorDeg = GimbalPlant::angleBetween(referenceAz, referenceEl, gimbalAz, gimbalEl);
+            break;
+        case Reference::None:
+            break;
+        }
+
+        const double scenarioTimeS = t - EngageS;
+        if (errorDeg > settleThresholdDeg) lastOutsideS = scenarioTimeS + kErrorSampleS;
+        if (scenarioTimeS >= metricsStartS) errors.push_back(errorDeg);
+        lastErrorDeg = errorDeg;
+    }
+    const double wallS = wallClock.nsecsElapsed() * 1e-9;
+    controller.reset();     // Exits the mode while the servos still exist
+
+    // ---- Metrics and expectations ----
+    const ModbusLinkModel::Stats azBus = simulation.azimuthTransport() ? simulation.azimuthTransport()->stats()
+                                                                        : ModbusLinkModel::Stats();
+    const ModbusLinkModel::Stats elBus = simulation.elevationTransport() ? simulation.elevationTransport()->stats()
+                                                                          : ModbusLinkModel::Stats();
+    result["motionMode"] = modeName;
+    result["durationS"] = durationS;
+    result["wallClockS"] = wallS;
+    result["realTimeFactor"] = wallS > 0.0 ? durationS / wallS : 0.0;
+
+    QJsonObject bus;
+    bus["azimuth"] = busJson(azBus);
+    bus["elevation"] = busJson(elBus);
+    result["bus"] = bus;
+    const double maxUtilisation = std::max(azBus.utilisation(), elBus.utilisation());
+
+    const bool hasError = reference != Reference::None && !errors.empty();
+    double rms = 0.0, maxError = 0.0;
+    for (double e : errors) {
+        rms += e * e;
+        maxError = std::max(maxError, e);
+    }
+    rms = errors.empty() ? 0.0 : std::sqrt(rms / errors.size());
+    const bool settled = hasError && lastErrorDeg <= settleThresholdDeg;
+    const double settlingTimeS = settled ? lastOutsideS : durationS;
+    if (hasError) {
+        QJsonObject tracking;
+        tracking["rmsErrorDeg"] = rms;
+        tracking["maxErrorDeg"] = maxError;
+        tracking["p95ErrorDeg"] = percentile(errors, 0.95);
+        tracking["samples"] = static_cast<int>(errors.size());
+        tracking["settleThresholdDeg"] = settleThresholdDeg;
+        tracking["settlingTimeS"] = settlingTimeS;
+        tracking["settled"] = settled;
+        result["tracking"] = tracking;
+    }
+
+    bool pass = true;
+    QJsonObject checks;
+    const QJsonObject expect = scenario["expect"].toObject();
+    if (expect.contains("maxRmsErrorDeg")) {
+        const bool ok = hasError && rms <= expect["maxRmsErrorDeg"].toDouble();
+        checks["maxRmsErrorDeg"] = ok;
+        pass &= ok;
+    }
+    if (expect.contains("maxErrorDeg")) {
+        const bool ok = hasError && maxError <= expect["maxErrorDeg"].toDouble();
+        checks["maxErrorDeg"] = ok;
+        pass &= ok;
+    }
+    if (expect.contains("maxSettlingTimeS")) {
+        const bool ok = settled && settlingTimeS <= expect["maxSettlingTimeS"].toDouble();
+        checks["maxSettlingTimeS"] = ok;
+        pass &= ok;
+    }
+    if (expect.contains("maxBusUtilisation")) {
+        const bool ok = maxUtilisation <= expect["maxBusUtilisation"].toDouble();
+        checks["maxBusUtilisation"] = ok;
+        pass &= ok;
+    }
+    result["checks"] = checks;
+    result["pass"] = pass;
+
+    qInfo().noquote() << QString("GimbalSimulationBenchmark: %1 | %2 s in %3 s wall | RMS %4 deg, max %5 deg, "
+                                 "settling %6 s | bus az %7% el %8% | %9")
+                             .arg(result["name"].toString(), modeName)
+                             .arg(wallS, 0, 'f', 2)
+                             .arg(rms, 0, 'f', 3)
+                             .arg(maxError, 0, 'f', 3)
+                             .arg(settlingTimeS, 0, 'f', 2)
+                             .arg(azBus.utilisation() * 100.0, 0, 'f', 1)
+                             .arg(elBus.utilisation() * 100.0, 0, 'f', 1)
+                             .arg(pass ? "PASS" : "FAIL");
+    return result;
+}
+
+QJsonObject GimbalSimulationBenchmark::run(const Options &options)
+{
+    QJsonObject json;
+    QJsonArray scenarios;
+    bool pass = !options.scenarioFiles.isEmpty();
+    if (!pass) {
+        qWarning() << "GimbalSimulationBenchmark: No scenario files given";
+    }
+
+    for (const QString &path : options.scenarioFiles) {
+        QJsonObject result;
+        QFile file(path);
+        QJsonParseError parseError;
+        const QJsonDocument document = file.open(QIODevice::ReadOnly)
+                                           ? QJsonDocument::fromJson(file.readAll(), &parseError)
+                                           : QJsonDocument();
+        if (!document.isObject()) {
+            qWarning() << "GimbalSimulationBenchmark: Cannot read scenario" << path;
+            result["error"] = "Cannot read scenario file";
+            result["pass"] = false;
+        } else {
+            result = runScenario(document.object());
+        }
+        result["file"] = path;
+        pass &= result["pass"].toBool();
+        scenarios.append(result);
+    }
+    MotionClock::useRealTime();
+
+    json["scenarios"] = scenarios;
+    json["pass"] = pass;
+    return json;
+}
+
+int GimbalSimulationBenchmark::writeReport(const QJsonObject &report, const QString &path)
+{
+    const int exitCode = report["pass"].toBool() ? 0 : 1;
+    const QByteArray document = QJsonDocument(report).toJson(QJsonDocument::Indented);
+    if (path.isEmpty()) {
+        std::fwrite(document.constData(), 1, static_cast<size_t>(document.size()), stdout);
+        std::fflush(stdout);
+        return exitCode;
+    }
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "GimbalSimulationBenchmark: Cannot write report to" << path;
+        return 2;
+    }
+    file.write(document);
+    qInfo() << "GimbalSimulationBenchmark: Report written to" << path;
+    return exitCode;
+}
@@ -0,0 +1,41 @@
+#ifndef GIMBALSIMULATIONBENCHMARK_H
+#define GIMBALSIMULATIONBENCHMARK_H
+
+#include <QJsonObject>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief Runs scripted motion-mode scenarios against the simulated gimbal.
+ *
+ * Each scenario file (JSON) builds a fresh SystemStateModel, servo devices on
+ * GimbalSimulation transports and a GimbalController, then steps simulated
+ * time as fast as the host allows: device polls and controller updates every
+ * 50 ms as in the application, physics at 1 ms. MotionClock runs on simulated
+ * time, so the motion modes see the same time base as on the vehicle.
+ *
+ * Reported per scenario: line-of-sight error to the reference (RMS, max,
+ * 95th percentile), settling time and per-axis Modbus bus utilisation,
+ * checked against the scenario's "expect" block.
+ */
+class GimbalSimulationBenchmark
+{
+public:
+    struct Options {
+        QStringList scenarioFiles;
+        QString reportPath;             // Empty = print to stdout
+    };
+
+    static constexpr double ControlPeriodS = 0.05;      // Servo polls and GimbalController::update
+    static constexpr double SampleStepS = 0.001;
+    static constexpr double EngageS = 0.2;              // Idle with encoder reads before the mode starts
+    static constexpr double DefaultSettleThresholdDeg = 0.2;
+
+    static QJsonObject run(const Options &options);
+    static QJsonObject runScenario(const QJsonObject &scenario);
+
+    // Writes the report and returns the process exit code (non-zero if a scenario failed its expectations)
+    static int writeReport(const QJsonObject &report, const QString &path);
+};
+
+#endif // GIMBALSIMULATIONBENCHMARK_H
@@ -1,5 +1,6 @@
 #include "inference.h"
 #include <chrono>
+#include <cstring>
 #include <iostream>
 
 YoloInference::YoloInference(const std::string &onnxModelPath, const cv::Size &modelInputShape, 
@@ -30,55 +31,134 @@ YoloInference::~YoloInference()
 }
 
 std::vector<YoloDetection> YoloInference::runInference(const cv::Mat &input)
+{
+    return runInferenceBatch({input}).front();
+}
+
+std::vector<std::vector<YoloDetection>> YoloInference::runInferenceBatch(const std::vector<cv::Mat> &inputs)
+{
+    if (inputs.empty())
+        return {};
+
+    const size_t batchSize = inputs.size();
+    std::vector<cv::Mat> modelInputs(batchSize);
+    std::vector<YoloLetterbox> letterbox(batchSize);
+
+    for (size_t i = 0; i < batchSize; ++i) {
+        modelInputs[i] = inputs[i];
+        if (letterBoxForSquare && modelShape.width == modelShape.height)
+            modelInputs[i] = formatToSquare(inputs[i], &letterbox[i].padX, &letterbox[i].padY, &letterbox[i].scale);
+    }
+
+    // Optimize blob creation - reuse allocated memory when possible
+    cv::dnn::blobFromImages(modelInputs, blob, 1.0/255.0, modelShape, cv::Scalar(), true, false, CV_32F);
+
+    return forwardBlob(blob, letterbox);
+}
+
+std::vector<std::vector<YoloDetection>> YoloInference::runInferenceOnTensors(const std::vector<cv::Mat> &tensors,
+                                                                             const std::vector<YoloLetterbox> &letterbox)
+{
+    if (tensors.empty() || tensors.size() != letterbox.size())
+        return std::vector<std::vector<YoloDetection>>(tensors.size());
+
+    if (tensors.size() == 1)
+        return forwardBlob(tensors.front(), letterbox);
+
+    // Stack the 1x3xHxW tensors into one Nx3xHxW blob
+    const int blobSize[] = {static_cast<int>(tensors.size()), 3, modelShape.height, modelShape.width};
+    blob.create(4, blobSize, CV_32F);
+    const size_t planeBytes = static_cast<size_t>(3) * modelShape.height * modelShape.width * sizeof(float);
+    for (size_t i = 0; i < tensors.size(); ++i)
+        std::memcpy(blob.ptr<float>(static_cast<int>(i)), tensors[i].ptr<float>(0), planeBytes);
+
+    return forwardBlob(blob, letterbox);
+}
+
+std::vector<std::vector<YoloDetection>> YoloInference::forwardBlob(const cv::Mat &input, const std::vector<YoloLetterbox> &letterbox)
 {
     // Start timing for performance monitoring
     auto start = std::chrono::high_resolution_clock::now();
-    
-    cv::Mat modelInput = input;
-    int pad_x = 0, pad_y = 0;
-    float scale = 1.0f;
-    
-    if (letterBoxForSquare && modelShape.width == modelShape.height)
-        modelInput = formatToSquare(modelInput, &pad_x, &pad_y, &scale);
 
-    // Optimize blob creation - reuse allocated memory when possible
-    cv::dnn::blobFromImage(modelInput, blob, 1.0/255.0, modelShape, cv::Scalar(), true, false, CV_32F);
-    net.setInput(blob);
+    const int batchSize = input.size[0];
+    std::vector<std::vector<YoloDetection>> results(batchSize);
 
-    // Use pre-allocated output vector
-    outputs.clear();
-    net.forward(outputs, outputNames);
+    // YOLOv8 has output shape (batchSize, 84, 8400); parse one plane per image
+    auto parseBatch = [&](int first) {
+        const int planeRows = outputs[0].size[1];
+        const int planeCols = outputs[0].size[2];
+        for (int i = 0; i < outputs[0].size[0]; ++i) {
+            cv::Mat plane(planeRows, planeCols, CV_32F, outputs[0].ptr<float>(i));
+            results[first + i] = parseOutput(plane, letterbox[first + i]);
+        }
+    };
 
-    auto inference_end = std::chrono::high_resolution_clock::now();
-    auto inference_time = std::chrono::duration_cast<std::chrono::milliseconds>(inference_end - start);
-    
-    int rows = outputs[0].size[1];
-    int dimensions = outputs[0].size[2];
-    
-    // YOLOv8 has output shape (batchSize, 84, 8400) (Num classes + box[x,y,w,h])
+    bool batched = batchSize == 1 || batchSupported;
+    if (batched) {
+        net.setInput(input);
+        // Use pre-allocated output vector
+        outputs.clear();
+        try {
+            net.forward(outputs, outputNames);
+        } catch (const cv::Exception &e) {
+            if (batchSize == 1)
+                throw;
+            std::cout << "Batched forward failed (model has a fixed batch size?), "
+                      << "falling back to per-image inference: " << e.what() << std::endl;
+            batchSupported = false;
+            batched = false;
+        }
+    }
+
+    if (batched) {
+        parseBatch(0);
+    } else {
+        // Fixed-batch models cannot take an N-image blob; run them one at a time
+        const int imageSize[] = {1, 3, input.size[2], input.size[3]};
+        for (int i = 0; i < batchSize; ++i) {
+            net.setInput(cv::Mat(4, imageSize, CV_32F, const_cast<float *>(input.ptr<float>(i))));
+            outputs.clear();
+            net.forward(outputs, outputNames);
+            parseBatch(i);
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto total_time = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+    // Optional: Print timing information
+    if (printTiming) {
+        std::cout << "Inference (N=" << batchSize << "): " << total_time.count() << "ms" << std::endl;
+    }
+
+    return results;
+}
+
+std::vector<YoloDetection> YoloInference::parseOutput(const cv::Mat &output, const YoloLetterbox &letterbox)
+{
+    cv::Mat candidates = output;
+    int rows = candidates.rows;
+    int dimensions = candidates.cols;
+
+    // (84, 8400) -> (8400, 84) so each row is one candidate box
     if (dimensions > rows) {
-        rows = outputs[0].size[2];
-        dimensions = outputs[0].size[1];
-        outputs[0] = outputs[0].reshape(1, dimensions);
-        cv::transpose(outputs[0], outputs[0]);
+        cv::transpose(candidates, transposedOutput);
+        candidates = transposedOutput;
+        rows = candidates.rows;
+        dimensions = candidates.cols;
     }
-    
-    float *data = (float *)outputs[0].data;
+
+    const float *data = candidates.ptr<float>(0);
 
     // Pre-allocated vectors for better performance
     class_ids.clear();
     confidences.clear();
     boxes.clear();
-    
-    // Reserve space to avoid reallocations
-    class_ids.reserve(1000);
-    confidences.reserve(1000);
-    boxes.reserve(1000);
 
     // Optimize detection loop with SIMD-friendly operations
     for (int i = 0; i < rows; ++i) {
-        float *classes_scores = data + 4;
-        
+        const float *classes_scores = data + 4;
+
         // Optimize score calculation using iterator
         auto max_iter = std::max_element(classes_scores, classes_scores + classes.size());
         float maxClassScore = *max_iter;
@@ -93,10 +173,10 @@ std::vector<YoloDetection> YoloInference::runInference(const cv::Mat &input)
             float w = data[2];
             float h = data[3];
 
-            int left = static_cast<int>((x - 0.5f * w - pad_x) / scale);
-            int top = static_cast<int>((y - 0.5f * h - pad_y) / scale);
-            int width = static_cast<int>(w / scale);
-            int height = static_cast<int>(h / scale);
+            int left = static_cast<int>((x - 0.5f * w - letterbox.padX) / letterbox.scale);
+            int top = static_cast<int>((y - 0.5f * h - letterbox.padY) / letterbox.scale);
+            int width = static_cast<int>(w / letterbox.scale);
+            int height = static_cast<int>(h / letterbox.scale);
 
             boxes.emplace_back(left, top, width, height);
         }
@@ -109,7 +189,7 @@ std::vector<YoloDetection> YoloInference::runInference(const cv::Mat &input)
 
     std::vector<YoloDetection> detections;
     detections.reserve(nms_result.size());
-    
+
     for (size_t i = 0; i < nms_result.size(); ++i) {
         int idx = nms_result[i];
 
@@ -118,19 +198,11 @@ std::vector<YoloDetection> YoloInference::runInference(const cv::Mat &input)
         result.confidence = confidences[idx];
         result.className = classes[result.class_id];
         result.box = boxes[idx];
-        
+
         // Use pre-computed colors
         result.color = predefinedColors[result.class_id % predefinedColors.size()];
-        
-        detections.push_back(result);
-    }
 
-    auto end = std::chrono::high_resolution_clock::now();
-    auto total_time = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-    
-    // Optional: Print timing information
-    if (printTiming) {
-        std::cout << "Inference: " << inference_time.count() << "ms, Total: " << total_time.count() << "ms" << std::endl;
+        detections.push_back(result);
     }
 
     return detections;
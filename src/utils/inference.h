@@ -25,6 +25,14 @@ struct YoloDetection
     cv::Rect box{};
 };
 
+// Letterbox geometry used to map model-space boxes back to the source frame
+struct YoloLetterbox
+{
+    int padX{0};
+    int padY{0};
+    float scale{1.0f};
+};
+
 class YoloInference
 {
 public:
@@ -34,6 +42,18 @@ public:
     ~YoloInference();
     
     std::vector<YoloDetection> runInference(const cv::Mat &input);
+
+    // Runs all inputs through the network as a single N-image blob and returns
+    // one detection list per input, in the same order. Falls back to one forward
+    // per image if the loaded model has a fixed batch dimension of 1.
+    std::vector<std::vector<YoloDetection>> runInferenceBatch(const std::vector<cv::Mat> &inputs);
+
+    // Same as runInferenceBatch(), for callers that already produced the
+    // letterboxed, normalised 1x3xHxW RGB float tensors themselves.
+    std::vector<std::vector<YoloDetection>> runInferenceOnTensors(const std::vector<cv::Mat> &tensors,
+                                                                  const std::vector<YoloLetterbox> &letterbox);
+
+    cv::Size inputShape() const { return modelShape; }
     
     // Configuration options
     bool letterBoxForSquare = true;
@@ -47,12 +67,15 @@ private:
     void preAllocateMemory();
     void warmUpNetwork();
     cv::Mat formatToSquare(const cv::Mat &source, int *pad_x, int *pad_y, float *scale);
+    std::vector<std::vector<YoloDetection>> forwardBlob(const cv::Mat &input, const std::vector<YoloLetterbox> &letterbox);
+    std::vector<YoloDetection> parseOutput(const cv::Mat &output, const YoloLetterbox &letterbox);
 
     std::string modelPath{};
     std::string tensorrtPath{};
     std::string classesPath{};
     bool cudaEnabled{};
     bool usingTensorRT{false};
+    bool batchSupported{true};
 
     cv::dnn::Net net;
     cv::Size modelShape{};
@@ -63,6 +86,7 @@ private:
     // Pre-allocated memory for better performance
     cv::Mat blob;
     std::vector<cv::Mat> outputs;
+    cv::Mat transposedOutput;
     std::vector<std::string> outputNames;
     std::vector<int> class_ids;
     std::vector<float> confidences;
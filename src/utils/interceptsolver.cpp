@@ -0,0 +1,220 @@
+#include "interceptsolver.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace {
+constexpr float kDegToRad = static_cast<float>(M_PI / 180.0);
+constexpr float kRadToDeg = static_cast<float>(180.0 / M_PI);
+constexpr double kMaxGapS = 1.0;            // Longer gaps restart the rate estimates
+constexpr double kMinRangeSpanS = 0.2;      // Minimum LRF history span for a range rate
+
+inline float wrapDegrees180(float deg)
+{
+    deg = std::fmod(deg + 180.0f, 360.0f);
+    if (deg < 0.0f)
+        deg += 360.0f;
+    return deg - 180.0f;
+}
+
+inline float dot3(const std::array<float, 3> &a, const std::array<float, 3> &b)
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+}
+
+void InterceptSolver::reset()
+{
+    m_rangeHead = 0;
+    m_rangeCount = 0;
+    m_rangeRate = 0.0f;
+    m_hasState = false;
+    m_hasVelocity = false;
+    m_gimbalRateAz = 0.0f;
+    m_gimbalRateEl = 0.0f;
+    m_position = {};
+    m_velocity = {};
+    m_accel = {};
+}
+
+float InterceptSolver::rangeAt(double timeS) const
+{
+    const int last = (m_rangeHead + RangeHistorySize - 1) % RangeHistorySize;
+    const float extrapolated = m_range[last] + m_rangeRate * static_cast<float>(timeS - m_rangeTime[last]);
+    return std::max(extrapolated, 1.0f);
+}
+
+void InterceptSolver::updateRangeRate()
+{
+    // Least-squares slope over readings inside the history window
+    const int last = (m_rangeHead + RangeHistorySize - 1) % RangeHistorySize;
+    const double newest = m_rangeTime[last];
+
+    double sumT = 0.0, sumR = 0.0, sumTT = 0.0, sumTR = 0.0, oldest = newest;
+    int n = 0;
+    for (int k = 0; k < m_rangeCount; ++k) {
+        const int i = (last - k + RangeHistorySize) % RangeHistorySize;
+        const double t = m_rangeTime[i] - newest;   // Relative time keeps the sums well conditioned
+        if (-t > RangeHistoryWindowS)
+            break;
+        sumT += t;
+        sumR += m_range[i];
+        sumTT += t * t;
+        sumTR += t * m_range[i];
+        oldest = m_rangeTime[i];
+        ++n;
+    }
+
+    const double denom = n * sumTT - sumT * sumT;
+    if (n < 2 || newest - oldest < kMinRangeSpanS || denom <= 0.0) {
+        m_rangeRate = 0.0f;
+        return;
+    }
+    m_rangeRate = static_cast<float>((n * sumTR - sumT * sumR) / denom);
+}
+
+void InterceptSolver::addMeasurement(const InterceptMeasurement &measurement)
+{
+    if (measurement.hasNewRange && measurement.rangeM > 0.0f) {
+        m_rangeTime[m_rangeHead] = measurement.timeS;
+        m_range[m_rangeHead] = measurement.rangeM;
+        m_rangeHead = (m_rangeHead + 1) % RangeHistorySize;
+        m_rangeCount = std::min(m_rangeCount + 1, RangeHistorySize);
+        updateRangeRate();
+    }
+
+    // Gimbal rate from successive positions; the tracker supplies the offset rate directly
+    const double dt = measurement.timeS - m_lastTimeS;
+    const bool continuous = m_hasState && dt > 1e-4 && dt < kMaxGapS;
+    if (continuous) {
+        const float rawAz = wrapDegrees180(measurement.gimbalAzDeg - m_lastGimbalAz) / static_cast<float>(dt);
+        const float rawEl = (measurement.gimbalElDeg - m_lastGimbalEl) / static_cast<float>(dt);
+        m_gimbalRateAz += GimbalRateAlpha * (rawAz - m_gimbalRateAz);
+        m_gimbalRateEl += GimbalRateAlpha * (rawEl - m_gimbalRateEl);
+    } else if (!m_hasState || dt >= kMaxGapS) {
+        m_gimbalRateAz = 0.0f;
+        m_gimbalRateEl = 0.0f;
+        m_hasVelocity = false;
+        m_accel = {};
+    }
+
+    m_hasState = true;
+    m_lastTimeS = measurement.timeS;
+    m_lastGimbalAz = measurement.gimbalAzDeg;
+    m_lastGimbalEl = measurement.gimbalElDeg;
+    m_losAzDeg = measurement.gimbalAzDeg + measurement.trackOffsetAzDeg;
+    m_losElDeg = measurement.gimbalElDeg + measurement.trackOffsetElDeg;
+    m_losRateAz = m_gimbalRateAz + measurement.trackOffsetRateAzDps;
+    m_losRateEl = m_gimbalRateEl + measurement.trackOffsetRateElDps;
+
+    if (m_rangeCount == 0)
+        return;
+
+    // Spherical (R, az, el) and rates to Cartesian position and velocity
+    const float range = rangeAt(measurement.timeS);
+    const float az = m_losAzDeg * kDegToRad;
+    const float el = m_losElDeg * kDegToRad;
+    const float sinAz = std::sin(az), cosAz = std::cos(az);
+    const float sinEl = std::sin(el), cosEl = std::cos(el);
+    const Vec3 unit = {cosEl * sinAz, cosEl * cosAz, sinEl};
+    const Vec3 dUnitDaz = {cosEl * cosAz, -cosEl * sinAz, 0.0f};
+    const Vec3 dUnitDel = {-sinEl * sinAz, -sinEl * cosAz, cosEl};
+    const float azRate = m_losRateAz * kDegToRad;
+    const float elRate = m_losRateEl * kDegToRad;
+
+    Vec3 velocity;
+    for (int i = 0; i < 3; ++i) {
+        m_position[i] = range * unit[i];
+        velocity[i] = m_rangeRate * unit[i] + range * (dUnitDaz[i] * azRate + dUnitDel[i] * elRate);
+    }
+
+    if (m_model == MotionModel::ConstantAcceleration && m_hasVelocity && continuous) {
+        Vec3 accel;
+        for (int i = 0; i < 3; ++i) {
+            const float raw = (velocity[i] - m_velocity[i]) / static_cast<float>(dt);
+            accel[i] = m_accel[i] + AccelAlpha * (raw - m_accel[i]);
+        }
+        const float magnitude = std::sqrt(dot3(accel, accel));
+        const float scale = magnitude > MaxTargetAccel ? MaxTargetAccel / magnitude : 1.0f;
+        for (int i = 0; i < 3; ++i)
+            m_accel[i] = accel[i] * scale;
+    }
+
+    m_velocity = velocity;
+    m_hasVelocity = true;
+}
+
+InterceptSolution InterceptSolver::solve(const BallisticTable &table) const
+{
+    const auto start = std::chrono::steady_clock::now();
+    InterceptSolution solution;
+    solution.rangeRateMps = m_rangeRate;
+
+    auto finish = [&]() {
+        const std::chrono::duration<float, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        solution.solveTimeUs = elapsed.count();
+        solution.overBudget = solution.solveTimeUs > m_budgetUs;
+        return solution;
+    };
+
+    if (!hasTarget() || !m_hasVelocity)
+        return finish();
+
+    const Vec3 &p0 = m_position;
+    const Vec3 &v = m_velocity;
+    const Vec3 a = (m_model == MotionModel::ConstantAcceleration) ? m_accel : Vec3{};
+
+    BallisticSolution ballistic;
+    if (!table.lookup(std::sqrt(dot3(p0, p0)), ballistic)) {
+        solution.status = InterceptStatus::OutOfRange;
+        return finish();
+    }
+
+    // Solve g(t) = TOF(|p(t)|) - t = 0 with Newton steps, dTOF/dR = 1 / projectile speed
+    float t = ballistic.timeOfFlightS;
+    Vec3 p = p0;
+    solution.status = InterceptStatus::IterationLimit;
+    for (int iter = 1; iter <= m_maxIterations; ++iter) {
+        Vec3 closing;
+        for (int i = 0; i < 3; ++i) {
+            p[i] = p0[i] + v[i] * t + 0.5f * a[i] * t * t;
+            closing[i] = v[i] + a[i] * t;
+        }
+        const float r = std::sqrt(dot3(p, p));
+        solution.iterations = iter;
+        if (!table.lookup(r, ballistic)) {
+            solution.status = InterceptStatus::OutOfRange;
+            break;
+        }
+
+        const float g = ballistic.timeOfFlightS - t;
+        if (std::abs(g) < m_toleranceS) {
+            t = ballistic.timeOfFlightS;
+            solution.status = InterceptStatus::Converged;
+            break;
+        }
+
+        const float rangeRate = dot3(p, closing) / r;
+        const float dg = rangeRate / std::max(ballistic.velocityMps, 1.0f) - 1.0f;
+        // dg is about -1 for any realistic target; fall back to a fixed-point step otherwise
+        t = (dg < -0.1f) ? t - g / dg : ballistic.timeOfFlightS;
+        t = std::max(t, 0.0f);
+
+        // Out of budget: keep the estimate so far instead of refining further
+        const std::chrono::duration<float, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() > m_budgetUs)
+            break;
+    }
+
+    for (int i = 0; i < 3; ++i)
+        p[i] = p0[i] + v[i] * t + 0.5f * a[i] * t * t;
+
+    const float aimAzDeg = std::atan2(p[0], p[1]) * kRadToDeg;
+    const float aimElDeg = std::atan2(p[2], std::hypot(p[0], p[1])) * kRadToDeg;
+    solution.leadAzDeg = wrapDegrees180(aimAzDeg - m_losAzDeg);
+    solution.leadElDeg = aimElDeg - m_losElDeg;
+    solution.interceptRangeM = std::sqrt(dot3(p, p));
+    solution.timeOfFlightS = t;
+    return finish();
+}
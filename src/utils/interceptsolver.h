@@ -0,0 +1,118 @@
+#ifndef INTERCEPTSOLVER_H
+#define INTERCEPTSOLVER_H
+
+#include "utils/ballisticstable.h"
+
+#include <array>
+
+/**
+ * @brief Target-motion prediction and time-of-flight iteration for lead.
+ *
+ * Each fire-control update feeds one InterceptMeasurement: the gimbal angles,
+ * the tracker's angular offset and offset rate, and the LRF range when a new
+ * reading came in. The solver keeps a constant-velocity (optionally
+ * constant-acceleration) target state in a station-centred Cartesian frame:
+ *   - LOS rate = smoothed gimbal rate + tracker offset rate
+ *   - range rate = least-squares slope over the recent LRF readings
+ *
+ * solve() then finds the time of flight t for which the projectile and the
+ * predicted target meet, i.e. t = TOF(|p(t)|), with Newton steps using the
+ * table's remaining velocity as dTOF/dR. Iterations are bounded by count and
+ * by the time budget: once over budget the Newton refinement stops and the
+ * estimate so far is returned (IterationLimit, overBudget set).
+ */
+
+struct InterceptMeasurement {
+    double timeS = 0.0;                 // Monotonic timestamp
+    float gimbalAzDeg = 0.0f;
+    float gimbalElDeg = 0.0f;
+    float trackOffsetAzDeg = 0.0f;      // Target relative to bore sight, 0 without a track
+    float trackOffsetElDeg = 0.0f;
+    float trackOffsetRateAzDps = 0.0f;  // From tracker pixel velocity
+    float trackOffsetRateElDps = 0.0f;
+    bool hasNewRange = false;           // Set only when the LRF produced a new reading
+    float rangeM = 0.0f;
+};
+
+enum class InterceptStatus {
+    Converged,
+    IterationLimit,     // Best estimate after maxIterations, not within tolerance
+    OutOfRange,         // Predicted intercept beyond the ballistic table
+    NoTarget            // No measurement or no range yet
+};
+
+struct InterceptSolution {
+    InterceptStatus status = InterceptStatus::NoTarget;
+    float leadAzDeg = 0.0f;             // Aim point minus current line of sight (target motion only)
+    float leadElDeg = 0.0f;
+    float interceptRangeM = 0.0f;       // Range to the predicted intercept point
+    float timeOfFlightS = 0.0f;
+    float rangeRateMps = 0.0f;
+    int iterations = 0;
+    float solveTimeUs = 0.0f;
+    bool overBudget = false;
+};
+
+class InterceptSolver
+{
+public:
+    enum class MotionModel {
+        ConstantVelocity,
+        ConstantAcceleration
+    };
+
+    void setMotionModel(MotionModel model) { m_model = model; }
+    void setMaxIterations(int iterations) { m_maxIterations = iterations > 0 ? iterations : 1; }
+    void setToleranceS(float toleranceS) { m_toleranceS = toleranceS; }
+    void setBudgetUs(float budgetUs) { m_budgetUs = budgetUs; }
+
+    void reset();
+    void addMeasurement(const InterceptMeasurement &measurement);
+    InterceptSolution solve(const BallisticTable &table) const;
+
+    bool hasTarget() const { return m_hasState && m_rangeCount > 0; }
+
+private:
+    static constexpr int RangeHistorySize = 8;
+    static constexpr double RangeHistoryWindowS = 4.0;
+    static constexpr float GimbalRateAlpha = 0.4f;     // Smoothing of the differentiated gimbal rate
+    static constexpr float AccelAlpha = 0.2f;
+    static constexpr float MaxTargetAccel = 30.0f;     // m/s², clamp for the CA model
+
+    using Vec3 = std::array<float, 3>;
+
+    float rangeAt(double timeS) const;
+    void updateRangeRate();
+
+    MotionModel m_model = MotionModel::ConstantVelocity;
+    int m_maxIterations = 6;
+    float m_toleranceS = 0.0001f;
+    float m_budgetUs = 50.0f;
+
+    // Range history (ring buffer)
+    std::array<double, RangeHistorySize> m_rangeTime{};
+    std::array<float, RangeHistorySize> m_range{};
+    int m_rangeHead = 0;
+    int m_rangeCount = 0;
+    float m_rangeRate = 0.0f;
+
+    // Line of sight state
+    bool m_hasState = false;
+    double m_lastTimeS = 0.0;
+    float m_lastGimbalAz = 0.0f;
+    float m_lastGimbalEl = 0.0f;
+    float m_gimbalRateAz = 0.0f;
+    float m_gimbalRateEl = 0.0f;
+    float m_losAzDeg = 0.0f;
+    float m_losElDeg = 0.0f;
+    float m_losRateAz = 0.0f;
+    float m_losRateEl = 0.0f;
+
+    // Cartesian target state relative to the station (x east, y north, z up)
+    Vec3 m_position{};
+    Vec3 m_velocity{};
+    Vec3 m_accel{};
+    bool m_hasVelocity = false;
+};
+
+#endif // INTERCEPTSOLVER_H
@@ -0,0 +1,236 @@
+#include "latencyhistogram.h"
+
+#include <QJsonArray>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace {
+constexpr double kBaseUs = 64.0;
+constexpr int kBucketsPerOctave = 4;
+constexpr quint64 kNoMin = std::numeric_limits<quint64>::max();
+
+// Upper bucket bounds in microseconds, computed once
+const std::array<double, LatencyHistogram::BucketCount> &bucketBoundsUs()
+{
+    static const std::array<double, LatencyHistogram::BucketCount> bounds = [] {
+        std::array<double, LatencyHistogram::BucketCount> b{};
+        for (int i = 0; i < LatencyHistogram::BucketCount; ++i)
+            b[i] = kBaseUs * std::pow(2.0, static_cast<double>(i + 1) / kBucketsPerOctave);
+        return b;
+    }();
+    return bounds;
+}
+}
+
+// ============================================================================
+// LatencyHistogram
+// ============================================================================
+
+LatencyHistogram::LatencyHistogram()
+    : m_count(0), m_sumUs(0), m_minUs(kNoMin), m_maxUs(0)
+{
+    for (auto &bucket : m_buckets)
+        bucket.store(0, std::memory_order_relaxed);
+}
+
+int LatencyHistogram::bucketFor(quint64 latencyUs)
+{
+    const auto &bounds = bucketBoundsUs();
+    const auto it = std::upper_bound(bounds.begin(), bounds.end() - 1, static_cast<double>(latencyUs));
+    return static_cast<int>(it - bounds.begin());
+}
+
+double LatencyHistogram::bucketUpperBoundMs(int bucket)
+{
+    return bucketBoundsUs()[std::clamp(bucket, 0, BucketCount - 1)] / 1000.0;
+}
+
+void LatencyHistogram::record(qint64 latencyNs)
+{
+    const quint64 latencyUs = latencyNs > 0 ? static_cast<quint64>(latencyNs / 1000) : 0;
+
+    m_buckets[bucketFor(latencyUs)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sumUs.fetch_add(latencyUs, std::memory_order_relaxed);
+
+    quint64 current = m_minUs.load(std::memory_order_relaxed);
+    while (latencyUs < current && !m_minUs.compare_exchange_weak(current, latencyUs, std::memory_order_relaxed)) {}
+    current = m_maxUs.load(std::memory_order_relaxed);
+    while (latencyUs > current && !m_maxUs.compare_exchange_weak(current, latencyUs, std::memory_order_relaxed)) {}
+}
+
+void LatencyHistogram::reset()
+{
+    for (auto &bucket : m_buckets)
+        bucket.store(0, std::memory_order_relaxed);
+    m_count.store(0, std::memory_order_relaxed);
+    m_sumUs.store(0, std::memory_order_relaxed);
+    m_minUs.store(kNoMin, std::memory_order_relaxed);
+    m_maxUs.store(0, std::memory_order_relaxed);
+}
+
+double LatencyHistogram::percentileMs(const std::array<quint64, BucketCount> &counts,
+                                      quint64 total, double fraction) const
+{
+    // Linear interpolation inside the bucket the percentile falls into
+    const double target = fraction * static_cast<double>(total);
+    double cumulative = 0.0;
+    for (int i = 0; i < BucketCount; ++i) {
+        if (counts[i] == 0)
+            continue;
+        if (cumulative + counts[i] >= target) {
+            const double lower = (i == 0) ? 0.0 : bucketUpperBoundMs(i - 1);
+            const double upper = bucketUpperBoundMs(i);
+            const double within = (target - cumulative) / static_cast<double>(counts[i]);
+            return lower + within * (upper - lower);
+        }
+        cumulative += counts[i];
+    }
+    return bucketUpperBoundMs(BucketCount - 1);
+}
+
+LatencyHistogram::Summary LatencyHistogram::summary() const
+{
+    Summary s;
+    std::array<quint64, BucketCount> counts;
+    quint64 total = 0;
+    for (int i = 0; i < BucketCount; ++i) {
+        counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0)
+        return s;
+
+    s.count = total;
+    s.meanMs = static_cast<double>(m_sumUs.load(std::memory_order_relaxed)) / 1000.0 / total;
+    s.minMs = static_cast<double>(m_minUs.load(std::memory_order_relaxed)) / 1000.0;
+    s.maxMs = static_cast<double>(m_maxUs.load(std::memory_order_relaxed)) / 1000.0;
+    // Bucket interpolation can overshoot the observed extremes; clamp to them
+    s.p50Ms = std::clamp(percentileMs(counts, total, 0.50), s.minMs, s.maxMs);
+    s.p95Ms = std::clamp(percentileMs(counts, total, 0.95), s.minMs, s.maxMs);
+    s.p99Ms = std::clamp(percentileMs(counts, total, 0.99), s.minMs, s.maxMs);
+    return s;
+}
+
+QJsonObject LatencyHistogram::toJson() const
+{
+    const Summary s = summary();
+
+    QJsonObject json;
+    json["count"] = static_cast<qint64>(s.count);
+    json["meanMs"] = s.meanMs;
+    json["minMs"] = s.minMs;
+    json["maxMs"] = s.maxMs;
+    json["p50Ms"] = s.p50Ms;
+    json["p95Ms"] = s.p95Ms;
+    json["p99Ms"] = s.p99Ms;
+
+    QJsonArray buckets;
+    for (int i = 0; i < BucketCount; ++i) {
+        const quint64 count = m_buckets[i].load(std::memory_order_relaxed);
+        if (count == 0)
+            continue;
+        QJsonObject bucket;
+        bucket["leMs"] = bucketUpperBoundMs(i);
+        bucket["count"] = static_cast<qint64>(count);
+        buckets.append(bucket);
+    }
+    json["buckets"] = buckets;
+    return json;
+}
+
+// ============================================================================
+// FrameLatencyMonitor
+// ============================================================================
+
+qint64 FrameLatencyMonitor::nowNs()
+{
+    // steady_clock is CLOCK_MONOTONIC on Linux, same as GstSystemClock's default
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+const char *FrameLatencyMonitor::stageName(FrameStage stage)
+{
+    switch (stage) {
+    case FrameStage::CaptureToSample:  return "captureToSample";
+    case FrameStage::Conversion:       return "conversion";
+    case FrameStage::Detection:        return "detection";
+    case FrameStage::Tracking:         return "tracking";
+    case FrameStage::SampleToEmit:     return "sampleToEmit";
+    case FrameStage::CaptureToEmit:    return "captureToEmit";
+    case FrameStage::EmitToOsd:        return "emitToOsd";
+    case FrameStage::CaptureToOsd:     return "captureToOsd";
+    case FrameStage::CaptureToDisplay: return "captureToDisplay";
+    case FrameStage::StateSkew:        return "stateSkew";
+    case FrameStage::Count:            break;
+    }
+    return "unknown";
+}
+
+void FrameLatencyMonitor::record(int cameraIndex, FrameStage stage, qint64 latencyNs)
+{
+    if (cameraIndex < 0 || cameraIndex >= MaxCameras || stage == FrameStage::Count)
+        return;
+    m_histograms[cameraIndex][static_cast<int>(stage)].record(latencyNs);
+}
+
+const LatencyHistogram &FrameLatencyMonitor::histogram(int cameraIndex, FrameStage stage) const
+{
+    const int camera = std::clamp(cameraIndex, 0, MaxCameras - 1);
+    const int index = std::clamp(static_cast<int>(stage), 0, static_cast<int>(FrameStage::Count) - 1);
+    return m_histograms[camera][index];
+}
+
+void FrameLatencyMonitor::recordProcessedFrame(int cameraIndex)
+{
+    if (cameraIndex >= 0 && cameraIndex < MaxCameras)
+        m_processedFrames[cameraIndex].fetch_add(1, std::memory_order_relaxed);
+}
+
+void FrameLatencyMonitor::recordDroppedFrames(int cameraIndex, quint64 count)
+{
+    if (cameraIndex >= 0 && cameraIndex < MaxCameras)
+        m_droppedFrames[cameraIndex].fetch_add(count, std::memory_order_relaxed);
+}
+
+quint64 FrameLatencyMonitor::processedFrames(int cameraIndex) const
+{
+    return m_processedFrames[std::clamp(cameraIndex, 0, MaxCameras - 1)].load(std::memory_order_relaxed);
+}
+
+quint64 FrameLatencyMonitor::droppedFrames(int cameraIndex) const
+{
+    return m_droppedFrames[std::clamp(cameraIndex, 0, MaxCameras - 1)].load(std::memory_order_relaxed);
+}
+
+void FrameLatencyMonitor::reset()
+{
+    for (auto &camera : m_histograms)
+        for (auto &histogram : camera)
+            histogram.reset();
+    for (int camera = 0; camera < MaxCameras; ++camera) {
+        m_processedFrames[camera].store(0, std::memory_order_relaxed);
+        m_droppedFrames[camera].store(0, std::memory_order_relaxed);
+    }
+}
+
+QJsonObject FrameLatencyMonitor::toJson() const
+{
+    QJsonObject json;
+    for (int camera = 0; camera < MaxCameras; ++camera) {
+        QJsonObject stages;
+        for (int stage = 0; stage < static_cast<int>(FrameStage::Count); ++stage) {
+            stages[stageName(static_cast<FrameStage>(stage))] = m_histograms[camera][stage].toJson();
+        }
+        QJsonObject frames;
+        frames["processed"] = static_cast<qint64>(processedFrames(camera));
+        frames["dropped"] = static_cast<qint64>(droppedFrames(camera));
+        stages["frames"] = frames;
+        json[camera == 0 ? "day" : "night"] = stages;
+    }
+    return json;
+}
@@ -0,0 +1,121 @@
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <QJsonObject>
+#include <QtGlobal>
+
+#include <array>
+#include <atomic>
+
+/**
+ * @brief Lock-free latency histogram with log-spaced buckets.
+ *
+ * Four buckets per octave starting at 64 us (bucket i ends at 64 * 2^((i+1)/4) us),
+ * so percentiles are resolved to within ~19%; the last bucket collects everything
+ * above ~4 s. Recording is wait-free so it can be called from the camera threads
+ * and the GUI thread without contention.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr int BucketCount = 64;
+
+    struct Summary {
+        quint64 count = 0;
+        double meanMs = 0.0;
+        double minMs = 0.0;
+        double maxMs = 0.0;
+        double p50Ms = 0.0;
+        double p95Ms = 0.0;
+        double p99Ms = 0.0;
+    };
+
+    LatencyHistogram();
+
+    void record(qint64 latencyNs);
+    void reset();
+
+    Summary summary() const;
+    QJsonObject toJson() const;
+
+    static double bucketUpperBoundMs(int bucket);
+
+private:
+    static int bucketFor(quint64 latencyUs);
+    double percentileMs(const std::array<quint64, BucketCount> &counts, quint64 total, double fraction) const;
+
+    std::array<std::atomic<quint64>, BucketCount> m_buckets;
+    std::atomic<quint64> m_count;
+    std::atomic<quint64> m_sumUs;
+    std::atomic<quint64> m_minUs;
+    std::atomic<quint64> m_maxUs;
+};
+
+/**
+ * @brief Video pipeline stages tracked by FrameLatencyMonitor.
+ *
+ * All timestamps are CLOCK_MONOTONIC nanoseconds, the same clock GStreamer's
+ * system clock uses, so capture PTS and wall time can be subtracted directly.
+ */
+enum class FrameStage {
+    CaptureToSample,   ///< Sensor capture -> appsink callback (driver + decode + crop/scale)
+    Conversion,        ///< Fused YUV -> BGRA/tensor conversion
+    Detection,         ///< Detection service round trip (including batching wait)
+    Tracking,          ///< VPI tracker cycle
+    SampleToEmit,      ///< Whole processFrame()
+    CaptureToEmit,     ///< Sensor capture -> frameDataReady
+    EmitToOsd,         ///< frameDataReady -> OsdController (queued connection hop)
+    CaptureToOsd,      ///< Glass-to-reticle: sensor capture -> OSD update
+    CaptureToDisplay,  ///< Sensor capture -> image handed to the video provider
+    StateSkew,         ///< |capture time - attached state snapshot time|
+    Count
+};
+
+/**
+ * @brief Process-wide per-camera, per-stage latency histograms and frame counters.
+ */
+class FrameLatencyMonitor
+{
+public:
+    static constexpr int MaxCameras = 2;
+
+    static FrameLatencyMonitor& instance() {
+        static FrameLatencyMonitor instance;
+        return instance;
+    }
+
+    /**
+     * @brief Current CLOCK_MONOTONIC time in nanoseconds.
+     */
+    static qint64 nowNs();
+
+    static const char *stageName(FrameStage stage);
+
+    void record(int cameraIndex, FrameStage stage, qint64 latencyNs);
+    const LatencyHistogram &histogram(int cameraIndex, FrameStage stage) const;
+
+    // Frame counters: processed = emitted to frameDataReady, dropped = lost
+    // upstream (PTS gaps) or failed in processFrame()
+    void recordProcessedFrame(int cameraIndex);
+    void recordDroppedFrames(int cameraIndex, quint64 count = 1);
+    quint64 processedFrames(int cameraIndex) const;
+    quint64 droppedFrames(int cameraIndex) const;
+
+    void reset();
+
+    /**
+     * @brief { "day": { "<stage>": {...}, "frames": { "processed", "dropped" } }, "night": { ... } }
+     */
+    QJsonObject toJson() const;
+
+private:
+    FrameLatencyMonitor() = default;
+    FrameLatencyMonitor(const FrameLatencyMonitor&) = delete;
+    FrameLatencyMonitor& operator=(const FrameLatencyMonitor&) = delete;
+
+    std::array<std::array<LatencyHistogram, static_cast<int>(FrameStage::Count)>, MaxCameras> m_histograms;
+    std::array<std::atomic<quint64>, MaxCameras> m_processedFrames{};
+    std::array<std::atomic<quint64>, MaxCameras> m_droppedFrames{};
+};
+
+#endif // LATENCYHISTOGRAM_H
@@ -0,0 +1,168 @@
+#include "pidtuningbenchmark.h"
+
+#include <QDebug>
+#include <QFile>
+#include <QJsonDocument>
+
+#include <cstdio>
+
+namespace {
+const DeviceConfiguration::PidGainConfig &loopGains(const DeviceConfiguration::AxisTuningConfig &tuning,
+                                                    PidTuner::Loop loop)
+{
+    switch (loop) {
+    case PidTuner::Loop::Tracking:  return tuning.tracking;
+    case PidTuner::Loop::RadarSlew: return tuning.radarSlew;
+    case PidTuner::Loop::ScanTrim:  break;
+    }
+    return tuning.scanTrim;
+}
+
+AxisPlantModel configuredPlant(const DeviceConfiguration::AxisTuningConfig &tuning)
+{
+    AxisPlantModel plant;
+    plant.gain = tuning.plantGain;
+    plant.timeConstantS = tuning.plantTimeConstantS;
+    plant.deadTimeS = tuning.plantDeadTimeS;
+    plant.valid = true;
+    return plant;
+}
+
+QJsonObject gainsJson(const PidGains &gains)
+{
+    QJsonObject json;
+    json["kp"] = gains.kp;
+    json["ki"] = gains.ki;
+    json["kd"] = gains.kd;
+    return json;
+}
+
+QJsonObject metricsJson(const AxisPlantSimulator::StepMetrics &metrics)
+{
+    QJsonObject json;
+    json["overshootPct"] = metrics.overshootPct;
+    json["riseTimeS"] = metrics.riseTimeS;
+    json["settlingTimeS"] = metrics.settlingTimeS;
+    json["iaeDegS"] = metrics.iaeDegS;
+    json["finalErrorDeg"] = metrics.finalErrorDeg;
+    json["peakVelocityDegS"] = metrics.peakVelocityDegS;
+    json["settled"] = metrics.settled;
+    return json;
+}
+}
+
+DeviceConfiguration::AxisTuningConfig PidTuningBenchmark::retune(const DeviceConfiguration::AxisTuningConfig &tuning,
+                                                                 const AxisPlantModel &plant)
+{
+    DeviceConfiguration::AxisTuningConfig retuned = tuning;
+    retuned.plantGain = plant.gain;
+    retuned.plantTimeConstantS = plant.timeConstantS;
+    retuned.plantDeadTimeS = plant.deadTimeS;
+    retuned.identified = true;
+
+    const auto toConfig = [&plant](PidTuner::Loop loop) {
+        const PidGains gains = PidTuner::tune(plant, loop);
+        return DeviceConfiguration::PidGainConfig{gains.kp, gains.ki, gains.kd};
+    };
+    retuned.tracking = toConfig(PidTuner::Loop::Tracking);
+    retuned.radarSlew = toConfig(PidTuner::Loop::RadarSlew);
+    retuned.scanTrim = toConfig(PidTuner::Loop::ScanTrim);
+    return retuned;
+}
+
+QJsonObject PidTuningBenchmark::compareAxis(const DeviceConfiguration::AxisTuningConfig &configured,
+                                            const AxisPlantModel &plant, double durationS)
+{
+    QJsonObject json;
+    QJsonObject plantJson;
+    plantJson["gain"] = plant.gain;
+    plantJson["timeConstantS"] = plant.timeConstantS;
+    plantJson["deadTimeS"] = plant.deadTimeS;
+    json["plant"] = plantJson;
+
+    const AxisPlantSimulator simulator(plant);
+    bool pass = true;
+    QJsonObject loops;
+    for (PidTuner::Loop loop : PidTuner::Loops) {
+        const PidTuner::LoopProfile profile = PidTuner::profile(loop);
+        const DeviceConfiguration::PidGainConfig &current = loopGains(configured, loop);
+        const PidGains configuredGains{current.kp, current.ki, current.kd};
+        const PidGains tunedGains = PidTuner::tune(plant, loop);
+
+        const auto before = simulator.stepResponse(configuredGains, profile.stepDeg, durationS, profile.maxIntegral);
+        const auto after = simulator.stepResponse(tunedGains, profile.stepDeg, durationS, profile.maxIntegral);
+        const bool loopPass = after.iaeDegS <= before.iaeDegS * (1.0 + MaxIaeRegression);
+        pass &= loopPass;
+
+        QJsonObject loopJson;
+        loopJson["stepDeg"] = profile.stepDeg;
+        loopJson["configuredGains"] = gainsJson(configuredGains);
+        loopJson["configured"] = metricsJson(before);
+        loopJson["retunedGains"] = gainsJson(tunedGains);
+        loopJson["retuned"] = metricsJson(after);
+        loopJson["pass"] = loopPass;
+        loops[profile.name] = loopJson;
+    }
+    json["loops"] = loops;
+    json["pass"] = pass;
+    return json;
+}
+
+QJsonObject PidTuningBenchmark::run(const Options &options)
+{
+    QJsonObject json;
+    json["durationS"] = options.durationS;
+    json["maxIaeRegression"] = MaxIaeRegression;
+
+    const struct {
+        const char *name;
+        const DeviceConfiguration::AxisTuningConfig &tuning;
+    } axes[] = {{"azimuth", options.azimuth}, {"elevation", options.elevation}};
+
+    bool pass = true;
+    for (const auto &axis : axes) {
+        QJsonObject result = compareAxis(axis.tuning, configuredPlant(axis.tuning), options.durationS);
+        result["identified"] = axis.tuning.identified;
+        pass &= result["pass"].toBool();
+
+        const QJsonObject loops = result["loops"].toObject();
+        for (PidTuner::Loop loop : PidTuner::Loops) {
+            const char *name = PidTuner::profile(loop).name;
+            const QJsonObject loopJson = loops[name].toObject();
+            const QJsonObject before = loopJson["configured"].toObject();
+            const QJsonObject after = loopJson["retuned"].toObject();
+            qInfo().noquote() << QString("PidTuningBenchmark: %1 %2 | overshoot %3% -> %4% | "
+                                         "settling %5 s -> %6 s | IAE %7 -> %8 deg*s")
+                                     .arg(axis.name, name)
+                                     .arg(before["overshootPct"].toDouble(), 0, 'f', 1)
+                                     .arg(after["overshootPct"].toDouble(), 0, 'f', 1)
+                                     .arg(before["settlingTimeS"].toDouble(), 0, 'f', 2)
+                                     .arg(after["settlingTimeS"].toDouble(), 0, 'f', 2)
+                                     .arg(before["iaeDegS"].toDouble(), 0, 'f', 2)
+                                     .arg(after["iaeDegS"].toDouble(), 0, 'f', 2);
+        }
+        json[axis.name] = result;
+    }
+    json["pass"] = pass;
+    return json;
+}
+
+int PidTuningBenchmark::writeReport(const QJsonObject &report, const QString &path)
+{
+    const int exitCode = report["pass"].toBool() ? 0 : 1;
+    const QByteArray document = QJsonDocument(report).toJson(QJsonDocument::Indented);
+    if (path.isEmpty()) {
+        std::fwrite(document.constData(), 1, static_cast<size_t>(document.size()), stdout);
+        std::fflush(stdout);
+        return exitCode;
+    }
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "PidTuningBenchmark: Cannot write report to" << path;
+        return 2;
+    }
+    file.write(document);
+    qInfo() << "PidTuningBenchmark: Report written to" << path;
+    return exitCode;
+}
@@ -0,0 +1,46 @@
+#ifndef PIDTUNINGBENCHMARK_H
+#define PIDTUNINGBENCHMARK_H
+
+#include <QJsonObject>
+#include <QString>
+
+#include "controllers/deviceconfiguration.h"
+#include "controllers/motion_modes/planttuning.h"
+
+/**
+ * @brief Offline comparison of configured and plant-tuned gimbal PID gains.
+ *
+ * Replays the plant stored in gimbal.tuning for each axis (AxisPlantSimulator)
+ * and runs the step that each motion-mode loop typically corrects, once with
+ * the configured gains and once with the gains PidTuner computes for the
+ * plant. No hardware is involved; the system identification mode uses the
+ * same comparison after fitting a new plant.
+ */
+class PidTuningBenchmark
+{
+public:
+    struct Options {
+        DeviceConfiguration::AxisTuningConfig azimuth;
+        DeviceConfiguration::AxisTuningConfig elevation;
+        double durationS = 60.0;        // Simulated time per step response
+        QString reportPath;             // Empty = print to stdout
+    };
+
+    // Gate for the report's "pass" flag: retuned IAE at most this fraction above the configured one
+    static constexpr double MaxIaeRegression = 0.05;
+
+    static QJsonObject run(const Options &options);
+
+    // Copy of tuning with the plant fields set and every loop retuned for it
+    static DeviceConfiguration::AxisTuningConfig retune(const DeviceConfiguration::AxisTuningConfig &tuning,
+                                                        const AxisPlantModel &plant);
+
+    // Configured against retuned step response of every loop on the plant
+    static QJsonObject compareAxis(const DeviceConfiguration::AxisTuningConfig &configured,
+                                   const AxisPlantModel &plant, double durationS);
+
+    // Writes the report and returns the process exit code (non-zero if the gate failed)
+    static int writeReport(const QJsonObject &report, const QString &path);
+};
+
+#endif // PIDTUNINGBENCHMARK_H
@@ -68,3 +68,17 @@ QPointF ReticleAimpointCalculator::calculateReticleImagePositionPx(
     return QPointF(screenCenterX_px + totalPixelShift.x(),
                    screenCenterY_px + totalPixelShift.y());
 }
+
+QPointF ReticleAimpointCalculator::angularOffsetToImagePositionPx(
+    float offsetAzDeg, float offsetElDeg,
+    float cameraHfovDeg, int imageWidthPx, int imageHeightPx)
+{
+    // The reticle shift is opposite to the gun offset, so a point that sits
+    // at (+az, +el) from boresight is found at the shift of (-az, -el).
+    QPointF shift = ReticleAimpointCalculator::convertSingleAngularToPixelShift(
+                        -offsetAzDeg, -offsetElDeg,
+                        cameraHfovDeg, imageWidthPx, imageHeightPx);
+
+    return QPointF(static_cast<qreal>(imageWidthPx) / 2.0 + shift.x(),
+                   static_cast<qreal>(imageHeightPx) / 2.0 + shift.y());
+}
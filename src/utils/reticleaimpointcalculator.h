@@ -16,6 +16,12 @@ public:
         float cameraHfovDeg, int imageWidthPx, int imageHeightPx
     );
 
+    // Image position of a point offset (az right, el up) from the boresight
+    static QPointF angularOffsetToImagePositionPx(
+        float offsetAzDeg, float offsetElDeg,
+        float cameraHfovDeg, int imageWidthPx, int imageHeightPx
+    );
+
 private:
     static QPointF convertSingleAngularToPixelShift(
         float angularOffsetAzDeg, float angularOffsetElDeg,
@@ -0,0 +1,151 @@
+#include "startupprofiler.h"
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QThread>
+#include <algorithm>
+
+StartupProfiler::StartupProfiler()
+{
+    m_clock.start();
+}
+
+double StartupProfiler::elapsedMs() const
+{
+    return m_clock.nsecsElapsed() / 1e6;
+}
+
+QString StartupProfiler::currentThreadName()
+{
+    QThread* thread = QThread::currentThread();
+    if (!thread->objectName().isEmpty()) {
+        return thread->objectName();
+    }
+    // Before QGuiApplication exists everything runs on the main thread
+    const QCoreApplication* app = QCoreApplication::instance();
+    return (!app || app->thread() == thread) ? QStringLiteral("main") : QStringLiteral("worker");
+}
+
+void StartupProfiler::begin(const QString& name, const QString& category)
+{
+    Span span;
+    span.name = name;
+    span.category = category;
+    span.thread = currentThreadName();
+    span.startMs = elapsedMs();
+
+    QMutexLocker locker(&m_mutex);
+    m_spans.append(span);
+}
+
+void StartupProfiler::end(const QString& name, bool ok)
+{
+    const double nowMs = elapsedMs();
+
+    QMutexLocker locker(&m_mutex);
+    for (auto it = m_spans.rbegin(); it != m_spans.rend(); ++it) {
+        if (it->name == name && it->endMs < 0.0) {
+            it->endMs = nowMs;
+            it->ok = ok;
+            return;
+        }
+    }
+    qWarning() << "StartupProfiler: end() without begin() for" << name;
+}
+
+bool StartupProfiler::milestone(const QString& name)
+{
+    const double nowMs = elapsedMs();
+
+    QMutexLocker locker(&m_mutex);
+    if (m_milestones.contains(name)) {
+        return false;
+    }
+    m_milestones.insert(name, nowMs);
+    locker.unlock();
+
+    qInfo().noquote() << QString("Startup milestone '%1' at %2 ms").arg(name).arg(nowMs, 0, 'f', 1);
+    return true;
+}
+
+bool StartupProfiler::hasMilestone(const QString& name) const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_milestones.contains(name);
+}
+
+QJsonObject StartupProfiler::toJson() const
+{
+    QMutexLocker locker(&m_mutex);
+
+    QJsonArray spans;
+    for (const Span& span : m_spans) {
+        QJsonObject obj;
+        obj["name"] = span.name;
+        obj["category"] = span.category;
+        obj["thread"] = span.thread;
+        obj["startMs"] = span.startMs;
+        obj["durationMs"] = span.endMs < 0.0 ? QJsonValue() : QJsonValue(span.endMs - span.startMs);
+        obj["ok"] = span.ok;
+        spans.append(obj);
+    }
+
+    QJsonObject milestones;
+    for (auto it = m_milestones.cbegin(); it != m_milestones.cend(); ++it) {
+        milestones[it.key()] = it.value();
+    }
+
+    QJsonObject root;
+    root["spans"] = spans;
+    root["milestones"] = milestones;
+    return root;
+}
+
+void StartupProfiler::logSummary() const
+{
+    QMutexLocker locker(&m_mutex);
+
+    qInfo() << "=== Startup profile ===";
+    for (const Span& span : m_spans) {
+        const QString duration = span.endMs < 0.0
+            ? QStringLiteral("running")
+            : QString("%1 ms").arg(span.endMs - span.startMs, 8, 'f', 1);
+        qInfo().noquote() << QString("  %1 +%2  %3  %4/%5%6")
+                                 .arg(span.thread, -8)
+                                 .arg(span.startMs, 8, 'f', 1)
+                                 .arg(duration, 11)
+                                 .arg(span.category, span.name)
+                                 .arg(span.ok ? QString() : QStringLiteral("  FAILED"));
+    }
+
+    QVector<QPair<double, QString>> milestones;
+    for (auto it = m_milestones.cbegin(); it != m_milestones.cend(); ++it) {
+        milestones.append({it.value(), it.key()});
+    }
+    std::sort(milestones.begin(), milestones.end());
+    for (const auto& milestone : milestones) {
+        qInfo().noquote() << QString("  milestone %1 ms  %2").arg(milestone.first, 8, 'f', 1).arg(milestone.second);
+    }
+}
+
+bool StartupProfiler::writeReport(const QString& filePath) const
+{
+    QDir().mkpath(QFileInfo(filePath).absolutePath());
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qWarning() << "StartupProfiler: cannot write" << filePath << file.errorString();
+        return false;
+    }
+    file.write(QJsonDocument(toJson()).toJson(QJsonDocument::Indented));
+    if (!file.commit()) {
+        qWarning() << "StartupProfiler: cannot write" << filePath << file.errorString();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,92 @@
+#ifndef STARTUPPROFILER_H
+#define STARTUPPROFILER_H
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QJsonObject>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+
+/**
+ * @brief Process-wide record of how long startup took and where.
+ *
+ * Spans cover the startup phases in main(), each task of the hardware
+ * bring-up graph and background work such as the detection model warm-up;
+ * milestones mark the moments the operator cares about (first live video
+ * frame, gimbal drivers answering). Times are milliseconds since the first
+ * use of the profiler, which main() makes before anything else.
+ *
+ * Thread-safe: bring-up tasks record from worker threads.
+ */
+class StartupProfiler
+{
+public:
+    static StartupProfiler& instance() {
+        static StartupProfiler instance;
+        return instance;
+    }
+
+    /**
+     * @brief Times the enclosing block as one span.
+     */
+    class Scope
+    {
+    public:
+        Scope(const QString& name, const QString& category)
+            : m_name(name) { StartupProfiler::instance().begin(name, category); }
+        ~Scope() { StartupProfiler::instance().end(m_name, m_ok); }
+
+        void setOk(bool ok) { m_ok = ok; }
+
+    private:
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        QString m_name;
+        bool m_ok = true;
+    };
+
+    double elapsedMs() const;
+
+    void begin(const QString& name, const QString& category);
+    void end(const QString& name, bool ok = true);
+
+    /**
+     * @brief Records a milestone; only the first call for a name counts.
+     * @return True if this call recorded it.
+     */
+    bool milestone(const QString& name);
+    bool hasMilestone(const QString& name) const;
+
+    /**
+     * @brief { "spans": [ { name, category, thread, startMs, durationMs, ok } ], "milestones": { name: ms } }
+     */
+    QJsonObject toJson() const;
+
+    void logSummary() const;
+    bool writeReport(const QString& filePath) const;
+
+private:
+    struct Span {
+        QString name;
+        QString category;
+        QString thread;
+        double startMs = 0.0;
+        double endMs = -1.0;    // -1 while running
+        bool ok = true;
+    };
+
+    StartupProfiler();
+    StartupProfiler(const StartupProfiler&) = delete;
+    StartupProfiler& operator=(const StartupProfiler&) = delete;
+
+    static QString currentThreadName();
+
+    mutable QMutex m_mutex;
+    QElapsedTimer m_clock;
+    QVector<Span> m_spans;
+    QHash<QString, double> m_milestones;
+};
+
+#endif // STARTUPPROFILER_H
@@ -0,0 +1,179 @@
+#include "startuptaskgraph.h"
+#include "startupprofiler.h"
+
+#include <QDebug>
+#include <QtConcurrent>
+#include <exception>
+
+namespace {
+bool runTimed(const QString& name, const QString& category, const std::function<bool()>& run)
+{
+    StartupProfiler::Scope scope(name, category);
+    bool ok = false;
+    try {
+        ok = run();
+    } catch (const std::exception& e) {
+        qCritical() << "Startup task" << name << "threw:" << e.what();
+    }
+    if (!ok) {
+        qWarning() << "Startup task" << name << "failed";
+    }
+    scope.setOk(ok);
+    return ok;
+}
+}
+
+StartupTaskGraph::StartupTaskGraph(const QString& category, QObject* parent)
+    : QObject(parent),
+      m_category(category)
+{
+}
+
+void StartupTaskGraph::addTask(const QString& name, std::function<bool()> run,
+                               const QStringList& dependsOn, Affinity affinity)
+{
+    if (m_started) {
+        qWarning() << "StartupTaskGraph: cannot add" << name << "after start()";
+        return;
+    }
+    if (indexOf(name) >= 0) {
+        qWarning() << "StartupTaskGraph: duplicate task" << name;
+        return;
+    }
+
+    Task task;
+    task.name = name;
+    task.run = std::move(run);
+    task.dependsOn = dependsOn;
+    task.affinity = affinity;
+    m_tasks.append(task);
+}
+
+void StartupTaskGraph::start()
+{
+    if (m_started) {
+        return;
+    }
+    m_started = true;
+    m_remaining = m_tasks.size();
+
+    if (m_remaining == 0) {
+        QMetaObject::invokeMethod(this, [this]() { emit finished(true); }, Qt::QueuedConnection);
+        return;
+    }
+    schedule();
+}
+
+QStringList StartupTaskGraph::failedTasks() const
+{
+    QStringList failed;
+    for (const Task& task : m_tasks) {
+        if (task.state == State::Failed || task.state == State::Skipped) {
+            failed.append(task.name);
+        }
+    }
+    return failed;
+}
+
+void StartupTaskGraph::schedule()
+{
+    bool progressed = true;
+    while (progressed) {
+        progressed = false;
+        for (int i = 0; i < m_tasks.size(); ++i) {
+            Task& task = m_tasks[i];
+            if (task.state != State::Pending) {
+                continue;
+            }
+
+            bool ready = true;
+            QString blockedBy;
+            for (const QString& dependency : task.dependsOn) {
+                const int d = indexOf(dependency);
+                const State state = d < 0 ? State::Failed : m_tasks.at(d).state;
+                if (state == State::Failed || state == State::Skipped) {
+                    blockedBy = dependency;
+                    break;
+                }
+                if (state != State::Done) {
+                    ready = false;
+                }
+            }
+
+            if (!blockedBy.isEmpty()) {
+                qWarning() << "Startup task" << task.name << "skipped:" << blockedBy << "did not complete";
+                task.state = State::Skipped;
+                --m_remaining;
+                progressed = true;
+                emit taskFinished(task.name, false);
+            } else if (ready) {
+                launch(i);
+            }
+        }
+    }
+
+    if (m_remaining == 0) {
+        emit finished(failedTasks().isEmpty());
+        return;
+    }
+
+    if (m_running == 0) {
+        // Nothing running and nothing ready: the rest wait on each other
+        for (Task& task : m_tasks) {
+            if (task.state == State::Pending) {
+                qWarning() << "Startup task" << task.name << "skipped: dependency cycle";
+                task.state = State::Skipped;
+                emit taskFinished(task.name, false);
+            }
+        }
+        m_remaining = 0;
+        emit finished(false);
+    }
+}
+
+void StartupTaskGraph::launch(int index)
+{
+    Task& task = m_tasks[index];
+    task.state = State::Running;
+    ++m_running;
+
+    // The closures own copies so a worker never reaches back into the graph
+    auto work = [name = task.name, category = m_category, run = task.run]() {
+        return runTimed(name, category, run);
+    };
+
+    if (task.affinity == Affinity::Worker) {
+        QtConcurrent::run(work).then(this, [this, index](bool ok) {
+            complete(index, ok ? State::Done : State::Failed);
+        });
+    } else {
+        QMetaObject::invokeMethod(this, [this, index, work]() {
+            complete(index, work() ? State::Done : State::Failed);
+        }, Qt::QueuedConnection);
+    }
+}
+
+void StartupTaskGraph::complete(int index, State state)
+{
+    Task& task = m_tasks[index];
+    task.state = state;
+    --m_running;
+    --m_remaining;
+    emit taskFinished(task.name, state == State::Done);
+
+    if (m_remaining == 0) {
+        emit finished(failedTasks().isEmpty());
+    } else {
+        schedule();
+    }
+}
+
+int StartupTaskGraph::indexOf(const QString& name) const
+{
+    for (int i = 0; i < m_tasks.size(); ++i) {
+        if (m_tasks.at(i).name == name) {
+            return i;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,69 @@
+#ifndef STARTUPTASKGRAPH_H
+#define STARTUPTASKGRAPH_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include <functional>
+
+/**
+ * @brief Runs startup tasks as soon as their dependencies have completed.
+ *
+ * Each task names the tasks it depends on and where it runs:
+ *  - MainThread: queued on the owner's event loop, one task per event so the
+ *    UI keeps rendering between them. Anything touching a QObject that lives
+ *    on the GUI thread (serial ports, Modbus clients, timers) belongs here.
+ *  - Worker: run on the global thread pool, in parallel with everything else.
+ *    Must not touch GUI-thread QObjects.
+ *
+ * A task returns false (or throws) to fail; tasks depending on it are skipped.
+ * Every task is recorded as a StartupProfiler span under the graph's category.
+ */
+class StartupTaskGraph : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum class Affinity { MainThread, Worker };
+
+    explicit StartupTaskGraph(const QString& category, QObject* parent = nullptr);
+
+    void addTask(const QString& name, std::function<bool()> run,
+                 const QStringList& dependsOn = {}, Affinity affinity = Affinity::MainThread);
+
+    // Returns immediately; finished() is emitted once every task has completed or been skipped
+    void start();
+
+    bool isFinished() const { return m_started && m_remaining == 0; }
+    QStringList failedTasks() const;
+
+signals:
+    void taskFinished(const QString& name, bool ok);
+    void finished(bool ok);
+
+private:
+    enum class State { Pending, Running, Done, Failed, Skipped };
+
+    struct Task {
+        QString name;
+        std::function<bool()> run;
+        QStringList dependsOn;
+        Affinity affinity = Affinity::MainThread;
+        State state = State::Pending;
+    };
+
+    void schedule();
+    void launch(int index);
+    void complete(int index, State state);
+    int indexOf(const QString& name) const;
+
+    QString m_category;
+    QVector<Task> m_tasks;
+    int m_remaining = 0;
+    int m_running = 0;
+    bool m_started = false;
+};
+
+#endif // STARTUPTASKGRAPH_H
@@ -0,0 +1,230 @@
+#include "yuvframeconverter.h"
+
+#include <algorithm>
+
+namespace {
+
+// BT.601 limited range in Q14 fixed point (same coefficients as cv::COLOR_YUV2BGRA_YUY2)
+constexpr int kShift = 14;
+constexpr int kRound = 1 << (kShift - 1);
+constexpr int kCY  = 19077;  // 1.164
+constexpr int kCRV = 26149;  // 1.596
+constexpr int kCGU = 6419;   // 0.391
+constexpr int kCGV = 13320;  // 0.813
+constexpr int kCBU = 33050;  // 2.018
+
+constexpr float kInv255 = 1.0f / 255.0f;
+
+inline uint8_t clampU8(int v)
+{
+    return static_cast<uint8_t>(v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+inline float clampUnit(float v)
+{
+    return std::min(std::max(v * kInv255, 0.0f), 1.0f);
+}
+
+inline void storeBgra(uint8_t *dst, int y, int ruv, int guv, int buv)
+{
+    const int yy = kCY * std::max(y - 16, 0);
+    dst[0] = clampU8((yy + buv + kRound) >> kShift);
+    dst[1] = clampU8((yy - guv + kRound) >> kShift);
+    dst[2] = clampU8((yy + ruv + kRound) >> kShift);
+    dst[3] = 255;
+}
+
+// One display row: each iteration handles a 2-pixel chroma pair
+template <YuvFrameView::Format F>
+void convertDisplayRow(const YuvFrameView &src, int row, uint8_t *dst)
+{
+    const uint8_t *yRow = src.planes[0] + static_cast<size_t>(row) * src.strides[0];
+    const uint8_t *uRow = nullptr;
+    const uint8_t *vRow = nullptr;
+    if (F == YuvFrameView::Format::I420) {
+        uRow = src.planes[1] + static_cast<size_t>(row / 2) * src.strides[1];
+        vRow = src.planes[2] + static_cast<size_t>(row / 2) * src.strides[2];
+    }
+
+    for (int x = 0; x + 1 < src.width; x += 2) {
+        int y0, y1, u, v;
+        if (F == YuvFrameView::Format::YUY2) {
+            const uint8_t *p = yRow + 2 * x;
+            y0 = p[0]; u = p[1] - 128; y1 = p[2]; v = p[3] - 128;
+        } else {
+            y0 = yRow[x]; y1 = yRow[x + 1];
+            u = uRow[x >> 1] - 128; v = vRow[x >> 1] - 128;
+        }
+        const int ruv = kCRV * v;
+        const int guv = kCGU * u + kCGV * v;
+        const int buv = kCBU * u;
+        storeBgra(dst + 4 * x, y0, ruv, guv, buv);
+        storeBgra(dst + 4 * x + 4, y1, ruv, guv, buv);
+    }
+}
+
+template <YuvFrameView::Format F>
+inline int lumaAt(const uint8_t *yRow, int x)
+{
+    return F == YuvFrameView::Format::YUY2 ? yRow[2 * x] : yRow[x];
+}
+
+// One letterboxed tensor row: bilinear luma, nearest chroma, written as planar RGB
+template <YuvFrameView::Format F>
+void sampleTensorRow(const YuvFrameView &src, int y0, int y1, float fy,
+                     const int *x0, const int *x1, const float *fx, int count,
+                     float *r, float *g, float *b)
+{
+    const uint8_t *row0 = src.planes[0] + static_cast<size_t>(y0) * src.strides[0];
+    const uint8_t *row1 = src.planes[0] + static_cast<size_t>(y1) * src.strides[0];
+    const int chromaRow = fy < 0.5f ? y0 : y1;
+    const uint8_t *cRow = src.planes[0] + static_cast<size_t>(chromaRow) * src.strides[0];
+    const uint8_t *uRow = nullptr;
+    const uint8_t *vRow = nullptr;
+    if (F == YuvFrameView::Format::I420) {
+        uRow = src.planes[1] + static_cast<size_t>(chromaRow / 2) * src.strides[1];
+        vRow = src.planes[2] + static_cast<size_t>(chromaRow / 2) * src.strides[2];
+    }
+
+    for (int i = 0; i < count; ++i) {
+        const int xa = x0[i];
+        const int xb = x1[i];
+        const float wx = fx[i];
+
+        const float top = lumaAt<F>(row0, xa) + wx * (lumaAt<F>(row0, xb) - lumaAt<F>(row0, xa));
+        const float bottom = lumaAt<F>(row1, xa) + wx * (lumaAt<F>(row1, xb) - lumaAt<F>(row1, xa));
+        const float luma = top + fy * (bottom - top);
+
+        const int xc = wx < 0.5f ? xa : xb;
+        float u, v;
+        if (F == YuvFrameView::Format::YUY2) {
+            const uint8_t *pair = cRow + 4 * (xc >> 1);
+            u = pair[1] - 128.0f;
+            v = pair[3] - 128.0f;
+        } else {
+            u = uRow[xc >> 1] - 128.0f;
+            v = vRow[xc >> 1] - 128.0f;
+        }
+
+        const float yy = 1.164f * std::max(luma - 16.0f, 0.0f);
+        r[i] = clampUnit(yy + 1.596f * v);
+        g[i] = clampUnit(yy - 0.391f * u - 0.813f * v);
+        b[i] = clampUnit(yy + 2.018f * u);
+    }
+}
+
+} // namespace
+
+YuvFrameConverter::YuvFrameConverter(const cv::Size &tensorShape)
+    : m_tensorShape(tensorShape)
+{
+}
+
+void YuvFrameConverter::updateGeometry(int srcWidth, int srcHeight)
+{
+    if (srcWidth == m_srcWidth && srcHeight == m_srcHeight)
+        return;
+
+    m_srcWidth = srcWidth;
+    m_srcHeight = srcHeight;
+
+    // Same letterbox as YoloInference::formatToSquare()
+    m_letterbox.scale = std::min(static_cast<float>(m_tensorShape.width) / srcWidth,
+                                 static_cast<float>(m_tensorShape.height) / srcHeight);
+    m_resizedWidth = static_cast<int>(srcWidth * m_letterbox.scale);
+    m_resizedHeight = static_cast<int>(srcHeight * m_letterbox.scale);
+    m_letterbox.padX = (m_tensorShape.width - m_resizedWidth) / 2;
+    m_letterbox.padY = (m_tensorShape.height - m_resizedHeight) / 2;
+
+    // Horizontal sampling positions are identical for every row, compute them once
+    m_x0.resize(m_resizedWidth);
+    m_x1.resize(m_resizedWidth);
+    m_fx.resize(m_resizedWidth);
+    const float ratio = static_cast<float>(srcWidth) / m_resizedWidth;
+    for (int i = 0; i < m_resizedWidth; ++i) {
+        const float sx = std::max((i + 0.5f) * ratio - 0.5f, 0.0f);
+        const int x0 = std::min(static_cast<int>(sx), srcWidth - 1);
+        m_x0[i] = x0;
+        m_x1[i] = std::min(x0 + 1, srcWidth - 1);
+        m_fx[i] = (x0 < srcWidth - 1) ? sx - x0 : 0.0f;
+    }
+}
+
+void YuvFrameConverter::convert(const YuvFrameView &src, cv::Mat &bgraOut,
+                                cv::Mat *tensorOut, YoloLetterbox *letterbox)
+{
+    CV_Assert(src.width > 1 && src.height > 0 && src.planes[0]);
+    CV_Assert(src.format == YuvFrameView::Format::YUY2 || (src.planes[1] && src.planes[2]));
+
+    bgraOut.create(src.height, src.width, CV_8UC4);
+
+    const int displayRows = src.height;
+    int tensorRows = 0;
+    float *tensorBase = nullptr;
+    if (tensorOut) {
+        updateGeometry(src.width, src.height);
+        const int tensorSize[] = {1, 3, m_tensorShape.height, m_tensorShape.width};
+        tensorOut->create(4, tensorSize, CV_32F);
+        tensorBase = tensorOut->ptr<float>();
+        tensorRows = m_tensorShape.height;
+    }
+
+    const int tensorWidth = m_tensorShape.width;
+    const size_t planeSize = static_cast<size_t>(m_tensorShape.width) * m_tensorShape.height;
+    const float yRatio = tensorOut ? static_cast<float>(m_srcHeight) / m_resizedHeight : 0.0f;
+    const bool isYuy2 = src.format == YuvFrameView::Format::YUY2;
+
+    // Display rows and tensor rows share a single parallel dispatch
+    cv::parallel_for_(cv::Range(0, displayRows + tensorRows), [&](const cv::Range &range) {
+        for (int row = range.start; row < range.end; ++row) {
+            if (row < displayRows) {
+                uint8_t *dst = bgraOut.ptr<uint8_t>(row);
+                if (isYuy2)
+                    convertDisplayRow<YuvFrameView::Format::YUY2>(src, row, dst);
+                else
+                    convertDisplayRow<YuvFrameView::Format::I420>(src, row, dst);
+                continue;
+            }
+
+            const int ty = row - displayRows;
+            float *r = tensorBase + static_cast<size_t>(ty) * tensorWidth;
+            float *g = r + planeSize;
+            float *b = g + planeSize;
+
+            const int ry = ty - m_letterbox.padY;
+            if (ry < 0 || ry >= m_resizedHeight) {
+                std::fill(r, r + tensorWidth, 0.0f);
+                std::fill(g, g + tensorWidth, 0.0f);
+                std::fill(b, b + tensorWidth, 0.0f);
+                continue;
+            }
+
+            // Letterbox side bars
+            const int rightStart = m_letterbox.padX + m_resizedWidth;
+            std::fill(r, r + m_letterbox.padX, 0.0f);
+            std::fill(g, g + m_letterbox.padX, 0.0f);
+            std::fill(b, b + m_letterbox.padX, 0.0f);
+            std::fill(r + rightStart, r + tensorWidth, 0.0f);
+            std::fill(g + rightStart, g + tensorWidth, 0.0f);
+            std::fill(b + rightStart, b + tensorWidth, 0.0f);
+
+            const float sy = std::max((ry + 0.5f) * yRatio - 0.5f, 0.0f);
+            const int y0 = std::min(static_cast<int>(sy), m_srcHeight - 1);
+            const int y1 = std::min(y0 + 1, m_srcHeight - 1);
+            const float fy = (y0 < m_srcHeight - 1) ? sy - y0 : 0.0f;
+
+            float *rOut = r + m_letterbox.padX;
+            float *gOut = g + m_letterbox.padX;
+            float *bOut = b + m_letterbox.padX;
+            if (isYuy2)
+                sampleTensorRow<YuvFrameView::Format::YUY2>(src, y0, y1, fy, m_x0.data(), m_x1.data(),
+                                                            m_fx.data(), m_resizedWidth, rOut, gOut, bOut);
+            else
+                sampleTensorRow<YuvFrameView::Format::I420>(src, y0, y1, fy, m_x0.data(), m_x1.data(),
+                                                            m_fx.data(), m_resizedWidth, rOut, gOut, bOut);
+        }
+    });
+
+    if (letterbox)
+        *letterbox = m_letterbox;
+}
@@ -0,0 +1,72 @@
+#ifndef YUVFRAMECONVERTER_H
+#define YUVFRAMECONVERTER_H
+
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "utils/inference.h" // For YoloLetterbox
+
+/**
+ * @brief Non-owning view of a mapped YUV camera frame (one pointer/stride per plane).
+ */
+struct YuvFrameView
+{
+    enum class Format { YUY2, I420 };
+
+    Format format = Format::YUY2;
+    int width = 0;
+    int height = 0;
+    const uint8_t *planes[3] = {nullptr, nullptr, nullptr};
+    int strides[3] = {0, 0, 0};
+};
+
+/**
+ * @brief Fused single-pass YUV -> display BGRA + detection tensor converter.
+ *
+ * Replaces the cvtColor(YUY2->BGRA) -> cvtColor(BGRA->BGR) -> letterbox resize
+ * -> blobFromImage chain with one row-parallel pass over the source frame:
+ *  - every display row is converted to BGRA (BT.601, same as COLOR_YUV2BGRA_YUY2)
+ *  - every detection tensor row is bilinearly sampled straight from the source
+ *    luma, letterboxed and written as normalised planar RGB (NCHW, 1/255)
+ *
+ * Inner loops are branch-free fixed-point / float arithmetic over contiguous
+ * rows so the compiler can vectorise them (NEON on Jetson, SSE/AVX on x86).
+ * Accepts packed YUY2 and planar I420, so the pipeline can hand over whatever
+ * the JPEG decoder produces natively.
+ */
+class YuvFrameConverter
+{
+public:
+    explicit YuvFrameConverter(const cv::Size &tensorShape = cv::Size(640, 640));
+
+    /**
+     * @brief Converts a frame.
+     * @param src Mapped source frame.
+     * @param bgraOut CV_8UC4 destination of src.width x src.height (may wrap external memory).
+     * @param tensorOut If non-null, receives the 1x3xHxW CV_32F detection tensor.
+     * @param letterbox If non-null, receives the letterbox used for tensorOut.
+     */
+    void convert(const YuvFrameView &src, cv::Mat &bgraOut,
+                 cv::Mat *tensorOut = nullptr, YoloLetterbox *letterbox = nullptr);
+
+    cv::Size tensorShape() const { return m_tensorShape; }
+
+private:
+    void updateGeometry(int srcWidth, int srcHeight);
+
+    cv::Size m_tensorShape;
+
+    // Cached letterbox geometry for the current source size
+    int m_srcWidth = 0;
+    int m_srcHeight = 0;
+    int m_resizedWidth = 0;
+    int m_resizedHeight = 0;
+    YoloLetterbox m_letterbox;
+    std::vector<int> m_x0;      // Left source column per resized tensor column
+    std::vector<int> m_x1;      // Right source column per resized tensor column
+    std::vector<float> m_fx;    // Horizontal interpolation weight
+};
+
+#endif // YUVFRAMECONVERTER_H
@@ -0,0 +1,141 @@
+#include "detectionoverlayitem.h"
+#include "models/detectionlistmodel.h"
+#include "osdgeometrybuilder.h"
+
+#include <QFontMetricsF>
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+
+namespace {
+constexpr qreal kLabelGap = 2.0;                              // Between label and box top
+constexpr qreal kLabelOpacity = 0.8;
+constexpr int kMaxCachedLabelWidths = 512;
+}
+
+DetectionOverlayItem::DetectionOverlayItem(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents, true);
+
+    m_labelFont.setFamily(QStringLiteral("Segoe UI"));
+    m_labelFont.setPixelSize(14);
+    m_labelFont.setBold(true);
+}
+
+void DetectionOverlayItem::setModel(DetectionListModel* model)
+{
+    if (m_model == model) return;
+
+    if (m_model) {
+        disconnect(m_model, nullptr, this, nullptr);
+    }
+    m_model = model;
+    if (m_model) {
+        connect(m_model, &DetectionListModel::detectionsUpdated,
+                this, &DetectionOverlayItem::rebuildGeometry);
+    }
+    rebuildGeometry();
+    emit modelChanged();
+}
+
+void DetectionOverlayItem::setLineWidth(qreal width)
+{
+    if (qFuzzyCompare(m_lineWidth, width)) return;
+    m_lineWidth = width;
+    rebuildGeometry();
+    emit lineWidthChanged();
+}
+
+void DetectionOverlayItem::setLabelHeight(qreal height)
+{
+    if (qFuzzyCompare(m_labelHeight, height)) return;
+    m_labelHeight = height;
+    rebuildGeometry();
+    emit labelHeightChanged();
+}
+
+void DetectionOverlayItem::setLabelPadding(qreal padding)
+{
+    if (qFuzzyCompare(m_labelPadding, padding)) return;
+    m_labelPadding = padding;
+    rebuildGeometry();
+    emit labelPaddingChanged();
+}
+
+void DetectionOverlayItem::setLabelFont(const QFont& font)
+{
+    if (m_labelFont == font) return;
+    m_labelFont = font;
+    m_labelWidths.clear();
+    rebuildGeometry();
+    emit labelFontChanged();
+}
+
+qreal DetectionOverlayItem::labelWidth(const QString& text)
+{
+    auto it = m_labelWidths.constFind(text);
+    if (it != m_labelWidths.constEnd()) {
+        return it.value();
+    }
+
+    // Labels are "<class> <percent>%", so the set of distinct strings is small
+    if (m_labelWidths.size() >= kMaxCachedLabelWidths) {
+        m_labelWidths.clear();
+    }
+    const qreal width = QFontMetricsF(m_labelFont).horizontalAdvance(text);
+    m_labelWidths.insert(text, width);
+    return width;
+}
+
+void DetectionOverlayItem::rebuildGeometry()
+{
+    OsdGeometryBuilder builder(&m_vertices);
+    builder.clear();
+
+    const int count = m_model ? m_model->entries().size() : 0;
+    const qreal w = m_lineWidth;
+
+    for (int i = 0; i < count; ++i) {
+        const DetectionListModel::Entry& entry = m_model->entries().at(i);
+        const QRectF& box = entry.box;
+
+        // Border drawn inside the box, like a Rectangle's border
+        builder.fillRect(QRectF(box.left(), box.top(), box.width(), w), entry.color);
+        builder.fillRect(QRectF(box.left(), box.bottom() - w, box.width(), w), entry.color);
+        builder.fillRect(QRectF(box.left(), box.top() + w, w, box.height() - 2 * w), entry.color);
+        builder.fillRect(QRectF(box.right() - w, box.top() + w, w, box.height() - 2 * w), entry.color);
+
+        // Label background above the box
+        const qreal labelW = labelWidth(entry.labelText) + 2.0 * m_labelPadding;
+        builder.fillRect(QRectF(box.left(), box.top() - kLabelGap - m_labelHeight, labelW, m_labelHeight),
+                         entry.color, kLabelOpacity);
+    }
+
+    m_geometryDirty = true;
+    update();
+}
+
+QSGNode* DetectionOverlayItem::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData*)
+{
+    auto* node = static_cast<QSGGeometryNode*>(oldNode);
+    if (!node) {
+        node = new QSGGeometryNode;
+        auto* geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(), 0);
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGVertexColorMaterial);
+        node->setFlag(QSGNode::OwnsMaterial);
+        m_geometryDirty = true;
+    }
+
+    if (!m_geometryDirty) {
+        return node;
+    }
+    m_geometryDirty = false;
+
+    // The GUI thread is blocked during sync, so m_vertices is stable here
+    OsdGeometryBuilder::upload(node->geometry(), m_vertices);
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
@@ -0,0 +1,75 @@
+#ifndef DETECTIONOVERLAYITEM_H
+#define DETECTIONOVERLAYITEM_H
+
+#include <QFont>
+#include <QHash>
+#include <QPointer>
+#include <QQuickItem>
+#include <QSGGeometry>
+#include <QVector>
+
+class DetectionListModel;
+
+/**
+ * @brief Draws every detection box of the OSD in one scene-graph node.
+ *
+ * Box outlines and label backgrounds are triangles in a single vertex-coloured
+ * QSGGeometryNode, so 50+ detections cost one draw call instead of two
+ * Rectangle items each. The vertices are rebuilt on the GUI thread when the
+ * model reports a change; updatePaintNode() only copies them.
+ *
+ * Label text stays in QML (a Repeater of Text over the same model); the
+ * label backgrounds are sized with labelFont, which must match that Text.
+ */
+class DetectionOverlayItem : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(DetectionListModel* model READ model WRITE setModel NOTIFY modelChanged)
+    Q_PROPERTY(qreal lineWidth READ lineWidth WRITE setLineWidth NOTIFY lineWidthChanged)
+    Q_PROPERTY(qreal labelHeight READ labelHeight WRITE setLabelHeight NOTIFY labelHeightChanged)
+    Q_PROPERTY(qreal labelPadding READ labelPadding WRITE setLabelPadding NOTIFY labelPaddingChanged)
+    Q_PROPERTY(QFont labelFont READ labelFont WRITE setLabelFont NOTIFY labelFontChanged)
+
+public:
+    explicit DetectionOverlayItem(QQuickItem *parent = nullptr);
+
+    DetectionListModel* model() const { return m_model; }
+    qreal lineWidth() const { return m_lineWidth; }
+    qreal labelHeight() const { return m_labelHeight; }
+    qreal labelPadding() const { return m_labelPadding; }
+    QFont labelFont() const { return m_labelFont; }
+
+    void setModel(DetectionListModel* model);
+    void setLineWidth(qreal width);
+    void setLabelHeight(qreal height);
+    void setLabelPadding(qreal padding);
+    void setLabelFont(const QFont& font);
+
+signals:
+    void modelChanged();
+    void lineWidthChanged();
+    void labelHeightChanged();
+    void labelPaddingChanged();
+    void labelFontChanged();
+
+protected:
+    QSGNode* updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+private slots:
+    void rebuildGeometry();
+
+private:
+    qreal labelWidth(const QString& text);
+
+    QPointer<DetectionListModel> m_model;
+    qreal m_lineWidth = 3.0;
+    qreal m_labelHeight = 22.0;
+    qreal m_labelPadding = 6.0;
+    QFont m_labelFont;
+
+    QVector<QSGGeometry::ColoredPoint2D> m_vertices;
+    QHash<QString, qreal> m_labelWidths;
+    bool m_geometryDirty = true;
+};
+
+#endif // DETECTIONOVERLAYITEM_H
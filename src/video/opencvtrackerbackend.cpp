@@ -0,0 +1,137 @@
+#include "opencvtrackerbackend.h"
+
+#include <QDebug>
+
+#include <opencv2/imgproc.hpp>
+
+#include <algorithm>
+
+OpenCvTrackerBackend::OpenCvTrackerBackend(Algorithm algorithm, int cameraIndex, float minConfidence)
+    : m_algorithm(algorithm),
+      m_cameraIndex(cameraIndex),
+      m_minConfidence(minConfidence)
+{
+}
+
+QString OpenCvTrackerBackend::name() const
+{
+    return m_algorithm == Algorithm::CSRT ? "OPENCV_CSRT" : "OPENCV_KCF";
+}
+
+bool OpenCvTrackerBackend::initialize(int frameWidth, int frameHeight)
+{
+    m_frameRect = cv::Rect(0, 0, frameWidth, frameHeight);
+    m_frameBGR.create(frameHeight, frameWidth, CV_8UC3);
+    m_frameGray.create(frameHeight, frameWidth, CV_8UC1);
+    try {
+        // Probe once so a build without the tracking module fails here, not mid-lock
+        createTracker();
+    } catch (const cv::Exception &e) {
+        qCritical() << "Cam" << m_cameraIndex << ":" << name() << "unavailable:" << e.what();
+        return false;
+    }
+    qInfo() << "Cam" << m_cameraIndex << ":" << name() << "CPU tracker ready, min confidence" << m_minConfidence;
+    return true;
+}
+
+void OpenCvTrackerBackend::cleanup()
+{
+    m_tracker.release();
+    m_template.release();
+    m_target = {};
+}
+
+cv::Ptr<cv::Tracker> OpenCvTrackerBackend::createTracker() const
+{
+    if (m_algorithm == Algorithm::CSRT)
+        return cv::TrackerCSRT::create();
+    return cv::TrackerKCF::create();
+}
+
+bool OpenCvTrackerBackend::extractPatch(const cv::Rect &box, cv::Mat &patch) const
+{
+    const cv::Rect clipped = box & m_frameRect;
+    if (clipped.width < 2 || clipped.height < 2)
+        return false;
+    cv::Mat resized;
+    cv::resize(m_frameGray(clipped), resized, cv::Size(TemplateSize, TemplateSize), 0, 0, cv::INTER_AREA);
+    resized.convertTo(patch, CV_32F);
+    return true;
+}
+
+bool OpenCvTrackerBackend::initTarget(const cv::Mat &frameBGRA, const QRect &box)
+{
+    m_target = {};
+    const cv::Rect initBox = cv::Rect(box.x(), box.y(), box.width(), box.height()) & m_frameRect;
+    if (initBox.width < 2 || initBox.height < 2) {
+        qWarning() << "Cam" << m_cameraIndex << ":" << name() << "rejected init box" << box;
+        return false;
+    }
+
+    try {
+        cv::cvtColor(frameBGRA, m_frameBGR, cv::COLOR_BGRA2BGR);
+        cv::cvtColor(frameBGRA, m_frameGray, cv::COLOR_BGRA2GRAY);
+        m_tracker = createTracker();
+        m_tracker->init(m_frameBGR, initBox);
+        if (!extractPatch(initBox, m_template))
+            return false;
+    } catch (const cv::Exception &e) {
+        qCritical() << "Cam" << m_cameraIndex << ":" << name() << "init failed:" << e.what();
+        m_tracker.release();
+        return false;
+    }
+
+    m_target.state = TRACKING_STATE_NEW;
+    m_target.bbox = QRect(initBox.x, initBox.y, initBox.width, initBox.height);
+    m_target.confidence = 1.0f;
+    return true;
+}
+
+bool OpenCvTrackerBackend::track(const cv::Mat &frameBGRA)
+{
+    if (!m_tracker) {
+        m_target.state = TRACKING_STATE_LOST;
+        return false;
+    }
+
+    cv::Rect box;
+    bool found = false;
+    try {
+        cv::cvtColor(frameBGRA, m_frameBGR, cv::COLOR_BGRA2BGR);
+        cv::cvtColor(frameBGRA, m_frameGray, cv::COLOR_BGRA2GRAY);
+        found = m_tracker->update(m_frameBGR, box);
+    } catch (const cv::Exception &e) {
+        qCritical() << "Cam" << m_cameraIndex << ":" << name() << "update failed:" << e.what();
+        m_target.state = TRACKING_STATE_LOST;
+        return false;
+    }
+
+    // A target leaving the frame edge is still tracked on its visible part;
+    // it is lost only once too little of the box remains in the image
+    const cv::Rect clipped = box & m_frameRect;
+    const bool visible = found && box.area() > 0 &&
+                         clipped.area() >= MinVisibleFraction * static_cast<float>(box.area());
+
+    float confidence = 0.0f;
+    cv::Mat patch;
+    if (visible && extractPatch(clipped, patch)) {
+        cv::Mat score;
+        cv::matchTemplate(patch, m_template, score, cv::TM_CCOEFF_NORMED);
+        confidence = std::clamp(score.at<float>(0, 0), 0.0f, 1.0f);
+    }
+
+    m_target.confidence = confidence;
+    if (!visible || confidence < m_minConfidence) {
+        qDebug() << "[CAM" << m_cameraIndex << "]" << name() << "lost target, found:" << found
+                 << "visible:" << visible << "confidence:" << confidence;
+        m_target.state = TRACKING_STATE_LOST;
+        return true;
+    }
+
+    m_target.state = TRACKING_STATE_TRACKED;
+    m_target.bbox = QRect(clipped.x, clipped.y, clipped.width, clipped.height);
+    // Adapt only on whole views of the target; a clipped patch is a different crop
+    if (clipped == box)
+        cv::accumulateWeighted(patch, m_template, TemplateLR);
+    return true;
+}
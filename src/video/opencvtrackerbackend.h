@@ -0,0 +1,48 @@
+#ifndef OPENCVTRACKERBACKEND_H
+#define OPENCVTRACKERBACKEND_H
+
+#include "video/trackerbackend.h"
+
+#include <opencv2/tracking.hpp>
+
+/**
+ * @brief CPU tracker backend built on OpenCV's KCF or CSRT trackers.
+ *
+ * Neither tracker exposes a usable score, so confidence is measured the same way
+ * for both: normalised cross-correlation of the tracked patch against a slowly
+ * adapting grey-level template. A target below minConfidence, or one the tracker
+ * itself reports as lost, maps to TRACKING_STATE_LOST.
+ */
+class OpenCvTrackerBackend : public TrackerBackend
+{
+public:
+    enum class Algorithm { KCF, CSRT };
+
+    OpenCvTrackerBackend(Algorithm algorithm, int cameraIndex, float minConfidence = 0.25f);
+
+    QString name() const override;
+    bool initialize(int frameWidth, int frameHeight) override;
+    void cleanup() override;
+    bool initTarget(const cv::Mat &frameBGRA, const QRect &box) override;
+    bool track(const cv::Mat &frameBGRA) override;
+
+private:
+    static constexpr int TemplateSize = 32;     // Confidence template edge, pixels
+    static constexpr float TemplateLR = 0.05f;  // Template adaptation rate while tracked
+    static constexpr float MinVisibleFraction = 0.25f; // Box area that must stay in frame
+
+    cv::Ptr<cv::Tracker> createTracker() const;
+    bool extractPatch(const cv::Rect &box, cv::Mat &patch) const;
+
+    Algorithm m_algorithm;
+    int m_cameraIndex;
+    float m_minConfidence;
+    cv::Rect m_frameRect;
+
+    cv::Ptr<cv::Tracker> m_tracker;
+    cv::Mat m_frameBGR;     // Trackers take 3-channel input
+    cv::Mat m_frameGray;
+    cv::Mat m_template;     // CV_32F, TemplateSize x TemplateSize
+};
+
+#endif // OPENCVTRACKERBACKEND_H
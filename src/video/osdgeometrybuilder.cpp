@@ -0,0 +1,156 @@
+#include "osdgeometrybuilder.h"
+
+#include <QtMath>
+#include <cstring>
+
+namespace {
+int circleSegments(qreal radius)
+{
+    return qBound(12, qCeil(radius * 1.5), 96);
+}
+}
+
+OsdGeometryBuilder::OsdGeometryBuilder(QVector<Vertex>* vertices)
+    : m_vertices(vertices)
+{
+}
+
+void OsdGeometryBuilder::clear()
+{
+    m_vertices->clear();
+}
+
+void OsdGeometryBuilder::appendVertex(qreal x, qreal y, const QColor& color, qreal opacity)
+{
+    const qreal a = qBound(0.0, color.alphaF() * opacity, 1.0);
+    Vertex v;
+    v.set(static_cast<float>(x), static_cast<float>(y),
+          static_cast<uchar>(qRound(color.red() * a)),
+          static_cast<uchar>(qRound(color.green() * a)),
+          static_cast<uchar>(qRound(color.blue() * a)),
+          static_cast<uchar>(qRound(a * 255.0)));
+    m_vertices->append(v);
+}
+
+void OsdGeometryBuilder::fillRect(const QRectF& rect, const QColor& color, qreal opacity)
+{
+    if (rect.isEmpty()) return;
+
+    const qreal x0 = rect.left(), y0 = rect.top(), x1 = rect.right(), y1 = rect.bottom();
+    appendVertex(x0, y0, color, opacity);
+    appendVertex(x1, y0, color, opacity);
+    appendVertex(x0, y1, color, opacity);
+    appendVertex(x1, y0, color, opacity);
+    appendVertex(x1, y1, color, opacity);
+    appendVertex(x0, y1, color, opacity);
+}
+
+void OsdGeometryBuilder::fillTriangle(const QPointF& a, const QPointF& b, const QPointF& c,
+                                      const QColor& color, qreal opacity)
+{
+    appendVertex(a.x(), a.y(), color, opacity);
+    appendVertex(b.x(), b.y(), color, opacity);
+    appendVertex(c.x(), c.y(), color, opacity);
+}
+
+void OsdGeometryBuilder::fillDisc(const QPointF& center, qreal radius, const QColor& color, qreal opacity)
+{
+    if (radius <= 0.0) return;
+
+    const int segments = circleSegments(radius);
+    QPointF prev(center.x() + radius, center.y());
+    for (int i = 1; i <= segments; ++i) {
+        const qreal angle = 2.0 * M_PI * i / segments;
+        const QPointF next(center.x() + radius * qCos(angle), center.y() + radius * qSin(angle));
+        fillTriangle(center, prev, next, color, opacity);
+        prev = next;
+    }
+}
+
+void OsdGeometryBuilder::strokeLine(const QLineF& line, qreal width, const QColor& color, qreal opacity)
+{
+    const qreal length = line.length();
+    if (length <= 0.0 || width <= 0.0) return;
+
+    // Unit direction scaled to half the width (end extension)
+    const qreal half = width / 2.0;
+    const qreal dx = line.dx() / length * half;
+    const qreal dy = line.dy() / length * half;
+
+    appendSegment(QPointF(line.x1() - dx, line.y1() - dy),
+                  QPointF(line.x2() + dx, line.y2() + dy), width, color, opacity);
+}
+
+void OsdGeometryBuilder::strokeDashedLine(const QLineF& line, qreal width, qreal dash, qreal gap,
+                                          const QColor& color, qreal opacity)
+{
+    const qreal length = line.length();
+    if (length <= 0.0 || width <= 0.0) return;
+    if (dash <= 0.0 || gap <= 0.0) {
+        appendSegment(line.p1(), line.p2(), width, color, opacity);
+        return;
+    }
+
+    for (qreal start = 0.0; start < length; start += dash + gap) {
+        const qreal end = qMin(start + dash, length);
+        appendSegment(line.pointAt(start / length), line.pointAt(end / length), width, color, opacity);
+    }
+}
+
+void OsdGeometryBuilder::appendSegment(const QPointF& p0, const QPointF& p1, qreal width,
+                                       const QColor& color, qreal opacity)
+{
+    const QLineF segment(p0, p1);
+    const qreal length = segment.length();
+    if (length <= 0.0) return;
+
+    // Normal scaled to half the width
+    const qreal half = width / 2.0;
+    const QPointF n(-segment.dy() / length * half, segment.dx() / length * half);
+
+    fillTriangle(p0 + n, p1 + n, p0 - n, color, opacity);
+    fillTriangle(p1 + n, p1 - n, p0 - n, color, opacity);
+}
+
+void OsdGeometryBuilder::strokeCircle(const QPointF& center, qreal radius, qreal width,
+                                      const QColor& color, qreal opacity)
+{
+    if (radius <= 0.0 || width <= 0.0) return;
+
+    const qreal inner = qMax(0.0, radius - width / 2.0);
+    const qreal outer = radius + width / 2.0;
+    const int segments = circleSegments(radius);
+
+    for (int i = 0; i < segments; ++i) {
+        const qreal a0 = 2.0 * M_PI * i / segments;
+        const qreal a1 = 2.0 * M_PI * (i + 1) / segments;
+        const QPointF i0(center.x() + inner * qCos(a0), center.y() + inner * qSin(a0));
+        const QPointF o0(center.x() + outer * qCos(a0), center.y() + outer * qSin(a0));
+        const QPointF i1(center.x() + inner * qCos(a1), center.y() + inner * qSin(a1));
+        const QPointF o1(center.x() + outer * qCos(a1), center.y() + outer * qSin(a1));
+        fillTriangle(i0, o0, o1, color, opacity);
+        fillTriangle(i0, o1, i1, color, opacity);
+    }
+}
+
+void OsdGeometryBuilder::strokeOutlined(const QVector<QLineF>& lines, qreal width, qreal outlineExtra,
+                                        const QColor& color, const QColor& outlineColor)
+{
+    for (const QLineF& line : lines) {
+        strokeLine(line, width + outlineExtra, outlineColor);
+    }
+    for (const QLineF& line : lines) {
+        strokeLine(line, width, color);
+    }
+}
+
+void OsdGeometryBuilder::upload(QSGGeometry* geometry, const QVector<Vertex>& vertices)
+{
+    if (geometry->vertexCount() != vertices.size()) {
+        geometry->allocate(vertices.size());
+    }
+    if (!vertices.isEmpty()) {
+        std::memcpy(geometry->vertexDataAsColoredPoint2D(), vertices.constData(),
+                    vertices.size() * sizeof(Vertex));
+    }
+}
@@ -0,0 +1,60 @@
+#ifndef OSDGEOMETRYBUILDER_H
+#define OSDGEOMETRYBUILDER_H
+
+#include <QColor>
+#include <QLineF>
+#include <QPointF>
+#include <QRectF>
+#include <QSGGeometry>
+#include <QVector>
+
+/**
+ * @brief Appends OSD primitives as vertex-coloured triangles.
+ *
+ * Everything the OSD draws (strokes, rings, dots, boxes) becomes plain
+ * triangles in one vertex array, so a whole symbol fits into a single
+ * QSGGeometryNode with QSGVertexColorMaterial. Colours are written
+ * premultiplied, as that material expects. Later primitives are drawn on
+ * top of earlier ones, which is how the black outlines end up behind the
+ * coloured strokes.
+ */
+class OsdGeometryBuilder
+{
+public:
+    using Vertex = QSGGeometry::ColoredPoint2D;
+
+    explicit OsdGeometryBuilder(QVector<Vertex>* vertices);
+
+    void clear();
+    int vertexCount() const { return m_vertices->size(); }
+
+    void fillRect(const QRectF& rect, const QColor& color, qreal opacity = 1.0);
+    void fillTriangle(const QPointF& a, const QPointF& b, const QPointF& c,
+                      const QColor& color, qreal opacity = 1.0);
+    void fillDisc(const QPointF& center, qreal radius, const QColor& color, qreal opacity = 1.0);
+
+    // Lines are extended by half their width at both ends (like a round cap)
+    void strokeLine(const QLineF& line, qreal width, const QColor& color, qreal opacity = 1.0);
+    // Dash pattern starts at p1; dashes are square-ended and not extended
+    void strokeDashedLine(const QLineF& line, qreal width, qreal dash, qreal gap,
+                          const QColor& color, qreal opacity = 1.0);
+    void strokeCircle(const QPointF& center, qreal radius, qreal width,
+                      const QColor& color, qreal opacity = 1.0);
+
+    // Outline pass for every line first, then the coloured pass, so crossing
+    // strokes do not cut each other with their outlines
+    void strokeOutlined(const QVector<QLineF>& lines, qreal width, qreal outlineExtra,
+                        const QColor& color, const QColor& outlineColor);
+
+    // Copies the vertices into a geometry, reallocating only on size change
+    static void upload(QSGGeometry* geometry, const QVector<Vertex>& vertices);
+
+private:
+    void appendVertex(qreal x, qreal y, const QColor& color, qreal opacity);
+    void appendSegment(const QPointF& p0, const QPointF& p1, qreal width,
+                       const QColor& color, qreal opacity);
+
+    QVector<Vertex>* m_vertices;
+};
+
+#endif // OSDGEOMETRYBUILDER_H
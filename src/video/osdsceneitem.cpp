@@ -0,0 +1,660 @@
+#include "osdsceneitem.h"
+#include "osdgeometrybuilder.h"
+
+#include <QSGGeometryNode>
+#include <QSGOpacityNode>
+#include <QSGTransformNode>
+#include <QSGVertexColorMaterial>
+#include <QtMath>
+#include <cmath>
+
+namespace {
+// Stroke widths shared with the previous QML components
+constexpr qreal kStrokeWidth = 2.0;
+constexpr qreal kOutlineExtra = 2.0;
+
+// Tracking box corners
+constexpr qreal kCornerLength = 15.0;
+constexpr qreal kCornerOutline = 4.0;
+
+// Elevation scale
+constexpr qreal kScaleLineWidth = 3.0;
+constexpr qreal kScaleTickWidth = 2.5;
+constexpr qreal kScaleOutline = 1.0;
+
+using Vertices = QVector<QSGGeometry::ColoredPoint2D>;
+
+QSGGeometryNode* createGeometryNode()
+{
+    auto* node = new QSGGeometryNode;
+    auto* geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(), 0);
+    geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+    node->setGeometry(geometry);
+    node->setFlag(QSGNode::OwnsGeometry);
+    node->setMaterial(new QSGVertexColorMaterial);
+    node->setFlag(QSGNode::OwnsMaterial);
+    return node;
+}
+
+void uploadGeometry(QSGGeometryNode* node, const Vertices& vertices)
+{
+    OsdGeometryBuilder::upload(node->geometry(), vertices);
+    node->markDirty(QSGNode::DirtyGeometry);
+}
+
+void setTransform(QSGTransformNode* node, const QMatrix4x4& matrix)
+{
+    if (node->matrix() == matrix) return;
+    node->setMatrix(matrix);
+    node->markDirty(QSGNode::DirtyMatrix);
+}
+
+void addDiamond(OsdGeometryBuilder& builder, const QPointF& center, qreal halfDiagonal,
+                const QColor& color, qreal opacity)
+{
+    const QPointF top(center.x(), center.y() - halfDiagonal);
+    const QPointF right(center.x() + halfDiagonal, center.y());
+    const QPointF bottom(center.x(), center.y() + halfDiagonal);
+    const QPointF left(center.x() - halfDiagonal, center.y());
+    builder.fillTriangle(top, right, bottom, color, opacity);
+    builder.fillTriangle(top, bottom, left, color, opacity);
+}
+
+// Node tree owned by the scene graph; the item only keeps the root
+struct OsdSceneRootNode : public QSGNode
+{
+    QSGTransformNode* reticleTransform = new QSGTransformNode;
+    QSGGeometryNode* reticle = createGeometryNode();
+
+    QSGGeometryNode* trackingBox = createGeometryNode();
+
+    QSGTransformNode* compassTransform = new QSGTransformNode;
+    QSGTransformNode* roseTransform = new QSGTransformNode;
+    QSGGeometryNode* rose = createGeometryNode();
+    QSGOpacityNode* vehicleOpacity = new QSGOpacityNode;
+    QSGGeometryNode* vehicleMarker = createGeometryNode();
+    QSGTransformNode* needleTransform = new QSGTransformNode;
+    QSGGeometryNode* needle = createGeometryNode();
+
+    QSGTransformNode* elevationTransform = new QSGTransformNode;
+    QSGGeometryNode* elevationScale = createGeometryNode();
+    QSGTransformNode* pointerTransform = new QSGTransformNode;
+    QSGGeometryNode* elevationPointer = createGeometryNode();
+
+    OsdSceneRootNode()
+    {
+        // Drawing order: scales first, reticle and tracking box on top
+        appendChildNode(compassTransform);
+        compassTransform->appendChildNode(roseTransform);
+        roseTransform->appendChildNode(rose);
+        compassTransform->appendChildNode(vehicleOpacity);
+        vehicleOpacity->appendChildNode(vehicleMarker);
+        compassTransform->appendChildNode(needleTransform);
+        needleTransform->appendChildNode(needle);
+
+        appendChildNode(elevationTransform);
+        elevationTransform->appendChildNode(elevationScale);
+        elevationTransform->appendChildNode(pointerTransform);
+        pointerTransform->appendChildNode(elevationPointer);
+
+        appendChildNode(trackingBox);
+
+        appendChildNode(reticleTransform);
+        reticleTransform->appendChildNode(reticle);
+
+        // Children are deleted by ~QSGNode via OwnedByParent (default)
+    }
+};
+}
+
+OsdSceneItem::OsdSceneItem(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents, true);
+}
+
+// ============================================================================
+// PROPERTY SETTERS
+// ============================================================================
+
+void OsdSceneItem::markDirty(int flags)
+{
+    m_dirty |= flags;
+    update();
+}
+
+void OsdSceneItem::setColor(const QColor& color)
+{
+    if (m_color == color) return;
+    m_color = color;
+    markDirty(ReticleShape | CompassShape | ElevationShape);
+    emit colorChanged();
+}
+
+void OsdSceneItem::setOutlineColor(const QColor& color)
+{
+    if (m_outlineColor == color) return;
+    m_outlineColor = color;
+    markDirty(ReticleShape | TrackingBoxShape | CompassShape | ElevationShape);
+    emit outlineColorChanged();
+}
+
+void OsdSceneItem::setRelativeColor(const QColor& color)
+{
+    if (m_relativeColor == color) return;
+    m_relativeColor = color;
+    markDirty(CompassShape);
+    emit relativeColorChanged();
+}
+
+void OsdSceneItem::setReticleType(int type)
+{
+    if (m_reticleType == type) return;
+    m_reticleType = type;
+    markDirty(ReticleShape);
+    emit reticleTypeChanged();
+}
+
+void OsdSceneItem::setReticleOffset(const QPointF& offset)
+{
+    if (m_reticleOffset == offset) return;
+    m_reticleOffset = offset;
+    markDirty(ReticleTransform);
+    emit reticleOffsetChanged();
+}
+
+void OsdSceneItem::setCurrentFov(qreal fov)
+{
+    if (m_currentFov == fov) return;
+    m_currentFov = fov;
+    // Only the mil-dot spacing depends on the FOV
+    if (m_reticleType == 4) {
+        markDirty(ReticleShape);
+    }
+    emit currentFovChanged();
+    emit pixelsPerMilChanged();
+}
+
+void OsdSceneItem::setLacActive(bool active)
+{
+    if (m_lacActive == active) return;
+    m_lacActive = active;
+    if (m_reticleType == 3) {
+        markDirty(ReticleShape);
+    }
+    emit lacActiveChanged();
+}
+
+void OsdSceneItem::setRangeMeters(qreal range)
+{
+    if (m_rangeMeters == range) return;
+    m_rangeMeters = range;
+    if (m_reticleType == 3) {
+        markDirty(ReticleShape);
+    }
+    emit rangeMetersChanged();
+}
+
+void OsdSceneItem::setConfidenceLevel(qreal level)
+{
+    if (m_confidenceLevel == level) return;
+    m_confidenceLevel = level;
+    if (m_reticleType == 3) {
+        markDirty(ReticleShape);
+    }
+    emit confidenceLevelChanged();
+}
+
+void OsdSceneItem::setTrackingBox(const QRectF& box)
+{
+    if (m_trackingBox == box) return;
+    m_trackingBox = box;
+    if (m_trackingBoxVisible) {
+        markDirty(TrackingBoxShape);
+    }
+    emit trackingBoxChanged();
+}
+
+void OsdSceneItem::setTrackingBoxVisible(bool visible)
+{
+    if (m_trackingBoxVisible == visible) return;
+    m_trackingBoxVisible = visible;
+    markDirty(TrackingBoxShape);
+    emit trackingBoxVisibleChanged();
+}
+
+void OsdSceneItem::setTrackingBoxColor(const QColor& color)
+{
+    if (m_trackingBoxColor == color) return;
+    m_trackingBoxColor = color;
+    markDirty(TrackingBoxShape);
+    emit trackingBoxColorChanged();
+}
+
+void OsdSceneItem::setTrackingBoxDashed(bool dashed)
+{
+    if (m_trackingBoxDashed == dashed) return;
+    m_trackingBoxDashed = dashed;
+    markDirty(TrackingBoxShape);
+    emit trackingBoxDashedChanged();
+}
+
+void OsdSceneItem::setAzimuthRect(const QRectF& rect)
+{
+    if (m_azimuthRect == rect) return;
+    const bool resized = rect.size() != m_azimuthRect.size();
+    m_azimuthRect = rect;
+    markDirty(CompassTransform | (resized ? CompassShape : 0));
+    emit azimuthRectChanged();
+}
+
+void OsdSceneItem::setAzimuth(qreal azimuth)
+{
+    if (m_azimuth == azimuth) return;
+    m_azimuth = azimuth;
+    markDirty(CompassTransform);
+    emit azimuthChanged();
+}
+
+void OsdSceneItem::setVehicleHeading(qreal heading)
+{
+    if (m_vehicleHeading == heading) return;
+    m_vehicleHeading = heading;
+    markDirty(CompassTransform);
+    emit vehicleHeadingChanged();
+}
+
+void OsdSceneItem::setImuConnected(bool connected)
+{
+    if (m_imuConnected == connected) return;
+    m_imuConnected = connected;
+    markDirty(CompassTransform);
+    emit imuConnectedChanged();
+}
+
+void OsdSceneItem::setElevationRect(const QRectF& rect)
+{
+    if (m_elevationRect == rect) return;
+    const bool resized = rect.size() != m_elevationRect.size();
+    m_elevationRect = rect;
+    markDirty(ElevationPointer | (resized ? ElevationShape : 0));
+    emit elevationRectChanged();
+}
+
+void OsdSceneItem::setElevation(qreal elevation)
+{
+    if (m_elevation == elevation) return;
+    m_elevation = elevation;
+    markDirty(ElevationPointer);
+    emit elevationChanged();
+}
+
+void OsdSceneItem::geometryChange(const QRectF& newGeometry, const QRectF& oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+
+    if (newGeometry.size() != oldGeometry.size()) {
+        markDirty(ReticleTransform | (m_reticleType == 4 ? ReticleShape : 0));
+        emit pixelsPerMilChanged();
+    }
+}
+
+// ============================================================================
+// DERIVED VALUES
+// ============================================================================
+
+qreal OsdSceneItem::trueBearing() const
+{
+    if (!m_imuConnected) return m_azimuth;  // Fallback to relative if no IMU
+
+    qreal combined = std::fmod(m_azimuth + m_vehicleHeading, 360.0);
+    if (combined < 0.0) combined += 360.0;
+    return combined;
+}
+
+qreal OsdSceneItem::pixelsPerMil() const
+{
+    if (m_currentFov <= 0.0 || width() <= 0.0) return 0.0;
+
+    // Mils across the screen ~ metres visible at 1000 m
+    const qreal milsAcrossScreen = 2.0 * 1000.0 * qTan(qDegreesToRadians(m_currentFov) / 2.0);
+    return width() / milsAcrossScreen;
+}
+
+qreal OsdSceneItem::elevationToY(qreal elevation) const
+{
+    const qreal height = m_elevationRect.height();
+    const qreal norm = qBound(0.0, (elevation - MinElevation) / (MaxElevation - MinElevation), 1.0);
+    return height - norm * height;
+}
+
+// ============================================================================
+// SCENE GRAPH
+// ============================================================================
+
+QSGNode* OsdSceneItem::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData*)
+{
+    auto* root = static_cast<OsdSceneRootNode*>(oldNode);
+    if (!root) {
+        root = new OsdSceneRootNode;
+        m_dirty = AllDirty;
+    }
+    if (m_dirty == 0) {
+        return root;
+    }
+
+    // The GUI thread is blocked during sync, so the members are stable here
+    Vertices vertices;
+
+    if (m_dirty & ReticleShape) {
+        buildReticle(vertices);
+        uploadGeometry(root->reticle, vertices);
+    }
+    if (m_dirty & ReticleTransform) {
+        QMatrix4x4 matrix;
+        matrix.translate(width() / 2.0 + m_reticleOffset.x(), height() / 2.0 + m_reticleOffset.y());
+        setTransform(root->reticleTransform, matrix);
+    }
+
+    if (m_dirty & TrackingBoxShape) {
+        buildTrackingBox(vertices);
+        uploadGeometry(root->trackingBox, vertices);
+    }
+
+    if (m_dirty & CompassShape) {
+        buildCompassRose(vertices);
+        uploadGeometry(root->rose, vertices);
+        buildVehicleMarker(vertices);
+        uploadGeometry(root->vehicleMarker, vertices);
+        buildNeedle(vertices);
+        uploadGeometry(root->needle, vertices);
+    }
+    if (m_dirty & CompassTransform) {
+        QMatrix4x4 center;
+        center.translate(m_azimuthRect.center().x(), m_azimuthRect.center().y());
+        setTransform(root->compassTransform, center);
+
+        // Compass rose turns so north points to true north (only with IMU)
+        QMatrix4x4 rose;
+        rose.rotate(m_imuConnected ? -m_vehicleHeading : 0.0, 0.0, 0.0, 1.0);
+        setTransform(root->roseTransform, rose);
+
+        QMatrix4x4 needle;
+        needle.rotate(trueBearing(), 0.0, 0.0, 1.0);
+        setTransform(root->needleTransform, needle);
+
+        // Vehicle forward reference only when the heading is known
+        const qreal opacity = m_imuConnected ? 1.0 : 0.0;
+        if (root->vehicleOpacity->opacity() != opacity) {
+            root->vehicleOpacity->setOpacity(opacity);
+        }
+    }
+
+    if (m_dirty & ElevationShape) {
+        buildElevationScale(vertices);
+        uploadGeometry(root->elevationScale, vertices);
+        buildElevationPointer(vertices);
+        uploadGeometry(root->elevationPointer, vertices);
+    }
+    if (m_dirty & ElevationPointer) {
+        QMatrix4x4 scale;
+        scale.translate(m_elevationRect.left(), m_elevationRect.top());
+        setTransform(root->elevationTransform, scale);
+
+        QMatrix4x4 pointer;
+        pointer.translate(0.0, elevationToY(m_elevation));
+        setTransform(root->pointerTransform, pointer);
+    }
+
+    m_dirty = 0;
+    return root;
+}
+
+// ============================================================================
+// RETICLE (centred on 0,0)
+// ============================================================================
+
+void OsdSceneItem::buildReticle(Vertices& out) const
+{
+    OsdGeometryBuilder b(&out);
+    b.clear();
+
+    const QColor& c = m_color;
+    const QColor& o = m_outlineColor;
+
+    switch (m_reticleType) {
+    case 0: {
+        // CIRCLE-DOT (close range, rapid acquisition)
+        b.strokeCircle(QPointF(), 25.0, kStrokeWidth + kOutlineExtra, o);
+        b.strokeCircle(QPointF(), 25.0, kStrokeWidth, c);
+        b.fillDisc(QPointF(), 2.0 + kOutlineExtra / 2.0, o);
+        b.fillDisc(QPointF(), 2.0, c);
+        break;
+    }
+    case 2: {
+        // TACTICAL CROSSHAIR (windage hashes, holdover marks below centre)
+        const qreal size = 80.0, gap = 8.0, hash = 4.0, spacing = 10.0, stadia = 8.0;
+        QVector<QLineF> lines = {
+            QLineF(-size, 0, -gap, 0), QLineF(gap, 0, size, 0),
+            QLineF(0, -size, 0, -gap), QLineF(0, gap, 0, size)
+        };
+        for (int i = 1; i <= 6; ++i) {
+            const qreal d = i * spacing;
+            if (d >= size - gap) continue;
+            lines << QLineF(-d, -hash, -d, hash) << QLineF(d, -hash, d, hash)
+                  << QLineF(-hash, d, hash, d);
+        }
+        for (int k = 3; k <= 6; k += 3) {
+            const qreal d = k * spacing;
+            if (d >= size - gap) continue;
+            lines << QLineF(-d, -stadia, -d, stadia) << QLineF(d, -stadia, d, stadia)
+                  << QLineF(-stadia, d, stadia, d);
+        }
+        b.strokeOutlined(lines, kStrokeWidth, kOutlineExtra, c, o);
+        b.fillDisc(QPointF(), 2.0 + kOutlineExtra / 2.0, o);
+        b.fillDisc(QPointF(), 2.0, c);
+        break;
+    }
+    case 3: {
+        // CCIP FIRE CONTROL (pipper, FPV, LAC bracket, range ladder, confidence)
+        const qreal pipper = 12.0, wing = 20.0, wingHeight = 6.0;
+        b.strokeCircle(QPointF(), pipper, kStrokeWidth + kOutlineExtra, o);
+        b.strokeCircle(QPointF(), pipper, kStrokeWidth, c);
+        b.fillDisc(QPointF(), 2.0 + kOutlineExtra / 2.0, o);
+        b.fillDisc(QPointF(), 2.0, c);
+
+        b.strokeOutlined({ QLineF(-wing, 0, -6, 0), QLineF(6, 0, wing, 0),
+                           QLineF(-wing, 0, -wing, -wingHeight), QLineF(wing, 0, wing, -wingHeight) },
+                         kStrokeWidth, kOutlineExtra, c, o);
+
+        if (m_lacActive) {
+            const qreal bx = pipper + 8.0, bracket = 25.0;
+            b.strokeOutlined({ QLineF(bx, -bracket, bx + bracket, -bracket),
+                               QLineF(bx + bracket, -bracket, bx + bracket, 0) },
+                             kStrokeWidth, kOutlineExtra, c, o);
+        }
+
+        // Range ladder ticks (labels are QML text); the current range is longer
+        const qreal scaleX = 50.0, scaleHeight = 60.0;
+        const qreal ranges[] = { 2000.0, 1500.0, 1000.0, 500.0 };
+        QVector<QLineF> ticks;
+        for (int i = 0; i < 4; ++i) {
+            const qreal y = -scaleHeight / 2.0 + i * scaleHeight / 3.0;
+            const bool current = m_rangeMeters >= ranges[i] - 250.0 && m_rangeMeters <= ranges[i] + 250.0;
+            ticks << QLineF(scaleX, y, scaleX + (current ? 12.0 : 8.0), y);
+        }
+        b.strokeOutlined(ticks, kStrokeWidth, kOutlineExtra, c, o);
+
+        // Confidence bar
+        const qreal barWidth = 40.0, barHeight = 4.0, barY = pipper + 25.0;
+        const qreal level = qBound(0.0, m_confidenceLevel, 1.0);
+        const QColor barColor = level > 0.7 ? c : (level > 0.4 ? QColor(Qt::yellow) : QColor(Qt::red));
+        b.fillRect(QRectF(-barWidth / 2.0 - 1.0, barY - 1.0, barWidth + 2.0, barHeight + 2.0), o);
+        b.fillRect(QRectF(-barWidth / 2.0, barY, barWidth * level, barHeight), barColor);
+        break;
+    }
+    case 4: {
+        // MIL-DOT (LRF verification): fine crosshair with 1 and 1/2 mil dots
+        const qreal lineSize = 100.0, dotRadius = 1.8;
+        b.strokeOutlined({ QLineF(-lineSize, 0, lineSize, 0), QLineF(0, -lineSize, 0, lineSize) },
+                         1.0, kOutlineExtra, c, o);
+
+        const qreal spacing = pixelsPerMil();
+        auto dot = [&](qreal x, qreal y, qreal r) {
+            b.fillDisc(QPointF(x, y), r + kOutlineExtra / 2.0, o);
+            b.fillDisc(QPointF(x, y), r, c);
+        };
+        for (int i = 1; spacing > 0.0 && i <= 5; ++i) {
+            const qreal d = i * spacing;
+            if (d > lineSize) break;
+            dot(-d, 0, dotRadius); dot(d, 0, dotRadius);
+            dot(0, -d, dotRadius); dot(0, d, dotRadius);
+
+            const qreal half = d + spacing / 2.0;
+            if (i < 5 && half <= lineSize) {
+                const qreal r = dotRadius * 0.6;
+                dot(-half, 0, r); dot(half, 0, r);
+                dot(0, -half, r); dot(0, half, r);
+            }
+        }
+        break;
+    }
+    case 1:
+    default: {
+        // BOX CROSSHAIR (general purpose)
+        const qreal len = 80.0, half = 25.0, gap = 2.0;
+        b.strokeOutlined({
+            QLineF(-len, 0, -half - gap, 0), QLineF(half + gap, 0, len, 0),
+            QLineF(0, -len, 0, -half - gap), QLineF(0, half + gap, 0, len),
+            QLineF(-half, -half, half, -half), QLineF(half, -half, half, half),
+            QLineF(half, half, -half, half), QLineF(-half, half, -half, -half)
+        }, kStrokeWidth, kOutlineExtra, c, o);
+        break;
+    }
+    }
+}
+
+// ============================================================================
+// TRACKING BOX (item coordinates; rebuilt when the box moves)
+// ============================================================================
+
+void OsdSceneItem::buildTrackingBox(Vertices& out) const
+{
+    OsdGeometryBuilder b(&out);
+    b.clear();
+    if (!m_trackingBoxVisible || m_trackingBox.isEmpty()) return;
+
+    const QRectF& r = m_trackingBox;
+    auto corners = [&](qreal thickness, const QColor& color, qreal opacity) {
+        const qreal right = r.right() - kCornerLength;
+        const qreal bottom = r.bottom() - kCornerLength;
+        // Horizontal then vertical leg of TL, TR, BL, BR
+        b.fillRect(QRectF(r.left(), r.top(), kCornerLength, thickness), color, opacity);
+        b.fillRect(QRectF(r.left(), r.top(), thickness, kCornerLength), color, opacity);
+        b.fillRect(QRectF(right, r.top(), kCornerLength, thickness), color, opacity);
+        b.fillRect(QRectF(r.right() - thickness, r.top(), thickness, kCornerLength), color, opacity);
+        b.fillRect(QRectF(r.left(), r.bottom() - thickness, kCornerLength, thickness), color, opacity);
+        b.fillRect(QRectF(r.left(), bottom, thickness, kCornerLength), color, opacity);
+        b.fillRect(QRectF(right, r.bottom() - thickness, kCornerLength, thickness), color, opacity);
+        b.fillRect(QRectF(r.right() - thickness, bottom, thickness, kCornerLength), color, opacity);
+    };
+
+    corners(kStrokeWidth + kCornerOutline, m_outlineColor, m_trackingBoxDashed ? 0.7 : 1.0);
+    corners(kStrokeWidth, m_trackingBoxColor, m_trackingBoxDashed ? 0.8 : 1.0);
+}
+
+// ============================================================================
+// AZIMUTH COMPASS (centred on 0,0; rotations are transforms)
+// ============================================================================
+
+void OsdSceneItem::buildCompassRose(Vertices& out) const
+{
+    OsdGeometryBuilder b(&out);
+    b.clear();
+
+    const qreal radius = m_azimuthRect.width() / 2.0;
+    if (radius <= 10.0) return;
+
+    b.strokeCircle(QPointF(), radius - 2.0, kStrokeWidth + kOutlineExtra, m_outlineColor);
+    b.strokeCircle(QPointF(), radius - 2.0, kStrokeWidth, m_color);
+
+    // Tick marks every 30°, pointing inward, longer on the cardinal points
+    QVector<QLineF> ticks;
+    const qreal outer = radius - 4.0;
+    for (int i = 0; i < 12; ++i) {
+        const qreal angle = qDegreesToRadians(i * 30.0);
+        const qreal length = (i % 3 == 0) ? 10.0 : 5.0;
+        const QPointF dir(qSin(angle), -qCos(angle));
+        ticks << QLineF(dir * outer, dir * (outer - length));
+    }
+    b.strokeOutlined(ticks, kStrokeWidth, kOutlineExtra, m_color, m_outlineColor);
+}
+
+void OsdSceneItem::buildVehicleMarker(Vertices& out) const
+{
+    OsdGeometryBuilder b(&out);
+    b.clear();
+
+    const qreal radius = m_azimuthRect.width() / 2.0;
+    if (radius <= 10.0) return;
+
+    // Vehicle forward reference: line up from the centre with a diamond tip
+    const qreal length = radius - 8.0;
+    b.strokeLine(QLineF(0, 0, 0, -length), kStrokeWidth, m_relativeColor, 0.7);
+    addDiamond(b, QPointF(0, -length), 4.0 * M_SQRT2, m_relativeColor, 0.7);
+}
+
+void OsdSceneItem::buildNeedle(Vertices& out) const
+{
+    OsdGeometryBuilder b(&out);
+    b.clear();
+
+    const qreal radius = m_azimuthRect.width() / 2.0;
+    if (radius <= 10.0) return;
+
+    const qreal length = radius - 10.0;
+    b.strokeLine(QLineF(0, 0, 0, -length), kStrokeWidth + kOutlineExtra, m_outlineColor);
+    b.strokeLine(QLineF(0, 0, 0, -length), 3.0, m_color);
+    addDiamond(b, QPointF(0, -length), 5.0 * M_SQRT2, m_color, 1.0);
+}
+
+// ============================================================================
+// ELEVATION SCALE (origin at the scale's top-left; pointer at y = 0)
+// ============================================================================
+
+void OsdSceneItem::buildElevationScale(Vertices& out) const
+{
+    OsdGeometryBuilder b(&out);
+    b.clear();
+
+    const qreal height = m_elevationRect.height();
+    if (height <= 0.0) return;
+
+    b.fillRect(QRectF(0, 0, kScaleLineWidth + kScaleOutline, height), m_outlineColor);
+    b.fillRect(QRectF(0, 0, kScaleLineWidth, height), m_color);
+
+    for (int deg = static_cast<int>(MinElevation); deg <= static_cast<int>(MaxElevation); deg += 10) {
+        const bool major = (deg == 60 || deg == 30 || deg == 0 || deg == -20);
+        const qreal length = major ? 12.0 : 6.0;
+        const qreal y = elevationToY(deg) - 1.0;
+        b.fillRect(QRectF(0, y - kScaleOutline / 2.0, length, kScaleTickWidth + kScaleOutline), m_outlineColor);
+        b.fillRect(QRectF(0, y, length, kScaleTickWidth), m_color);
+    }
+}
+
+void OsdSceneItem::buildElevationPointer(Vertices& out) const
+{
+    OsdGeometryBuilder b(&out);
+    b.clear();
+
+    // Horizontal reference bar from the scale
+    b.fillRect(QRectF(-2.0, -1.0 - kScaleOutline / 2.0, 20.0, 2.0 + kScaleOutline), m_outlineColor);
+    b.fillRect(QRectF(-2.0, -1.0, 20.0, 2.0), m_color);
+
+    // Triangle pointer
+    b.fillTriangle(QPointF(17.0, 0.0), QPointF(29.0, -7.0), QPointF(29.0, 7.0), m_outlineColor);
+    b.fillTriangle(QPointF(18.0, 0.0), QPointF(28.0, -6.0), QPointF(28.0, 6.0), m_color);
+
+    // Value box background (the value itself is QML text)
+    b.fillRect(QRectF(30.0, -9.0, 45.0, 18.0), m_outlineColor, 0.8);
+}
@@ -0,0 +1,193 @@
+#ifndef OSDSCENEITEM_H
+#define OSDSCENEITEM_H
+
+#include <QColor>
+#include <QPointF>
+#include <QQuickItem>
+#include <QRectF>
+#include <QSGGeometry>
+#include <QVector>
+
+/**
+ * @brief Scene-graph renderer for the OSD symbology.
+ *
+ * Draws the reticle (all five types), the tracking box corners, the azimuth
+ * compass and the elevation scale as a handful of vertex-coloured geometry
+ * nodes, replacing the Canvas / Shape / Rectangle based QML components.
+ *
+ * Geometry is retained: each symbol is built once in its own coordinates and
+ * only rebuilt when something that changes its shape changes (reticle type,
+ * FOV, colours, layout). Per-frame motion is carried by transform nodes:
+ * the reticle offset, compass heading, bearing needle and elevation pointer
+ * only update a matrix. The tracking box corners are the one symbol whose
+ * vertex positions are rewritten every frame (16 quads).
+ *
+ * Text (range ladder, scale labels, bearing readouts) stays in QML Text items,
+ * which the scene graph already renders from cached glyphs.
+ */
+class OsdSceneItem : public QQuickItem
+{
+    Q_OBJECT
+
+    // Colours
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY colorChanged)
+    Q_PROPERTY(QColor outlineColor READ outlineColor WRITE setOutlineColor NOTIFY outlineColorChanged)
+    Q_PROPERTY(QColor relativeColor READ relativeColor WRITE setRelativeColor NOTIFY relativeColorChanged)
+
+    // Reticle (centred on the item, shifted by the offset)
+    Q_PROPERTY(int reticleType READ reticleType WRITE setReticleType NOTIFY reticleTypeChanged)
+    Q_PROPERTY(QPointF reticleOffset READ reticleOffset WRITE setReticleOffset NOTIFY reticleOffsetChanged)
+    Q_PROPERTY(qreal currentFov READ currentFov WRITE setCurrentFov NOTIFY currentFovChanged)
+    Q_PROPERTY(bool lacActive READ lacActive WRITE setLacActive NOTIFY lacActiveChanged)
+    Q_PROPERTY(qreal rangeMeters READ rangeMeters WRITE setRangeMeters NOTIFY rangeMetersChanged)
+    Q_PROPERTY(qreal confidenceLevel READ confidenceLevel WRITE setConfidenceLevel NOTIFY confidenceLevelChanged)
+    Q_PROPERTY(qreal pixelsPerMil READ pixelsPerMil NOTIFY pixelsPerMilChanged)
+
+    // Tracking box
+    Q_PROPERTY(QRectF trackingBox READ trackingBox WRITE setTrackingBox NOTIFY trackingBoxChanged)
+    Q_PROPERTY(bool trackingBoxVisible READ trackingBoxVisible WRITE setTrackingBoxVisible NOTIFY trackingBoxVisibleChanged)
+    Q_PROPERTY(QColor trackingBoxColor READ trackingBoxColor WRITE setTrackingBoxColor NOTIFY trackingBoxColorChanged)
+    Q_PROPERTY(bool trackingBoxDashed READ trackingBoxDashed WRITE setTrackingBoxDashed NOTIFY trackingBoxDashedChanged)
+
+    // Azimuth compass (rect in item coordinates)
+    Q_PROPERTY(QRectF azimuthRect READ azimuthRect WRITE setAzimuthRect NOTIFY azimuthRectChanged)
+    Q_PROPERTY(qreal azimuth READ azimuth WRITE setAzimuth NOTIFY azimuthChanged)
+    Q_PROPERTY(qreal vehicleHeading READ vehicleHeading WRITE setVehicleHeading NOTIFY vehicleHeadingChanged)
+    Q_PROPERTY(bool imuConnected READ imuConnected WRITE setImuConnected NOTIFY imuConnectedChanged)
+
+    // Elevation scale (rect in item coordinates)
+    Q_PROPERTY(QRectF elevationRect READ elevationRect WRITE setElevationRect NOTIFY elevationRectChanged)
+    Q_PROPERTY(qreal elevation READ elevation WRITE setElevation NOTIFY elevationChanged)
+
+public:
+    // Same limits as the OSD elevation scale labels
+    static constexpr qreal MinElevation = -20.0;
+    static constexpr qreal MaxElevation = 60.0;
+
+    explicit OsdSceneItem(QQuickItem *parent = nullptr);
+
+    QColor color() const { return m_color; }
+    QColor outlineColor() const { return m_outlineColor; }
+    QColor relativeColor() const { return m_relativeColor; }
+    int reticleType() const { return m_reticleType; }
+    QPointF reticleOffset() const { return m_reticleOffset; }
+    qreal currentFov() const { return m_currentFov; }
+    bool lacActive() const { return m_lacActive; }
+    qreal rangeMeters() const { return m_rangeMeters; }
+    qreal confidenceLevel() const { return m_confidenceLevel; }
+    QRectF trackingBox() const { return m_trackingBox; }
+    bool trackingBoxVisible() const { return m_trackingBoxVisible; }
+    QColor trackingBoxColor() const { return m_trackingBoxColor; }
+    bool trackingBoxDashed() const { return m_trackingBoxDashed; }
+    QRectF azimuthRect() const { return m_azimuthRect; }
+    qreal azimuth() const { return m_azimuth; }
+    qreal vehicleHeading() const { return m_vehicleHeading; }
+    bool imuConnected() const { return m_imuConnected; }
+    QRectF elevationRect() const { return m_elevationRect; }
+    qreal elevation() const { return m_elevation; }
+
+    void setColor(const QColor& color);
+    void setOutlineColor(const QColor& color);
+    void setRelativeColor(const QColor& color);
+    void setReticleType(int type);
+    void setReticleOffset(const QPointF& offset);
+    void setCurrentFov(qreal fov);
+    void setLacActive(bool active);
+    void setRangeMeters(qreal range);
+    void setConfidenceLevel(qreal level);
+    void setTrackingBox(const QRectF& box);
+    void setTrackingBoxVisible(bool visible);
+    void setTrackingBoxColor(const QColor& color);
+    void setTrackingBoxDashed(bool dashed);
+    void setAzimuthRect(const QRectF& rect);
+    void setAzimuth(qreal azimuth);
+    void setVehicleHeading(qreal heading);
+    void setImuConnected(bool connected);
+    void setElevationRect(const QRectF& rect);
+    void setElevation(qreal elevation);
+
+    // Bearing shown by the needle: gimbal azimuth plus vehicle heading when the IMU is up
+    qreal trueBearing() const;
+    // Screen pixels per mil for the current FOV (mil-dot spacing)
+    qreal pixelsPerMil() const;
+
+signals:
+    void colorChanged();
+    void outlineColorChanged();
+    void relativeColorChanged();
+    void reticleTypeChanged();
+    void reticleOffsetChanged();
+    void currentFovChanged();
+    void lacActiveChanged();
+    void rangeMetersChanged();
+    void confidenceLevelChanged();
+    void pixelsPerMilChanged();
+    void trackingBoxChanged();
+    void trackingBoxVisibleChanged();
+    void trackingBoxColorChanged();
+    void trackingBoxDashedChanged();
+    void azimuthRectChanged();
+    void azimuthChanged();
+    void vehicleHeadingChanged();
+    void imuConnectedChanged();
+    void elevationRectChanged();
+    void elevationChanged();
+
+protected:
+    QSGNode* updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+    void geometryChange(const QRectF& newGeometry, const QRectF& oldGeometry) override;
+
+private:
+    // What has to be redone on the next sync
+    enum DirtyFlag {
+        ReticleShape      = 1 << 0,
+        ReticleTransform  = 1 << 1,
+        TrackingBoxShape  = 1 << 2,
+        CompassShape      = 1 << 3,
+        CompassTransform  = 1 << 4,
+        ElevationShape    = 1 << 5,
+        ElevationPointer  = 1 << 6,
+        AllDirty          = 0x7f
+    };
+
+    void markDirty(int flags);
+
+    // Vertex builders, in each symbol's own coordinates (run during sync)
+    void buildReticle(QVector<QSGGeometry::ColoredPoint2D>& out) const;
+    void buildTrackingBox(QVector<QSGGeometry::ColoredPoint2D>& out) const;
+    void buildCompassRose(QVector<QSGGeometry::ColoredPoint2D>& out) const;
+    void buildVehicleMarker(QVector<QSGGeometry::ColoredPoint2D>& out) const;
+    void buildNeedle(QVector<QSGGeometry::ColoredPoint2D>& out) const;
+    void buildElevationScale(QVector<QSGGeometry::ColoredPoint2D>& out) const;
+    void buildElevationPointer(QVector<QSGGeometry::ColoredPoint2D>& out) const;
+
+    qreal elevationToY(qreal elevation) const;
+
+    QColor m_color = QColor(70, 226, 165);
+    QColor m_outlineColor = Qt::black;
+    QColor m_relativeColor = Qt::yellow;
+
+    int m_reticleType = 1;
+    QPointF m_reticleOffset;
+    qreal m_currentFov = 45.0;
+    bool m_lacActive = false;
+    qreal m_rangeMeters = 0.0;
+    qreal m_confidenceLevel = 1.0;
+
+    QRectF m_trackingBox;
+    bool m_trackingBoxVisible = false;
+    QColor m_trackingBoxColor = Qt::yellow;
+    bool m_trackingBoxDashed = false;
+
+    QRectF m_azimuthRect;
+    qreal m_azimuth = 0.0;
+    qreal m_vehicleHeading = 0.0;
+    bool m_imuConnected = false;
+
+    QRectF m_elevationRect;
+    qreal m_elevation = 0.0;
+
+    int m_dirty = AllDirty;
+};
+
+#endif // OSDSCENEITEM_H
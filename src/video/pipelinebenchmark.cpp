@@ -0,0 +1,230 @@
+#include "pipelinebenchmark.h"
+
+#include "models/domain/systemstatemodel.h"
+#include "services/detectionservice.h"
+#include "utils/latencyhistogram.h"
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QFile>
+#include <QJsonDocument>
+
+#include <cstdio>
+
+namespace {
+constexpr int kOutputWidth = 1024;   // CameraVideoStreamDevice output size
+constexpr int kOutputHeight = 768;
+constexpr int kTrackBoxSize = 100;
+
+const char *cameraName(int cameraIndex)
+{
+    return cameraIndex == 0 ? "day" : "night";
+}
+}
+
+PipelineBenchmark::PipelineBenchmark(const Options &options, QObject *parent)
+    : QObject(parent),
+      m_options(options)
+{
+    m_stateModel = new SystemStateModel(this);
+
+    if (m_options.detection) {
+        m_detectionService = new DetectionService(m_options.detectionModelPath.toStdString(),
+                                                  cv::Size(640, 640),
+                                                  false, // use CUDA
+                                                  this);
+        // Warm up before measuring, not during the first frames
+        m_detectionService->loadModel();
+    }
+
+    const CameraVideoStreamDevice::ReplayOptions *replays[MaxCameras] = {&m_options.day, &m_options.night};
+    for (int i = 0; i < MaxCameras; ++i) {
+        if (replays[i]->source.isEmpty())
+            continue;
+
+        auto *device = new CameraVideoStreamDevice(i, QString("replay:%1").arg(cameraName(i)),
+                                                   m_options.sourceWidth, m_options.sourceHeight,
+                                                   m_stateModel, m_detectionService, nullptr);
+        device->setReplayOptions(*replays[i]);
+        device->setTrackingBackend(m_options.trackingBackend);
+
+        // Fixed operating point for the whole run: the state model is not
+        // connected, so nothing changes the phase behind the benchmark's back.
+        SystemStateData state = m_stateModel->data();
+        state.activeCameraIsDay = true;
+        state.detectionEnabled = m_options.detection;
+        if (m_options.tracking) {
+            state.currentTrackingPhase = TrackingPhase::Tracking_LockPending;
+            state.acquisitionBoxX_px = (kOutputWidth - kTrackBoxSize) / 2.0f;
+            state.acquisitionBoxY_px = (kOutputHeight - kTrackBoxSize) / 2.0f;
+            state.acquisitionBoxW_px = kTrackBoxSize;
+            state.acquisitionBoxH_px = kTrackBoxSize;
+        }
+        device->onSystemStateChanged(state);
+
+        connect(device, &CameraVideoStreamDevice::frameDataReady, this, &PipelineBenchmark::onFrameDataReady);
+        connect(device, &CameraVideoStreamDevice::processingError, this, &PipelineBenchmark::onProcessingError);
+        connect(device, &QThread::finished, this, &PipelineBenchmark::onDeviceFinished);
+        m_devices[i] = device;
+    }
+
+    m_durationTimer.setSingleShot(true);
+    connect(&m_durationTimer, &QTimer::timeout, this, &PipelineBenchmark::finish);
+}
+
+PipelineBenchmark::~PipelineBenchmark()
+{
+    for (CameraVideoStreamDevice *device : m_devices) {
+        if (!device)
+            continue;
+        device->stop();
+        device->wait(3000);
+        delete device;
+    }
+}
+
+void PipelineBenchmark::start()
+{
+    if (!m_devices[0] && !m_devices[1]) {
+        qCritical() << "PipelineBenchmark: No replay source configured.";
+        QTimer::singleShot(0, this, [this]() { emit finished(2); });
+        return;
+    }
+
+    qInfo() << "PipelineBenchmark: Starting"
+            << (m_options.durationSec > 0 ? QString("%1 s run").arg(m_options.durationSec) : QString("run to end of stream"))
+            << "| detection:" << m_options.detection << "| tracking:" << m_options.tracking
+            << "(" << m_options.trackingBackend << ")";
+
+    FrameLatencyMonitor::instance().reset();
+    m_elapsed.start();
+    for (CameraVideoStreamDevice *device : m_devices) {
+        if (device)
+            device->start();
+    }
+    if (m_options.durationSec > 0)
+        m_durationTimer.start(m_options.durationSec * 1000);
+}
+
+void PipelineBenchmark::onFrameDataReady(const FrameData &data)
+{
+    if (data.cameraIndex >= 0 && data.cameraIndex < MaxCameras)
+        ++m_framesReceived[data.cameraIndex];
+}
+
+void PipelineBenchmark::onProcessingError(int cameraIndex, const QString &errorMessage)
+{
+    qWarning() << "PipelineBenchmark: Cam" << cameraIndex << "error:" << errorMessage;
+    if (cameraIndex >= 0 && cameraIndex < MaxCameras)
+        ++m_errors[cameraIndex];
+}
+
+void PipelineBenchmark::onDeviceFinished()
+{
+    for (CameraVideoStreamDevice *device : m_devices) {
+        if (device && device->isRunning())
+            return;
+    }
+    finish();
+}
+
+void PipelineBenchmark::finish()
+{
+    if (m_finished)
+        return;
+    m_finished = true;
+    m_durationTimer.stop();
+    m_elapsedMs = m_elapsed.elapsed();
+
+    for (CameraVideoStreamDevice *device : m_devices) {
+        if (device)
+            device->stop();
+    }
+    for (CameraVideoStreamDevice *device : m_devices) {
+        if (device)
+            device->wait(3000);
+    }
+    // Deliver frameDataReady events still queued from the camera threads
+    QCoreApplication::processEvents();
+
+    writeReport();
+
+    int exitCode = 0;
+    for (int i = 0; i < MaxCameras; ++i) {
+        if (m_devices[i] && (m_framesReceived[i] == 0 || m_errors[i] > 0))
+            exitCode = 1;
+    }
+    emit finished(exitCode);
+}
+
+QJsonObject PipelineBenchmark::report() const
+{
+    const FrameLatencyMonitor &latency = FrameLatencyMonitor::instance();
+    const QJsonObject stages = latency.toJson();
+    const double seconds = m_elapsedMs / 1000.0;
+
+    QJsonObject cameras;
+    for (int i = 0; i < MaxCameras; ++i) {
+        if (!m_devices[i])
+            continue;
+        const CameraVideoStreamDevice::ReplayOptions &replay = (i == 0) ? m_options.day : m_options.night;
+
+        QJsonObject camera;
+        camera["source"] = replay.source;
+        camera["stateFile"] = replay.stateFile;
+        camera["framesProcessed"] = static_cast<qint64>(latency.processedFrames(i));
+        camera["framesReceived"] = static_cast<qint64>(m_framesReceived[i]);
+        camera["framesDropped"] = static_cast<qint64>(latency.droppedFrames(i));
+        camera["errors"] = m_errors[i];
+        camera["fps"] = seconds > 0.0 ? latency.processedFrames(i) / seconds : 0.0;
+        camera["stages"] = stages[cameraName(i)].toObject();
+        cameras[cameraName(i)] = camera;
+    }
+
+    QJsonObject json;
+    json["durationSec"] = seconds;
+    json["realtime"] = (m_devices[0] ? m_options.day.realtime : m_options.night.realtime);
+    json["detection"] = m_options.detection;
+    json["tracking"] = m_options.tracking;
+    json["trackingBackend"] = m_options.trackingBackend;
+    if (m_detectionService) {
+        json["batchedForwards"] = static_cast<qint64>(m_detectionService->batchedForwards());
+        json["singleForwards"] = static_cast<qint64>(m_detectionService->singleForwards());
+    }
+    json["cameras"] = cameras;
+    return json;
+}
+
+void PipelineBenchmark::writeReport()
+{
+    const QJsonObject json = report();
+    const QJsonObject cameras = json["cameras"].toObject();
+    for (auto it = cameras.constBegin(); it != cameras.constEnd(); ++it) {
+        const QJsonObject camera = it.value().toObject();
+        const QJsonObject stages = camera["stages"].toObject();
+        qInfo().noquote() << QString("PipelineBenchmark: %1 | %2 fps | processed %3 | dropped %4 | "
+                                     "sampleToEmit p50 %5 ms p95 %6 ms | captureToEmit p95 %7 ms")
+                                 .arg(it.key())
+                                 .arg(camera["fps"].toDouble(), 0, 'f', 1)
+                                 .arg(camera["framesProcessed"].toInteger())
+                                 .arg(camera["framesDropped"].toInteger())
+                                 .arg(stages["sampleToEmit"].toObject()["p50Ms"].toDouble(), 0, 'f', 2)
+                                 .arg(stages["sampleToEmit"].toObject()["p95Ms"].toDouble(), 0, 'f', 2)
+                                 .arg(stages["captureToEmit"].toObject()["p95Ms"].toDouble(), 0, 'f', 2);
+    }
+
+    const QByteArray document = QJsonDocument(json).toJson(QJsonDocument::Indented);
+    if (m_options.reportPath.isEmpty()) {
+        std::fwrite(document.constData(), 1, static_cast<size_t>(document.size()), stdout);
+        std::fflush(stdout);
+        return;
+    }
+
+    QFile file(m_options.reportPath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "PipelineBenchmark: Cannot write report to" << m_options.reportPath;
+        return;
+    }
+    file.write(document);
+    qInfo() << "PipelineBenchmark: Report written to" << m_options.reportPath;
+}
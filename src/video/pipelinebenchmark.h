@@ -0,0 +1,80 @@
+#ifndef PIPELINEBENCHMARK_H
+#define PIPELINEBENCHMARK_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QString>
+#include <QTimer>
+
+#include <array>
+
+#include "hardware/devices/cameravideostreamdevice.h"
+
+class DetectionService;
+class SystemStateModel;
+
+/**
+ * @brief Headless video pipeline benchmark.
+ *
+ * Runs the day and/or night CameraVideoStreamDevice on replay sources (no cameras,
+ * no QML, no serial hardware) and reports frames/s, dropped frames and the
+ * per-stage latency histograms from FrameLatencyMonitor as JSON.
+ *
+ * The run ends when every replay reaches end-of-stream or the duration expires,
+ * whichever comes first. finished() carries the process exit code: non-zero when
+ * a camera failed or processed no frames, so CI can gate on it.
+ */
+class PipelineBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Options {
+        CameraVideoStreamDevice::ReplayOptions day;     // Empty source = camera not run
+        CameraVideoStreamDevice::ReplayOptions night;
+        int sourceWidth = 1280;
+        int sourceHeight = 720;
+        int durationSec = 30;           // 0 = until end of stream
+        bool detection = false;
+        QString detectionModelPath;
+        bool tracking = false;          // Lock a centred box on the day camera
+        QString trackingBackend = "VPI_BACKEND_CUDA";
+        QString reportPath;             // Empty = print to stdout
+    };
+
+    explicit PipelineBenchmark(const Options &options, QObject *parent = nullptr);
+    ~PipelineBenchmark() override;
+
+    void start();
+
+    QJsonObject report() const;
+
+signals:
+    void finished(int exitCode);
+
+private slots:
+    void onFrameDataReady(const FrameData &data);
+    void onProcessingError(int cameraIndex, const QString &errorMessage);
+    void onDeviceFinished();
+    void finish();
+
+private:
+    static constexpr int MaxCameras = 2;
+
+    void writeReport();
+
+    Options m_options;
+    SystemStateModel *m_stateModel = nullptr;
+    DetectionService *m_detectionService = nullptr;
+    std::array<CameraVideoStreamDevice *, MaxCameras> m_devices{};
+    std::array<quint64, MaxCameras> m_framesReceived{};
+    std::array<int, MaxCameras> m_errors{};
+
+    QTimer m_durationTimer;
+    QElapsedTimer m_elapsed;
+    qint64 m_elapsedMs = 0;
+    bool m_finished = false;
+};
+
+#endif // PIPELINEBENCHMARK_H
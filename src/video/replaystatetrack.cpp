@@ -0,0 +1,166 @@
+#include "replaystatetrack.h"
+
+#include <QDebug>
+#include <QFile>
+#include <QStringList>
+#include <QTextStream>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+enum Column {
+    ColPts, ColAzimuth, ColElevation, ColRoll, ColPitch, ColYaw,
+    ColGyroX, ColGyroY, ColGyroZ, ColAccelX, ColAccelY, ColAccelZ, ColLrf,
+    ColumnCount
+};
+
+const char *const kColumnNames[ColumnCount] = {
+    "pts_ms", "azimuth", "elevation", "roll", "pitch", "yaw",
+    "gyro_x", "gyro_y", "gyro_z", "accel_x", "accel_y", "accel_z", "lrf"
+};
+
+template <typename T>
+T lerp(T a, T b, double t)
+{
+    return static_cast<T>(a + (b - a) * t);
+}
+
+// Interpolates across the 360 degree wrap instead of sweeping the long way round
+template <typename T>
+T lerpAngle(T a, T b, double t)
+{
+    double delta = std::fmod(static_cast<double>(b) - a, 360.0);
+    if (delta > 180.0) delta -= 360.0;
+    else if (delta < -180.0) delta += 360.0;
+    return static_cast<T>(a + delta * t);
+}
+
+} // namespace
+
+bool ReplayStateTrack::load(const QString &filePath)
+{
+    clear();
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qWarning() << "ReplayStateTrack: Cannot open state file:" << filePath;
+        return false;
+    }
+
+    QTextStream in(&file);
+    int columnIndex[ColumnCount];
+    std::fill(std::begin(columnIndex), std::end(columnIndex), -1);
+    bool haveHeader = false;
+    int lineNumber = 0;
+    int skipped = 0;
+
+    while (!in.atEnd()) {
+        const QString line = in.readLine().trimmed();
+        ++lineNumber;
+        if (line.isEmpty() || line.startsWith('#'))
+            continue;
+
+        const QStringList fields = line.split(',');
+        if (!haveHeader) {
+            for (int i = 0; i < fields.size(); ++i) {
+                const QString name = fields[i].trimmed().toLower();
+                for (int c = 0; c < ColumnCount; ++c) {
+                    if (name == QLatin1String(kColumnNames[c]))
+                        columnIndex[c] = i;
+                }
+            }
+            if (columnIndex[ColPts] < 0) {
+                qWarning() << "ReplayStateTrack: Missing 'pts_ms' column in" << filePath;
+                return false;
+            }
+            haveHeader = true;
+            continue;
+        }
+
+        double values[ColumnCount] = {};
+        bool ok = true;
+        for (int c = 0; c < ColumnCount && ok; ++c) {
+            const int i = columnIndex[c];
+            if (i < 0)
+                continue;
+            if (i >= fields.size()) { ok = false; break; }
+            values[c] = fields[i].trimmed().toDouble(&ok);
+        }
+        if (!ok) {
+            if (skipped++ < 5)
+                qWarning() << "ReplayStateTrack: Skipping malformed line" << lineNumber << "in" << filePath;
+            continue;
+        }
+
+        ReplayStateSample s;
+        s.ptsNs = static_cast<qint64>(std::llround(values[ColPts] * 1e6));
+        s.azimuth = static_cast<float>(values[ColAzimuth]);
+        s.elevation = static_cast<float>(values[ColElevation]);
+        s.imuRollDeg = values[ColRoll];
+        s.imuPitchDeg = values[ColPitch];
+        s.imuYawDeg = values[ColYaw];
+        s.gyroX = values[ColGyroX];
+        s.gyroY = values[ColGyroY];
+        s.gyroZ = values[ColGyroZ];
+        s.accelX = values[ColAccelX];
+        s.accelY = values[ColAccelY];
+        s.accelZ = values[ColAccelZ];
+        s.lrfDistance = static_cast<float>(values[ColLrf]);
+        m_samples.push_back(s);
+    }
+
+    std::stable_sort(m_samples.begin(), m_samples.end(),
+                     [](const ReplayStateSample &a, const ReplayStateSample &b) { return a.ptsNs < b.ptsNs; });
+
+    if (m_samples.empty()) {
+        qWarning() << "ReplayStateTrack: No samples in" << filePath;
+        return false;
+    }
+
+    qInfo() << "ReplayStateTrack: Loaded" << m_samples.size() << "samples from" << filePath
+            << "spanning" << (m_samples.back().ptsNs - m_samples.front().ptsNs) / 1000000 << "ms"
+            << (skipped ? QString("(%1 malformed lines skipped)").arg(skipped) : QString());
+    return true;
+}
+
+void ReplayStateTrack::clear()
+{
+    m_samples.clear();
+}
+
+bool ReplayStateTrack::sampleAt(qint64 ptsNs, ReplayStateSample &out) const
+{
+    if (m_samples.empty())
+        return false;
+
+    const auto upper = std::lower_bound(m_samples.begin(), m_samples.end(), ptsNs,
+                                        [](const ReplayStateSample &s, qint64 t) { return s.ptsNs < t; });
+    if (upper == m_samples.begin()) {
+        out = m_samples.front();
+    } else if (upper == m_samples.end()) {
+        out = m_samples.back();
+    } else {
+        const ReplayStateSample &a = *(upper - 1);
+        const ReplayStateSample &b = *upper;
+        const double span = static_cast<double>(b.ptsNs - a.ptsNs);
+        const double t = span > 0.0 ? (ptsNs - a.ptsNs) / span : 0.0;
+
+        out.azimuth = lerpAngle(a.azimuth, b.azimuth, t);
+        out.elevation = lerp(a.elevation, b.elevation, t);
+        out.imuRollDeg = lerp(a.imuRollDeg, b.imuRollDeg, t);
+        out.imuPitchDeg = lerp(a.imuPitchDeg, b.imuPitchDeg, t);
+        out.imuYawDeg = std::fmod(lerpAngle(a.imuYawDeg, b.imuYawDeg, t) + 360.0, 360.0);
+        out.gyroX = lerp(a.gyroX, b.gyroX, t);
+        out.gyroY = lerp(a.gyroY, b.gyroY, t);
+        out.gyroZ = lerp(a.gyroZ, b.gyroZ, t);
+        out.accelX = lerp(a.accelX, b.accelX, t);
+        out.accelY = lerp(a.accelY, b.accelY, t);
+        out.accelZ = lerp(a.accelZ, b.accelZ, t);
+        // Range readings are discrete, take the most recent one
+        out.lrfDistance = a.lrfDistance;
+    }
+    out.ptsNs = ptsNs;
+    return true;
+}
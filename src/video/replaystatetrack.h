@@ -0,0 +1,55 @@
+#ifndef REPLAYSTATETRACK_H
+#define REPLAYSTATETRACK_H
+
+#include <QString>
+#include <QtGlobal>
+
+#include <vector>
+
+/**
+ * @brief Gimbal/IMU/LRF state recorded alongside a video file.
+ */
+struct ReplayStateSample {
+    qint64 ptsNs = 0;           ///< Media time of the sample (0 = first video frame)
+    float azimuth = 0.0f;
+    float elevation = 0.0f;
+    double imuRollDeg = 0.0, imuPitchDeg = 0.0, imuYawDeg = 0.0;
+    double gyroX = 0.0, gyroY = 0.0, gyroZ = 0.0;
+    double accelX = 0.0, accelY = 0.0, accelZ = 0.0;
+    float lrfDistance = 0.0f;
+};
+
+/**
+ * @brief Sidecar state file for video replay.
+ *
+ * CSV, one sample per line, '#' starts a comment. The first non-comment line is a
+ * header naming the columns, so columns may appear in any order and missing ones
+ * stay at zero:
+ *
+ *   pts_ms,azimuth,elevation,roll,pitch,yaw,gyro_x,gyro_y,gyro_z,accel_x,accel_y,accel_z,lrf
+ *   0.0,12.50,3.20,0.1,-0.4,271.0,0.01,0.00,0.02,0.00,0.00,1.00,0
+ *
+ * pts_ms is the media time of the video stream, so samples line up with buffer PTS
+ * regardless of replay speed. Lookups interpolate linearly between neighbouring
+ * samples (shortest way round for azimuth and yaw).
+ */
+class ReplayStateTrack
+{
+public:
+    bool load(const QString &filePath);
+    void clear();
+
+    bool isLoaded() const { return !m_samples.empty(); }
+    int sampleCount() const { return static_cast<int>(m_samples.size()); }
+
+    /**
+     * @brief Interpolated state at the given media time.
+     * @return false if no samples are loaded. Times outside the recording are clamped.
+     */
+    bool sampleAt(qint64 ptsNs, ReplayStateSample &out) const;
+
+private:
+    std::vector<ReplayStateSample> m_samples;   // Sorted by ptsNs
+};
+
+#endif // REPLAYSTATETRACK_H
@@ -0,0 +1,25 @@
+#include "trackerbackend.h"
+
+#include "controllers/deviceconfiguration.h"
+#include "video/opencvtrackerbackend.h"
+#ifdef RCWS_HAVE_VPI
+#include "video/vpidcftrackerbackend.h"
+#endif
+
+std::unique_ptr<TrackerBackend> TrackerBackend::create(const QString &backendName, int cameraIndex)
+{
+    const QString key = backendName.trimmed().toUpper();
+    const float minConfidence = DeviceConfiguration::video().trackingConfidence;
+
+#ifdef RCWS_HAVE_VPI
+    if (key == "VPI_BACKEND_CUDA")
+        return std::make_unique<VpiDcfTrackerBackend>(VPI_BACKEND_CUDA, cameraIndex);
+    if (key == "VPI_BACKEND_PVA")
+        return std::make_unique<VpiDcfTrackerBackend>(VPI_BACKEND_PVA, cameraIndex);
+#endif
+    if (key == "OPENCV_KCF")
+        return std::make_unique<OpenCvTrackerBackend>(OpenCvTrackerBackend::Algorithm::KCF, cameraIndex, minConfidence);
+    if (key == "OPENCV_CSRT")
+        return std::make_unique<OpenCvTrackerBackend>(OpenCvTrackerBackend::Algorithm::CSRT, cameraIndex, minConfidence);
+    return nullptr;
+}
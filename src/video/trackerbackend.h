@@ -0,0 +1,74 @@
+#ifndef TRACKERBACKEND_H
+#define TRACKERBACKEND_H
+
+#include <QRect>
+#include <QString>
+
+#include <memory>
+
+#include <opencv2/core.hpp>
+
+#include "video/trackingstate.h"
+
+/**
+ * @brief Single-target tracker result, identical for every backend.
+ */
+struct TrackedTarget {
+    TrackingState state = TRACKING_STATE_LOST;
+    QRect bbox;                 // Frame pixel coordinates
+    float confidence = 0.0f;    // 0..1, higher is better
+};
+
+/**
+ * @brief Pluggable single-target visual tracker used by CameraVideoStreamDevice.
+ *
+ * All calls come from the camera's video thread. Frames are the BGRA display
+ * frame (CV_8UC4, frame size given to initialize()). Per-frame timing is taken
+ * by the caller (FrameStage::Tracking) so every backend is measured the same way.
+ *
+ * Backends are selected by name through video.trackingBackend in devices.json:
+ *  - "VPI_BACKEND_CUDA" / "VPI_BACKEND_PVA": NVIDIA VPI DCF tracker (builds with VPI only)
+ *  - "OPENCV_KCF" / "OPENCV_CSRT": CPU trackers from OpenCV
+ */
+class TrackerBackend
+{
+public:
+    virtual ~TrackerBackend() = default;
+
+    virtual QString name() const = 0;
+
+    /**
+     * @brief Allocates backend resources. Returns false if the backend cannot run here.
+     */
+    virtual bool initialize(int frameWidth, int frameHeight) = 0;
+    virtual void cleanup() = 0;
+
+    /**
+     * @brief Starts tracking box on frame. target() is NEW on success.
+     */
+    virtual bool initTarget(const cv::Mat &frameBGRA, const QRect &box) = 0;
+
+    /**
+     * @brief Localises the target on a new frame and updates the appearance model.
+     * @return false on backend failure; a lost target is reported through target().state.
+     */
+    virtual bool track(const cv::Mat &frameBGRA) = 0;
+
+    const TrackedTarget &target() const { return m_target; }
+
+    /**
+     * @brief Creates the backend for a devices.json trackingBackend name, or nullptr if
+     * unknown or not built into this binary.
+     */
+    static std::unique_ptr<TrackerBackend> create(const QString &backendName, int cameraIndex);
+
+    /**
+     * @brief CPU backend used when the configured one cannot be initialised.
+     */
+    static constexpr const char *CpuFallbackName = "OPENCV_KCF";
+
+protected:
+    TrackedTarget m_target;
+};
+
+#endif // TRACKERBACKEND_H
@@ -0,0 +1,16 @@
+#ifndef TRACKINGSTATE_H
+#define TRACKINGSTATE_H
+
+/**
+ * @brief State of the single tracked target, shared by every tracker backend.
+ *
+ * Project-local so the state model, OSD and CPU trackers build without VPI;
+ * the VPI backend translates its VPITrackingState into this.
+ */
+enum TrackingState {
+    TRACKING_STATE_LOST = 0,    ///< No target, or the tracker gave it up
+    TRACKING_STATE_TRACKED,     ///< Localised on the latest frame
+    TRACKING_STATE_NEW          ///< Just initialised, not yet localised
+};
+
+#endif // TRACKINGSTATE_H
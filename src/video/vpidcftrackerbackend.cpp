@@ -0,0 +1,230 @@
+#include "vpidcftrackerbackend.h"
+#include "hardware/devices/vpi_helpers.h" // For CHECK_VPI_STATUS
+
+#include <QDebug>
+
+#include <vpi/algo/ConvertImageFormat.h>
+#include <vpi/algo/CropScaler.h>
+#include <vpi/OpenCVInterop.hpp>
+#include <cuda_runtime.h>
+
+VpiDcfTrackerBackend::VpiDcfTrackerBackend(VPIBackend backend, int cameraIndex)
+    : m_backend(backend),
+      m_cameraIndex(cameraIndex)
+{
+}
+
+VpiDcfTrackerBackend::~VpiDcfTrackerBackend()
+{
+    cleanup();
+}
+
+QString VpiDcfTrackerBackend::name() const
+{
+    return m_backend == VPI_BACKEND_PVA ? "VPI_BACKEND_PVA" : "VPI_BACKEND_CUDA";
+}
+
+bool VpiDcfTrackerBackend::initialize(int frameWidth, int frameHeight)
+{
+    m_frameWidth = frameWidth;
+    m_frameHeight = frameHeight;
+
+    // CUDA device check and reset before VPI initialization
+    cudaError_t cudaStatus = cudaSetDevice(0);
+    if (cudaStatus != cudaSuccess) {
+        qWarning() << "Cam" << m_cameraIndex << ": CUDA device unavailable:"
+                   << cudaGetErrorString(cudaStatus);
+
+        // Try to reset the device
+        cudaStatus = cudaDeviceReset();
+        if (cudaStatus != cudaSuccess) {
+            qCritical() << "Cam" << m_cameraIndex << ": Failed to reset CUDA device:"
+                        << cudaGetErrorString(cudaStatus);
+            return false;
+        }
+
+        // Retry setting device
+        cudaStatus = cudaSetDevice(0);
+        if (cudaStatus != cudaSuccess) {
+            qCritical() << "Cam" << m_cameraIndex << ": CUDA device still unavailable after reset";
+            return false;
+        }
+    }
+
+    qInfo() << "Cam" << m_cameraIndex << ": CUDA device initialized successfully";
+
+    try {
+        CHECK_VPI_STATUS(vpiStreamCreate(0, &m_stream));
+        CHECK_VPI_STATUS(vpiImageCreate(m_frameWidth, m_frameHeight, VPI_IMAGE_FORMAT_NV12_ER, 0, &m_frameNV12));
+        CHECK_VPI_STATUS(vpiCreateCropScaler(m_backend, 1, m_maxTrackedTargets, &m_cropScalePayload));
+        VPIDCFTrackerCreationParams dcfParams;
+        CHECK_VPI_STATUS(vpiInitDCFTrackerCreationParams(&dcfParams));
+        m_tgtPatchSize = dcfParams.featurePatchSize * dcfParams.hogCellSize;
+        CHECK_VPI_STATUS(vpiCreateDCFTracker(m_backend, 1, m_maxTrackedTargets, &dcfParams, &m_dcfPayload));
+        VPIImageFormat patchFormat = (m_backend == VPI_BACKEND_PVA) ? VPI_IMAGE_FORMAT_RGB8p : VPI_IMAGE_FORMAT_RGBA8;
+        CHECK_VPI_STATUS(vpiImageCreate(m_tgtPatchSize, m_tgtPatchSize * m_maxTrackedTargets, patchFormat, 0, &m_tgtPatches));
+        CHECK_VPI_STATUS(vpiArrayCreate(m_maxTrackedTargets, VPI_ARRAY_TYPE_DCF_TRACKED_BOUNDING_BOX, 0, &m_inTargets));
+        CHECK_VPI_STATUS(vpiArrayCreate(m_maxTrackedTargets, VPI_ARRAY_TYPE_DCF_TRACKED_BOUNDING_BOX, 0, &m_outTargets));
+        // Create an array to hold the confidence scores.
+        CHECK_VPI_STATUS(vpiArrayCreate(m_maxTrackedTargets, VPI_ARRAY_TYPE_F32, 0, &m_confidenceScores));
+    } catch (const std::exception &e) {
+        qCritical() << "Cam" << m_cameraIndex << ": VPI Initialization failed:" << e.what();
+        cleanup(); return false;
+    }
+    return true;
+}
+
+void VpiDcfTrackerBackend::cleanup()
+{
+    if (m_stream) {
+        VPIStatus syncStatus = vpiStreamSync(m_stream);
+        if (syncStatus != VPI_SUCCESS) {
+            qWarning() << "Cam" << m_cameraIndex << ": VPI Stream sync failed during cleanup: " << vpiStatusGetName(syncStatus);
+        }
+    }
+    const bool hadResources = m_stream != nullptr;
+    VPI_SAFE_DESTROY(vpiArrayDestroy, m_inTargets);
+    VPI_SAFE_DESTROY(vpiArrayDestroy, m_outTargets);
+    VPI_SAFE_DESTROY(vpiImageDestroy, m_tgtPatches);
+    VPI_SAFE_DESTROY(vpiPayloadDestroy, m_dcfPayload);
+    VPI_SAFE_DESTROY(vpiPayloadDestroy, m_cropScalePayload);
+    VPI_SAFE_DESTROY(vpiImageDestroy, m_frameWrapper);
+    VPI_SAFE_DESTROY(vpiImageDestroy, m_frameNV12);
+    VPI_SAFE_DESTROY(vpiStreamDestroy, m_stream);
+    VPI_SAFE_DESTROY(vpiArrayDestroy, m_confidenceScores);
+
+    if (hadResources) {
+        // CUDA context cleanup
+        cudaError_t cudaStatus = cudaDeviceSynchronize();
+        if (cudaStatus != cudaSuccess) {
+            qWarning() << "Cam" << m_cameraIndex << ": CUDA sync failed:"
+                       << cudaGetErrorString(cudaStatus);
+        }
+        qInfo() << "Cam" << m_cameraIndex << ": Finished cleaning VPI objects.";
+    }
+}
+
+void VpiDcfTrackerBackend::wrapFrame(const cv::Mat &frameBGRA)
+{
+    if (!m_frameWrapper) {
+        CHECK_VPI_STATUS(vpiImageCreateWrapperOpenCVMat(frameBGRA, 0, &m_frameWrapper));
+    } else {
+        CHECK_VPI_STATUS(vpiImageSetWrappedOpenCVMat(m_frameWrapper, frameBGRA));
+    }
+}
+
+void VpiDcfTrackerBackend::publish(const VPIDCFTrackedBoundingBox &box, float confidence)
+{
+    switch (box.state) {
+    case VPI_TRACKING_STATE_TRACKED: m_target.state = TRACKING_STATE_TRACKED; break;
+    case VPI_TRACKING_STATE_NEW: m_target.state = TRACKING_STATE_NEW; break;
+    default: m_target.state = TRACKING_STATE_LOST; break;
+    }
+    m_target.bbox = QRect(box.bbox.left, box.bbox.top, box.bbox.width, box.bbox.height);
+    m_target.confidence = confidence;
+}
+
+bool VpiDcfTrackerBackend::initTarget(const cv::Mat &frameBGRA, const QRect &box)
+{
+    try {
+        wrapFrame(frameBGRA);
+
+        VPIArrayData targetsData;
+        CHECK_VPI_STATUS(vpiArrayLockData(m_inTargets, VPI_LOCK_WRITE, VPI_ARRAY_BUFFER_HOST_AOS, &targetsData));
+        if (targetsData.buffer.aos.capacity < 1) {
+             qCritical() << "Cam" << m_cameraIndex << ": VPI target array capacity is zero!";
+             vpiArrayUnlock(m_inTargets); return false;
+        }
+        auto *pTarget = static_cast<VPIDCFTrackedBoundingBox *>(targetsData.buffer.aos.data);
+        pTarget->bbox.left   = box.x();
+        pTarget->bbox.top    = box.y();
+        pTarget->bbox.width  = box.width();
+        pTarget->bbox.height = box.height();
+        pTarget->state       = VPI_TRACKING_STATE_NEW;
+        pTarget->seqIndex    = 0;
+        pTarget->filterLR    = 0.075f;
+        pTarget->filterChannelWeightsLR = 0.1f;
+        pTarget->userData    = nullptr;
+        publish(*pTarget, 1.0f);
+        *targetsData.buffer.aos.sizePointer = 1;
+        CHECK_VPI_STATUS(vpiArrayUnlock(m_inTargets));
+
+        CHECK_VPI_STATUS(vpiSubmitConvertImageFormat(m_stream, VPI_BACKEND_CUDA, m_frameWrapper, m_frameNV12, nullptr));
+        CHECK_VPI_STATUS(vpiSubmitCropScalerBatch(m_stream, 0, m_cropScalePayload, &m_frameNV12,
+                                                  1, m_inTargets, m_tgtPatchSize, m_tgtPatchSize, m_tgtPatches));
+        CHECK_VPI_STATUS(vpiSubmitDCFTrackerUpdateBatch(m_stream, 0, m_dcfPayload, nullptr, 0,
+                                                        nullptr, nullptr, m_tgtPatches, m_inTargets, nullptr));
+        CHECK_VPI_STATUS(vpiStreamSync(m_stream));
+    } catch (const std::exception &e) {
+        qCritical() << "Cam" << m_cameraIndex << ": Failed init first target:" << e.what();
+        m_target = {};
+        return false;
+    }
+    return true;
+}
+
+bool VpiDcfTrackerBackend::track(const cv::Mat &frameBGRA)
+{
+    try {
+        wrapFrame(frameBGRA);
+
+        CHECK_VPI_STATUS(vpiSubmitConvertImageFormat(m_stream, VPI_BACKEND_CUDA, m_frameWrapper, m_frameNV12, nullptr));
+        CHECK_VPI_STATUS(vpiSubmitCropScalerBatch(m_stream, 0, m_cropScalePayload, &m_frameNV12,
+                                                  1, m_inTargets, m_tgtPatchSize, m_tgtPatchSize, m_tgtPatches));
+        CHECK_VPI_STATUS(vpiSubmitDCFTrackerLocalizeBatch(m_stream, 0, m_dcfPayload, NULL, 0,
+                                                          NULL, m_tgtPatches, m_inTargets, m_outTargets,
+                                                          NULL, m_confidenceScores, NULL));
+        CHECK_VPI_STATUS(vpiStreamSync(m_stream));
+
+        VPIArrayData outTargetsData;
+        VPIArrayData confidenceData;
+        CHECK_VPI_STATUS(vpiArrayLockData(m_outTargets, VPI_LOCK_READ, VPI_ARRAY_BUFFER_HOST_AOS, &outTargetsData));
+        CHECK_VPI_STATUS(vpiArrayLockData(m_confidenceScores, VPI_LOCK_READ, VPI_ARRAY_BUFFER_HOST_AOS, &confidenceData));
+
+        VPIDCFTrackedBoundingBox localized{};
+        localized.state = VPI_TRACKING_STATE_LOST;
+        float confidence = 0.0f;
+        if (*outTargetsData.buffer.aos.sizePointer > 0) {
+            localized = *static_cast<VPIDCFTrackedBoundingBox *>(outTargetsData.buffer.aos.data);
+            confidence = static_cast<float*>(confidenceData.buffer.aos.data)[0];
+            qDebug() << "[CAM" << m_cameraIndex << "] VPI Localize Result: State=" << localized.state << "Confidence=" << confidence;
+        } else {
+            qWarning() << "Cam" << m_cameraIndex << ": Output target array empty after localize.";
+        }
+        CHECK_VPI_STATUS(vpiArrayUnlock(m_outTargets));
+        CHECK_VPI_STATUS(vpiArrayUnlock(m_confidenceScores));
+
+        const bool inFrame = localized.bbox.left >= 0 && localized.bbox.top >= 0 &&
+                             localized.bbox.width > 0 && localized.bbox.height > 0 &&
+                             localized.bbox.left + localized.bbox.width <= m_frameWidth &&
+                             localized.bbox.top + localized.bbox.height <= m_frameHeight;
+        if (!inFrame)
+            localized.state = VPI_TRACKING_STATE_LOST; // Ensure state is LOST if box is invalid
+        publish(localized, confidence);
+
+        // Feed the localised box back as the input for the model update and the
+        // next localise; clear it when the target is gone.
+        VPIArrayData inTargetsData;
+        CHECK_VPI_STATUS(vpiArrayLockData(m_inTargets, VPI_LOCK_WRITE, VPI_ARRAY_BUFFER_HOST_AOS, &inTargetsData));
+        if (localized.state != VPI_TRACKING_STATE_LOST) {
+            if (inTargetsData.buffer.aos.capacity < 1) {
+                qCritical() << "Cam" << m_cameraIndex << ": VPI inTargets array capacity is zero for update!";
+                vpiArrayUnlock(m_inTargets); return false;
+            }
+            *static_cast<VPIDCFTrackedBoundingBox *>(inTargetsData.buffer.aos.data) = localized;
+            *inTargetsData.buffer.aos.sizePointer = 1;
+            CHECK_VPI_STATUS(vpiArrayUnlock(m_inTargets));
+
+            CHECK_VPI_STATUS(vpiSubmitDCFTrackerUpdateBatch(m_stream, 0, m_dcfPayload, nullptr, 0,
+                                                            nullptr, nullptr, m_tgtPatches, m_inTargets, nullptr));
+            CHECK_VPI_STATUS(vpiStreamSync(m_stream)); // Sync after update
+        } else {
+            *inTargetsData.buffer.aos.sizePointer = 0; // Clear the array
+            CHECK_VPI_STATUS(vpiArrayUnlock(m_inTargets));
+        }
+    } catch (const std::exception &e) {
+        qCritical() << "Cam" << m_cameraIndex << ": Exception during tracking cycle:" << e.what();
+        m_target.state = TRACKING_STATE_LOST; return false;
+    }
+    return true;
+}
@@ -0,0 +1,53 @@
+#ifndef VPIDCFTRACKERBACKEND_H
+#define VPIDCFTRACKERBACKEND_H
+
+#include "video/trackerbackend.h"
+
+#include <vpi/Types.h>
+#include <vpi/Array.h>
+#include <vpi/Image.h>
+#include <vpi/Stream.h>
+#include <vpi/algo/DCFTracker.h>
+
+/**
+ * @brief VPI DCF tracker (CUDA or PVA).
+ *
+ * Per frame: BGRA -> NV12 conversion, crop/scale of the target patch, DCF localise,
+ * then a model update when the target is still present. The BGRA wrapper is created
+ * once and re-pointed at each new frame instead of being rebuilt every frame.
+ */
+class VpiDcfTrackerBackend : public TrackerBackend
+{
+public:
+    VpiDcfTrackerBackend(VPIBackend backend, int cameraIndex);
+    ~VpiDcfTrackerBackend() override;
+
+    QString name() const override;
+    bool initialize(int frameWidth, int frameHeight) override;
+    void cleanup() override;
+    bool initTarget(const cv::Mat &frameBGRA, const QRect &box) override;
+    bool track(const cv::Mat &frameBGRA) override;
+
+private:
+    void wrapFrame(const cv::Mat &frameBGRA);
+    void publish(const VPIDCFTrackedBoundingBox &box, float confidence);
+
+    VPIBackend m_backend;
+    int m_cameraIndex;
+    int m_frameWidth = 0;
+    int m_frameHeight = 0;
+    const int m_maxTrackedTargets = 1;
+
+    VPIStream m_stream = nullptr;
+    VPIPayload m_dcfPayload = nullptr;
+    VPIPayload m_cropScalePayload = nullptr;
+    VPIImage m_frameWrapper = nullptr;  // Wraps the caller's BGRA cv::Mat
+    VPIImage m_frameNV12 = nullptr;
+    VPIImage m_tgtPatches = nullptr;
+    VPIArray m_inTargets = nullptr;
+    VPIArray m_outTargets = nullptr;
+    VPIArray m_confidenceScores = nullptr;
+    int m_tgtPatchSize = 0;
+};
+
+#endif // VPIDCFTRACKERBACKEND_H
@@ -0,0 +1,355 @@
+#include "zonemapitem.h"
+#include "models/zonemapviewmodel.h"
+#include "osdgeometrybuilder.h"
+
+#include <QSGGeometryNode>
+#include <QSGTransformNode>
+#include <QSGVertexColorMaterial>
+#include <QVariantMap>
+#include <cmath>
+
+namespace {
+// Same look as the previous Canvas implementation
+const QColor kBackgroundColor(0x28, 0x28, 0x28);
+const QColor kGridColor(0x50, 0x50, 0x50);
+const QColor kSectorScanColor(0x4A, 0x90, 0xE2);
+const QColor kWipColor(0x00, 0xFF, 0x99);
+const QColor kMarkerColor(Qt::yellow);
+
+constexpr qreal kZoneFillOpacity = 0x33 / 255.0;
+constexpr qreal kLineWidth = 2.0;
+constexpr qreal kHighlightLineWidth = 3.0;
+
+// Elevation span of the map (ZoneMapViewModel::EL_MIN / EL_MAX)
+constexpr float kElMin = -20.0f;
+constexpr float kElMax = 90.0f;
+
+using Vertices = QVector<QSGGeometry::ColoredPoint2D>;
+
+QSGGeometryNode* createGeometryNode()
+{
+    auto* node = new QSGGeometryNode;
+    auto* geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(), 0);
+    geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+    node->setGeometry(geometry);
+    node->setFlag(QSGNode::OwnsGeometry);
+    node->setMaterial(new QSGVertexColorMaterial);
+    node->setFlag(QSGNode::OwnsMaterial);
+    return node;
+}
+
+void uploadGeometry(QSGGeometryNode* node, const Vertices& vertices)
+{
+    OsdGeometryBuilder::upload(node->geometry(), vertices);
+    node->markDirty(QSGNode::DirtyGeometry);
+}
+
+QColor zoneColor(ZoneType type)
+{
+    switch (type) {
+    case ZoneType::Safety:     return QColor(0x00, 0xFF, 0xFF);
+    case ZoneType::NoTraverse: return QColor(0xC8, 0x14, 0x28);
+    case ZoneType::NoFire:     return QColor(0xFF, 0x00, 0xFF);
+    default:                   return QColor(0x80, 0x80, 0x80);
+    }
+}
+
+float normalizeAzimuth(float az)
+{
+    float normalized = std::fmod(az, 360.0f);
+    if (normalized < 0.0f) normalized += 360.0f;
+    return normalized;
+}
+
+// Translucent fill plus border; dash <= 0 draws a solid border
+void addZoneRect(OsdGeometryBuilder& b, const QRectF& rect, const QColor& fill,
+                 const QColor& stroke, qreal width, qreal dash, qreal gap)
+{
+    const QRectF r = rect.normalized();
+    b.fillRect(r, fill, kZoneFillOpacity);
+
+    const QLineF edges[] = {
+        QLineF(r.topLeft(), r.topRight()),
+        QLineF(r.topRight(), r.bottomRight()),
+        QLineF(r.bottomRight(), r.bottomLeft()),
+        QLineF(r.bottomLeft(), r.topLeft())
+    };
+    for (const QLineF& edge : edges) {
+        if (dash > 0.0) {
+            b.strokeDashedLine(edge, width, dash, gap, stroke);
+        } else {
+            b.strokeLine(edge, width, stroke);
+        }
+    }
+}
+
+void addCross(OsdGeometryBuilder& b, const QPointF& center, qreal arm, const QColor& color,
+              qreal dash = 0.0)
+{
+    const QLineF lines[] = {
+        QLineF(center.x() - arm, center.y(), center.x() + arm, center.y()),
+        QLineF(center.x(), center.y() - arm, center.x(), center.y() + arm)
+    };
+    for (const QLineF& line : lines) {
+        if (dash > 0.0) {
+            b.strokeDashedLine(line, kLineWidth, dash, dash, color);
+        } else {
+            b.strokeLine(line, kLineWidth, color);
+        }
+    }
+}
+
+struct ZoneMapRootNode : public QSGNode
+{
+    QSGGeometryNode* staticLayer = createGeometryNode();
+    QSGGeometryNode* wipZone = createGeometryNode();
+    QSGTransformNode* gimbalTransform = new QSGTransformNode;
+    QSGGeometryNode* gimbalMarker = createGeometryNode();
+
+    ZoneMapRootNode()
+    {
+        appendChildNode(staticLayer);
+        appendChildNode(wipZone);
+        appendChildNode(gimbalTransform);
+        gimbalTransform->appendChildNode(gimbalMarker);
+    }
+};
+}
+
+ZoneMapItem::ZoneMapItem(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents, true);
+}
+
+void ZoneMapItem::setViewModel(ZoneMapViewModel* viewModel)
+{
+    if (m_viewModel == viewModel) return;
+
+    if (m_viewModel) {
+        disconnect(m_viewModel, nullptr, this, nullptr);
+        disconnect(m_viewModel->areaZoneModel(), nullptr, this, nullptr);
+        disconnect(m_viewModel->sectorScanModel(), nullptr, this, nullptr);
+        disconnect(m_viewModel->trpModel(), nullptr, this, nullptr);
+    }
+    m_viewModel = viewModel;
+    if (m_viewModel) {
+        auto staticChanged = [this]() { markDirty(StaticLayer); };
+        auto wipChanged = [this]() { markDirty(WipLayer); };
+        auto gimbalChanged = [this]() { markDirty(GimbalTransform); };
+
+        connect(m_viewModel->areaZoneModel(), &ZoneMapListModel::zonesUpdated, this, staticChanged);
+        connect(m_viewModel->sectorScanModel(), &ZoneMapListModel::zonesUpdated, this, staticChanged);
+        connect(m_viewModel->trpModel(), &ZoneMapListModel::zonesUpdated, this, staticChanged);
+        connect(m_viewModel, &ZoneMapViewModel::highlightedZoneIdChanged, this, staticChanged);
+
+        connect(m_viewModel, &ZoneMapViewModel::hasWipZoneChanged, this, wipChanged);
+        connect(m_viewModel, &ZoneMapViewModel::wipZoneChanged, this, wipChanged);
+        connect(m_viewModel, &ZoneMapViewModel::wipZoneTypeChanged, this, wipChanged);
+
+        connect(m_viewModel, &ZoneMapViewModel::gimbalAzChanged, this, gimbalChanged);
+        connect(m_viewModel, &ZoneMapViewModel::gimbalElChanged, this, gimbalChanged);
+    }
+    markDirty(AllDirty);
+    emit viewModelChanged();
+}
+
+void ZoneMapItem::markDirty(int flags)
+{
+    m_dirty |= flags;
+    update();
+}
+
+void ZoneMapItem::geometryChange(const QRectF& newGeometry, const QRectF& oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size()) {
+        markDirty(AllDirty);
+    }
+}
+
+QPointF ZoneMapItem::toPixel(float az, float el) const
+{
+    // Not normalised: callers pass 360 for the right edge of wrapped zones
+    const qreal x = az / 360.0 * width();
+    const qreal y = height() - (el - kElMin) / (kElMax - kElMin) * height();
+    return QPointF(x, y);
+}
+
+QSGNode* ZoneMapItem::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData*)
+{
+    auto* root = static_cast<ZoneMapRootNode*>(oldNode);
+    if (!root) {
+        root = new ZoneMapRootNode;
+        Vertices marker;
+        buildGimbalMarker(marker);
+        uploadGeometry(root->gimbalMarker, marker);
+        m_dirty = AllDirty;
+    }
+    if (m_dirty == 0) {
+        return root;
+    }
+
+    // The GUI thread is blocked during sync, so the view model is stable here
+    Vertices vertices;
+
+    if (m_dirty & StaticLayer) {
+        buildStaticLayer(vertices);
+        uploadGeometry(root->staticLayer, vertices);
+    }
+    if (m_dirty & WipLayer) {
+        buildWipZone(vertices);
+        uploadGeometry(root->wipZone, vertices);
+    }
+    if (m_dirty & GimbalTransform) {
+        QMatrix4x4 matrix;
+        if (m_viewModel) {
+            const QPointF pos = toPixel(normalizeAzimuth(m_viewModel->gimbalAz()), m_viewModel->gimbalEl());
+            matrix.translate(pos.x(), pos.y());
+        }
+        if (root->gimbalTransform->matrix() != matrix) {
+            root->gimbalTransform->setMatrix(matrix);
+            root->gimbalTransform->markDirty(QSGNode::DirtyMatrix);
+        }
+    }
+
+    m_dirty = 0;
+    return root;
+}
+
+void ZoneMapItem::addAreaZone(OsdGeometryBuilder& b, float startAz, float endAz, float minEl, float maxEl,
+                              const QColor& fill, const QColor& stroke, qreal lineWidth,
+                              qreal dash, qreal gap) const
+{
+    const float start = normalizeAzimuth(startAz);
+    const float end = normalizeAzimuth(endAz);
+    const qreal top = toPixel(0.0f, maxEl).y();
+    const qreal bottom = toPixel(0.0f, minEl).y();
+
+    if (start <= end) {
+        addZoneRect(b, QRectF(QPointF(toPixel(start, 0.0f).x(), top), QPointF(toPixel(end, 0.0f).x(), bottom)),
+                    fill, stroke, lineWidth, dash, gap);
+        return;
+    }
+
+    // Wrap-around zone: split at 0°/360°
+    addZoneRect(b, QRectF(QPointF(toPixel(start, 0.0f).x(), top), QPointF(width(), bottom)),
+                fill, stroke, lineWidth, dash, gap);
+    addZoneRect(b, QRectF(QPointF(0.0, top), QPointF(toPixel(end, 0.0f).x(), bottom)),
+                fill, stroke, lineWidth, dash, gap);
+}
+
+// ============================================================================
+// STATIC LAYER (background, grid, saved zones)
+// ============================================================================
+
+void ZoneMapItem::buildStaticLayer(Vertices& out) const
+{
+    OsdGeometryBuilder b(&out);
+    b.clear();
+
+    const qreal w = width();
+    const qreal h = height();
+    b.fillRect(QRectF(0.0, 0.0, w, h), kBackgroundColor);
+
+    // Azimuth grid every 30°, elevation grid every 10°
+    for (int az = 0; az <= 360; az += 30) {
+        const qreal x = toPixel(az, 0.0f).x();
+        b.strokeLine(QLineF(x, 0.0, x, h), 1.0, kGridColor);
+    }
+    for (int el = static_cast<int>(kElMin); el <= static_cast<int>(kElMax); el += 10) {
+        const qreal y = toPixel(0.0f, el).y();
+        b.strokeLine(QLineF(0.0, y, w, y), 1.0, kGridColor);
+    }
+
+    if (!m_viewModel) return;
+
+    // Area zones
+    const int highlightedId = m_viewModel->highlightedZoneId();
+    for (const AreaZone& zone : m_viewModel->areaZoneModel()->zones()) {
+        if (!zone.isEnabled) continue;
+
+        const QColor color = zoneColor(zone.type);
+        const bool highlighted = zone.id == highlightedId;
+        const QColor stroke = highlighted ? color.lighter(150) : color;
+        const qreal lineWidth = highlighted ? kHighlightLineWidth : kLineWidth;
+        const qreal dash = zone.isOverridable ? 5.0 : 0.0;
+
+        addAreaZone(b, zone.startAzimuth, zone.endAzimuth, zone.minElevation, zone.maxElevation,
+                    color, stroke, lineWidth, dash, 3.0);
+    }
+
+    // Sector scans; a scan crossing north is drawn as two segments
+    for (const AutoSectorScanZone& scan : m_viewModel->sectorScanModel()->zones()) {
+        if (!scan.isEnabled) continue;
+
+        const float az1 = normalizeAzimuth(scan.az1);
+        const float az2 = normalizeAzimuth(scan.az2);
+        const QPointF p1 = toPixel(az1, scan.el1);
+        const QPointF p2 = toPixel(az2, scan.el2);
+
+        if (az1 > az2 && (az1 - az2) > 180.0f) {
+            const float totalSpan = (360.0f - az1) + az2;
+            const float elAtZero = scan.el1 + (scan.el2 - scan.el1) * (360.0f - az1) / totalSpan;
+            b.strokeLine(QLineF(p1, toPixel(360.0f, elAtZero)), kLineWidth, kSectorScanColor);
+            b.strokeLine(QLineF(toPixel(0.0f, elAtZero), p2), kLineWidth, kSectorScanColor);
+        } else {
+            b.strokeLine(QLineF(p1, p2), kLineWidth, kSectorScanColor);
+        }
+        b.fillDisc(p1, 3.0, kSectorScanColor);
+        b.fillDisc(p2, 3.0, kSectorScanColor);
+    }
+
+    for (const TargetReferencePoint& trp : m_viewModel->trpModel()->zones()) {
+        addCross(b, toPixel(normalizeAzimuth(trp.azimuth), trp.elevation), 6.0, kMarkerColor);
+    }
+}
+
+// ============================================================================
+// WORK-IN-PROGRESS ZONE
+// ============================================================================
+
+void ZoneMapItem::buildWipZone(Vertices& out) const
+{
+    OsdGeometryBuilder b(&out);
+    b.clear();
+
+    if (!m_viewModel || !m_viewModel->hasWipZone()) return;
+
+    const QVariantMap wip = m_viewModel->wipZone();
+    switch (m_viewModel->wipZoneType()) {
+    case 1:  // AreaZone
+        addAreaZone(b, wip.value("startAzimuth").toFloat(), wip.value("endAzimuth").toFloat(),
+                    wip.value("minElevation").toFloat(), wip.value("maxElevation").toFloat(),
+                    kWipColor, kWipColor, kLineWidth, 5.0, 5.0);
+        break;
+    case 2: {  // SectorScan
+        const QPointF p1 = toPixel(normalizeAzimuth(wip.value("az1").toFloat()), wip.value("el1").toFloat());
+        const QPointF p2 = toPixel(normalizeAzimuth(wip.value("az2").toFloat()), wip.value("el2").toFloat());
+        b.strokeDashedLine(QLineF(p1, p2), kLineWidth, 5.0, 5.0, kWipColor);
+        b.fillDisc(p1, 4.0, kWipColor);
+        b.fillDisc(p2, 4.0, kWipColor);
+        break;
+    }
+    case 3: {  // TRP
+        const QPointF pos = toPixel(normalizeAzimuth(wip.value("azimuth").toFloat()),
+                                    wip.value("elevation").toFloat());
+        addCross(b, pos, 8.0, kWipColor, 5.0);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+// ============================================================================
+// GIMBAL MARKER (centred on 0,0)
+// ============================================================================
+
+void ZoneMapItem::buildGimbalMarker(Vertices& out)
+{
+    OsdGeometryBuilder b(&out);
+    b.clear();
+    addCross(b, QPointF(0.0, 0.0), 10.0, kMarkerColor);
+    b.fillDisc(QPointF(0.0, 0.0), 3.0, kMarkerColor);
+}
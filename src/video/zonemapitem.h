@@ -0,0 +1,70 @@
+#ifndef ZONEMAPITEM_H
+#define ZONEMAPITEM_H
+
+#include <QColor>
+#include <QPointer>
+#include <QQuickItem>
+#include <QSGGeometry>
+#include <QVector>
+
+class OsdGeometryBuilder;
+class ZoneMapViewModel;
+
+/**
+ * @brief Scene-graph renderer for the zone definition map.
+ *
+ * Replaces the Canvas that repainted the whole map (grid, every saved zone,
+ * sector scan and TRP) on each gimbal update. The map is split in three
+ * nodes:
+ *   - static layer: background, grid and saved zones, rebuilt only when a
+ *     zone model reports a change, the highlight moves or the item resizes;
+ *   - work-in-progress zone: rebuilt while the operator is aiming it;
+ *   - gimbal marker: built once, moved by a transform node.
+ *
+ * Text (axis labels, zone ids) stays in QML Text items next to this item.
+ */
+class ZoneMapItem : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(ZoneMapViewModel* viewModel READ viewModel WRITE setViewModel NOTIFY viewModelChanged)
+
+public:
+    explicit ZoneMapItem(QQuickItem *parent = nullptr);
+
+    ZoneMapViewModel* viewModel() const { return m_viewModel; }
+    void setViewModel(ZoneMapViewModel* viewModel);
+
+signals:
+    void viewModelChanged();
+
+protected:
+    QSGNode* updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+    void geometryChange(const QRectF& newGeometry, const QRectF& oldGeometry) override;
+
+private:
+    enum DirtyFlag {
+        StaticLayer     = 1 << 0,
+        WipLayer        = 1 << 1,
+        GimbalTransform = 1 << 2,
+        AllDirty        = 0x7
+    };
+
+    void markDirty(int flags);
+
+    // Vertex builders in item coordinates (run during sync)
+    void buildStaticLayer(QVector<QSGGeometry::ColoredPoint2D>& out) const;
+    void buildWipZone(QVector<QSGGeometry::ColoredPoint2D>& out) const;
+    static void buildGimbalMarker(QVector<QSGGeometry::ColoredPoint2D>& out);
+
+    // Saved or WIP area zone, split in two when it wraps through north
+    void addAreaZone(OsdGeometryBuilder& b, float startAz, float endAz, float minEl, float maxEl,
+                     const QColor& fill, const QColor& stroke, qreal lineWidth,
+                     qreal dash, qreal gap) const;
+
+    QPointF toPixel(float az, float el) const;
+
+    QPointer<ZoneMapViewModel> m_viewModel;
+    int m_dirty = AllDirty;
+};
+
+#endif // ZONEMAPITEM_H